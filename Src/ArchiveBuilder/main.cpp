@@ -0,0 +1,244 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <algorithm>
+#include <filesystem>
+#include <string_view>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <Utility/Archive/ArchiveWriter.hpp>
+#include <Utility/Archive/AssetLibrary.hpp>
+
+// Packs all files of the directory into an asset archive, paths in the archive are relative to the directory.
+// The measure command reads every file of the directory as a loose file and from the archive, first with files
+// evicted from the page cache (cold, Linux only, elsewhere the first pass is reported as cold) and then again (warm).
+//
+// Usage: ArchiveBuilder pack <directory> <archive> [--compress]
+//        ArchiveBuilder measure <directory> <archive> [--repeat N]
+
+namespace
+{
+    std::vector<std::string> ListFiles(const std::filesystem::path& directory)
+    {
+        std::vector<std::string> files;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+        {
+            if (entry.is_regular_file())
+            {
+                files.push_back(std::filesystem::relative(entry.path(), directory).generic_string());
+            }
+        }
+
+        // Sorted, so the archive does not depend on the order of the directory iteration
+        std::sort(files.begin(), files.end());
+
+        return files;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    std::optional<std::vector<std::byte>> ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::ate | std::ios::binary);
+        if (!file.is_open())
+        {
+            return std::nullopt;
+        }
+
+        std::vector<std::byte> content(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(content.data()), static_cast<std::streamsize>(content.size()));
+
+        return content;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    int Pack(const std::filesystem::path& directory, const std::filesystem::path& archivePath, bool compress)
+    {
+        C2D::ArchiveWriter writer;
+        size_t size(0);
+        for (const auto& file : ListFiles(directory))
+        {
+            const auto content = ReadFile(directory / file);
+            if (!content.has_value())
+            {
+                std::cerr << "Failed to read " << file << std::endl;
+                return 1;
+            }
+
+            if (!writer.Add(file, content.value(), compress))
+            {
+                std::cerr << "Path hash of " << file << " collides with another file" << std::endl;
+                return 1;
+            }
+            size += content->size();
+        }
+
+        if (!writer.Write(archivePath))
+        {
+            std::cerr << "Failed to write " << archivePath << std::endl;
+            return 1;
+        }
+
+        std::cout << "Packed " << writer.GetEntryCount() << " files, " << size << " bytes -> "
+                  << std::filesystem::file_size(archivePath) << " bytes" << std::endl;
+
+        return 0;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    void EvictFromPageCache(const std::filesystem::path& path)
+    {
+#ifndef _WIN32
+        const auto file = open(path.c_str(), O_RDONLY);
+        if (file >= 0)
+        {
+            posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+            close(file);
+        }
+#else
+        (void)path;
+#endif
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    // Every page is touched, since views of the mapped archive are loaded only on access
+    uint64_t Touch(std::span<const std::byte> data)
+    {
+        constexpr size_t pageSize = 4096;
+        uint64_t sum(0);
+        for (size_t i = 0; i < data.size(); i += pageSize)
+        {
+            sum += static_cast<uint8_t>(data[i]);
+        }
+
+        return sum;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    double MeasureLoose(const std::filesystem::path& directory, const std::vector<std::string>& files, uint64_t& sum)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const C2D::AssetLibrary library(directory);
+        for (const auto& file : files)
+        {
+            if (const auto blob = library.Read(file))
+            {
+                sum += Touch(blob->GetData());
+            }
+        }
+
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    double MeasureArchive(const std::filesystem::path& archivePath,
+                          const std::vector<std::string>& files,
+                          uint64_t& sum)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        C2D::AssetLibrary library(".", false);
+        library.Mount(archivePath);
+        for (const auto& file : files)
+        {
+            if (const auto blob = library.Read(file))
+            {
+                sum += Touch(blob->GetData());
+            }
+        }
+
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    int Measure(const std::filesystem::path& directory, const std::filesystem::path& archivePath, uint32_t repeat)
+    {
+        if (!C2D::AssetArchive(archivePath).IsOpen())
+        {
+            std::cerr << "Failed to open " << archivePath << std::endl;
+            return 1;
+        }
+
+        const auto files = ListFiles(directory);
+        for (const auto& file : files)
+        {
+            EvictFromPageCache(directory / file);
+        }
+        EvictFromPageCache(archivePath);
+
+        uint64_t looseSum(0);
+        uint64_t archiveSum(0);
+        const auto looseCold = MeasureLoose(directory, files, looseSum);
+        const auto archiveCold = MeasureArchive(archivePath, files, archiveSum);
+
+        double looseWarm(0.0);
+        double archiveWarm(0.0);
+        for (uint32_t i = 0; i < repeat; ++i)
+        {
+            looseWarm += MeasureLoose(directory, files, looseSum);
+            archiveWarm += MeasureArchive(archivePath, files, archiveSum);
+        }
+
+        std::cout << "Files: " << files.size() << std::endl;
+        std::cout << "Loose files (ms): cold " << looseCold << ", warm " << looseWarm / repeat << std::endl;
+        std::cout << "Archive (ms): cold " << archiveCold << ", warm " << archiveWarm / repeat << std::endl;
+
+        // Both sources must provide the same content
+        if (looseSum != archiveSum)
+        {
+            std::cerr << "Content of the archive differs from the files" << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argc < 4)
+    {
+        std::cerr << "Usage: ArchiveBuilder pack <directory> <archive> [--compress]" << std::endl
+                  << "       ArchiveBuilder measure <directory> <archive> [--repeat N]" << std::endl;
+        return 2;
+    }
+
+    const std::string_view command = argv[1];
+    const std::filesystem::path directory = argv[2];
+    const std::filesystem::path archivePath = argv[3];
+    const std::vector<std::string_view> options(argv + 4, argv + argc);
+
+    if (command == "pack")
+    {
+        const auto compress = std::find(options.begin(), options.end(), "--compress") != options.end();
+        return Pack(directory, archivePath, compress);
+    }
+
+    if (command == "measure")
+    {
+        uint32_t repeat(5);
+        const auto repeatOption = std::find(options.begin(), options.end(), "--repeat");
+        if (repeatOption != options.end() && repeatOption + 1 != options.end())
+        {
+            repeat = std::max(static_cast<uint32_t>(std::stoul(std::string(*(repeatOption + 1)))), 1u);
+        }
+        return Measure(directory, archivePath, repeat);
+    }
+
+    std::cerr << "Unknown command " << command << std::endl;
+    return 2;
+}
\ No newline at end of file
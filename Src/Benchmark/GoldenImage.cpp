@@ -0,0 +1,114 @@
+#include "GoldenImage.hpp"
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace Benchmark;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+double ComparisonResult::GetMismatchRatio(const Image& image) const
+{
+    const auto pixelsCount = static_cast<double>(image.width) * image.height;
+    return pixelsCount > 0 ? static_cast<double>(mismatchedPixels) / pixelsCount : 0.0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+Image Benchmark::FromRgba(uint32_t width, uint32_t height, const std::vector<uint8_t>& rgbaPixels)
+{
+    Image image = { width, height, {} };
+
+    const size_t pixelsCount = static_cast<size_t>(width) * height;
+    image.pixels.resize(pixelsCount * 3);
+    for (size_t i = 0; i < pixelsCount && i * 4 + 2 < rgbaPixels.size(); ++i)
+    {
+        image.pixels[i * 3 + 0] = rgbaPixels[i * 4 + 0];
+        image.pixels[i * 3 + 1] = rgbaPixels[i * 4 + 1];
+        image.pixels[i * 3 + 2] = rgbaPixels[i * 4 + 2];
+    }
+
+    return image;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::optional<Image> Benchmark::LoadPpm(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return std::nullopt;
+    }
+
+    std::string magic;
+    uint32_t maxValue(0);
+    Image image;
+    file >> magic >> image.width >> image.height >> maxValue;
+    if (magic != "P6" || maxValue != 255 || image.width == 0 || image.height == 0)
+    {
+        return std::nullopt;
+    }
+
+    // Exactly one whitespace character separates the header from the pixels
+    file.get();
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height * 3);
+    file.read(reinterpret_cast<char*>(image.pixels.data()), static_cast<std::streamsize>(image.pixels.size()));
+    if (!file)
+    {
+        return std::nullopt;
+    }
+
+    return image;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool Benchmark::SavePpm(const std::filesystem::path& path, const Image& image)
+{
+    if (path.has_parent_path())
+    {
+        std::error_code errorCode;
+        std::filesystem::create_directories(path.parent_path(), errorCode);
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    file << "P6\n" << image.width << " " << image.height << "\n255\n";
+    file.write(reinterpret_cast<const char*>(image.pixels.data()), static_cast<std::streamsize>(image.pixels.size()));
+
+    return static_cast<bool>(file);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+ComparisonResult Benchmark::Compare(const Image& actual, const Image& expected, uint8_t tolerance)
+{
+    ComparisonResult result;
+    result.isSizeEqual = actual.width == expected.width &&
+                         actual.height == expected.height &&
+                         actual.pixels.size() == expected.pixels.size();
+    if (!result.isSizeEqual)
+    {
+        return result;
+    }
+
+    for (size_t i = 0; i + 2 < actual.pixels.size(); i += 3)
+    {
+        uint8_t pixelDifference(0);
+        for (size_t channel = 0; channel < 3; ++channel)
+        {
+            const auto difference = std::abs(actual.pixels[i + channel] - expected.pixels[i + channel]);
+            pixelDifference = std::max(pixelDifference, static_cast<uint8_t>(difference));
+        }
+
+        result.maxDifference = std::max(result.maxDifference, pixelDifference);
+        if (pixelDifference > tolerance)
+        {
+            ++result.mismatchedPixels;
+        }
+    }
+
+    return result;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <filesystem>
+
+namespace Benchmark
+{
+    /*!
+     * \brief 8-bit RGB image.
+     */
+    struct Image
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::vector<uint8_t> pixels;
+    };
+
+    /*!
+     * \brief Result of the comparison of two images.
+     */
+    struct ComparisonResult
+    {
+        bool isSizeEqual = false;
+        size_t mismatchedPixels = 0;
+        uint8_t maxDifference = 0;
+
+        [[nodiscard]]
+        double GetMismatchRatio(const Image& image) const;
+    };
+
+    /*!
+     * \brief Converts tightly packed RGBA pixels, e.g. read back from an offscreen target, to an RGB image.
+     */
+    Image FromRgba(uint32_t width, uint32_t height, const std::vector<uint8_t>& rgbaPixels);
+
+    /*!
+     * \brief Loads a binary PPM (P6) image. PPM is used because it does not require any external library.
+     * \return Image or empty if the file does not exist or has an unsupported format.
+     */
+    std::optional<Image> LoadPpm(const std::filesystem::path& path);
+
+    bool SavePpm(const std::filesystem::path& path, const Image& image);
+
+    /*!
+     * \brief Compares images per channel. Pixel is mismatched if any channel differs more than the tolerance,
+     *        small differences are allowed because rasterization may differ slightly between drivers.
+     */
+    ComparisonResult Compare(const Image& actual, const Image& expected, uint8_t tolerance);
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#version 450
+
+// Synthetic sprite scene: every instance is a quad with pseudo-random position, size and color.
+// Geometry is generated from the vertex and instance indices, so the scene does not need any buffers
+// and the same instance always produces the same image, which allows comparing it with golden images.
+
+layout(location = 0) out vec3 fragColor;
+
+const vec2 corners[6] = vec2[](
+    vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0),
+    vec2(1.0, 1.0), vec2(0.0, 1.0), vec2(0.0, 0.0)
+);
+
+float Hash(uint x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return float(x) / 4294967295.0;
+}
+
+void main()
+{
+    uint id = uint(gl_InstanceIndex) * 8u;
+    vec2 origin = vec2(Hash(id), Hash(id + 1u)) * 2.0 - 1.0;
+    vec2 size = vec2(0.01 + 0.04 * Hash(id + 2u));
+
+    gl_Position = vec4(origin + corners[gl_VertexIndex] * size, 0.0, 1.0);
+    fragColor = vec3(Hash(id + 3u), Hash(id + 4u), Hash(id + 5u));
+}
\ No newline at end of file
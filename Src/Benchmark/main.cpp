@@ -0,0 +1,279 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <string_view>
+
+#include <VkWrapper/Application.hpp>
+#include <Logger/Logger.hpp>
+#include <Tracer/TraceTimeline.hpp>
+
+#include "GoldenImage.hpp"
+
+// Renders N frames of a synthetic sprite scene in the headless mode (e.g. on lavapipe), reports frame rate and CPU
+// timings and compares the last frame with the golden image. With --trace the measured frames are written as a
+// Chrome trace with CPU and GPU zones.
+//
+// Usage: Benchmark [--frames N] [--warmup N] [--sprites N] [--width N] [--height N] [--frames-in-flight N]
+//                  [--device NAME] [--golden PATH] [--tolerance N] [--max-mismatch RATIO] [--output PATH]
+//                  [--trace PATH] [--update-golden]
+
+namespace
+{
+    struct Options
+    {
+        uint32_t frames = 1000;
+        uint32_t warmupFrames = 10;
+        uint32_t sprites = 10000;
+        uint32_t width = 1280;
+        uint32_t height = 720;
+        uint32_t framesInFlight = 2;
+        std::string deviceName;
+        std::filesystem::path goldenPath;
+        std::filesystem::path outputPath;
+        std::filesystem::path tracePath;
+        uint8_t tolerance = 2;
+        double maxMismatchRatio = 0.001;
+        bool mustUpdateGolden = false;
+    };
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    std::optional<Options> ParseOptions(int argc, char** argv)
+    {
+        Options options;
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view argument = argv[i];
+            if (argument == "--update-golden")
+            {
+                options.mustUpdateGolden = true;
+                continue;
+            }
+
+            if (i + 1 >= argc)
+            {
+                std::cerr << "Missing value for " << argument << std::endl;
+                return std::nullopt;
+            }
+
+            const std::string value = argv[++i];
+            if (argument == "--frames")                { options.frames = std::stoul(value); }
+            else if (argument == "--warmup")           { options.warmupFrames = std::stoul(value); }
+            else if (argument == "--sprites")          { options.sprites = std::stoul(value); }
+            else if (argument == "--width")            { options.width = std::stoul(value); }
+            else if (argument == "--height")           { options.height = std::stoul(value); }
+            else if (argument == "--frames-in-flight") { options.framesInFlight = std::stoul(value); }
+            else if (argument == "--device")           { options.deviceName = value; }
+            else if (argument == "--golden")           { options.goldenPath = value; }
+            else if (argument == "--output")           { options.outputPath = value; }
+            else if (argument == "--trace")            { options.tracePath = value; }
+            else if (argument == "--tolerance")        { options.tolerance = static_cast<uint8_t>(std::stoul(value)); }
+            else if (argument == "--max-mismatch")     { options.maxMismatchRatio = std::stod(value); }
+            else
+            {
+                std::cerr << "Unknown option " << argument << std::endl;
+                return std::nullopt;
+            }
+        }
+
+        if (options.frames == 0)
+        {
+            std::cerr << "At least one frame must be rendered" << std::endl;
+            return std::nullopt;
+        }
+
+        // Every resolution and number of sprites has its own golden image
+        if (options.goldenPath.empty())
+        {
+            const auto fileName = "Sprites_" + std::to_string(options.width) + "x" + std::to_string(options.height) +
+                                  "_" + std::to_string(options.sprites) + ".ppm";
+            options.goldenPath = std::filesystem::path(C2D_BENCHMARK_DATA_DIR) / "Golden" / fileName;
+        }
+
+        return options;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    struct Statistics
+    {
+        double average = 0.0;
+        double p95 = 0.0;
+        double max = 0.0;
+    };
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    Statistics CalcStatistics(std::vector<double> values)
+    {
+        Statistics statistics;
+        if (values.empty())
+        {
+            return statistics;
+        }
+
+        std::sort(values.begin(), values.end());
+        for (auto value : values)
+        {
+            statistics.average += value;
+        }
+        statistics.average /= static_cast<double>(values.size());
+        statistics.p95 = values[static_cast<size_t>(static_cast<double>(values.size() - 1) * 0.95)];
+        statistics.max = values.back();
+
+        return statistics;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    void PrintStatistics(std::string_view name, const std::vector<double>& values)
+    {
+        const auto statistics = CalcStatistics(values);
+        std::cout << name << " (us): avg " << statistics.average
+                  << ", p95 " << statistics.p95
+                  << ", max " << statistics.max << std::endl;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    double ToMicroseconds(std::chrono::nanoseconds duration)
+    {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    Logger::ChangeLevel(Logger::Level::Warning);
+
+    const auto options = ParseOptions(argc, argv);
+    if (!options.has_value())
+    {
+        return 2;
+    }
+
+    VkWrapper::ApplicationConfiguration configuration =
+    {
+        VkExtent2D{ options->width, options->height },
+        options->deviceName,
+        {
+            (std::filesystem::path(C2D_BENCHMARK_DATA_DIR) / "Shaders" / "Sprites").string(),
+        },
+        VkWrapper::PresentConfiguration{ .framesInFlight = options->framesInFlight }
+    };
+    VkWrapper::Application application(configuration);
+
+    auto& renderPipeline = application.GetRenderPipeline();
+    renderPipeline.SetDrawParameters({ .vertexCount = 6, .instanceCount = options->sprites });
+
+    for (uint32_t i = 0; i < options->warmupFrames; ++i)
+    {
+        application.DrawFrame();
+    }
+
+    // Measurement
+    std::vector<double> recordTimes;
+    std::vector<double> submitTimes;
+    std::vector<double> waitTimes;
+    std::vector<double> gpuTimes;
+    recordTimes.reserve(options->frames);
+    submitTimes.reserve(options->frames);
+    waitTimes.reserve(options->frames);
+    gpuTimes.reserve(options->frames);
+
+    if (!options->tracePath.empty())
+    {
+        TraceTimeline::Enable();
+    }
+
+    auto& frameScheduler = application.GetFrameScheduler();
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < options->frames; ++i)
+    {
+        application.DrawFrame();
+
+        const auto& frameTimings = renderPipeline.GetFrameTimings();
+        recordTimes.push_back(ToMicroseconds(frameTimings.record));
+        submitTimes.push_back(ToMicroseconds(frameTimings.submit));
+        waitTimes.push_back(ToMicroseconds(frameScheduler.GetCpuWaitTime()));
+
+        // Zones of the frame that finished last, the first one covers the whole frame
+        const auto& gpuZones = renderPipeline.GetGpuProfiler().GetLastZones();
+        if (!gpuZones.empty())
+        {
+            gpuTimes.push_back(ToMicroseconds(gpuZones.front().end - gpuZones.front().start));
+        }
+    }
+    frameScheduler.WaitForSubmittedFrames();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Frames: " << options->frames << ", sprites: " << options->sprites
+              << ", resolution: " << options->width << "x" << options->height << std::endl;
+    std::cout << "Frames/s: " << static_cast<double>(options->frames) / elapsed.count() << std::endl;
+    PrintStatistics("CPU record time", recordTimes);
+    PrintStatistics("CPU submit time", submitTimes);
+    PrintStatistics("CPU wait time", waitTimes);
+    if (!gpuTimes.empty())
+    {
+        PrintStatistics("GPU frame time", gpuTimes);
+    }
+    if (const auto& pipelineStatistics = renderPipeline.GetGpuProfiler().GetLastPipelineStatistics())
+    {
+        std::cout << "Shader invocations per frame: vertex " << pipelineStatistics->vertexShaderInvocations
+                  << ", fragment " << pipelineStatistics->fragmentShaderInvocations << std::endl;
+    }
+
+    if (!options->tracePath.empty())
+    {
+        TraceTimeline::Disable();
+        if (!TraceTimeline::WriteChromeTrace(options->tracePath))
+        {
+            std::cerr << "Failed to write trace " << options->tracePath << std::endl;
+        }
+    }
+
+    // Comparison with the golden image
+    const auto image = Benchmark::FromRgba(options->width, options->height, renderPipeline.ReadBackLastFrame());
+    if (!options->outputPath.empty())
+    {
+        Benchmark::SavePpm(options->outputPath, image);
+    }
+
+    if (options->mustUpdateGolden)
+    {
+        if (!Benchmark::SavePpm(options->goldenPath, image))
+        {
+            std::cerr << "Failed to write golden image " << options->goldenPath << std::endl;
+            return 1;
+        }
+
+        std::cout << "Golden image is updated: " << options->goldenPath << std::endl;
+        return 0;
+    }
+
+    const auto golden = Benchmark::LoadPpm(options->goldenPath);
+    if (!golden.has_value())
+    {
+        // Missing golden image is an error, otherwise a renamed or deleted file silently disables the check
+        std::cerr << "Golden image " << options->goldenPath << " is not found, "
+                  << "run with --update-golden to create it" << std::endl;
+        return 1;
+    }
+
+    const auto result = Benchmark::Compare(image, golden.value(), options->tolerance);
+    if (!result.isSizeEqual)
+    {
+        std::cerr << "Golden image has different size" << std::endl;
+        return 1;
+    }
+
+    const auto mismatchRatio = result.GetMismatchRatio(image);
+    std::cout << "Golden image: " << result.mismatchedPixels << " mismatched pixels (" << mismatchRatio * 100.0
+              << "%), max difference " << static_cast<int>(result.maxDifference) << std::endl;
+
+    return mismatchRatio <= options->maxMismatchRatio ? 0 : 1;
+}
\ No newline at end of file
@@ -111,6 +111,13 @@ uint8_t CameraComponent::GetPriority() const
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+const RenderOrder& CameraComponent::GetRenderOrder() const
+{
+    return _renderOrder;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void CameraComponent::SetSize(const Vector2f& newSize)
 {
     _size = newSize;
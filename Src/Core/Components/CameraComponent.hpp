@@ -1,6 +1,7 @@
 #pragma once
 #include "Core/Components/Base/BaseDataComponent.hpp"
 #include "Core/Components/Utility/CamerasCompare.hpp"
+#include "Core/Components/Utility/RenderOrder.hpp"
 #include "Utility/Math/Vector2.hpp"
 #include <SFML/Graphics/View.hpp>
 #include <SFML/Graphics/Rect.hpp>
@@ -87,6 +88,12 @@ namespace C2D
          */
         uint8_t GetPriority() const;
 
+        /*!
+         * \brief Returns position of the component in the camera order of the scene.
+         * \return Priority and id of the scene object that were applied by the render thread.
+         */
+        const RenderOrder& GetRenderOrder() const;
+
         /*!
          * \brief Sets new size of a camera view.
          * \param newSize - new size of a camera view.
@@ -140,10 +147,14 @@ namespace C2D
         std::atomic<float> _viewportWidth;
         /*! Height of a viewport of a view. */
         std::atomic<float> _viewportHeight;
+        /*! Position in the camera order of the scene, changed only by the scene on the render thread. */
+        RenderOrder _renderOrder;
+
+        friend class BaseScene;
     };
 
     /*! Simple alias to shorten the name of the vector of weak pointers to camera components. */
     using CameraArray = std::vector<std::weak_ptr<CameraComponent>>;
-    /*! Simple alias to shorten the name of the set of weak pointers to camera components. */
-    using CameraSet = std::set<std::weak_ptr<CameraComponent>, CamerasCompare>;
+    /*! Simple alias to shorten the name of the set of shared pointers to camera components. */
+    using CameraSet = std::set<std::shared_ptr<CameraComponent>, CamerasCompare>;
 }
\ No newline at end of file
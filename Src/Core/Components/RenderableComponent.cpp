@@ -14,7 +14,7 @@ RenderableComponent::~RenderableComponent()
         _transformComponent = object->GetTransformComponent();
         if (const auto transform = _transformComponent.lock())
         {
-            //transform->UnbindFromEvent("TransformUpdated", _transformUpdatedHandler);
+            transform->GetTransformUpdatedEvent().Unsubscribe(_transformUpdatedSubscription);
         }
     }
 }
@@ -25,13 +25,16 @@ RenderableComponent::RenderableComponent(std::weak_ptr<SceneObject>&& sceneObjec
 : BaseDataComponent(std::move(sceneObject))
 , _layerNumber(0)
 , _transformNeedUpdate(true)
+, _globalVerticesNeedUpdate(true)
+, _transformUpdatedSubscription(0)
 {
     if (const auto object = GetSceneObject().lock())
     {
         _transformComponent = object->GetTransformComponent();
         if (const auto transform = _transformComponent.lock())
         {
-            //_transformUpdatedHandler = transform->BindToEvent("TransformUpdated", this, &RenderableComponent::_OnTransformComponentUpdated);
+            _transformUpdatedSubscription = transform->GetTransformUpdatedEvent().Subscribe(
+                this, &RenderableComponent::_OnTransformComponentUpdated);
         }
     }
 }
@@ -92,7 +95,7 @@ void RenderableComponent::SetLayerNumber(const int8_t newLayerNumber)
         _layerNumber = newLayerNumber;
 
         const auto thisComponent = std::dynamic_pointer_cast<RenderableComponent>(this->shared_from_this());
-        //InvokeEvent<void, std::weak_ptr<RenderableComponent>, const int8_t>("LayerUpdated", thisComponent, _layerNumber.load());
+        _layerUpdatedEvent.Invoke(thisComponent, newLayerNumber);
     }
 }
 
@@ -105,6 +108,13 @@ int8_t RenderableComponent::GetLayerNumber() const
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+const RenderOrder& RenderableComponent::GetRenderOrder() const
+{
+    return _renderOrder;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 bool RenderableComponent::IsVisible(const std::weak_ptr<CameraComponent>&) const
 {
     return true;
@@ -112,11 +122,33 @@ bool RenderableComponent::IsVisible(const std::weak_ptr<CameraComponent>&) const
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+sf::FloatRect RenderableComponent::GetGlobalBounds() const
+{
+    _UpdateGlobalVertices();
+
+    return _globalBounds;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void RenderableComponent::SetTexture(const std::shared_ptr<sf::Texture>& texture)
 {
     _texture = texture;
+    _textureHandle.reset();
+    _textureRect = texture ? sf::IntRect(0, 0, texture->getSize().x, texture->getSize().y) : sf::IntRect();
 
-    //InvokeEvent("TextureUpdated");
+    _textureUpdatedEvent.Invoke();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void RenderableComponent::SetTexture(const TextureHandle& texture)
+{
+    _textureHandle = texture;
+    _texture = texture ? texture->texture : nullptr;
+    _textureRect = texture ? texture->rect : sf::IntRect();
+
+    _textureUpdatedEvent.Invoke();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -128,12 +160,37 @@ std::weak_ptr<sf::Texture> RenderableComponent::GetTexture() const
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+sf::IntRect RenderableComponent::GetTextureRect() const
+{
+    return _textureRect;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Event<std::weak_ptr<RenderableComponent>, int8_t>& RenderableComponent::GetLayerUpdatedEvent()
+{
+    return _layerUpdatedEvent;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Event<>& RenderableComponent::GetTextureUpdatedEvent()
+{
+    return _textureUpdatedEvent;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void RenderableComponent::Initialize()
 {
     _typeIndex = typeid(RenderableComponent);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    //AddEvent("TextureUpdated", new Dispatcher<void>());
-    //AddEvent("LayerUpdated", new Dispatcher<void>());
+void RenderableComponent::InvalidateGlobalVertices()
+{
+    _globalVerticesNeedUpdate = true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,7 +202,7 @@ void RenderableComponent::_OnTransformComponentUpdated()
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void RenderableComponent::_UpdateTransform() const
+void RenderableComponent::_UpdateGlobalVertices() const
 {
     if (_transformNeedUpdate)
     {
@@ -154,6 +211,18 @@ void RenderableComponent::_UpdateTransform() const
         {
             _transform = transform->GetTransform();
         }
+        _globalVerticesNeedUpdate = true;
+    }
+
+    if (_globalVerticesNeedUpdate)
+    {
+        _globalVerticesNeedUpdate = false;
+        _globalVertices = _vertices;
+        for (size_t i = 0; i < _globalVertices.getVertexCount(); ++i)
+        {
+            _globalVertices[i].position = _transform.transformPoint(_vertices[i].position);
+        }
+        _globalBounds = _globalVertices.getBounds();
     }
 }
 
@@ -161,16 +230,15 @@ void RenderableComponent::_UpdateTransform() const
 
 void RenderableComponent::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-    _UpdateTransform();
-
-    states.transform *= _transform;
+    _UpdateGlobalVertices();
 
+    // Vertices are already in the world, so only the view of the camera is applied to them
     if (const auto texture = _texture.lock())
     {
         states.texture = texture.get();
     }
 
-    target.draw(_vertices, states);
+    target.draw(_globalVertices, states);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
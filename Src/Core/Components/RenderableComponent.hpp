@@ -1,6 +1,9 @@
 #pragma once
 #include "Core/Components/Base/BaseDataComponent.hpp"
+#include "Core/Resources/TextureCache.hpp"
 #include "Utility/RenderablesCompare.hpp"
+#include "Utility/RenderOrder.hpp"
+#include "Utility/Containers/Delegate/Event.hpp"
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <set>
@@ -83,27 +86,73 @@ namespace C2D
          */
         int8_t GetLayerNumber() const;
 
+        /*!
+         * \brief Returns position of the component in the render order of the scene.
+         * \return Layer number and id of the scene object that were applied by the render thread.
+         *
+         * Render thread applies changes of the layer number at the beginning of the next frame,
+         * so the render order can lag behind GetLayerNumber().
+         */
+        const RenderOrder& GetRenderOrder() const;
+
         /*!
          * \brief Returns status of the visibility of this object in view of a specified camera component.
          * \param cameraComponent - weak pointer to a camera component.
          * \return True if object is visible for a specified camera component.
          * 
-         * Virtual method, can be overridden.
+         * Virtual method, can be overridden. Called by visibility jobs of the render system, one per camera,
+         * so it can be called concurrently for different cameras.
          */
         virtual bool IsVisible(const std::weak_ptr<CameraComponent>& cameraComponent) const;
 
+        /*!
+         * \brief Returns bounding box of the vertices in the world.
+         * \return Axis-aligned rectangle that contains transformed vertices.
+         *
+         * Transforms vertices if they or the transform were changed since the last call.
+         * Transformed vertices are drawn by every camera, so they are computed once per frame
+         * however many cameras see the component.
+         */
+        sf::FloatRect GetGlobalBounds() const;
+
         /*!
          * \brief Sets texture for this component.
          * \param texture - shared pointer to a texture that will be used by this component.
          */
         void SetTexture(const std::shared_ptr<sf::Texture>& texture);
 
+        /*!
+         * \brief Sets cached texture for this component.
+         * \param texture - handle of the texture from the texture cache, it is kept while the component uses it.
+         *
+         * Texture can be an atlas page that is shared with other components, so only the region of the image is used.
+         */
+        void SetTexture(const TextureHandle& texture);
+
         /*!
          * \brief Returns texture that is used by this component.
          * \return Weak pointer to the texture that is used in render process.
          */
         std::weak_ptr<sf::Texture> GetTexture() const;
 
+        /*!
+         * \brief Returns rectangle of the image in the texture.
+         * \return Rectangle in pixels, the whole texture if it is not an atlas page.
+         */
+        sf::IntRect GetTextureRect() const;
+
+        /*!
+         * \brief Returns event that is invoked when the layer number is changed.
+         * \return Reference to the event, its arguments are the component and its new layer number.
+         */
+        Event<std::weak_ptr<RenderableComponent>, int8_t>& GetLayerUpdatedEvent();
+
+        /*!
+         * \brief Returns event that is invoked when the texture is changed.
+         * \return Reference to the event.
+         */
+        Event<>& GetTextureUpdatedEvent();
+
     protected:
         /*!
          * \brief Initializes component.
@@ -114,12 +163,21 @@ namespace C2D
          */
         void Initialize() override;
 
+        /*!
+         * \brief Marks transformed vertices as outdated, must be called after vertices are changed.
+         */
+        void InvalidateGlobalVertices();
+
         /*! Weak pointer to transform component of a scene object that contains this component. */
         std::weak_ptr<TransformComponent> _transformComponent;
         /*! Array of vertices. */
         sf::VertexArray _vertices;
         /*! Weak pointer to the texture that will be used in render. */
         std::weak_ptr<sf::Texture> _texture;
+        /*! Handle of the cached texture, keeps the texture from the eviction. */
+        TextureHandle _textureHandle;
+        /*! Rectangle of the image in the texture. */
+        sf::IntRect _textureRect;
 
     private:
         /*!
@@ -128,11 +186,11 @@ namespace C2D
         void _OnTransformComponentUpdated();
 
         /*!
-         * \brief Utility function to update stored transform.
+         * \brief Utility function to update stored transform and transformed vertices.
          * 
-         * Called only when transform needs to be updated.
+         * Does nothing if neither transform nor vertices were changed.
          */
-        void _UpdateTransform() const;
+        void _UpdateGlobalVertices() const;
         
         /*!
          * \brief Draws object to the specified render target.
@@ -145,14 +203,28 @@ namespace C2D
         std::atomic_int8_t _layerNumber;
         /*! Simple atomic flag of the need of the update of the transform. */
         mutable std::atomic_bool _transformNeedUpdate;
+        /*! Simple atomic flag of the need of the update of the transformed vertices. */
+        mutable std::atomic_bool _globalVerticesNeedUpdate;
         /*! Transform that will be used in render. */
         mutable sf::Transform _transform;
-        /*! Handler of TransformUpdated event from transform component. */
-        //AnyCallableHandler _transformUpdatedHandler;
+        /*! Vertices transformed to the world, shared by all cameras. */
+        mutable sf::VertexArray _globalVertices;
+        /*! Bounding box of the transformed vertices. */
+        mutable sf::FloatRect _globalBounds;
+        /*! Subscription to TransformUpdated event of the transform component. */
+        Event<>::SubscriptionId _transformUpdatedSubscription;
+        /*! Event that is invoked when the layer number is changed. */
+        Event<std::weak_ptr<RenderableComponent>, int8_t> _layerUpdatedEvent;
+        /*! Event that is invoked when the texture is changed. */
+        Event<> _textureUpdatedEvent;
+        /*! Position in the render order of the scene, changed only by the scene on the render thread. */
+        RenderOrder _renderOrder;
+
+        friend class BaseScene;
     };
 
     /*! Simple alias to shorten the name of the vector of weak pointers to renderable components. */
     using RenderableArray = std::vector<std::weak_ptr<RenderableComponent>>;
-    /*! Simple alias to shorten the name of the set of weak pointers to renderable components. */
-    using RenderableSet = std::set<std::weak_ptr<RenderableComponent>, RenderablesCompare>;
+    /*! Simple alias to shorten the name of the set of shared pointers to renderable components. */
+    using RenderableSet = std::set<std::shared_ptr<RenderableComponent>, RenderablesCompare>;
 }
@@ -289,13 +289,18 @@ void TransformComponent::SetTransformations(const Transformations& transformatio
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void TransformComponent::Initialize()
+Event<>& TransformComponent::GetTransformUpdatedEvent()
 {
-    //AddEvent("TransformUpdated", new Dispatcher<void>());
+    return _transformUpdatedEvent;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void TransformComponent::Initialize()
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void TransformComponent::Update()
 { }
 
@@ -307,7 +312,7 @@ void TransformComponent::LateUpdate()
     {
         _transformUpdated = false;
         _UpdateGlobalTransformations();
-        //InvokeEvent("TransformUpdated");
+        _transformUpdatedEvent.Invoke();
     }
 }
 
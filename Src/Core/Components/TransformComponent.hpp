@@ -1,6 +1,7 @@
 #pragma once
 #include "Core/Components/Base/BaseLogicComponent.hpp"
 #include "Utility/Math/Vector2.hpp"
+#include "Utility/Containers/Delegate/Event.hpp"
 #include <SFML/Graphics/Transform.hpp>
 
 namespace C2D
@@ -191,9 +192,15 @@ namespace C2D
          */
         void SetTransformations(const Transformations& transformations);
 
+        /*!
+         * \brief Returns event that is invoked once per tick, in LateUpdate(), if the transform was changed.
+         * \return Reference to the event.
+         */
+        Event<>& GetTransformUpdatedEvent();
+
     private:
         /*!
-         * \brief Creates necessary events.
+         * \brief Empty function.
          */
         void Initialize() final;
         /*!
@@ -215,7 +222,9 @@ namespace C2D
          */
         void _UpdateGlobalTransformations() const;
 
-        /*! Simple flag to identify if transform was updated and we should invoke "OnTransformUpdate" event. */
+        /*! Event that is invoked if transform was updated. */
+        Event<> _transformUpdatedEvent;
+        /*! Simple flag to identify if transform was updated and we should invoke "TransformUpdated" event. */
         mutable std::atomic_bool _transformUpdated;
         /*! Simple flag to identify if global transformations need to be updated. */
         mutable std::atomic_bool _globalTransformationsNeedUpdate;
@@ -8,7 +8,7 @@ using namespace C2D;
 bool CamerasCompare::operator() (const std::shared_ptr<CameraComponent>& first,
                                  const std::shared_ptr<CameraComponent>& second) const
 {
-    return *first < *second;
+    return first->GetRenderOrder() < second->GetRenderOrder();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -16,7 +16,7 @@ bool CamerasCompare::operator() (const std::shared_ptr<CameraComponent>& first,
 bool CamerasCompare::operator()(const std::shared_ptr<CameraComponent>& first,
                                 const CameraComponent& second) const
 {
-    return *first < second;
+    return first->GetRenderOrder() < second.GetRenderOrder();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,7 +24,7 @@ bool CamerasCompare::operator()(const std::shared_ptr<CameraComponent>& first,
 bool CamerasCompare::operator()(const CameraComponent& first,
                                 const std::shared_ptr<CameraComponent>& second) const
 {
-    return first < *second;
+    return first.GetRenderOrder() < second->GetRenderOrder();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,7 +38,7 @@ bool CamerasCompare::operator()(const std::weak_ptr<CameraComponent>& first,
     {
         if (const auto lockedSecond = second.lock())
         {
-            less = *lockedFirst < *lockedSecond;
+            less = lockedFirst->GetRenderOrder() < lockedSecond->GetRenderOrder();
         }
     }
 
@@ -54,7 +54,7 @@ bool CamerasCompare::operator()(const std::weak_ptr<CameraComponent>& first,
 
     if (const auto lockedFirst = first.lock())
     {
-        less = *lockedFirst < second;
+        less = lockedFirst->GetRenderOrder() < second.GetRenderOrder();
     }
 
     return less;
@@ -69,7 +69,7 @@ bool CamerasCompare::operator()(const CameraComponent& first,
 
     if (const auto lockedSecond = second.lock())
     {
-        less = first < *lockedSecond;
+        less = first.GetRenderOrder() < lockedSecond->GetRenderOrder();
     }
 
     return less;
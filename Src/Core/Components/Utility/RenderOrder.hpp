@@ -0,0 +1,25 @@
+#pragma once
+#include <compare>
+#include <cstdint>
+
+namespace C2D
+{
+    /*!
+     * \brief Position of a renderable or camera component in the sets that are passed to the render system.
+     *
+     * Stored in the component and changed only by the render thread when it applies changes of the scene,
+     * so the sets stay sorted even if the logic thread changes the layer in the middle of a frame.
+     */
+    struct RenderOrder
+    {
+        /*! Layer number of a renderable component or priority of a camera component. */
+        int16_t rank = 0;
+        /*! Id of the scene object that owns the component, it makes positions of components unique. */
+        uint64_t objectId = 0;
+
+        /*!
+         * \brief Compares ranks and then ids of scene objects.
+         */
+        auto operator<=>(const RenderOrder& other) const = default;
+    };
+}
@@ -7,7 +7,7 @@ using namespace C2D;
 bool RenderablesCompare::operator() (const std::shared_ptr<RenderableComponent>& first,
                                     const std::shared_ptr<RenderableComponent>& second) const
 {
-    return *first < *second;
+    return first->GetRenderOrder() < second->GetRenderOrder();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -15,7 +15,7 @@ bool RenderablesCompare::operator() (const std::shared_ptr<RenderableComponent>&
 bool RenderablesCompare::operator()(const std::shared_ptr<RenderableComponent>& first, 
                                    const RenderableComponent& second) const
 {
-    return *first < second;
+    return first->GetRenderOrder() < second.GetRenderOrder();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,7 +23,7 @@ bool RenderablesCompare::operator()(const std::shared_ptr<RenderableComponent>&
 bool RenderablesCompare::operator()(const RenderableComponent& first, 
                                    const std::shared_ptr<RenderableComponent>& second) const
 {
-    return first < *second;
+    return first.GetRenderOrder() < second->GetRenderOrder();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -37,7 +37,7 @@ bool RenderablesCompare::operator()(const std::weak_ptr<RenderableComponent>& fi
     {
         if (const auto lockedSecond = second.lock())
         {
-            less = *lockedFirst < *lockedSecond;
+            less = lockedFirst->GetRenderOrder() < lockedSecond->GetRenderOrder();
         }
     }
 
@@ -53,7 +53,7 @@ bool RenderablesCompare::operator()(const std::weak_ptr<RenderableComponent>& fi
 
     if (const auto lockedFirst = first.lock())
     {
-        less = *lockedFirst < second;
+        less = lockedFirst->GetRenderOrder() < second.GetRenderOrder();
     }
 
     return less;
@@ -68,7 +68,7 @@ bool RenderablesCompare::operator()(const RenderableComponent& first,
 
     if (const auto lockedSecond = second.lock())
     {
-        less = first < *lockedSecond;
+        less = first.GetRenderOrder() < lockedSecond->GetRenderOrder();
     }
 
     return less;
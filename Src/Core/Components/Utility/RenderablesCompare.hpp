@@ -7,6 +7,8 @@ namespace C2D
 
     /*!
      * \brief Comparator for shared and weak pointers to RenderableComponent.
+     *
+     * Compares render orders of components, so a set stays sorted while the logic thread changes them.
      */
     struct [[deprecated("Will be reimplemented")]] RenderablesCompare
     {
@@ -0,0 +1,342 @@
+#include "TextureCache.hpp"
+#include <algorithm>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    /*! Bytes per pixel of RGBA textures. */
+    constexpr size_t bytesPerPixel = 4;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TextureCache::TextureCache(TextureCacheSettings settings)
+: _settings(settings)
+, _nextEntryId(0)
+, _nextPageId(1)
+, _memoryUsage(0)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TextureHandle TextureCache::Load(const std::string& path)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (auto handle = _Find(path))
+        {
+            return handle;
+        }
+    }
+
+    // Decoding is the slowest part, so it is done without the lock
+    sf::Image image;
+    if (!image.loadFromFile(path))
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _Insert(path, image);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TextureHandle TextureCache::Add(const std::string& name, const sf::Image& image)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (auto handle = _Find(name))
+    {
+        return handle;
+    }
+
+    return _Insert(name, image);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureCache::CollectGarbage()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _Evict();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureCache::SetMemoryBudget(const size_t memoryBudget)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _settings.memoryBudget = memoryBudget;
+    _Evict();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t TextureCache::GetMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memoryUsage;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t TextureCache::GetAtlasPageCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _pages.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TextureHandle TextureCache::_Find(const std::string& path)
+{
+    const auto id = _paths.find(path);
+    if (id == _paths.end())
+    {
+        return nullptr;
+    }
+
+    auto& entry = _entries.at(id->second);
+    _recentlyUsed.splice(_recentlyUsed.begin(), _recentlyUsed, entry.recentlyUsed);
+
+    return entry.handle;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TextureHandle TextureCache::_Insert(const std::string& path, const sf::Image& image)
+{
+    // Another thread could load the same path while the lock was released
+    if (auto handle = _Find(path))
+    {
+        return handle;
+    }
+
+    // The same content under a different path shares the texture, equal hashes alone do not prove equal content
+    const auto hash = _HashImage(image);
+    const auto [first, last] = _contentHashes.equal_range(hash);
+    for (auto it = first; it != last; ++it)
+    {
+        auto& sameHashEntry = _entries.at(it->second);
+        if (_IsSameImage(sameHashEntry.image, image))
+        {
+            sameHashEntry.paths.push_back(path);
+            _paths.emplace(path, it->second);
+            return _Find(path);
+        }
+    }
+
+    // Images that do not fit an empty page with their padding get own textures, otherwise a new page would be
+    // created for them and stay empty
+    const auto size = image.getSize();
+    const auto paddedSize = sf::Vector2u(size.x + _settings.atlasPadding * 2, size.y + _settings.atlasPadding * 2);
+    const auto fitsAtlas = size.x <= _settings.maxAtlasImageSize && size.y <= _settings.maxAtlasImageSize &&
+                           paddedSize.x <= _settings.atlasPageSize && paddedSize.y <= _settings.atlasPageSize;
+    const auto id = _nextEntryId++;
+    Entry entry{ nullptr, image, hash, 0, 0, {}, { path } };
+    if (fitsAtlas)
+    {
+        entry.handle = _InsertToAtlas(image, id, entry.page);
+    }
+    else
+    {
+        auto texture = std::make_shared<sf::Texture>();
+        if (texture->loadFromImage(image))
+        {
+            entry.memory = static_cast<size_t>(size.x) * size.y * bytesPerPixel;
+            entry.handle = std::make_shared<const TextureRegion>(TextureRegion
+            {
+                std::move(texture),
+                sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y))
+            });
+        }
+    }
+
+    if (!entry.handle)
+    {
+        return nullptr;
+    }
+
+    _memoryUsage += entry.memory;
+    _recentlyUsed.push_front(id);
+    entry.recentlyUsed = _recentlyUsed.begin();
+    auto handle = entry.handle;
+    _entries.emplace(id, std::move(entry));
+    _contentHashes.emplace(hash, id);
+    _paths.emplace(path, id);
+
+    _Evict();
+
+    return handle;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TextureHandle TextureCache::_InsertToAtlas(const sf::Image& image, const uint64_t id, size_t& page)
+{
+    const auto size = image.getSize();
+    const auto padding = _settings.atlasPadding;
+
+    // Pages that are filled earlier are tried first, so new pages are created only when necessary
+    std::optional<SkylinePacker::Position> position;
+    auto pageIterator = _pages.end();
+    for (auto it = _pages.begin(); it != _pages.end() && !position; ++it)
+    {
+        position = it->second.packer.Insert(size.x + padding * 2, size.y + padding * 2);
+        pageIterator = it;
+    }
+
+    if (!position)
+    {
+        // Image is packed before the page is created, so a page is never created without images
+        SkylinePacker packer(_settings.atlasPageSize, _settings.atlasPageSize);
+        position = packer.Insert(size.x + padding * 2, size.y + padding * 2);
+        auto texture = std::make_shared<sf::Texture>();
+        if (!position || !texture->create(_settings.atlasPageSize, _settings.atlasPageSize))
+        {
+            return nullptr;
+        }
+
+        // Page is cleared, so the padding is transparent
+        sf::Image clearImage;
+        clearImage.create(_settings.atlasPageSize, _settings.atlasPageSize, sf::Color::Transparent);
+        texture->update(clearImage);
+
+        pageIterator = _pages.emplace(_nextPageId++, AtlasPage
+        {
+            std::move(texture),
+            std::move(packer),
+            {}
+        }).first;
+        _memoryUsage += static_cast<size_t>(_settings.atlasPageSize) * _settings.atlasPageSize * bytesPerPixel;
+    }
+
+    auto& atlasPage = pageIterator->second;
+    atlasPage.texture->update(image, position->x + padding, position->y + padding);
+    atlasPage.images.push_back(id);
+    page = pageIterator->first;
+
+    return std::make_shared<const TextureRegion>(TextureRegion
+    {
+        atlasPage.texture,
+        sf::IntRect(static_cast<int>(position->x + padding),
+                    static_cast<int>(position->y + padding),
+                    static_cast<int>(size.x),
+                    static_cast<int>(size.y))
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureCache::_Evict()
+{
+    const auto pageMemory = static_cast<size_t>(_settings.atlasPageSize) * _settings.atlasPageSize * bytesPerPixel;
+    const auto isUnused = [this](uint64_t id)
+    {
+        return _entries.at(id).handle.use_count() == 1;
+    };
+
+    // Eviction of an atlas page removes several entries at once, so the search starts over after each eviction
+    bool evicted(true);
+    while (evicted && _memoryUsage > _settings.memoryBudget)
+    {
+        evicted = false;
+        for (auto id = _recentlyUsed.rbegin(); id != _recentlyUsed.rend() && !evicted; ++id)
+        {
+            const auto pageId = _entries.at(*id).page;
+            if (pageId == 0)
+            {
+                if (isUnused(*id))
+                {
+                    _RemoveEntry(*id);
+                    evicted = true;
+                }
+                continue;
+            }
+
+            // Textures that are referenced by components can not be evicted, so the page waits for all its images
+            const auto page = _pages.find(pageId);
+            const auto& images = page->second.images;
+            if (std::all_of(images.begin(), images.end(), isUnused))
+            {
+                for (const auto image : images)
+                {
+                    _RemoveEntry(image);
+                }
+                _pages.erase(page);
+                _memoryUsage -= pageMemory;
+                evicted = true;
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextureCache::_RemoveEntry(const uint64_t id)
+{
+    const auto entry = _entries.find(id);
+    for (const auto& path : entry->second.paths)
+    {
+        _paths.erase(path);
+    }
+
+    const auto [first, last] = _contentHashes.equal_range(entry->second.hash);
+    _contentHashes.erase(std::find_if(first, last, [id](const auto& contentHash)
+    {
+        return contentHash.second == id;
+    }));
+    _recentlyUsed.erase(entry->second.recentlyUsed);
+    _memoryUsage -= entry->second.memory;
+    _entries.erase(entry);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t TextureCache::_HashImage(const sf::Image& image)
+{
+    constexpr uint64_t prime = 1099511628211ull;
+    uint64_t hash(14695981039346656037ull);
+    const auto hashByte = [&hash](uint8_t byte)
+    {
+        hash ^= byte;
+        hash *= prime;
+    };
+
+    const auto size = image.getSize();
+    for (const auto dimension : { size.x, size.y })
+    {
+        for (size_t i = 0; i < sizeof(dimension); ++i)
+        {
+            hashByte(static_cast<uint8_t>(dimension >> (i * 8)));
+        }
+    }
+
+    const auto* pixels = image.getPixelsPtr();
+    const auto byteCount = static_cast<size_t>(size.x) * size.y * bytesPerPixel;
+    for (size_t i = 0; i < byteCount; ++i)
+    {
+        hashByte(pixels[i]);
+    }
+
+    return hash;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool TextureCache::_IsSameImage(const sf::Image& left, const sf::Image& right)
+{
+    if (left.getSize() != right.getSize())
+    {
+        return false;
+    }
+
+    const auto size = left.getSize();
+    const auto byteCount = static_cast<size_t>(size.x) * size.y * bytesPerPixel;
+    return byteCount == 0 || std::equal(left.getPixelsPtr(), left.getPixelsPtr() + byteCount, right.getPixelsPtr());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
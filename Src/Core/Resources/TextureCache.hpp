@@ -0,0 +1,212 @@
+#pragma once
+#include "Utility/Packing/SkylinePacker.hpp"
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <list>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace C2D
+{
+    /*!
+     * \brief Part of the texture that is used by a renderable component.
+     *
+     * Small images share atlas pages, so the rectangle does not always start at the origin of the texture.
+     */
+    struct TextureRegion
+    {
+        /*! Texture that contains the image. */
+        std::shared_ptr<sf::Texture> texture;
+        /*! Rectangle of the image in the texture, in pixels. */
+        sf::IntRect rect;
+    };
+
+    /*! Reference-counted handle of the cached texture, it is evicted only when all handles are released. */
+    using TextureHandle = std::shared_ptr<const TextureRegion>;
+
+    /*!
+     * \brief Settings of the texture cache.
+     */
+    struct TextureCacheSettings
+    {
+        /*! Memory of all textures and atlas pages, in bytes. It can be exceeded by textures that are in use. */
+        size_t memoryBudget = 256 * 1024 * 1024;
+        /*! Width and height of an atlas page. */
+        uint32_t atlasPageSize = 2048;
+        /*! Images not larger than this value are packed into atlas pages if they fit a page with the padding. */
+        uint32_t maxAtlasImageSize = 256;
+        /*! Transparent border around images in atlas pages that prevents bleeding of neighbours on filtering. */
+        uint32_t atlasPadding = 1;
+    };
+
+    /*!
+     * \brief Cache of textures that are shared by renderable components.
+     *
+     * - Images are deduplicated by the path and by the content, so the same image is loaded to the GPU only once.
+     *   Content is found by the hash and compared byte by byte, so images whose hashes collide are not shared.
+     * - Small images are packed into shared atlas pages, so sprites that use them can be batched.
+     * - Textures that are not referenced by any handle are evicted in least recently used order
+     *   when the memory budget is exceeded. Images in an atlas page are evicted all together when none of them
+     *   is used, since space of a single image can not be reused by the packer.
+     *
+     * Cache is thread-safe.
+     */
+    class TextureCache final
+    {
+    public:
+        TextureCache(const TextureCache& other) = delete;
+        TextureCache(TextureCache&& other) = delete;
+        TextureCache& operator=(const TextureCache& other) = delete;
+        TextureCache& operator=(TextureCache&& other) = delete;
+        ~TextureCache() = default;
+
+        /*!
+         * \brief Default constructor.
+         * \param settings - sizes of atlas pages and the memory budget.
+         */
+        explicit TextureCache(TextureCacheSettings settings = TextureCacheSettings());
+
+        /*!
+         * \brief Returns the texture from the cache or loads it from the file.
+         * \param path - path to the image file.
+         * \return Handle of the texture or nullptr if the image can not be loaded.
+         */
+        TextureHandle Load(const std::string& path);
+
+        /*!
+         * \brief Returns the texture from the cache or creates it from the image, e.g. generated at runtime.
+         * \param name - unique name of the image, used as a path.
+         * \param image - image that is uploaded if there is no texture with such name or content.
+         * \return Handle of the texture or nullptr if the texture can not be created.
+         */
+        TextureHandle Add(const std::string& name, const sf::Image& image);
+
+        /*!
+         * \brief Evicts unused textures until memory usage fits the budget.
+         *
+         * Called automatically when a new texture is added.
+         */
+        void CollectGarbage();
+
+        /*!
+         * \brief Sets new memory budget, unused textures above it are evicted immediately.
+         * \param memoryBudget - memory of all textures and atlas pages, in bytes.
+         */
+        void SetMemoryBudget(size_t memoryBudget);
+
+        /*!
+         * \brief Returns memory used by textures and atlas pages.
+         * \return Memory in bytes, 4 bytes per pixel.
+         */
+        size_t GetMemoryUsage() const;
+
+        /*!
+         * \brief Returns number of atlas pages.
+         * \return Number of atlas pages.
+         */
+        size_t GetAtlasPageCount() const;
+
+    private:
+        struct AtlasPage
+        {
+            /*! Texture of the page. */
+            std::shared_ptr<sf::Texture> texture;
+            /*! Packer of the page. */
+            SkylinePacker packer;
+            /*! Ids of entries that are stored in the page. */
+            std::vector<uint64_t> images;
+        };
+
+        struct Entry
+        {
+            /*! Handle that is kept by the cache, so use count 1 means that texture is not used. */
+            TextureHandle handle;
+            /*! Copy of the image that is compared with new images of the same hash, it is not counted as memory. */
+            sf::Image image;
+            /*! Hash of the image. */
+            uint64_t hash;
+            /*! Id of the atlas page or 0 if the image has its own texture. */
+            size_t page;
+            /*! Memory of the own texture, 0 for images in atlas pages. */
+            size_t memory;
+            /*! Position in the list of recently used entries. */
+            std::list<uint64_t>::iterator recentlyUsed;
+            /*! Paths that refer to the entry. */
+            std::vector<std::string> paths;
+        };
+
+        /*!
+         * \brief Returns the texture with the specified path and marks it as recently used.
+         * \param path - path or name of the image.
+         * \return Handle of the texture or nullptr if the path is unknown.
+         */
+        TextureHandle _Find(const std::string& path);
+
+        /*!
+         * \brief Returns the texture with the same content or creates a new one.
+         * \param path - path or name of the image.
+         * \param image - image of the texture.
+         * \return Handle of the texture or nullptr if the texture can not be created.
+         */
+        TextureHandle _Insert(const std::string& path, const sf::Image& image);
+
+        /*!
+         * \brief Copies the image to an atlas page, a new page is created if there is no space in existing ones.
+         * \param image - image that fits an empty atlas page with the padding.
+         * \param id - id of the entry of the image.
+         * \param page - id of the page that contains the image.
+         * \return Region of the image in the page texture or nullptr if the page can not be created.
+         */
+        TextureHandle _InsertToAtlas(const sf::Image& image, uint64_t id, size_t& page);
+
+        /*!
+         * \brief Evicts unused textures, starting from the least recently used, until memory fits the budget.
+         */
+        void _Evict();
+
+        /*!
+         * \brief Removes the entry and its paths, memory of the atlas page is not released.
+         * \param id - id of the entry.
+         */
+        void _RemoveEntry(uint64_t id);
+
+        /*!
+         * \brief Hashes dimensions and pixels of the image.
+         * \param image - image to hash.
+         * \return 64-bit FNV-1a hash.
+         */
+        static uint64_t _HashImage(const sf::Image& image);
+
+        /*!
+         * \brief Compares dimensions and pixels of the images.
+         * \param left - first image.
+         * \param right - second image.
+         * \return True if the images have the same size and pixels.
+         */
+        static bool _IsSameImage(const sf::Image& left, const sf::Image& right);
+
+        /*! Settings of the cache. */
+        TextureCacheSettings _settings;
+        /*! Mutex that is used to lock the cache. */
+        mutable std::mutex _mutex;
+        /*! Entries by ids. */
+        std::unordered_map<uint64_t, Entry> _entries;
+        /*! Ids of entries by the hash of the content, a hash has several entries only on collisions. */
+        std::unordered_multimap<uint64_t, uint64_t> _contentHashes;
+        /*! Ids of entries by paths. */
+        std::unordered_map<std::string, uint64_t> _paths;
+        /*! Ids of entries, the most recently used are in the front. */
+        std::list<uint64_t> _recentlyUsed;
+        /*! Atlas pages by ids. */
+        std::unordered_map<size_t, AtlasPage> _pages;
+        /*! Id of the next entry. */
+        uint64_t _nextEntryId;
+        /*! Id of the next atlas page, ids start from 1. */
+        size_t _nextPageId;
+        /*! Memory of all textures and atlas pages. */
+        size_t _memoryUsage;
+    };
+}
@@ -1,4 +1,5 @@
 #include "BaseScene.hpp"
+#include <algorithm>
 
 using namespace C2D;
 
@@ -9,6 +10,7 @@ BaseScene::BaseScene(const std::string_view sceneName)
 , _deleteLater(false)
 , _activated(false)
 , _renderableComponents(std::make_shared<RenderableSet>())
+, _cameraComponents(std::make_shared<CameraSet>())
 { }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -16,7 +18,8 @@ BaseScene::BaseScene(const std::string_view sceneName)
 std::weak_ptr<SceneObject> BaseScene::CreateObject()
 {
     _newSceneObjects.emplace_back(std::make_shared<SceneObject>())->_Initialize();
-    //_newSceneObjects.back()->BindToEvent("ComponentAdded", this, &BaseScene::_OnNewComponentAdded);
+    _newSceneObjects.back()->GetComponentAddedEvent().Subscribe(this, &BaseScene::_OnNewComponentAdded);
+    _newSceneObjects.back()->GetComponentRemovedEvent().Subscribe(this, &BaseScene::_OnComponentRemoved);
 
     return _newSceneObjects.back();
 }
@@ -53,35 +56,7 @@ void BaseScene::DeleteLater()
 
 std::shared_ptr<RenderableSet> BaseScene::GetRenderableComponents() const
 {
-    // Remove "dead" pointers 
-    for (auto iter = _renderableComponents->begin(); iter != _renderableComponents->end(); )
-    {
-        if ((*iter).lock())
-        {
-            ++iter;
-        }
-        else
-        {
-            iter = _renderableComponents->erase(iter);
-        }
-    }
-    
-    // Add new pointers to the list
-    std::lock_guard lock(_renderableArrayMutex);
-    for (auto& renderableComponent : _renderableComponentsToAdd)
-    {
-        const auto result = _renderableComponents->insert(renderableComponent);
-
-        // If such component already in the set, replace it with a new one
-        if (!result.second)
-        {
-            _renderableComponents->erase(result.first);
-            _renderableComponents->insert(renderableComponent);
-        }
-    }
-
-    // Clear to prevent copying
-    _renderableComponentsToAdd.clear();
+    _ApplyRenderChanges();
 
     return _renderableComponents;
 }
@@ -90,35 +65,7 @@ std::shared_ptr<RenderableSet> BaseScene::GetRenderableComponents() const
 
 std::shared_ptr<CameraSet> BaseScene::GetCameraComponents() const
 {
-    // Remove "dead" pointers
-    for (auto iter = _cameraComponents->begin(); iter != _cameraComponents->end(); )
-    {
-        if ((*iter).lock())
-        {
-            ++iter;
-        }
-        else
-        {
-            iter = _cameraComponents->erase(iter);
-        }
-    }
-
-    // Add new pointers to the list
-    std::lock_guard lock(_cameraArrayMutex);
-    for (auto& cameraComponent : _cameraComponentsToAdd)
-    {
-        const auto result = _cameraComponents->insert(cameraComponent);
-
-        // If such component already in the set, replace it with a new one
-        if (!result.second)
-        {
-            _cameraComponents->erase(result.first);
-            _cameraComponents->insert(cameraComponent);
-        }
-    }
-
-    // Clear to prevent copying
-    _cameraComponentsToAdd.clear();
+    _ApplyRenderChanges();
 
     return _cameraComponents;
 }
@@ -162,10 +109,84 @@ bool BaseScene::MarkedAsDeleteLater() const
 
 void BaseScene::_DeleteMarkedObjects()
 {
-    _sceneObjects.erase(std::remove_if(_sceneObjects.begin(), 
-                                       _sceneObjects.end(),
-                                       [](const std::shared_ptr<SceneObject> object) { return object->_deleteLater; }),
-                        _sceneObjects.end());
+    const auto isMarked = [](const std::shared_ptr<SceneObject>& object) { return object->_deleteLater; };
+
+    // Components of deleted objects are kept by the render thread until it applies their removal
+    for (const auto& sceneObject : _sceneObjects)
+    {
+        if (isMarked(sceneObject))
+        {
+            for (const auto& [typeIndex, component] : sceneObject->_dataComponentMap)
+            {
+                _JournalChange(RenderChange::Type::Removed, component);
+            }
+        }
+    }
+
+    _sceneObjects.erase(std::remove_if(_sceneObjects.begin(), _sceneObjects.end(), isMarked), _sceneObjects.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BaseScene::_JournalChange(const RenderChange::Type type, const std::shared_ptr<BaseComponent>& component)
+{
+    RenderChange change{ type, {}, {}, {} };
+    if (const auto sceneObject = component->GetSceneObject().lock())
+    {
+        change.order.objectId = sceneObject->GetId();
+    }
+
+    if (auto renderableComponent = std::dynamic_pointer_cast<RenderableComponent>(component))
+    {
+        change.order.rank = renderableComponent->GetLayerNumber();
+        change.renderable = std::move(renderableComponent);
+        _renderChanges.Append(std::move(change));
+    }
+    else if (auto cameraComponent = std::dynamic_pointer_cast<CameraComponent>(component))
+    {
+        change.order.rank = cameraComponent->GetPriority();
+        change.camera = std::move(cameraComponent);
+        _renderChanges.Append(std::move(change));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Set, class Component>
+void BaseScene::_ApplyRenderChange(Set& set, const std::shared_ptr<Component>& component, const RenderChange& change)
+{
+    // Set is sorted by render orders, so the component is erased before its render order is changed
+    bool found(false);
+    if (const auto iter = set.find(component); iter != set.end() && *iter == component)
+    {
+        set.erase(iter);
+        found = true;
+    }
+
+    // Order changes of components that were already removed are ignored
+    if (change.type == RenderChange::Type::Added || (change.type == RenderChange::Type::OrderChanged && found))
+    {
+        component->_renderOrder = change.order;
+        set.insert(component);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BaseScene::_ApplyRenderChanges() const
+{
+    _renderChanges.Consume([this](const RenderChange& change)
+    {
+        // Components that are dead are not in the sets, since the sets keep their components alive
+        if (const auto renderableComponent = change.renderable.lock())
+        {
+            _ApplyRenderChange(*_renderableComponents, renderableComponent, change);
+        }
+        else if (const auto cameraComponent = change.camera.lock())
+        {
+            _ApplyRenderChange(*_cameraComponents, cameraComponent, change);
+        }
+    });
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,25 +195,26 @@ void BaseScene::_OnNewComponentAdded(std::weak_ptr<BaseComponent> newComponent)
 {
     if (const auto component = newComponent.lock())
     {
-        // Check if new component is renderable and then add it to the array
-        if ((*component) == std::type_index(typeid(RenderableComponent)))
+        if (const auto renderableComponent = std::dynamic_pointer_cast<RenderableComponent>(component))
         {
-            std::lock_guard lock(_renderableArrayMutex);
+            renderableComponent->GetLayerUpdatedEvent().Subscribe(this, &BaseScene::_OnRenderableComponentLayerChanged);
+        }
+        //if (const auto cameraComponent = std::dynamic_pointer_cast<CameraComponent>(component))
+        //{
+        //    cameraComponent->BindToEvent("PriorityUpdated", this, &BaseScene::_OnCameraComponentPriorityChanged);
+        //}
 
-            // Check if added component is renderable component
-            if (const auto renderableComponent = std::dynamic_pointer_cast<RenderableComponent>(component))
-            {
-                _renderableComponentsToAdd.push_back(renderableComponent);
-                //renderableComponent->BindToEvent("LayerUpdated", this, &BaseScene::_OnRenderableComponentLayerChanged);
-            }
+        _JournalChange(RenderChange::Type::Added, component);
+    }
+}
 
-            // Check if added component is camera component
-            if (const auto cameraComponent = std::dynamic_pointer_cast<CameraComponent>(component))
-            {
-                _cameraComponentsToAdd.push_back(cameraComponent);
-                //cameraComponent->BindToEvent("PriorityUpdated", this, &BaseScene::_OnCameraComponentPriorityChanged);
-            }
-        }
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BaseScene::_OnComponentRemoved(std::weak_ptr<BaseComponent> removedComponent)
+{
+    if (const auto component = removedComponent.lock())
+    {
+        _JournalChange(RenderChange::Type::Removed, component);
     }
 }
 
@@ -200,16 +222,20 @@ void BaseScene::_OnNewComponentAdded(std::weak_ptr<BaseComponent> newComponent)
 
 void BaseScene::_OnCameraComponentPriorityChanged(std::weak_ptr<CameraComponent> cameraComponent, int8_t)
 {
-    std::lock_guard lock(_cameraArrayMutex);
-    _cameraComponentsToAdd.push_back(cameraComponent);
+    if (const auto component = cameraComponent.lock())
+    {
+        _JournalChange(RenderChange::Type::OrderChanged, component);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void BaseScene::_OnRenderableComponentLayerChanged(std::weak_ptr<RenderableComponent> renderableComponent, int8_t)
 {
-    std::lock_guard lock(_renderableArrayMutex);
-    _renderableComponentsToAdd.push_back(renderableComponent);
+    if (const auto component = renderableComponent.lock())
+    {
+        _JournalChange(RenderChange::Type::OrderChanged, component);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
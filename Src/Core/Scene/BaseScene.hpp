@@ -3,8 +3,8 @@
 #include "Core/Scene/SceneObject.hpp"
 #include "Core/Components/RenderableComponent.hpp"
 #include "Core/Components/CameraComponent.hpp"
+#include "Utility/Containers/Journal/Journal.hpp"
 #include <memory>
-#include <mutex>
 
 namespace C2D
 {
@@ -13,6 +13,10 @@ namespace C2D
      * 
      * This base scene contains functionality to create scene objects 
      * and to aggregate renderable components that can be passed to a render system.
+     *
+     * Additions, removals and layer changes of renderable and camera components are appended to a journal
+     * by the logic thread, and the render thread applies only them to its sets, so the cost of a frame
+     * depends on the number of changes instead of the size of the scene.
      */
     class [[deprecated("Will be reimplemented")]] BaseScene : public BaseSceneInterface
     {
@@ -64,22 +68,20 @@ namespace C2D
 
     private:
         /*!
-         * \brief Grabs array of renderable components of the scene.
-         * \return Shared pointer to the array of renderable components of the scene.
+         * \brief Grabs set of renderable components of the scene.
+         * \return Shared pointer to the set of renderable components of the scene.
          * 
-         * Removes all weak pointers from the array if they are not "alive".
-         * Then adds new renderable components that was added during the render phase.
-         * Returns shared pointer to updated array of weak pointers to renderable components of the scene.
+         * Applies changes of the scene that were journaled since the previous call.
+         * Set keeps removed components alive until their removal is applied, so the render thread
+         * never sees a component that is destroyed in the middle of a frame.
          */
         std::shared_ptr<RenderableSet> GetRenderableComponents() const final;
 
         /*!
-         * \brief Grabs array of camera components of the scene.
-         * \return Shared pointer to the array of camera components of the scene.
+         * \brief Grabs set of camera components of the scene.
+         * \return Shared pointer to the set of camera components of the scene.
          *
-         * Removes all weak pointers from the array if they are not "alive".
-         * Then adds new camera components that was added during the render phase.
-         * Returns shared pointer to updated array of weak pointers to camera components of the scene.
+         * Applies changes of the scene that were journaled since the previous call.
          */
         std::shared_ptr<CameraSet> GetCameraComponents() const final;
 
@@ -98,11 +100,61 @@ namespace C2D
          */
         bool MarkedAsDeleteLater() const final;
 
+        /*!
+         * \brief Change of the renderable or camera component that is applied by the render thread.
+         */
+        struct RenderChange
+        {
+            /*!
+             * \brief Kind of the change.
+             */
+            enum class Type : uint8_t
+            {
+                Added,
+                Removed,
+                OrderChanged
+            };
+
+            /*! Kind of the change. */
+            Type type;
+            /*! Changed renderable component, empty if a camera component was changed. */
+            std::weak_ptr<RenderableComponent> renderable;
+            /*! Changed camera component, empty if a renderable component was changed. */
+            std::weak_ptr<CameraComponent> camera;
+            /*! New render order of the component, not used by removals. */
+            RenderOrder order;
+        };
+
         /*!
          * \brief Deletes all scene objects that were marked as "delete later".
          */
         void _DeleteMarkedObjects();
 
+        /*!
+         * \brief Appends change of the component to the journal if it is a renderable or a camera component.
+         * \param type - kind of the change.
+         * \param component - changed component, its current layer or priority becomes its new render order.
+         */
+        void _JournalChange(RenderChange::Type type, const std::shared_ptr<BaseComponent>& component);
+
+        /*!
+         * \brief Applies journaled changes to the sets of renderable and camera components.
+         *
+         * Called by the render thread only.
+         */
+        void _ApplyRenderChanges() const;
+
+        /*!
+         * \brief Applies a change to the set of components.
+         * \param set - set of renderable or camera components.
+         * \param component - changed component.
+         * \param change - change of the component.
+         */
+        template <class Set, class Component>
+        static void _ApplyRenderChange(Set& set,
+                                       const std::shared_ptr<Component>& component,
+                                       const RenderChange& change);
+
         /*!
          * \brief Callback that is used to add new renderable components to the renderable array 
          *        when a new component has been added to any scene object.
@@ -113,6 +165,13 @@ namespace C2D
          */
         void _OnNewComponentAdded(std::weak_ptr<BaseComponent> newComponent);
 
+        /*!
+         * \brief Callback that is used to remove renderable and camera components from the sets
+         *        when they are removed from any scene object.
+         * \param removedComponent - weak pointer to the removed component.
+         */
+        void _OnComponentRemoved(std::weak_ptr<BaseComponent> removedComponent);
+
         /*!
          * \brief Callback that is used to update renderable components in the set when they change their layer.
          * \param renderableComponent - weak pointer to the renderable component that should be updated.
@@ -131,18 +190,12 @@ namespace C2D
         bool _deleteLater;
         /*! Simple flag that defines if scene is activated or not. Used to know if scene should be rendered. */
         std::atomic_bool _activated;
-        /*! Set of renderable components that should be used by render system. */
+        /*! Set of renderable components that should be used by render system, changed by the render thread only. */
         mutable std::shared_ptr<RenderableSet> _renderableComponents;
-        /*! Array of renderable components that will be added to main array that goes to a render system. */
-        mutable RenderableArray _renderableComponentsToAdd;
-        /*! Mutex that used to update renderable arrays. */
-        mutable std::mutex _renderableArrayMutex;
-        /*! Set of camera components that should be used by render system. */
+        /*! Set of camera components that should be used by render system, changed by the render thread only. */
         mutable std::shared_ptr<CameraSet> _cameraComponents;
-        /*! Array of camera components that will be added to main array that goes to a render system. */
-        mutable std::mutex _cameraArrayMutex;
-        /*! Mutex that used to update camera arrays. */
-        mutable CameraArray _cameraComponentsToAdd;
+        /*! Changes of renderable and camera components that are not applied to the sets yet. */
+        mutable Journal<RenderChange> _renderChanges;
         /*! Array of shared pointers to scene objects that were created and should be added to main array before update phase. */
         std::vector<std::shared_ptr<SceneObject>> _newSceneObjects;
     };
@@ -57,24 +57,24 @@ namespace C2D
         virtual const std::string& GetName() const = 0;
 
         /*!
-         * \brief Grabs array of renderable components of the scene.
-         * \return Shared pointer to the array of renderable components of the scene.
+         * \brief Grabs set of renderable components of the scene.
+         * \return Shared pointer to the set of renderable components of the scene.
          *
-         * Removes all weak pointers from the array if they are not "alive".
-         * Then adds new renderable components that was added during the render phase.
-         * Returns shared pointer to updated array of weak pointers to renderable components of the scene.
+         * Applies changes of the scene that were made since the previous call.
+         * Called by the render thread only.
          */
-        virtual std::shared_ptr<std::set<std::weak_ptr<RenderableComponent>, RenderablesCompare>> GetRenderableComponents() const = 0;
+        virtual std::shared_ptr<std::set<std::shared_ptr<RenderableComponent>, RenderablesCompare>>
+            GetRenderableComponents() const = 0;
 
         /*!
-         * \brief Grabs array of camera components of the scene.
-         * \return Shared pointer to the array of camera components of the scene.
+         * \brief Grabs set of camera components of the scene.
+         * \return Shared pointer to the set of camera components of the scene.
          *
-         * Removes all weak pointers from the array if they are not "alive".
-         * Then adds new camera components that was added during the render phase.
-         * Returns shared pointer to updated array of weak pointers to camera components of the scene.
+         * Applies changes of the scene that were made since the previous call.
+         * Called by the render thread only.
          */
-        virtual std::shared_ptr<std::set<std::weak_ptr<CameraComponent>, CamerasCompare>> GetCameraComponents() const = 0;
+        virtual std::shared_ptr<std::set<std::shared_ptr<CameraComponent>, CamerasCompare>>
+            GetCameraComponents() const = 0;
 
         /*!
          * \brief Updates all scene objects one by one.
@@ -53,6 +53,20 @@ std::weak_ptr<TransformComponent> SceneObject::GetTransformComponent() const
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+Event<std::weak_ptr<BaseComponent>>& SceneObject::GetComponentAddedEvent()
+{
+    return _componentAddedEvent;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Event<std::weak_ptr<BaseComponent>>& SceneObject::GetComponentRemovedEvent()
+{
+    return _componentRemovedEvent;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 std::weak_ptr<SceneObject> SceneObject::GetParent() const
 {
     return _parent;
@@ -155,10 +169,7 @@ bool SceneObject::_AddChild(const std::shared_ptr<SceneObject>& newChild)
 void SceneObject::_Initialize()
 {
     // Every scene object ALWAYS must have transform component 
-    if (AddComponent<TransformComponent>())
-    {
-        //AddEvent("ComponentAdded", new Dispatcher<void>);
-    }
+    AddComponent<TransformComponent>();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
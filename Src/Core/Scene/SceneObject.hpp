@@ -2,6 +2,7 @@
 #include "Core/Components/Base/BaseDataComponent.hpp"
 #include "Core/Components/Base/BaseLogicComponent.hpp"
 #include "Core/Components/TransformComponent.hpp"
+#include "Utility/Containers/Delegate/Event.hpp"
 #include <typeindex>
 #include <vector>
 #include <unordered_map>
@@ -73,6 +74,20 @@ namespace C2D
         template <class Component>
         bool AddComponent();
 
+        /*!
+         * \brief Returns event that is invoked when a new component is added to the object.
+         * \return Reference to the event, its argument is the added component.
+         */
+        Event<std::weak_ptr<BaseComponent>>& GetComponentAddedEvent();
+
+        /*!
+         * \brief Returns event that is invoked when a component is removed from the object.
+         * \return Reference to the event, its argument is the removed component.
+         *
+         * Event is invoked before the component is released by the object.
+         */
+        Event<std::weak_ptr<BaseComponent>>& GetComponentRemovedEvent();
+
         /*!
          * \brief Returns component of the object.
          * \tparam Component - Type of component that was requested.
@@ -170,6 +185,10 @@ namespace C2D
         std::unordered_map<std::type_index, std::shared_ptr<BaseDataComponent>> _dataComponentMap;
         /*! Map of logic components. Only one instance of a component should exist in the map. */
         std::unordered_map<std::type_index, std::shared_ptr<BaseLogicComponent>> _logicComponentMap;
+        /*! Event that is invoked when a new component is added. */
+        Event<std::weak_ptr<BaseComponent>> _componentAddedEvent;
+        /*! Event that is invoked when a component is removed. */
+        Event<std::weak_ptr<BaseComponent>> _componentRemovedEvent;
         /*! Weak pointer to a parent scene object. */
         std::weak_ptr<SceneObject> _parent;
         /*! Array of shared pointers to the children of this object. */
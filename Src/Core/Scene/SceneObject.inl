@@ -19,7 +19,7 @@ bool SceneObject::AddComponent()
             added = true;
 
             // Notify listeners that new component was added
-            //InvokeEvent<void, std::weak_ptr<BaseComponent>>("ComponentAdded", _dataComponentMap[componentTypeIndex]);
+            _componentAddedEvent.Invoke(_dataComponentMap[componentTypeIndex]);
         }
     }
     else if constexpr (std::is_base_of<BaseLogicComponent, Component>::value)
@@ -33,7 +33,7 @@ bool SceneObject::AddComponent()
             added = true;
 
             // Notify listeners that new component was added
-            //InvokeEvent<void, std::weak_ptr<BaseComponent>>("ComponentAdded", _logicComponentMap[componentTypeIndex]);
+            _componentAddedEvent.Invoke(_logicComponentMap[componentTypeIndex]);
         }
     }    
 
@@ -87,6 +87,7 @@ void SceneObject::RemoveComponent()
             if (const auto component = _dataComponentMap.find(componentTypeIndex);
                 component != _dataComponentMap.end())
             {
+                _componentRemovedEvent.Invoke(component->second);
                 _dataComponentMap.erase(component);
             }
         }
@@ -97,6 +98,7 @@ void SceneObject::RemoveComponent()
             if (const auto component = _logicComponentMap.find(componentTypeIndex); 
                 component != _logicComponentMap.end())
             {
+                _componentRemovedEvent.Invoke(component->second);
                 _logicComponentMap.erase(component);
             }
         }        
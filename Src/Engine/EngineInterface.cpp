@@ -25,7 +25,7 @@ InputSystemInterface& GetInputSystem()
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/*
+
 const TimeSpan& GetRenderLoopTimeSpan()
 {
     return EngineApp::Instance().GetRenderLoopTimeSpan();
@@ -37,7 +37,7 @@ const TimeSpan& GetLogicLoopTimeSpan()
 {
     return EngineApp::Instance().GetLogicLoopTimeSpan();
 }
-*/
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /*IOSystemInterface& GetIOSystem()
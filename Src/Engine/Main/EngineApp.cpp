@@ -12,7 +12,7 @@ EngineApp::EngineApp()
 : _renderSystem(std::make_unique<RenderSystem>())
 , _logicThreadIsWorking(false)
 , _sceneMap(std::make_unique<SceneMap>())
-//, _inputSystem(std::make_unique<InputSystem>(_logicLoopTimeSpan))
+, _inputSystem(std::make_unique<InputSystem>())
 { }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,7 +34,7 @@ void EngineApp::Run()
     std::thread(&EngineApp::_LogicLoop, this).detach();
 
     // Start render system
-    //_renderSystem->Start(*_sceneMap, *_inputSystem, _renderLoopTimeSpan);
+    _renderSystem->Start(*_sceneMap, *_inputSystem, _renderLoopTimeSpan);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,7 +78,7 @@ InputSystem& EngineApp::GetInputSystem() const
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-/*const TimeSpan& EngineApp::GetRenderLoopTimeSpan() const
+const TimeSpan& EngineApp::GetRenderLoopTimeSpan() const
 {
     return _renderLoopTimeSpan;
 }
@@ -88,7 +88,7 @@ InputSystem& EngineApp::GetInputSystem() const
 const TimeSpan& EngineApp::GetLogicLoopTimeSpan() const
 {
     return _logicLoopTimeSpan;
-}*/
+}
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -114,17 +114,19 @@ void EngineApp::_LogicLoop()
     if (!_logicThreadIsWorking)
     {
         _logicThreadIsWorking = true;
-        //_logicLoopTimeSpan.SetNewEnd(Time::CurrentTime());
-        //_logicLoopTimeSpan.SetNewEnd(Time::CurrentTime());
+        _logicLoopTimeSpan.Reset(EngineClock::now());
 
         // If render system works properly, update scenes
         while (_renderSystem->NoErrors())
         {
+            // Apply input events that were received since the previous tick
+            _inputSystem->Update();
+
             // Update scenes
             _sceneMap->UpdateScenes();
 
             // Update time span
-            //_logicLoopTimeSpan.SetNewEnd(Time::CurrentTime());
+            _logicLoopTimeSpan.SetNewEnd(EngineClock::now());
         }
 
         // Mark that logic thread finished its work
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <Utility/Time/EngineClock.hpp>
+
+namespace GLFWWrapper
+{
+    /*!
+     * Compact input event that is passed from the main thread, where GLFW calls callbacks, to the input system.
+     */
+    struct InputEvent
+    {
+        /*!
+         * Type of the input event, defines meaning of the other fields.
+         */
+        enum class Type : uint8_t
+        {
+            Key,               /*!< Keyboard key. Code is the key, action is GLFW_PRESS/RELEASE/REPEAT.         */
+            Char,              /*!< Text input. Code is the Unicode code point.                                 */
+            MouseButton,       /*!< Mouse button. Code is the button, action is GLFW_PRESS/RELEASE.             */
+            CursorMoved,       /*!< Cursor was moved to x and y, consecutive moves are merged into one event.   */
+            Scrolled,          /*!< Mouse wheel or touchpad was scrolled by x and y, deltas are accumulated.    */
+            CursorEntered,     /*!< Cursor entered (action 1) or left (action 0) the content area.              */
+            Focused,           /*!< Window gained (action 1) or lost (action 0) the input focus.                */
+            Iconified,         /*!< Window was minimized (action 1) or restored (action 0).                     */
+            JoystickConnected, /*!< Joystick was connected (action 1) or disconnected (action 0).               */
+            JoystickButton,    /*!< Joystick button. Code is the button, action is GLFW_PRESS/RELEASE.          */
+            JoystickAxis       /*!< Joystick axis was moved. Code is the axis, x is the position from -1 to 1.  */
+        };
+
+        /*! Time when the event was received. */
+        C2D::EngineTimePoint timestamp;
+        /*! Type of the event. */
+        Type type;
+        /*! Action of the event, see Type. */
+        uint8_t action;
+        /*! Modifier keys for keyboard and mouse events, joystick id for joystick events. */
+        uint16_t mods;
+        /*! Key, button, axis or code point, see Type. */
+        int32_t code;
+        /*! X coordinate of the cursor, horizontal scroll or position of the joystick axis. */
+        float x;
+        /*! Y coordinate of the cursor or vertical scroll. */
+        float y;
+    };
+
+    static_assert(sizeof(InputEvent) <= 32, "Input events are copied through the queue, so they must stay compact");
+}
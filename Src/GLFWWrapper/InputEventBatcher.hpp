@@ -0,0 +1,89 @@
+#pragma once
+#include <GLFWWrapper/InputEvent.hpp>
+
+namespace GLFWWrapper
+{
+    /*!
+     * Merges consecutive cursor moves and scrolls into single events.
+     *
+     * At most one batch is pending at a time: a batch of the other kind is pushed before a new one is started, so
+     * the order of the events is kept, e.g. move, scroll, move produces three events.
+     */
+    class InputEventBatcher final
+    {
+    public:
+        /*!
+         * Replaces the pending cursor move, a pending scroll is pushed first.
+         *
+         * \param event Cursor move event.
+         * \param push Function that receives events which are ready, called as push(const InputEvent&).
+         */
+        template<typename Push>
+        void MoveCursor(const InputEvent& event, Push&& push)
+        {
+            if (_hasPendingScroll)
+            {
+                Flush(push);
+            }
+
+            _pendingCursorMove = event;
+            _hasPendingCursorMove = true;
+        }
+
+        /*!
+         * Adds deltas of the event to the pending scroll, a pending cursor move is pushed first.
+         *
+         * \param event Scroll event.
+         * \param push Function that receives events which are ready, called as push(const InputEvent&).
+         */
+        template<typename Push>
+        void Scroll(const InputEvent& event, Push&& push)
+        {
+            if (_hasPendingCursorMove)
+            {
+                Flush(push);
+            }
+
+            if (!_hasPendingScroll)
+            {
+                _pendingScroll = event;
+                _hasPendingScroll = true;
+                return;
+            }
+
+            _pendingScroll.timestamp = event.timestamp;
+            _pendingScroll.x += event.x;
+            _pendingScroll.y += event.y;
+        }
+
+        /*!
+         * Pushes the pending batch, if there is one.
+         *
+         * \param push Function that receives events which are ready, called as push(const InputEvent&).
+         */
+        template<typename Push>
+        void Flush(Push&& push)
+        {
+            if (_hasPendingCursorMove)
+            {
+                _hasPendingCursorMove = false;
+                push(_pendingCursorMove);
+            }
+            if (_hasPendingScroll)
+            {
+                _hasPendingScroll = false;
+                push(_pendingScroll);
+            }
+        }
+
+    private:
+        /*! Cursor move that is not pushed yet. */
+        InputEvent _pendingCursorMove{};
+        /*! Scroll that is not pushed yet. */
+        InputEvent _pendingScroll{};
+        /*! Flag that shows if there is a pending cursor move. */
+        bool _hasPendingCursorMove = false;
+        /*! Flag that shows if there is a pending scroll. */
+        bool _hasPendingScroll = false;
+    };
+}
@@ -27,9 +27,7 @@ Window& Window::Create(int width, int height, std::string_view title)
     _state = State::Normal;
     Logger::LogInfo("Window was created", __PRETTY_FUNCTION__);
 
-    // Set OnSizeChanged callback
-    glfwSetWindowUserPointer(_window, this);
-    glfwSetFramebufferSizeCallback(_window, OnFramebufferResizeCallback);
+    RegisterCallbacks();
 
     return *this;
 }
@@ -46,6 +44,11 @@ void Window::Destroy()
 
     glfwDestroyWindow(_window);
     _window = nullptr;
+    if (_joystickWindow == this)
+    {
+        glfwSetJoystickCallback(nullptr);
+        _joystickWindow = nullptr;
+    }
     Logger::LogInfo("Window was destroyed", __PRETTY_FUNCTION__);
 }
 
@@ -397,6 +400,8 @@ Window& Window::SetBorderlessWindowedOnMonitor(const Monitor& monitor)
     Assert(_window != nullptr, "Windows was not recreated");
     Logger::LogInfo("Window was recreated", __PRETTY_FUNCTION__);
 
+    RegisterCallbacks();
+
     return *this;
 }
 
@@ -423,6 +428,13 @@ void Window::AddFramebufferResizedCallback(WindowFramebufferResizedCallback call
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+void Window::AddIconifiedCallback(WindowIconifiedCallback callback)
+{
+    _iconifiedCallbacks.emplace_back(std::move(callback));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 void Window::OnFramebufferResizeCallback(GLFWwindow* window, int width, int height)
 {
     static_cast<Window*>(glfwGetWindowUserPointer(window))->OnFramebufferResized(width, height);
@@ -430,11 +442,259 @@ void Window::OnFramebufferResizeCallback(GLFWwindow* window, int width, int heig
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-void Window::OnFramebufferResized(int, int) const
+void Window::OnFramebufferResized(int width, int height) const
 {
     for (const auto& callback : _framebufferResizedCallbacks)
     {
-        callback();
+        callback(width, height);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::ProcessEvents()
+{
+    if (IsIdle())
+    {
+        glfwWaitEventsTimeout(_idleTimeout);
+    }
+    else
+    {
+        glfwPollEvents();
+    }
+
+    PollJoysticks();
+    FlushBatchedEvents();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+Window& Window::SetIdleMode(bool enabled, double timeout)
+{
+    _idleModeEnabled = enabled;
+    _idleTimeout = timeout;
+    return *this;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool Window::IsIdle() const
+{
+    return _idleModeEnabled && _window != nullptr && (_iconified || !_focused);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool Window::IsMinimized() const
+{
+    return _iconified;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+Window::EventQueue& Window::GetEventQueue()
+{
+    return *_events;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint64_t Window::GetDroppedEventCount() const
+{
+    return _droppedEventCount.load(std::memory_order_relaxed);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+C2D::EngineTimePoint Window::GetLastInputTime() const
+{
+    return C2D::EngineTimePoint(C2D::EngineDuration(_lastInputTime.load(std::memory_order_relaxed)));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::RegisterCallbacks()
+{
+    glfwSetWindowUserPointer(_window, this);
+    glfwSetFramebufferSizeCallback(_window, OnFramebufferResizeCallback);
+    glfwSetKeyCallback(_window, OnKeyCallback);
+    glfwSetCharCallback(_window, OnCharCallback);
+    glfwSetMouseButtonCallback(_window, OnMouseButtonCallback);
+    glfwSetCursorPosCallback(_window, OnCursorPositionCallback);
+    glfwSetScrollCallback(_window, OnScrollCallback);
+    glfwSetCursorEnterCallback(_window, OnCursorEnterCallback);
+    glfwSetWindowFocusCallback(_window, OnFocusCallback);
+    glfwSetWindowIconifyCallback(_window, OnIconifyCallback);
+
+    _joystickWindow = this;
+    glfwSetJoystickCallback(OnJoystickCallback);
+
+    _focused = glfwGetWindowAttrib(_window, GLFW_FOCUSED) == GLFW_TRUE;
+    _iconified = glfwGetWindowAttrib(_window, GLFW_ICONIFIED) == GLFW_TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::PushEvent(InputEvent event)
+{
+    FlushBatchedEvents();
+
+    event.timestamp = C2D::EngineClock::now();
+    PushToQueue(event);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::FlushBatchedEvents()
+{
+    _batcher.Flush([this](const InputEvent& event) { PushToQueue(event); });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::PushToQueue(const InputEvent& event)
+{
+    _lastInputTime.store(event.timestamp.time_since_epoch().count(), std::memory_order_relaxed);
+    if (!_events->TryPush(event))
+    {
+        // Main thread must not wait for the input system, so events that do not fit the queue are lost
+        _droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::PollJoysticks()
+{
+    for (int jid = GLFW_JOYSTICK_1; jid <= GLFW_JOYSTICK_LAST; ++jid)
+    {
+        auto& state = _joysticks[jid];
+        if (glfwJoystickPresent(jid) == GLFW_FALSE)
+        {
+            state.buttons.clear();
+            state.axes.clear();
+            continue;
+        }
+
+        int buttonCount = 0;
+        const auto* buttons = glfwGetJoystickButtons(jid, &buttonCount);
+        state.buttons.resize(buttonCount, GLFW_RELEASE);
+        for (int button = 0; button < buttonCount; ++button)
+        {
+            if (state.buttons[button] != buttons[button])
+            {
+                state.buttons[button] = buttons[button];
+                PushEvent({ {}, InputEvent::Type::JoystickButton, buttons[button], static_cast<uint16_t>(jid), button,
+                            0.0f, 0.0f });
+            }
+        }
+
+        int axisCount = 0;
+        const auto* axes = glfwGetJoystickAxes(jid, &axisCount);
+        state.axes.resize(axisCount, 0.0f);
+        for (int axis = 0; axis < axisCount; ++axis)
+        {
+            if (state.axes[axis] != axes[axis])
+            {
+                state.axes[axis] = axes[axis];
+                PushEvent({ {}, InputEvent::Type::JoystickAxis, 0, static_cast<uint16_t>(jid), axis, axes[axis],
+                            0.0f });
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::OnKeyCallback(GLFWwindow* window, int key, int, int action, int mods)
+{
+    static_cast<Window*>(glfwGetWindowUserPointer(window))->PushEvent(
+        { {}, InputEvent::Type::Key, static_cast<uint8_t>(action), static_cast<uint16_t>(mods), key, 0.0f, 0.0f });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::OnCharCallback(GLFWwindow* window, unsigned int codepoint)
+{
+    static_cast<Window*>(glfwGetWindowUserPointer(window))->PushEvent(
+        { {}, InputEvent::Type::Char, 0, 0, static_cast<int32_t>(codepoint), 0.0f, 0.0f });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::OnMouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
+{
+    static_cast<Window*>(glfwGetWindowUserPointer(window))->PushEvent(
+        { {}, InputEvent::Type::MouseButton, static_cast<uint8_t>(action), static_cast<uint16_t>(mods), button,
+          0.0f, 0.0f });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::OnCursorPositionCallback(GLFWwindow* window, double x, double y)
+{
+    // Only the latest position matters, so moves are merged until another event arrives
+    auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
+    self->_batcher.MoveCursor({ C2D::EngineClock::now(), InputEvent::Type::CursorMoved, 0, 0, 0,
+                                static_cast<float>(x), static_cast<float>(y) },
+                              [self](const InputEvent& event) { self->PushToQueue(event); });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::OnScrollCallback(GLFWwindow* window, double x, double y)
+{
+    // Deltas are accumulated, so touchpads that report many small scrolls produce a single event
+    auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
+    self->_batcher.Scroll({ C2D::EngineClock::now(), InputEvent::Type::Scrolled, 0, 0, 0,
+                            static_cast<float>(x), static_cast<float>(y) },
+                          [self](const InputEvent& event) { self->PushToQueue(event); });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::OnCursorEnterCallback(GLFWwindow* window, int entered)
+{
+    static_cast<Window*>(glfwGetWindowUserPointer(window))->PushEvent(
+        { {}, InputEvent::Type::CursorEntered, static_cast<uint8_t>(entered), 0, 0, 0.0f, 0.0f });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::OnFocusCallback(GLFWwindow* window, int focused)
+{
+    auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
+    self->_focused = focused == GLFW_TRUE;
+    self->PushEvent({ {}, InputEvent::Type::Focused, static_cast<uint8_t>(focused), 0, 0, 0.0f, 0.0f });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::OnIconifyCallback(GLFWwindow* window, int iconified)
+{
+    auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
+    self->_iconified = iconified == GLFW_TRUE;
+    if (self->_state == State::Minimized || self->_iconified)
+    {
+        // The window can be minimized and restored by the user, not only by Minimize() and Restore()
+        self->_state = self->_iconified ? State::Minimized : State::Normal;
+    }
+    self->PushEvent({ {}, InputEvent::Type::Iconified, static_cast<uint8_t>(iconified), 0, 0, 0.0f, 0.0f });
+    for (const auto& callback : self->_iconifiedCallbacks)
+    {
+        callback(self->_iconified);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Window::OnJoystickCallback(int jid, int event)
+{
+    if (_joystickWindow != nullptr)
+    {
+        const uint8_t connected = event == GLFW_CONNECTED ? 1 : 0;
+        _joystickWindow->PushEvent(
+            { {}, InputEvent::Type::JoystickConnected, connected, static_cast<uint16_t>(jid), 0, 0.0f, 0.0f });
     }
 }
 
@@ -1,8 +1,15 @@
 #pragma once
+#include <array>
+#include <atomic>
 #include <tuple>
+#include <memory>
 #include <string_view>
 #include <functional>
+#include <vector>
 #include <GLFW/glfw3.h>
+#include <GLFWWrapper/InputEvent.hpp>
+#include <GLFWWrapper/InputEventBatcher.hpp>
+#include <Utility/Containers/SpscQueue/SpscQueue.hpp>
 
 namespace GLFWWrapper
 {
@@ -10,14 +17,31 @@ namespace GLFWWrapper
 
     /*!
      * A wrapper class for GLFWWindow.
+     *
+     * Input callbacks of the window push compact events to the lock-free queue, so the input system can consume them
+     * on another thread. Cursor moves and scrolls are batched: consecutive callbacks are merged into one event, which
+     * is pushed before the next event of another type, including a move after a scroll and vice versa, or at the end
+     * of ProcessEvents().
      */
     class Window final
     {
     public:
         /*!
          * Simplification of the type that is used as callback for frame buffer resize event.
+         * Receives the new width and height of the frame buffer in pixels.
          */
-        using WindowFramebufferResizedCallback = std::function<void()>;
+        using WindowFramebufferResizedCallback = std::function<void(int32_t, int32_t)>;
+
+        /*!
+         * Simplification of the type that is used as callback for minimize and restore events.
+         * Receives true if the window was minimized and false if it was restored.
+         */
+        using WindowIconifiedCallback = std::function<void(bool)>;
+
+        /*!
+         * Queue of input events. The main thread is the producer, the input system is the consumer.
+         */
+        using EventQueue = C2D::SpscQueue<InputEvent, 1024>;
 
         /*!
          * State of the window.
@@ -434,7 +458,146 @@ namespace GLFWWrapper
          */
         void AddFramebufferResizedCallback(WindowFramebufferResizedCallback callback);
 
+        /*!
+         * Adds a callback that will be called when the window is minimized or restored.
+         *
+         * \param callback A function that will added as a callback.
+         *
+         * \threadSafety Not thread-safe. Callbacks are called from the main thread by ProcessEvents().
+         */
+        void AddIconifiedCallback(WindowIconifiedCallback callback);
+
+        /*!
+         * Processes pending window events, which calls callbacks of the window, and pushes batched input events.
+         *
+         * If idle mode is enabled and the window is idle (see IsIdle()), waits for events up to the idle timeout,
+         * so a minimized or background application does not burn CPU and GPU. Otherwise returns immediately.
+         *
+         * \threadSafety Not thread-safe. Must be called only from the main thread.
+         */
+        void ProcessEvents();
+
+        /*!
+         * Enables or disables idle mode.
+         *
+         * \param enabled Flag that defines if ProcessEvents() waits for events while the window is idle.
+         * \param timeout Maximal time of waiting in seconds, e.g. to keep background animations at a low rate.
+         *
+         * \return A reference to the window.
+         *
+         * \threadSafety Not thread-safe. Must be called only from the main thread.
+         */
+        Window& SetIdleMode(bool enabled, double timeout = 0.1);
+
+        /*!
+         * Checks if the window is idle, i.e. it is minimized or it is not focused.
+         *
+         * \return True if idle mode is enabled and the window is idle. Otherwise - false.
+         *
+         * \threadSafety Not thread-safe. Must be called only from the main thread.
+         */
+        [[nodiscard]]
+        bool IsIdle() const;
+
+        /*!
+         * Checks if the window is minimized. Its frame buffer is empty then, so nothing should be rendered.
+         *
+         * \return True if the window is minimized. Otherwise - false.
+         *
+         * \threadSafety Not thread-safe. Must be called only from the main thread.
+         */
+        [[nodiscard]]
+        bool IsMinimized() const;
+
+        /*!
+         * Gets the queue of input events.
+         *
+         * \return A reference to the queue, events must be popped only by one consumer thread.
+         *
+         * \threadSafety Thread-safe. Can be called from any thread.
+         */
+        [[nodiscard]]
+        EventQueue& GetEventQueue();
+
+        /*!
+         * Gets the number of events that were lost because the queue was full.
+         *
+         * \return Number of dropped events.
+         *
+         * \threadSafety Thread-safe. Can be called from any thread.
+         */
+        [[nodiscard]]
+        uint64_t GetDroppedEventCount() const;
+
+        /*!
+         * Gets the timestamp of the newest input event, e.g. to measure the latency from input to present.
+         *
+         * \return Time when the newest event was received or the epoch of the clock if there were no events.
+         *
+         * \threadSafety Thread-safe. Can be called from any thread.
+         */
+        [[nodiscard]]
+        C2D::EngineTimePoint GetLastInputTime() const;
+
     private:
+        /*!
+         * Last known state of a joystick, buttons and axes are polled since GLFW has no callbacks for them.
+         */
+        struct JoystickState
+        {
+            std::vector<uint8_t> buttons;
+            std::vector<float> axes;
+        };
+
+        /*!
+         * Registers the user pointer and all callbacks of the window.
+         */
+        void RegisterCallbacks();
+
+        /*!
+         * Pushes the event to the queue, pending cursor move and scroll are pushed first to keep the order.
+         *
+         * \param event Event to push, its timestamp is set to the current time.
+         */
+        void PushEvent(InputEvent event);
+
+        /*!
+         * Pushes pending cursor move and scroll.
+         */
+        void FlushBatchedEvents();
+
+        /*!
+         * Pushes the event to the queue, the event is counted as dropped if the queue is full.
+         *
+         * \param event Event to push with the timestamp set.
+         */
+        void PushToQueue(const InputEvent& event);
+
+        /*!
+         * Pushes events for buttons and axes of connected joysticks that have changed since the previous poll.
+         */
+        void PollJoysticks();
+
+        /*!
+         * Callbacks that are assigned to GLFW upon creation of the window, they push events to the queue.
+         */
+        static void OnKeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+        static void OnCharCallback(GLFWwindow* window, unsigned int codepoint);
+        static void OnMouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+        static void OnCursorPositionCallback(GLFWwindow* window, double x, double y);
+        static void OnScrollCallback(GLFWwindow* window, double x, double y);
+        static void OnCursorEnterCallback(GLFWwindow* window, int entered);
+        static void OnFocusCallback(GLFWwindow* window, int focused);
+        static void OnIconifyCallback(GLFWwindow* window, int iconified);
+
+        /*!
+         * GLFW has a single joystick callback for all windows, so events are passed to the latest created window.
+         *
+         * \param jid Id of the joystick.
+         * \param event GLFW_CONNECTED or GLFW_DISCONNECTED.
+         */
+        static void OnJoystickCallback(int jid, int event);
+
         /*!
          * A callback function that is assigned to GLFW upon creation of the window.
          * Calls \ref OnFramebufferResized().
@@ -455,6 +618,8 @@ namespace GLFWWrapper
 
         /*! List of callbacks. Each one of them is called when frame buffer resized even is received. */
         std::vector<WindowFramebufferResizedCallback> _framebufferResizedCallbacks;
+        /*! List of callbacks. Each one of them is called when the window is minimized or restored. */
+        std::vector<WindowIconifiedCallback> _iconifiedCallbacks;
 
         /*! Current state of the window. */
         State _state = State::Destroyed;
@@ -464,5 +629,28 @@ namespace GLFWWrapper
         int32_t _decorated = GLFW_TRUE;
         /*! Raw pointer to the GLFWWindow. */
         GLFWwindow* _window = nullptr;
+
+        /*! Queue of input events. */
+        std::unique_ptr<EventQueue> _events = std::make_unique<EventQueue>();
+        /*! Number of events that were lost because the queue was full. */
+        std::atomic<uint64_t> _droppedEventCount = 0;
+        /*! Timestamp of the newest input event, ticks of the engine clock. */
+        std::atomic<C2D::EngineTimePoint::rep> _lastInputTime = 0;
+        /*! Cursor moves and scrolls that are not pushed yet. */
+        InputEventBatcher _batcher;
+        /*! States of joysticks by ids. */
+        std::array<JoystickState, GLFW_JOYSTICK_LAST + 1> _joysticks;
+
+        /*! Flag that shows if ProcessEvents() waits while the window is idle. */
+        bool _idleModeEnabled = false;
+        /*! Maximal time of waiting for events in idle mode, in seconds. */
+        double _idleTimeout = 0.1;
+        /*! Flag that shows if the window has the input focus. */
+        bool _focused = false;
+        /*! Flag that shows if the window is minimized. */
+        bool _iconified = false;
+
+        /*! Window that receives joystick connection events. */
+        static inline Window* _joystickWindow = nullptr;
     };
 }
\ No newline at end of file
@@ -1,60 +1,28 @@
 #pragma once
 #include "Input/Devices/JoystickDeviceInterface.hpp"
-#include "Input/Utilities/Buttons/JoystickButtons.hpp"
-#include "Input/Utilities/ButtonStateHandler.hpp"
-#include <SFML/Window/Event.hpp>
-#include <atomic>
+#include "Input/Utilities/InputSnapshot.hpp"
 #include <string>
-#include <vector>
 
 namespace C2D
 {
     /*!
-     * \brief Device which handles all joystick actions.
+     * \brief Joystick device that reads the state of the joystick from the input snapshot.
      */
-    class [[deprecated("Will be reimplemented")]] JoystickDevice : public JoystickDeviceInterface
+    class [[deprecated("Will be reimplemented")]] JoystickDevice final : public JoystickDeviceInterface
     {
     public:
+        JoystickDevice(const JoystickDevice&) = delete;
+        JoystickDevice(JoystickDevice&&) = delete;
         JoystickDevice& operator=(const JoystickDevice&) = delete;
         JoystickDevice& operator=(JoystickDevice&&) = delete;
-        JoystickDevice(JoystickDevice&& other) = delete;
+        ~JoystickDevice() final = default;
 
         /*!
-         * \brief Default constructor that initializes inner arrays of buttons.
+         * \brief Default constructor.
+         * \param snapshot - input snapshot that is updated by the input system.
+         * \param joystickId - id of the joystick.
          */
-        JoystickDevice();
-
-        /*!
-         * \brief Copy constructor.
-         * 
-         * Copy constructor is required because we have several joysticks that can be connected and handled.
-         */
-        JoystickDevice(const JoystickDevice&);
-
-        /*!
-         * \brief Simple destructor.
-         */
-        ~JoystickDevice() final;
-
-        /*!
-         * \brief Sets inner id of current joystick.
-         * \param joystickId - inner id of joystick that will be used by device to identify itself.
-         */
-        void SetJoystickId(unsigned int joystickId);
-
-        /*!
-         * \brief Sets connection state of current joystick.
-         * \param connectionState - state of connection.
-         */
-        void SetJoystickConnectionState(bool connectionState);
-
-         /*!
-          * \brief Returns state of specified joystick button.
-          * \param button - joystick button which should be checked.
-          * \param timeSpan - time span in which button should be checked.
-          * \return ButtonState which defines in what state specified button is.
-          */
-        //ButtonState GetButtonState(JoystickButton button, const TimeSpan& timeSpan) const;
+        JoystickDevice(const InputSnapshot& snapshot, uint32_t joystickId);
 
         /*!
          * \brief Returns position [range: -100.0f .. 100.0f] of specified joystick axis.
@@ -87,34 +55,10 @@ namespace C2D
          */
         bool IsConnected() const final;
 
-        /*!
-         * \brief Handles joystick events.
-         * \param event - joystick event to handle.
-         */
-        void HandleJoystickEvents(const sf::Event& event);
-
     private:
-        /*!
-         * \brief Handles joystick button events.
-         * \param event - joystick button event.
-         */
-        void _HandleJoystickButtonEvent(const sf::Event& event);
-
-        /*!
-         * \brief Handles joystick axis movement event.
-         * \param event - joystick axis movement event.
-         */
-        void _HandleJoystickMoveEvent(const sf::Event& event);
-
-        /*! Buttons states. */
-        std::vector<ButtonStateHandler> _buttons;
-        /*! Axis states. */
-        std::atomic<float>* _axes;
-        /*! Inner joystick id which is required to identify itself. */
-        unsigned int _joystickId;
-        /*! Flag that defines if current joystick is connected. */
-        std::atomic<bool> _isConnected;
-
-        friend class JoystickDeviceTests;
+        /*! Input snapshot that stores the state of the joystick. */
+        const InputSnapshot& _snapshot;
+        /*! Id of the joystick. */
+        uint32_t _joystickId;
     };
 }
@@ -1,15 +1,11 @@
 #pragma once
 #include "Input/Devices/MouseDeviceInterface.hpp"
-#include "Input/Utilities/Buttons/MouseButtons.hpp"
-#include "Input/Utilities/ButtonStateHandler.hpp"
-#include <SFML/Window/Event.hpp>
-#include <vector>
-#include <atomic>
+#include "Input/Utilities/InputSnapshot.hpp"
 
 namespace C2D
 {
     /*!
-     * \brief Device which handles all mouse actions.
+     * \brief Mouse device that reads the state of the mouse from the input snapshot.
      */
     class [[deprecated("Will be reimplemented")]] MouseDevice final : public MouseDeviceInterface
     {
@@ -21,29 +17,22 @@ namespace C2D
         ~MouseDevice() final = default;
 
         /*!
-         * \brief Default constructor that initializes inner arrays of buttons.
+         * \brief Default constructor.
+         * \param snapshot - input snapshot that is updated by the input system.
          */
-        MouseDevice();
-
-         /*!
-          * \brief Returns state of specified mouse button.
-          * \param button - mouse button which should be checked.
-          * \param timeSpan - time span in which button should be checked.
-          * \return ButtonState which defines in what state specified button is.
-          */
-        //ButtonState GetButtonState(MouseButton button, const TimeSpan& timeSpan) const;
+        explicit MouseDevice(const InputSnapshot& snapshot);
 
         /*!
          * \brief Returns wheel offset (positive is up, negative is down).
-         * \return Abstract value that defines how much vertical wheel was scrolled.
+         * \return Abstract value that defines how much vertical wheel was scrolled during the logic tick.
          */
-        //float VerticalWheelDiff(const TimeSpan& timeSpan) const final;
+        float VerticalWheelDiff() const final;
 
         /*!
          * \brief Returns wheel offset (positive is left, negative is right).
-         * \return Abstract value that defines how much horizontal wheel was scrolled.
+         * \return Abstract value that defines how much horizontal wheel was scrolled during the logic tick.
          */
-        //float HorizontalWheelDiff(const TimeSpan& timeSpan) const final;
+        float HorizontalWheelDiff() const final;
 
         /*!
          * \brief Returns current x coordinate of the mouse cursor relative to the top left corner of the window.
@@ -57,44 +46,8 @@ namespace C2D
          */
         int PositionY() const final;
 
-        /*!
-         * \brief Handles mouse events.
-         * \param event - mouse event to handle.
-         */
-        void HandleMouseEvent(const sf::Event& event);
-
     private:
-        /*!
-         * \brief Handles mouse button events.
-         * \param event - mouse button event.
-         */
-        void _HandleMouseButtonEvent(const sf::Event& event);
-
-        /*!
-         * \brief Handles mouse wheel events.
-         * \param event - mouse wheel event.
-         */
-        void _HandleMouseWheelEvent(const sf::Event& event);
-
-        /*!
-         * \brief Handles mouse move event.
-         * \param event - mouse move event.
-         */
-        void _HandleMouseMoveEvent(const sf::Event& event);
-
-        /*! Buttons states. */
-        std::vector<ButtonStateHandler> _buttons;
-        /*! Timestamp of a moment when vertical wheel was moved. */
-        //Time _verticalWheelMovedTime;
-        /*! Value of vertical wheel scroll. */
-        std::atomic<float> _verticalWheelDiff;
-        /*! Timestamp of a moment when horizontal wheel was moved. */
-        //Time _horizontalWheelMovedTime;
-        /*! Value of horizontal wheel scroll. */
-        std::atomic<float> _horizontalWheelDiff;
-        /*! Current x coordinate of the mouse cursor relative to the top left corner of the window. */
-        std::atomic<int> _posX;
-        /*! Current y coordinate of the mouse cursor relative to the top left corner of the window. */
-        std::atomic<int> _posY;
+        /*! Input snapshot that stores the state of the mouse. */
+        const InputSnapshot& _snapshot;
     };
-}
\ No newline at end of file
+}
@@ -17,15 +17,15 @@ namespace C2D
         
         /*!
          * \brief Returns wheel offset (positive is up, negative is down).
-         * \return Abstract value that defines how much vertical wheel was scrolled.
+         * \return Abstract value that defines how much vertical wheel was scrolled during the logic tick.
          */
-        //virtual float VerticalWheelDiff(const TimeSpan& timeSpan) const = 0;
+        virtual float VerticalWheelDiff() const = 0;
 
         /*!
          * \brief Returns wheel offset (positive is left, negative is right).
-         * \return Abstract value that defines how much horizontal wheel was scrolled.
+         * \return Abstract value that defines how much horizontal wheel was scrolled during the logic tick.
          */
-        //virtual float HorizontalWheelDiff(const TimeSpan& timeSpan) const = 0;
+        virtual float HorizontalWheelDiff() const = 0;
 
         /*!
          * \brief Returns current x coordinate of the mouse cursor relative to the top left corner of the window.
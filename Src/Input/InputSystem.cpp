@@ -4,142 +4,204 @@
 using namespace C2D;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-/*
-InputSystem::InputSystem(const TimeSpan& logicLoopTimeSpan)
-: _logicLoopTimeSpan(logicLoopTimeSpan)
-, _keyboard(std::make_unique<KeyboardDevice>())
-, _mouse(std::make_unique<MouseDevice>())
-, _lastJoystickId(-1)
+InputSystem::InputSystem()
+: _mouse(std::make_unique<MouseDevice>(_snapshot))
 , _joysticksThreshold(0.1f)
-, _inputMap(std::make_unique<InputMap>(*this))
+, _inputMap(std::make_unique<InputMap>(_snapshot))
 {
-    _joystick.resize(sf::Joystick::Count);
-    for (auto& joystick : _joystick)
+    _joystick.reserve(InputSnapshot::joystickCount);
+    for (uint32_t joystickId = 0; joystickId < InputSnapshot::joystickCount; ++joystickId)
     {
-        joystick = std::make_unique<JoystickDevice>();
+        _joystick.push_back(std::make_unique<JoystickDevice>(_snapshot, joystickId));
     }
 }
-*/
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void InputSystem::HandleInputEvent(const sf::Event& inputEvent)
 {
+    InputEvent event{};
+    event.timestamp = EngineClock::now();
+
     switch (inputEvent.type)
     {
     case sf::Event::EventType::KeyPressed:
     case sf::Event::EventType::KeyReleased:
-        _keyboard->HandleKeyboardEvent(inputEvent);
+        // Keys that are unknown to SFML have negative codes
+        if (inputEvent.key.code < 0 || inputEvent.key.code >= sf::Keyboard::KeyCount)
+        {
+            return;
+        }
+        event.type = (inputEvent.type == sf::Event::EventType::KeyPressed) ? InputEvent::Type::KeyPressed
+                                                                            : InputEvent::Type::KeyReleased;
+        event.code = static_cast<uint16_t>(inputEvent.key.code);
         break;
     case sf::Event::EventType::MouseButtonPressed:
     case sf::Event::EventType::MouseButtonReleased:
+        event.type = (inputEvent.type == sf::Event::EventType::MouseButtonPressed)
+                   ? InputEvent::Type::MouseButtonPressed
+                   : InputEvent::Type::MouseButtonReleased;
+        event.code = static_cast<uint16_t>(inputEvent.mouseButton.button);
+        break;
     case sf::Event::EventType::MouseWheelScrolled:
+        event.type = InputEvent::Type::MouseWheelScrolled;
+        event.code = static_cast<uint16_t>(inputEvent.mouseWheelScroll.wheel);
+        event.value = inputEvent.mouseWheelScroll.delta;
+        break;
     case sf::Event::EventType::MouseMoved:
-        _mouse->HandleMouseEvent(inputEvent);
+        event.type = InputEvent::Type::MouseMoved;
+        event.x = inputEvent.mouseMove.x;
+        event.y = inputEvent.mouseMove.y;
         break;
     case sf::Event::EventType::JoystickConnected:
-        _joystick[inputEvent.joystickConnect.joystickId]->SetJoystickConnectionState(true);
-        break;
     case sf::Event::EventType::JoystickDisconnected:
-        _joystick[inputEvent.joystickConnect.joystickId]->SetJoystickConnectionState(false);
+        event.type = (inputEvent.type == sf::Event::EventType::JoystickConnected)
+                   ? InputEvent::Type::JoystickConnected
+                   : InputEvent::Type::JoystickDisconnected;
+        event.joystickId = static_cast<uint8_t>(inputEvent.joystickConnect.joystickId);
         break;
     case sf::Event::EventType::JoystickButtonPressed:
     case sf::Event::EventType::JoystickButtonReleased:
-        _joystick[inputEvent.joystickButton.joystickId]->HandleJoystickEvents(inputEvent);
-        // Update joystick id which was used and time when it happened
-        //_lastTimeJoystickUsed = Time::CurrentTime();
-        _lastJoystickId = inputEvent.joystickButton.joystickId;        
+        event.type = (inputEvent.type == sf::Event::EventType::JoystickButtonPressed)
+                   ? InputEvent::Type::JoystickButtonPressed
+                   : InputEvent::Type::JoystickButtonReleased;
+        event.joystickId = static_cast<uint8_t>(inputEvent.joystickButton.joystickId);
+        event.code = static_cast<uint16_t>(inputEvent.joystickButton.button);
         break;
     case sf::Event::EventType::JoystickMoved:
-        // Check JoystickMove event values to fits the threshold        
-        if (std::abs(inputEvent.joystickMove.position) >= _joysticksThreshold.load())
-        {
-            _joystick[inputEvent.joystickMove.joystickId]->HandleJoystickEvents(inputEvent);
-            // Update joystick id which was used and time when it happened
-            //_lastTimeJoystickUsed = Time::CurrentTime();
-            _lastJoystickId = inputEvent.joystickButton.joystickId;
-        }
+        event.type = InputEvent::Type::JoystickMoved;
+        event.joystickId = static_cast<uint8_t>(inputEvent.joystickMove.joystickId);
+        event.code = static_cast<uint16_t>(inputEvent.joystickMove.axis);
+        event.value = inputEvent.joystickMove.position;
         break;
     default:
         // Unexpected event
-        break;
+        return;
+    }
+
+    // Window thread must not wait for the logic thread, so events that do not fit the queue are lost
+    _events.TryPush(event);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputSystem::Update()
+{
+    const auto tickStart = EngineClock::now();
+    _snapshot.BeginTick();
+
+    // Events that arrive while the queue is drained belong to the next tick
+    for (auto event = _events.Front(); event && event->timestamp <= tickStart; event = _events.Front())
+    {
+        // Events of the window are dropped during the replay, so they do not disturb the recorded session
+        if (!IsReplaying())
+        {
+            _ApplyEvent(*event);
+        }
+        _events.Pop();
+    }
+
+    if (IsReplaying())
+    {
+        for (const auto& event : _replay->NextTick())
+        {
+            _ApplyEvent(event);
+        }
+    }
+
+    if (_recorder)
+    {
+        _recorder->EndTick();
     }
+
+    _inputMap->Update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputSystem::SetRecorder(std::unique_ptr<InputRecorder> recorder)
+{
+    _recorder = std::move(recorder);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputSystem::SetReplay(std::unique_ptr<InputReplay> replay)
+{
+    _replay = std::move(replay);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InputSystem::IsReplaying() const
+{
+    return _replay && !_replay->IsFinished();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool InputSystem::ButtonPressed(const KeyboardButton keyboardButton) const
 {
-    return false;
-    //return (_keyboard->GetButtonState(keyboardButton, _logicLoopTimeSpan) == ButtonState::Pressed);
+    return _snapshot.GetButtons().Is(InputSnapshot::ButtonIndex(keyboardButton), ButtonState::Pressed);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool InputSystem::ButtonPressed(const MouseButton mouseButton) const
 {
-    return false;
-    //return (_mouse->GetButtonState(mouseButton, _logicLoopTimeSpan) == ButtonState::Pressed);
+    return _snapshot.GetButtons().Is(InputSnapshot::ButtonIndex(mouseButton), ButtonState::Pressed);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool InputSystem::ButtonPressed(const uint32_t joystickId, const JoystickButton joystickButton) const
 {
-
-    return false;
-    //return (_joystick[joystickId]->GetButtonState(joystickButton, _logicLoopTimeSpan) == ButtonState::Pressed);
+    return _snapshot.GetJoystickButtons().Is(InputSnapshot::ButtonIndex(joystickId, joystickButton),
+                                             ButtonState::Pressed);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool InputSystem::ButtonHeldDown(const KeyboardButton keyboardButton) const
 {
-
-    return false;
-    //return (_keyboard->GetButtonState(keyboardButton, _logicLoopTimeSpan) == ButtonState::HeldDown);
+    return _snapshot.GetButtons().Is(InputSnapshot::ButtonIndex(keyboardButton), ButtonState::HeldDown);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool InputSystem::ButtonHeldDown(const MouseButton mouseButton) const
 {
-
-    return false;
-    //return (_mouse->GetButtonState(mouseButton, _logicLoopTimeSpan) == ButtonState::HeldDown);
+    return _snapshot.GetButtons().Is(InputSnapshot::ButtonIndex(mouseButton), ButtonState::HeldDown);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool InputSystem::ButtonHeldDown(const uint32_t joystickId, const JoystickButton joystickButton) const
 {
-
-    return false;
-    //return (_joystick[joystickId]->GetButtonState(joystickButton, _logicLoopTimeSpan) == ButtonState::HeldDown);
+    return _snapshot.GetJoystickButtons().Is(InputSnapshot::ButtonIndex(joystickId, joystickButton),
+                                             ButtonState::HeldDown);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool InputSystem::ButtonReleased(const KeyboardButton keyboardButton) const
 {
-
-    return false;
-    //return (_keyboard->GetButtonState(keyboardButton, _logicLoopTimeSpan) == ButtonState::Released);
+    return _snapshot.GetButtons().Is(InputSnapshot::ButtonIndex(keyboardButton), ButtonState::Released);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool InputSystem::ButtonReleased(const MouseButton mouseButton) const
 {
-    return false;
-    //return (_mouse->GetButtonState(mouseButton, _logicLoopTimeSpan) == ButtonState::Released);
+    return _snapshot.GetButtons().Is(InputSnapshot::ButtonIndex(mouseButton), ButtonState::Released);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool InputSystem::ButtonReleased(const uint32_t joystickId, const JoystickButton joystickButton) const
 {
-    return false;
-    //return (_joystick[joystickId]->GetButtonState(joystickButton, _logicLoopTimeSpan) == ButtonState::Released);
+    return _snapshot.GetJoystickButtons().Is(InputSnapshot::ButtonIndex(joystickId, joystickButton),
+                                             ButtonState::Released);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -181,21 +243,14 @@ JoystickDeviceInterface& InputSystem::Joystick(const uint32_t joystickId) const
 
 int32_t InputSystem::LastJoystickUsed() const
 {
-    auto joystickId(-1);
-
-    /*if (_logicLoopTimeSpan.Start() <= _lastTimeJoystickUsed)
-    {
-        joystickId = _lastJoystickId.load();
-    }*/
-
-    return joystickId;
+    return _snapshot.GetLastJoystickUsed();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void InputSystem::SetJoystickThreshold(const float newThreshold)
 {
-    if (0.0f <= newThreshold || newThreshold <= 100.0f)
+    if (0.0f <= newThreshold && newThreshold <= 100.0f)
     {
         _joysticksThreshold = newThreshold;
     }
@@ -205,7 +260,7 @@ void InputSystem::SetJoystickThreshold(const float newThreshold)
 
 float InputSystem::GetJoystickThreshold() const
 {
-    return _joysticksThreshold.load();
+    return _joysticksThreshold;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -219,32 +274,20 @@ InputMapInterface& InputSystem::Map() const
 
 bool InputSystem::_AnyButtonState(const ButtonState state) const
 {
-    bool anyButtonInState(false);
+    // Keyboard and mouse buttons share one bitset, so the check is a reduction of a few words
+    return _snapshot.GetButtons().Any(state);
+}
 
-    // Check if any keyboard button was in specified state
-    for (auto i = 0; i < sf::Keyboard::KeyCount; ++i)
-    {
-        /*if (_keyboard->GetButtonState(static_cast<KeyboardButton>(i), _logicLoopTimeSpan) == state)
-        {
-            anyButtonInState = true;
-            break;
-        }*/
-    }
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputSystem::_ApplyEvent(const InputEvent& event)
+{
+    _snapshot.Apply(event, _joysticksThreshold);
 
-    // If keyboard button was not in specified state, check mouse buttons
-    if (!anyButtonInState)
+    if (_recorder)
     {
-        for (auto i = 0; i < sf::Mouse::ButtonCount; ++i)
-        {
-            /*if (_mouse->GetButtonState(static_cast<MouseButton>(i), _logicLoopTimeSpan) == state)
-            {
-                anyButtonInState = true;
-                break;
-            }*/
-        }
+        _recorder->Record(event);
     }
-
-    return anyButtonInState;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,11 +1,16 @@
 #pragma once
 #include "Input/InputSystemHandlerInterface.hpp"
 #include "Input/InputSystemInterface.hpp"
-#include "Input/Devices/KeyboardDevice.hpp"
 #include "Input/Devices/MouseDevice.hpp"
 #include "Input/Devices/JoystickDevice.hpp"
+#include "Input/Recording/InputRecorder.hpp"
+#include "Input/Recording/InputReplay.hpp"
+#include "Input/Utilities/InputEvent.hpp"
+#include "Input/Utilities/InputSnapshot.hpp"
 #include "Input/Utilities/MappedInput/InputMap.hpp"
+#include "Utility/Containers/SpscQueue/SpscQueue.hpp"
 #include <memory>
+#include <vector>
 
 namespace C2D
 {
@@ -17,6 +22,10 @@ namespace C2D
      *  - Get mouse position and vertical/horizontal wheel values
      *  - Get joystick axes values and vendor information
      *  - Create/edit/delete mapped actions and axes
+     *
+     * Events are handled by the window thread and passed to the logic thread through a lock-free queue.
+     * The logic thread folds them into the input snapshot once per tick by Update(), so all queries
+     * read the snapshot without synchronization and return the same result during the whole tick.
      */
     class [[deprecated("Will be reimplemented")]] InputSystem final : public InputSystemInterface, public InputSystemHandlerInterface
     {
@@ -29,16 +38,44 @@ namespace C2D
 
         /*!
          * \brief Default constructor.
-         * \param logicLoopTimeSpan - time span of logic loop that will be used to check input events.
          */
-        InputSystem(/*const TimeSpan& logicLoopTimeSpan*/);
+        InputSystem();
 
         /*!
-         * \brief Handles input events.
+         * \brief Handles input events, called by the window thread.
          * \param inputEvent - SFML event which will be handled by input system.
+         *
+         * Event is queued until the next Update(). If the logic thread stalls and the queue is full,
+         * the event is dropped.
          */
         void HandleInputEvent(const sf::Event& inputEvent) final;
 
+        /*!
+         * \brief Applies events that were received before the call to the input snapshot and evaluates mapped
+         *        actions and axes, called by the logic thread at the beginning of each tick.
+         */
+        void Update();
+
+        /*!
+         * \brief Starts recording of events that are applied by Update(), the previous recording is finished.
+         * \param recorder - recorder that receives events or nullptr to stop the recording.
+         */
+        void SetRecorder(std::unique_ptr<InputRecorder> recorder);
+
+        /*!
+         * \brief Starts replay of the recording, events of the window are ignored until the replay is finished.
+         * \param replay - loaded replay or nullptr to stop the replay.
+         *
+         * Each Update() applies events of the next recorded tick.
+         */
+        void SetReplay(std::unique_ptr<InputReplay> replay);
+
+        /*!
+         * \brief Checks if the replay is active.
+         * \return True if events are replayed. Otherwise - false.
+         */
+        bool IsReplaying() const;
+
         /*!
          * \brief Checks if specified button was pressed.
          * \param keyboardButton - keyboard button which will be checked.
@@ -147,8 +184,8 @@ namespace C2D
          * \brief Sets the joystick threshold.
          * \param newThreshold - New threshold, in the range [0.0f, 100.0f]
          *
-         * The joystick threshold is the value below which no JoystickMoved event will be handled.
-         * The threshold value is 0.1 by default.
+         * The joystick threshold is the value below which axis position is treated as zero
+         * and movement does not mark the joystick as used. The threshold value is 0.1 by default.
          */
         void SetJoystickThreshold(float newThreshold) final;
 
@@ -172,20 +209,29 @@ namespace C2D
          */
         bool _AnyButtonState(ButtonState state) const;
 
-        /*! Const reference to the logic loop time span that is used by input system to check button states. */
-        //const TimeSpan& _logicLoopTimeSpan;
-        /*! Keyboard device which handles keyboard events. */
-        std::unique_ptr<KeyboardDevice> _keyboard;
-        /*! Mouse device which handles mouse events. */
+        /*!
+         * \brief Applies the event to the input snapshot and records it if the recording is active.
+         * \param event - event to apply.
+         */
+        void _ApplyEvent(const InputEvent& event);
+
+        /*! Maximum number of events between two updates, the window thread never waits for the logic thread. */
+        static constexpr size_t eventQueueCapacity = 1024;
+
+        /*! Events that are pushed by the window thread and popped by the logic thread. */
+        SpscQueue<InputEvent, eventQueueCapacity> _events;
+        /*! State of all devices at the end of the last update. */
+        InputSnapshot _snapshot;
+        /*! Mouse device that reads the snapshot. */
         std::unique_ptr<MouseDevice> _mouse;
-        /*! Array of joystick devices that handles joystick events. */
+        /*! Array of joystick devices that read the snapshot. */
         std::vector<std::unique_ptr<JoystickDevice>> _joystick;
-        /*! A time when any joystick was used last time. */
-        //Time _lastTimeJoystickUsed;
-        /*! An id of a joystick which was used last time. */
-        std::atomic<int32_t> _lastJoystickId;
         /*! Joystick threshold that will be used to filter JoystickMoved events by its value. */
-        std::atomic<float> _joysticksThreshold;
+        float _joysticksThreshold;
+        /*! Recorder of applied events, nullptr if the recording is not active. */
+        std::unique_ptr<InputRecorder> _recorder;
+        /*! Replay that substitutes events of the window, nullptr if the replay is not active. */
+        std::unique_ptr<InputReplay> _replay;
         /*! Input map system which stores and handle control of mapped actions and axes. */
         std::unique_ptr<InputMap> _inputMap;
     };
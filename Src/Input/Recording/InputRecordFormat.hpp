@@ -0,0 +1,57 @@
+#pragma once
+#include "Input/Utilities/InputEvent.hpp"
+#include <cstdint>
+
+namespace C2D
+{
+    /*! Magic number of input recordings, "C2DI" in little-endian. */
+    constexpr uint32_t inputRecordMagic = 0x49443243;
+    /*! Version of the format of input recordings. */
+    constexpr uint32_t inputRecordVersion = 1;
+
+    /*!
+     * \brief Header of the input recording file.
+     *
+     * Records follow the header in the order of ticks. Fields are stored in the byte order of the machine,
+     * recordings are meant to be replayed on the same platform.
+     */
+    struct InputRecordHeader
+    {
+        /*! Magic number, must be equal to inputRecordMagic. */
+        uint32_t magic;
+        /*! Version of the format, must be equal to inputRecordVersion. */
+        uint32_t version;
+        /*! Seed of the random generator during the recording. */
+        uint32_t seed;
+        /*! Number of records in the file. */
+        uint32_t recordCount;
+        /*! Number of recorded ticks, including ticks without events. */
+        uint64_t tickCount;
+    };
+
+    /*!
+     * \brief Input event of the recording.
+     *
+     * Timestamps are not stored, events are replayed by the tick index.
+     */
+    struct InputRecord
+    {
+        /*! Index of the tick, counted from the beginning of the recording. */
+        uint32_t tick;
+        /*! Type of the event. */
+        InputEvent::Type type;
+        /*! Id of the joystick for joystick events. */
+        uint8_t joystickId;
+        /*! Button, axis or wheel of the event. */
+        uint16_t code;
+        /*! Position of the axis or delta of the wheel. */
+        float value;
+        /*! X coordinate of the mouse cursor. */
+        int32_t x;
+        /*! Y coordinate of the mouse cursor. */
+        int32_t y;
+    };
+
+    static_assert(sizeof(InputRecordHeader) == 24, "Header must not have padding");
+    static_assert(sizeof(InputRecord) == 20, "Record must not have padding");
+}
@@ -0,0 +1,89 @@
+#include "InputRecorder.hpp"
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    /*! Number of records that are buffered before they are written to the file. */
+    constexpr size_t bufferedRecordCount = 4096;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+InputRecorder::InputRecorder(const std::string& path, const uint32_t seed)
+: _file(path, std::ios::binary | std::ios::trunc)
+, _header{ inputRecordMagic, inputRecordVersion, seed, 0, 0 }
+{
+    _records.reserve(bufferedRecordCount);
+
+    // Header is written in advance to reserve its place, counts are known only at the end
+    _file.write(reinterpret_cast<const char*>(&_header), sizeof(_header));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+InputRecorder::~InputRecorder()
+{
+    if (IsOpen())
+    {
+        _Flush();
+        _file.seekp(0);
+        _file.write(reinterpret_cast<const char*>(&_header), sizeof(_header));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InputRecorder::IsOpen() const
+{
+    return _file.is_open() && _file.good();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputRecorder::Record(const InputEvent& event)
+{
+    _records.push_back(InputRecord
+    {
+        static_cast<uint32_t>(_header.tickCount),
+        event.type,
+        event.joystickId,
+        event.code,
+        event.value,
+        event.x,
+        event.y
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputRecorder::EndTick()
+{
+    ++_header.tickCount;
+
+    if (_records.size() >= bufferedRecordCount)
+    {
+        _Flush();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t InputRecorder::GetTickCount() const
+{
+    return _header.tickCount;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputRecorder::_Flush()
+{
+    _file.write(reinterpret_cast<const char*>(_records.data()),
+                static_cast<std::streamsize>(_records.size() * sizeof(InputRecord)));
+    _header.recordCount += static_cast<uint32_t>(_records.size());
+    _records.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,71 @@
+#pragma once
+#include "Input/Recording/InputRecordFormat.hpp"
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace C2D
+{
+    /*!
+     * \brief Writes input events that are applied by the input system to a compact binary file.
+     *
+     * Events are grouped by logic ticks, so the recording can be replayed frame-exactly by InputReplay.
+     * The file is completed when the recorder is destroyed.
+     */
+    class InputRecorder final
+    {
+    public:
+        InputRecorder(const InputRecorder& other) = delete;
+        InputRecorder(InputRecorder&& other) = delete;
+        InputRecorder& operator=(const InputRecorder& other) = delete;
+        InputRecorder& operator=(InputRecorder&& other) = delete;
+
+        /*!
+         * \brief Default constructor that creates the recording file.
+         * \param path - path to the file, existing file is overwritten.
+         * \param seed - seed of the random generator that should be set on replay.
+         */
+        InputRecorder(const std::string& path, uint32_t seed);
+
+        /*!
+         * \brief Writes remaining events and the final header.
+         */
+        ~InputRecorder();
+
+        /*!
+         * \brief Checks if the file was created.
+         * \return True if events can be recorded. Otherwise - false.
+         */
+        bool IsOpen() const;
+
+        /*!
+         * \brief Records the event of the current tick.
+         * \param event - event that was applied to the input snapshot.
+         */
+        void Record(const InputEvent& event);
+
+        /*!
+         * \brief Finishes the current tick, next events belong to the next tick.
+         */
+        void EndTick();
+
+        /*!
+         * \brief Returns number of finished ticks.
+         * \return Number of ticks.
+         */
+        uint64_t GetTickCount() const;
+
+    private:
+        /*!
+         * \brief Writes buffered records to the file.
+         */
+        void _Flush();
+
+        /*! Recording file. */
+        std::ofstream _file;
+        /*! Records that are not written yet. */
+        std::vector<InputRecord> _records;
+        /*! Header that is rewritten when the recording is finished. */
+        InputRecordHeader _header;
+    };
+}
@@ -0,0 +1,156 @@
+#include "InputReplay.hpp"
+#include "Input/Utilities/InputSnapshot.hpp"
+#include <algorithm>
+#include <fstream>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    /*!
+     * \brief Checks that the record can be applied to the input snapshot, which indexes its arrays by the codes.
+     * \param record - record to check.
+     * \return True if type, joystick id and code of the record are in range. Otherwise - false.
+     */
+    bool IsValid(const InputRecord& record)
+    {
+        switch (record.type)
+        {
+        case InputEvent::Type::KeyPressed:
+        case InputEvent::Type::KeyReleased:
+            return record.code < InputSnapshot::keyboardButtonCount;
+        case InputEvent::Type::MouseButtonPressed:
+        case InputEvent::Type::MouseButtonReleased:
+            return record.code < InputSnapshot::mouseButtonCount;
+        case InputEvent::Type::MouseMoved:
+            return true;
+        case InputEvent::Type::MouseWheelScrolled:
+            return record.code <= sf::Mouse::Wheel::HorizontalWheel;
+        case InputEvent::Type::JoystickConnected:
+        case InputEvent::Type::JoystickDisconnected:
+            return record.joystickId < InputSnapshot::joystickCount;
+        case InputEvent::Type::JoystickButtonPressed:
+        case InputEvent::Type::JoystickButtonReleased:
+            return record.joystickId < InputSnapshot::joystickCount &&
+                   record.code < InputSnapshot::joystickButtonCount;
+        case InputEvent::Type::JoystickMoved:
+            return record.joystickId < InputSnapshot::joystickCount &&
+                   record.code < InputSnapshot::joystickAxisCount;
+        }
+
+        // Type is read from the file, so it may be none of the known ones
+        return false;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InputReplay::Load(const std::string& path)
+{
+    _events.clear();
+    _eventTicks.clear();
+    _nextEvent = 0;
+    _tick = 0;
+    _tickCount = 0;
+    _seed = 0;
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    const auto fileSize = static_cast<uint64_t>(std::max<std::streamoff>(file.tellg(), 0));
+    file.seekg(0);
+
+    // Sizes are checked before the allocation, so a damaged header can not request too much memory
+    InputRecordHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != inputRecordMagic ||
+        header.version != inputRecordVersion ||
+        fileSize != sizeof(header) + uint64_t(header.recordCount) * sizeof(InputRecord))
+    {
+        return false;
+    }
+
+    std::vector<InputRecord> records(header.recordCount);
+    if (!file.read(reinterpret_cast<char*>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(InputRecord))))
+    {
+        return false;
+    }
+
+    // Records must be ordered by ticks, otherwise some of them would never be replayed
+    const auto isOrdered = std::is_sorted(records.begin(), records.end(), [](const auto& left, const auto& right)
+    {
+        return left.tick < right.tick;
+    });
+    if (!isOrdered || (!records.empty() && records.back().tick >= header.tickCount))
+    {
+        return false;
+    }
+
+    // Damaged records would index the arrays of the input snapshot out of range
+    if (!std::all_of(records.begin(), records.end(), IsValid))
+    {
+        return false;
+    }
+
+    // Records are converted back to events once, so the replay only returns views of them
+    _events.reserve(records.size());
+    _eventTicks.reserve(records.size());
+    for (const auto& record : records)
+    {
+        auto& event = _events.emplace_back();
+        event.type = record.type;
+        event.joystickId = record.joystickId;
+        event.code = record.code;
+        event.value = record.value;
+        event.x = record.x;
+        event.y = record.y;
+        _eventTicks.push_back(record.tick);
+    }
+    _tickCount = header.tickCount;
+    _seed = header.seed;
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::span<const InputEvent> InputReplay::NextTick()
+{
+    if (IsFinished())
+    {
+        return {};
+    }
+
+    const auto first = _nextEvent;
+    while (_nextEvent < _eventTicks.size() && _eventTicks[_nextEvent] == _tick)
+    {
+        ++_nextEvent;
+    }
+    ++_tick;
+
+    return std::span<const InputEvent>(_events.data() + first, _nextEvent - first);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InputReplay::IsFinished() const
+{
+    return _tick >= _tickCount;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t InputReplay::GetSeed() const
+{
+    return _seed;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t InputReplay::GetTickCount() const
+{
+    return _tickCount;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,71 @@
+#pragma once
+#include "Input/Recording/InputRecordFormat.hpp"
+#include <span>
+#include <string>
+#include <vector>
+
+namespace C2D
+{
+    /*!
+     * \brief Source of input events that replays a recording of InputRecorder instead of the window.
+     *
+     * Events are returned tick by tick, so a replay with the seed of the recording set to the random generator
+     * reproduces the recorded session frame-exactly, also without a window.
+     */
+    class InputReplay final
+    {
+    public:
+        InputReplay(const InputReplay& other) = delete;
+        InputReplay(InputReplay&& other) = delete;
+        InputReplay& operator=(const InputReplay& other) = delete;
+        InputReplay& operator=(InputReplay&& other) = delete;
+        InputReplay() = default;
+        ~InputReplay() = default;
+
+        /*!
+         * \brief Loads the recording and rewinds the replay to the first tick.
+         * \param path - path to the recording file.
+         * \return True if the recording was loaded. False if the file can not be read or is not a recording
+         *         of the supported version or has events out of range, then the replay is empty.
+         */
+        bool Load(const std::string& path);
+
+        /*!
+         * \brief Returns events of the next tick and advances the replay.
+         * \return Events of the tick, empty if there were no events or the replay is finished.
+         */
+        std::span<const InputEvent> NextTick();
+
+        /*!
+         * \brief Checks if all recorded ticks were replayed.
+         * \return True if the replay is finished. Otherwise - false.
+         */
+        bool IsFinished() const;
+
+        /*!
+         * \brief Returns seed of the random generator during the recording.
+         * \return Seed of the random generator.
+         */
+        uint32_t GetSeed() const;
+
+        /*!
+         * \brief Returns number of recorded ticks.
+         * \return Number of ticks.
+         */
+        uint64_t GetTickCount() const;
+
+    private:
+        /*! Events of all ticks in the order of ticks. */
+        std::vector<InputEvent> _events;
+        /*! Tick of each event. */
+        std::vector<uint32_t> _eventTicks;
+        /*! Index of the first event that was not replayed yet. */
+        size_t _nextEvent = 0;
+        /*! Index of the next tick. */
+        uint64_t _tick = 0;
+        /*! Number of recorded ticks. */
+        uint64_t _tickCount = 0;
+        /*! Seed of the random generator during the recording. */
+        uint32_t _seed = 0;
+    };
+}
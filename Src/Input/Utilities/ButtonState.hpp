@@ -0,0 +1,15 @@
+#pragma once
+
+namespace C2D
+{
+    /*!
+     * \brief Simple enumeration to enumerate all possible button states.
+     */
+    enum class ButtonState
+    {
+        NotTouched, /*!< Button was not touched. */
+        Pressed,    /*!< Button was pressed.     */
+        HeldDown,   /*!< Button was held down.   */
+        Released    /*!< Button was released.    */
+    };
+}
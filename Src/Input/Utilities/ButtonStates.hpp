@@ -0,0 +1,134 @@
+#pragma once
+#include "Input/Utilities/ButtonState.hpp"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace C2D
+{
+    /*!
+     * \brief Fixed set of button bits packed into 64-bit words.
+     * \tparam Size - number of buttons.
+     */
+    template <size_t Size>
+    class ButtonBitset final
+    {
+    public:
+        /*! Number of 64-bit words that store the bits. */
+        static constexpr size_t wordCount = (Size + 63) / 64;
+
+        /*!
+         * \brief Checks the bit of the button.
+         * \param index - index of the button, must be less than Size.
+         * \return True if the bit is set. Otherwise - false.
+         */
+        bool Test(size_t index) const;
+
+        /*!
+         * \brief Sets or clears the bit of the button.
+         * \param index - index of the button, must be less than Size.
+         * \param value - new value of the bit.
+         */
+        void Set(size_t index, bool value);
+
+        /*!
+         * \brief Clears all bits.
+         */
+        void Clear();
+
+        /*!
+         * \brief Checks if any bit is set.
+         * \return True if at least one bit is set. Otherwise - false.
+         */
+        bool Any() const;
+
+        /*!
+         * \brief Counts set bits.
+         * \return Number of set bits.
+         */
+        size_t Count() const;
+
+        /*!
+         * \brief Returns the word that contains the bit of the button.
+         * \param index - index of the button, must be less than Size.
+         * \return Word with the bit.
+         */
+        uint64_t Word(size_t index) const;
+
+        /*!
+         * \brief Returns all words.
+         * \return Reference to the words.
+         */
+        const std::array<uint64_t, wordCount>& Words() const;
+
+    private:
+        /*! Bits of buttons, bit i of the set is bit (i % 64) of the word (i / 64). */
+        std::array<uint64_t, wordCount> _words{};
+    };
+
+    /*!
+     * \brief States of a group of buttons during one logic tick.
+     * \tparam Size - number of buttons.
+     *
+     * Current and previous bits are the states at the end of this and the previous tick. Transitions that happened
+     * during the tick are kept separately, so a button that was pressed and released within one tick is still
+     * reported as pressed and released.
+     */
+    template <size_t Size>
+    class ButtonStates final
+    {
+    public:
+        /*!
+         * \brief Starts a new tick, current state becomes the previous one and transitions are cleared.
+         */
+        void BeginTick();
+
+        /*!
+         * \brief Marks the button as pressed.
+         * \param index - index of the button.
+         */
+        void Press(size_t index);
+
+        /*!
+         * \brief Marks the button as released.
+         * \param index - index of the button.
+         */
+        void Release(size_t index);
+
+        /*!
+         * \brief Checks if the button is in specified state.
+         * \param index - index of the button.
+         * \param state - state to check.
+         * \return True if the button is in specified state. Otherwise - false.
+         */
+        bool Is(size_t index, ButtonState state) const;
+
+        /*!
+         * \brief Checks if any button is in specified state.
+         * \param state - state to check.
+         * \return True if at least one button is in specified state. Otherwise - false.
+         */
+        bool Any(ButtonState state) const;
+
+        /*!
+         * \brief Checks if the button is down at the end of the tick.
+         * \param index - index of the button.
+         * \return True if the button is down. Otherwise - false.
+         */
+        bool IsDown(size_t index) const;
+
+    private:
+        /*! Buttons that are down at the end of the tick. */
+        ButtonBitset<Size> _current;
+        /*! Buttons that were down at the end of the previous tick. */
+        ButtonBitset<Size> _previous;
+        /*! Buttons that were pressed during the tick. */
+        ButtonBitset<Size> _pressed;
+        /*! Buttons that were released during the tick. */
+        ButtonBitset<Size> _released;
+    };
+
+#include "ButtonStates.inl"
+
+}
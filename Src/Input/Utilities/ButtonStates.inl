@@ -0,0 +1,159 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+bool ButtonBitset<Size>::Test(const size_t index) const
+{
+    return (_words[index / 64] >> (index % 64)) & 1u;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+void ButtonBitset<Size>::Set(const size_t index, const bool value)
+{
+    const auto mask = uint64_t(1) << (index % 64);
+    auto& word = _words[index / 64];
+    word = (word & ~mask) | ((uint64_t(0) - value) & mask);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+void ButtonBitset<Size>::Clear()
+{
+    _words.fill(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+bool ButtonBitset<Size>::Any() const
+{
+    uint64_t bits(0);
+    for (const auto word : _words)
+    {
+        bits |= word;
+    }
+
+    return bits != 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+size_t ButtonBitset<Size>::Count() const
+{
+    size_t count(0);
+    for (const auto word : _words)
+    {
+        count += std::popcount(word);
+    }
+
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+uint64_t ButtonBitset<Size>::Word(const size_t index) const
+{
+    return _words[index / 64];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+const std::array<uint64_t, ButtonBitset<Size>::wordCount>& ButtonBitset<Size>::Words() const
+{
+    return _words;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+void ButtonStates<Size>::BeginTick()
+{
+    _previous = _current;
+    _pressed.Clear();
+    _released.Clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+void ButtonStates<Size>::Press(const size_t index)
+{
+    // Key repeat sends presses of the button that is already down, they are not new presses
+    _pressed.Set(index, _pressed.Test(index) || !_current.Test(index));
+    _current.Set(index, true);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+void ButtonStates<Size>::Release(const size_t index)
+{
+    _released.Set(index, _released.Test(index) || _current.Test(index));
+    _current.Set(index, false);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+bool ButtonStates<Size>::Is(const size_t index, const ButtonState state) const
+{
+    const auto bit = index % 64;
+
+    switch (state)
+    {
+    case ButtonState::Pressed:
+        return (_pressed.Word(index) >> bit) & 1u;
+    case ButtonState::HeldDown:
+        return ((_current.Word(index) & _previous.Word(index)) >> bit) & 1u;
+    case ButtonState::Released:
+        return (_released.Word(index) >> bit) & 1u;
+    default:
+        return !(((_current.Word(index) | _previous.Word(index) | _released.Word(index)) >> bit) & 1u);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+bool ButtonStates<Size>::Any(const ButtonState state) const
+{
+    uint64_t bits(0);
+    size_t count(0);
+
+    switch (state)
+    {
+    case ButtonState::Pressed:
+        return _pressed.Any();
+    case ButtonState::HeldDown:
+        for (size_t i = 0; i < ButtonBitset<Size>::wordCount; ++i)
+        {
+            bits |= _current.Words()[i] & _previous.Words()[i];
+        }
+        return bits != 0;
+    case ButtonState::Released:
+        return _released.Any();
+    default:
+        for (size_t i = 0; i < ButtonBitset<Size>::wordCount; ++i)
+        {
+            count += std::popcount(_current.Words()[i] | _previous.Words()[i] | _released.Words()[i]);
+        }
+        return count < Size;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <size_t Size>
+bool ButtonStates<Size>::IsDown(const size_t index) const
+{
+    return _current.Test(index);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,45 @@
+#pragma once
+#include "Utility/Time/EngineClock.hpp"
+#include <cstdint>
+
+namespace C2D
+{
+    /*!
+     * \brief Compact input event that is passed from the window thread to the logic thread.
+     */
+    struct InputEvent
+    {
+        /*!
+         * \brief Type of the input event.
+         */
+        enum class Type : uint8_t
+        {
+            KeyPressed,             /*!< Keyboard button was pressed, code is the button.       */
+            KeyReleased,            /*!< Keyboard button was released, code is the button.      */
+            MouseButtonPressed,     /*!< Mouse button was pressed, code is the button.          */
+            MouseButtonReleased,    /*!< Mouse button was released, code is the button.         */
+            MouseMoved,             /*!< Mouse cursor was moved to x and y.                     */
+            MouseWheelScrolled,     /*!< Mouse wheel was scrolled, code is the wheel.           */
+            JoystickConnected,      /*!< Joystick was connected.                                */
+            JoystickDisconnected,   /*!< Joystick was disconnected.                             */
+            JoystickButtonPressed,  /*!< Joystick button was pressed, code is the button.       */
+            JoystickButtonReleased, /*!< Joystick button was released, code is the button.      */
+            JoystickMoved           /*!< Joystick axis was moved, code is the axis.             */
+        };
+
+        /*! Time when the event was received by the window thread. */
+        EngineTimePoint timestamp;
+        /*! Type of the event. */
+        Type type;
+        /*! Id of the joystick for joystick events. */
+        uint8_t joystickId;
+        /*! Button, axis or wheel of the event. */
+        uint16_t code;
+        /*! Position of the axis or delta of the wheel. */
+        float value;
+        /*! X coordinate of the mouse cursor. */
+        int32_t x;
+        /*! Y coordinate of the mouse cursor. */
+        int32_t y;
+    };
+}
@@ -0,0 +1,162 @@
+#include "InputSnapshot.hpp"
+#include <cmath>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+InputSnapshot::InputSnapshot()
+: _axes{}
+, _isJoystickConnected{}
+, _lastJoystickUsed(-1)
+, _verticalWheelDiff(0.0f)
+, _horizontalWheelDiff(0.0f)
+, _mouseX(0)
+, _mouseY(0)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputSnapshot::BeginTick()
+{
+    _buttons.BeginTick();
+    _joystickButtons.BeginTick();
+    _lastJoystickUsed = -1;
+    _verticalWheelDiff = 0.0f;
+    _horizontalWheelDiff = 0.0f;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputSnapshot::Apply(const InputEvent& event, const float joystickThreshold)
+{
+    switch (event.type)
+    {
+    case InputEvent::Type::KeyPressed:
+        _buttons.Press(event.code);
+        break;
+    case InputEvent::Type::KeyReleased:
+        _buttons.Release(event.code);
+        break;
+    case InputEvent::Type::MouseButtonPressed:
+        _buttons.Press(keyboardButtonCount + event.code);
+        break;
+    case InputEvent::Type::MouseButtonReleased:
+        _buttons.Release(keyboardButtonCount + event.code);
+        break;
+    case InputEvent::Type::MouseMoved:
+        _mouseX = event.x;
+        _mouseY = event.y;
+        break;
+    case InputEvent::Type::MouseWheelScrolled:
+        // Deltas of all scrolls during the tick are accumulated, so fast scrolling is not lost
+        if (event.code == sf::Mouse::Wheel::VerticalWheel)
+        {
+            _verticalWheelDiff += event.value;
+        }
+        else
+        {
+            _horizontalWheelDiff += event.value;
+        }
+        break;
+    case InputEvent::Type::JoystickConnected:
+        _isJoystickConnected[event.joystickId] = true;
+        break;
+    case InputEvent::Type::JoystickDisconnected:
+        _isJoystickConnected[event.joystickId] = false;
+        break;
+    case InputEvent::Type::JoystickButtonPressed:
+        _joystickButtons.Press(event.joystickId * joystickButtonCount + event.code);
+        _UseJoystick(event.joystickId);
+        break;
+    case InputEvent::Type::JoystickButtonReleased:
+        _joystickButtons.Release(event.joystickId * joystickButtonCount + event.code);
+        _UseJoystick(event.joystickId);
+        break;
+    case InputEvent::Type::JoystickMoved:
+        // Small positions are noise of the stick, they do not mean that the joystick is used
+        if (std::abs(event.value) >= joystickThreshold)
+        {
+            _axes[event.joystickId][event.code] = event.value / 100.0f;
+            _UseJoystick(event.joystickId);
+        }
+        else
+        {
+            _axes[event.joystickId][event.code] = 0.0f;
+        }
+        break;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const InputSnapshot::Buttons& InputSnapshot::GetButtons() const
+{
+    return _buttons;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const InputSnapshot::JoystickButtons& InputSnapshot::GetJoystickButtons() const
+{
+    return _joystickButtons;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+float InputSnapshot::GetAxisPosition(const uint32_t joystickId, const JoystickAxis axis) const
+{
+    return _axes[joystickId][static_cast<size_t>(axis)];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InputSnapshot::IsJoystickConnected(const uint32_t joystickId) const
+{
+    return _isJoystickConnected[joystickId];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int32_t InputSnapshot::GetLastJoystickUsed() const
+{
+    return _lastJoystickUsed;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+float InputSnapshot::GetVerticalWheelDiff() const
+{
+    return _verticalWheelDiff;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+float InputSnapshot::GetHorizontalWheelDiff() const
+{
+    return _horizontalWheelDiff;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int InputSnapshot::GetMouseX() const
+{
+    return _mouseX;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int InputSnapshot::GetMouseY() const
+{
+    return _mouseY;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputSnapshot::_UseJoystick(const uint32_t joystickId)
+{
+    _isJoystickConnected[joystickId] = true;
+    _lastJoystickUsed = static_cast<int32_t>(joystickId);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,164 @@
+#pragma once
+#include "Input/Utilities/ButtonStates.hpp"
+#include "Input/Utilities/InputEvent.hpp"
+#include "Input/Utilities/Buttons/KeyboardButtons.hpp"
+#include "Input/Utilities/Buttons/MouseButtons.hpp"
+#include "Input/Utilities/Buttons/JoystickButtons.hpp"
+#include "Input/Utilities/Buttons/JoystickAxes.hpp"
+#include <SFML/Window/Joystick.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <array>
+
+namespace C2D
+{
+    /*!
+     * \brief State of all input devices at the end of a logic tick.
+     *
+     * Snapshot is owned by the logic thread, input events are folded into it once per tick,
+     * so it is read without any synchronization.
+     */
+    class InputSnapshot final
+    {
+    public:
+        /*! Number of keyboard buttons. */
+        static constexpr size_t keyboardButtonCount = sf::Keyboard::KeyCount;
+        /*! Number of mouse buttons. */
+        static constexpr size_t mouseButtonCount = sf::Mouse::ButtonCount;
+        /*! Number of keyboard and mouse buttons, mouse buttons follow keyboard ones. */
+        static constexpr size_t buttonCount = keyboardButtonCount + mouseButtonCount;
+        /*! Maximum number of joysticks. */
+        static constexpr size_t joystickCount = sf::Joystick::Count;
+        /*! Number of buttons of a single joystick. */
+        static constexpr size_t joystickButtonCount = sf::Joystick::ButtonCount;
+        /*! Number of axes of a single joystick. */
+        static constexpr size_t joystickAxisCount = sf::Joystick::AxisCount;
+
+        /*! States of keyboard and mouse buttons. */
+        using Buttons = ButtonStates<buttonCount>;
+        /*! States of buttons of all joysticks, buttons of joystick i start at i * joystickButtonCount. */
+        using JoystickButtons = ButtonStates<joystickCount * joystickButtonCount>;
+
+        InputSnapshot();
+
+        /*!
+         * \brief Starts a new tick, transitions and wheel deltas of the previous tick are cleared.
+         */
+        void BeginTick();
+
+        /*!
+         * \brief Applies input event to the snapshot.
+         * \param event - event to apply.
+         * \param joystickThreshold - absolute axis position below which the axis is treated as centered.
+         */
+        void Apply(const InputEvent& event, float joystickThreshold);
+
+        /*!
+         * \brief Returns states of keyboard and mouse buttons.
+         * \return Reference to the button states.
+         */
+        const Buttons& GetButtons() const;
+
+        /*!
+         * \brief Returns states of joystick buttons.
+         * \return Reference to the joystick button states.
+         */
+        const JoystickButtons& GetJoystickButtons() const;
+
+        /*!
+         * \brief Returns position of the joystick axis.
+         * \param joystickId - id of the joystick.
+         * \param axis - axis of the joystick.
+         * \return Position of the axis.
+         */
+        float GetAxisPosition(uint32_t joystickId, JoystickAxis axis) const;
+
+        /*!
+         * \brief Checks if the joystick is connected.
+         * \param joystickId - id of the joystick.
+         * \return True if joystick is connected. Otherwise - false.
+         */
+        bool IsJoystickConnected(uint32_t joystickId) const;
+
+        /*!
+         * \brief Returns id of the joystick which was used last during the tick.
+         * \return Id of the joystick or -1 if no joystick was used during the tick.
+         */
+        int32_t GetLastJoystickUsed() const;
+
+        /*!
+         * \brief Returns sum of vertical wheel deltas during the tick.
+         * \return Vertical wheel offset (positive is up, negative is down).
+         */
+        float GetVerticalWheelDiff() const;
+
+        /*!
+         * \brief Returns sum of horizontal wheel deltas during the tick.
+         * \return Horizontal wheel offset (positive is left, negative is right).
+         */
+        float GetHorizontalWheelDiff() const;
+
+        /*!
+         * \brief Returns x coordinate of the mouse cursor relative to the top left corner of the window.
+         * \return X coordinate of the mouse cursor.
+         */
+        int GetMouseX() const;
+
+        /*!
+         * \brief Returns y coordinate of the mouse cursor relative to the top left corner of the window.
+         * \return Y coordinate of the mouse cursor.
+         */
+        int GetMouseY() const;
+
+        /*!
+         * \brief Returns index of the keyboard button in the button states.
+         * \param keyboardButton - keyboard button.
+         * \return Index of the button.
+         */
+        static constexpr size_t ButtonIndex(KeyboardButton keyboardButton);
+
+        /*!
+         * \brief Returns index of the mouse button in the button states.
+         * \param mouseButton - mouse button.
+         * \return Index of the button.
+         */
+        static constexpr size_t ButtonIndex(MouseButton mouseButton);
+
+        /*!
+         * \brief Returns index of the joystick button in the joystick button states.
+         * \param joystickId - id of the joystick, must be less than joystickCount.
+         * \param joystickButton - joystick button.
+         * \return Index of the button.
+         */
+        static constexpr size_t ButtonIndex(uint32_t joystickId, JoystickButton joystickButton);
+
+    private:
+        /*!
+         * \brief Marks the joystick as connected and used during the tick.
+         * \param joystickId - id of the joystick.
+         */
+        void _UseJoystick(uint32_t joystickId);
+
+        /*! States of keyboard and mouse buttons. */
+        Buttons _buttons;
+        /*! States of joystick buttons. */
+        JoystickButtons _joystickButtons;
+        /*! Axes positions of all joysticks. */
+        std::array<std::array<float, joystickAxisCount>, joystickCount> _axes;
+        /*! Connection states of all joysticks. */
+        std::array<bool, joystickCount> _isJoystickConnected;
+        /*! Id of the joystick which was used last during the tick, -1 if none. */
+        int32_t _lastJoystickUsed;
+        /*! Sum of vertical wheel deltas during the tick. */
+        float _verticalWheelDiff;
+        /*! Sum of horizontal wheel deltas during the tick. */
+        float _horizontalWheelDiff;
+        /*! X coordinate of the mouse cursor. */
+        int _mouseX;
+        /*! Y coordinate of the mouse cursor. */
+        int _mouseY;
+    };
+
+#include "InputSnapshot.inl"
+
+}
@@ -1,24 +1,24 @@
-#include "AnyCallableHandler.hpp"
-
-using namespace C2D;
+#pragma once
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-AnyCallableHandler::AnyCallableHandler() noexcept : _firstHandler(0), _secondHandler(nullptr)
-{ }
+constexpr size_t InputSnapshot::ButtonIndex(const KeyboardButton keyboardButton)
+{
+    return static_cast<size_t>(keyboardButton);
+}
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-bool AnyCallableHandler::operator==(const AnyCallableHandler& other) const
+constexpr size_t InputSnapshot::ButtonIndex(const MouseButton mouseButton)
 {
-    return (_firstHandler == other._firstHandler) && (_secondHandler == other._secondHandler);
+    return keyboardButtonCount + static_cast<size_t>(mouseButton);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-bool AnyCallableHandler::IsHandling() const
+constexpr size_t InputSnapshot::ButtonIndex(const uint32_t joystickId, const JoystickButton joystickButton)
 {
-    return (_firstHandler != 0);
+    return joystickId * joystickButtonCount + static_cast<size_t>(joystickButton);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 #include "InputAction.hpp"
-#include "Input/Utilities/ButtonStateHandler.hpp"
-#include "Input/InputSystemInterface.hpp"
+#include "Input/Utilities/ButtonState.hpp"
+#include "Input/Utilities/InputSnapshot.hpp"
 
 using namespace C2D;
 
@@ -81,9 +81,12 @@ void ActionButton::SetButton(const JoystickButton joystickButton)
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 InputAction::InputAction()
-: _requiredState(ButtonState::Pressed)
+: _requiredState(ButtonState::NotTouched)
 , _button(KeyboardButton::Escape)
 , _joystickId(-1)
+, _index(0)
+, _isJoystickButton(false)
+, _isValid(false)
 { }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -92,7 +95,12 @@ InputAction::InputAction(const ButtonState state, const int joystickId, const Ac
 : _requiredState(state)
 , _button(actionButton)
 , _joystickId(joystickId)
-{ }
+, _index(0)
+, _isJoystickButton(false)
+, _isValid(false)
+{
+    _Compile();
+}
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -105,27 +113,15 @@ bool InputAction::operator==(const InputAction& other) const
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-bool InputAction::IsActive(const InputSystemInterface& inputSystem) const
+bool InputAction::IsActive(const InputSnapshot& snapshot) const
 {
-    bool isActive(false);
-
-    switch (_requiredState)
+    if (!_isValid)
     {
-    case ButtonState::Pressed:
-        isActive = _IsButtonPressed(inputSystem);
-        break;
-    case ButtonState::HeldDown:
-        isActive = _IsButtonHeldDown(inputSystem);
-        break;
-    case ButtonState::Released:
-        isActive = _IsButtonReleased(inputSystem);
-        break;
-    default:
-        // Unexpected state
-        break;
+        return false;
     }
 
-    return isActive;
+    return _isJoystickButton ? snapshot.GetJoystickButtons().Is(_index, _requiredState)
+                             : snapshot.GetButtons().Is(_index, _requiredState);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,6 +129,7 @@ bool InputAction::IsActive(const InputSystemInterface& inputSystem) const
 void InputAction::SetRequiredState(const ButtonState state)
 {
     _requiredState = state;
+    _Compile();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -141,72 +138,34 @@ void InputAction::SetRequriedButton(const int joystickId, const ActionButton& ac
 {
     _button = actionButton;
     _joystickId = joystickId;
+    _Compile();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-bool InputAction::_IsButtonPressed(const InputSystemInterface& inputSystem) const
+void InputAction::_Compile()
 {
-    bool isPressed(false);
-
-    switch (_button.type)
-    {
-    case InputType::Keyboard:
-        isPressed = inputSystem.ButtonPressed(_button.buttonUnion.keyboardButton);
-        break;
-    case InputType::Mouse:
-        isPressed = inputSystem.ButtonPressed(_button.buttonUnion.mouseButton);
-        break;
-    case InputType::Joystick:
-        isPressed = inputSystem.ButtonPressed(_joystickId, _button.buttonUnion.joystickButton);
-        break;
-    }
-
-    return isPressed;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-bool InputAction::_IsButtonHeldDown(const InputSystemInterface& inputSystem) const
-{
-    bool isHelDown(false);
-
-    switch (_button.type)
-    {
-    case InputType::Keyboard:
-        isHelDown = inputSystem.ButtonHeldDown(_button.buttonUnion.keyboardButton);
-        break;
-    case InputType::Mouse:
-        isHelDown = inputSystem.ButtonHeldDown(_button.buttonUnion.mouseButton);
-        break;
-    case InputType::Joystick:
-        isHelDown = inputSystem.ButtonHeldDown(_joystickId, _button.buttonUnion.joystickButton);
-        break;
-    }
-
-    return isHelDown;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-bool InputAction::_IsButtonReleased(const InputSystemInterface& inputSystem) const
-{
-    bool isReleased(false);
-
     switch (_button.type)
     {
     case InputType::Keyboard:
-        isReleased = inputSystem.ButtonReleased(_button.buttonUnion.keyboardButton);
+        _index = InputSnapshot::ButtonIndex(_button.buttonUnion.keyboardButton);
+        _isJoystickButton = false;
+        _isValid = true;
         break;
     case InputType::Mouse:
-        isReleased = inputSystem.ButtonReleased(_button.buttonUnion.mouseButton);
+        _index = InputSnapshot::ButtonIndex(_button.buttonUnion.mouseButton);
+        _isJoystickButton = false;
+        _isValid = true;
         break;
     case InputType::Joystick:
-        isReleased = inputSystem.ButtonReleased(_joystickId, _button.buttonUnion.joystickButton);
+        _isValid = (0 <= _joystickId) && (static_cast<size_t>(_joystickId) < InputSnapshot::joystickCount);
+        _index = _isValid ? InputSnapshot::ButtonIndex(_joystickId, _button.buttonUnion.joystickButton) : 0;
+        _isJoystickButton = true;
         break;
     }
 
-    return isReleased;
+    // Untouched button is not an action
+    _isValid = _isValid && (_requiredState != ButtonState::NotTouched);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 
 namespace C2D
 {
@@ -6,7 +7,7 @@ namespace C2D
     enum class KeyboardButton;
     enum class MouseButton;
     enum class JoystickButton;
-    class InputSystemInterface;
+    class InputSnapshot;
 
     /*!
      * \brief Simple enumeration of input types.
@@ -113,7 +114,7 @@ namespace C2D
     {
     public:
         /*!
-         * \brief Default constructor.
+         * \brief Default constructor that creates action which is never active.
          */
         InputAction();
 
@@ -133,10 +134,10 @@ namespace C2D
 
         /*!
          * \brief Check if input action is currently active.
-         * \param inputSystem - reference to the input system from which action will be checked.
+         * \param snapshot - input snapshot from which action will be checked.
          * \return True if specified button is in required state. Otherwise - false.
          */
-        bool IsActive(const InputSystemInterface& inputSystem) const;
+        bool IsActive(const InputSnapshot& snapshot) const;
 
         /*!
          * \brief Sets required button state to specified one.
@@ -154,25 +155,9 @@ namespace C2D
                 
     private:
         /*!
-         * \brief Checks if stored button was pressed during the frame.
-         * \param inputSystem - reference to the input system from which button will be checked.
-         * \return True if stored button was pressed.
+         * \brief Computes index of the button in the snapshot, so the check does not depend on the input type.
          */
-        bool _IsButtonPressed(const InputSystemInterface& inputSystem) const;
-
-        /*!
-         * \brief Checks if stored button was held down during the frame.
-         * \param inputSystem - reference to the input system from which button will be checked.
-         * \return True if stored button was held down.
-         */
-        bool _IsButtonHeldDown(const InputSystemInterface& inputSystem) const;
-
-        /*!
-         * \brief Checks if stored button was released during the frame.
-         * \param inputSystem - reference to the input system from which button will be checked.
-         * \return True if stored button was released.
-         */
-        bool _IsButtonReleased(const InputSystemInterface& inputSystem) const;
+        void _Compile();
 
         /*! Required state of button. */
         ButtonState _requiredState;
@@ -180,5 +165,11 @@ namespace C2D
         ActionButton _button;
         /*! Joystick id that will be used if button specified for joystick device. */
         int _joystickId;
+        /*! Index of the button in the button states of the snapshot. */
+        size_t _index;
+        /*! Flag that defines if the button is a joystick button. */
+        bool _isJoystickButton;
+        /*! Flag that defines if the button can be checked, e.g. joystick id is valid. */
+        bool _isValid;
     };
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 #include "InputAxis.hpp"
-#include "Input/InputSystemInterface.hpp"
+#include "Input/Utilities/InputSnapshot.hpp"
 
 using namespace C2D;
 
@@ -8,7 +8,9 @@ using namespace C2D;
 InputAxis::InputAxis()
 : _axisType(AxisType::Axis)
 , _joystickAxis(JoystickAxis::PovX)
-, _joystickId(0)
+, _joystickId(-1)
+, _negativeAction(0)
+, _positiveAction(0)
 { }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -17,11 +19,13 @@ InputAxis::InputAxis(const int joystickId, const JoystickAxis axis)
 : _axisType(AxisType::Axis)
 , _joystickAxis(axis)
 , _joystickId(joystickId)
+, _negativeAction(0)
+, _positiveAction(0)
 { }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-InputAxis::InputAxis(std::string&& negativeAction, std::string&& positiveAction)
+InputAxis::InputAxis(const ActionId negativeAction, const ActionId positiveAction)
 : _axisType(AxisType::Buttons)
 , _joystickAxis()
 , _joystickId(-1)
@@ -49,22 +53,25 @@ bool InputAxis::operator==(const InputAxis& other) const
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-float InputAxis::GetPosition(const InputSystemInterface& inputSystem) const
+float InputAxis::GetPosition(const InputSnapshot& snapshot, const InputMapInterface& inputMap) const
 {
     float position(0.0f);
 
     if (_axisType == AxisType::Axis)
     {
-        position = inputSystem.Joystick(_joystickId).JoystickAxisPosition(_joystickAxis);
+        if ((0 <= _joystickId) && (static_cast<size_t>(_joystickId) < InputSnapshot::joystickCount))
+        {
+            position = snapshot.GetAxisPosition(_joystickId, _joystickAxis);
+        }
     }
     else
     {
-        if (inputSystem.Map().IsActionActive(_negativeAction))
+        if (inputMap.IsActionActive(_negativeAction))
         {
             position -= 1.0f;
         }
-        
-        if (inputSystem.Map().IsActionActive(_positiveAction))
+
+        if (inputMap.IsActionActive(_positiveAction))
         {
             position += 1.0f;
         }
@@ -80,13 +87,11 @@ void InputAxis::SetAxis(const int joystickId, const JoystickAxis& axis)
     _axisType = AxisType::Axis;
     _joystickId = joystickId;
     _joystickAxis = axis;
-    _negativeAction.clear();
-    _positiveAction.clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void InputAxis::SetAxis(const std::string& negativeAction, const std::string& positiveAction)
+void InputAxis::SetAxis(const ActionId negativeAction, const ActionId positiveAction)
 {
     _axisType = AxisType::Buttons;
     _joystickId = -1;
@@ -1,10 +1,10 @@
 #pragma once
 #include "Input/Utilities/Buttons/JoystickAxes.hpp"
-#include <string>
+#include "Input/Utilities/MappedInput/InputMapInterface.hpp"
 
 namespace C2D
 {
-    class InputSystemInterface;
+    class InputSnapshot;
 
     /*!
      * \brief Axis type that is used in AxisUnion.
@@ -24,7 +24,7 @@ namespace C2D
         /*!
          * \brief Default constructor.
          * 
-         * Will assign AxisType::Axis, JoystickAxis::PovX, Joystick Id = 0.
+         * Will assign AxisType::Axis, JoystickAxis::PovX and invalid joystick id, so the position is always 0.
          */
         InputAxis();
 
@@ -36,11 +36,11 @@ namespace C2D
         InputAxis(int joystickId, JoystickAxis axis);
 
         /*!
-         * \brief Constructor to create input axis from two already mapped actions.
-         * \param negativeAction - name of the action that will be interpreted as the negative position of an axis.
-         * \param positiveAction - name of the action that will be interpreted as the positive position of an axis.
+         * \brief Constructor to create input axis from two mapped actions.
+         * \param negativeAction - id of the action that will be interpreted as the negative position of an axis.
+         * \param positiveAction - id of the action that will be interpreted as the positive position of an axis.
          */
-        InputAxis(std::string&& negativeAction, std::string&& positiveAction);
+        InputAxis(ActionId negativeAction, ActionId positiveAction);
 
         /*!
          * \brief Relational operator to compare one InputAxis to another.
@@ -51,10 +51,11 @@ namespace C2D
 
         /*!
          * \brief Returns axis position.
-         * \param inputSystem - reference to the input system from which axis will be checked.
+         * \param snapshot - input snapshot from which joystick axis will be checked.
+         * \param inputMap - input map from which actions will be checked, they must be evaluated already.
          * \return Current axis position.
          */
-        float GetPosition(const InputSystemInterface& inputSystem) const;
+        float GetPosition(const InputSnapshot& snapshot, const InputMapInterface& inputMap) const;
 
         /*!
          * \brief Sets actual axis to check.
@@ -64,11 +65,11 @@ namespace C2D
         void SetAxis(int joystickId, const JoystickAxis& axis);
 
         /*!
-         * \brief Sets two already mapped actions to be interpreted as input axis.
-         * \param negativeAction - name of the action that will be interpreted as the negative position of an axis.
-         * \param positiveAction - name of the action that will be interpreted as the positive position of an axis.
+         * \brief Sets two mapped actions to be interpreted as input axis.
+         * \param negativeAction - id of the action that will be interpreted as the negative position of an axis.
+         * \param positiveAction - id of the action that will be interpreted as the positive position of an axis.
          */
-        void SetAxis(const std::string& negativeAction, const std::string& positiveAction);
+        void SetAxis(ActionId negativeAction, ActionId positiveAction);
 
     private:
         /*! Type of axis. Can be actual joystick axis or pair of mapped actions. */
@@ -77,9 +78,9 @@ namespace C2D
         JoystickAxis _joystickAxis;
         /*! Joystick id that will be used if button specified for joystick device.. */
         int _joystickId;
-        /*! Name of the action that will be interpreted as the negative position of an axis. */
-        std::string _negativeAction;
-        /*! Name of the action that will be interpreted as the positive position of an axis. */
-        std::string _positiveAction;
+        /*! Id of the action that will be interpreted as the negative position of an axis. */
+        ActionId _negativeAction;
+        /*! Id of the action that will be interpreted as the positive position of an axis. */
+        ActionId _positiveAction;
     };
 }
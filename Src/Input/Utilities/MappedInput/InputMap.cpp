@@ -1,51 +1,137 @@
 #include "InputMap.hpp"
+#include "Input/Utilities/InputSnapshot.hpp"
 
 using namespace C2D;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-InputMap::InputMap(const InputSystemInterface& inputSystem)
-: _inputSystem(inputSystem)
-, _inputActionMap(std::make_unique<std::unordered_map<std::string, InputAction>>())
-, _inputAxisMap(std::make_unique<std::unordered_map<std::string, InputAxis>>())
+InputMap::InputMap(const InputSnapshot& snapshot)
+: _snapshot(snapshot)
 { }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void InputMap::MapAction(const std::string& actionName, const ButtonState state, const KeyboardButton keyBoardButton)
+void InputMap::Update()
 {
-    (*_inputActionMap)[actionName].SetRequiredState(state);
-    (*_inputActionMap)[actionName].SetRequriedButton(-1, ActionButton(keyBoardButton));
+    // Axes can be made of actions, so actions are evaluated first
+    for (ActionId actionId = 0; actionId < _actions.size(); ++actionId)
+    {
+        _EvaluateAction(actionId);
+    }
+
+    for (AxisId axisId = 0; axisId < _axes.size(); ++axisId)
+    {
+        _EvaluateAxis(axisId);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ActionId InputMap::MapAction(const std::string& actionName,
+                             const ButtonState state,
+                             const KeyboardButton keyBoardButton)
+{
+    const auto actionId = GetActionId(actionName);
+    _actions[actionId].SetRequiredState(state);
+    _actions[actionId].SetRequriedButton(-1, ActionButton(keyBoardButton));
+    _EvaluateAction(actionId);
+
+    return actionId;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ActionId InputMap::MapAction(const std::string& actionName, const ButtonState state, const MouseButton mouseButton)
+{
+    const auto actionId = GetActionId(actionName);
+    _actions[actionId].SetRequiredState(state);
+    _actions[actionId].SetRequriedButton(-1, ActionButton(mouseButton));
+    _EvaluateAction(actionId);
+
+    return actionId;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void InputMap::MapAction(const std::string& actionName, const ButtonState state, const MouseButton mouseButton)
+ActionId InputMap::MapAction(const std::string& actionName,
+                             const ButtonState state,
+                             const int joystickId,
+                             const JoystickButton joystickButton)
 {
-    (*_inputActionMap)[actionName].SetRequiredState(state);
-    (*_inputActionMap)[actionName].SetRequriedButton(-1, ActionButton(mouseButton));
+    const auto actionId = GetActionId(actionName);
+    _actions[actionId].SetRequiredState(state);
+    _actions[actionId].SetRequriedButton(joystickId, ActionButton(joystickButton));
+    _EvaluateAction(actionId);
+
+    return actionId;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void InputMap::MapAction(const std::string& actionName, const ButtonState state, const int joystickId, const JoystickButton joystickButton)
+AxisId InputMap::MapAxis(const std::string& axisName, const int joystickId, const JoystickAxis axis)
 {
-    (*_inputActionMap)[actionName].SetRequiredState(state);
-    (*_inputActionMap)[actionName].SetRequriedButton(joystickId, ActionButton(joystickButton));
+    const auto axisId = GetAxisId(axisName);
+    _axes[axisId].SetAxis(joystickId, axis);
+    _EvaluateAxis(axisId);
+
+    return axisId;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void InputMap::MapAxis(const std::string& axisName, const int joystickId, const JoystickAxis axis)
+AxisId InputMap::MapAxis(const std::string& axisName,
+                         const std::string& negativeAction,
+                         const std::string& positiveAction)
 {
-    (*_inputAxisMap)[axisName].SetAxis(joystickId, axis);
+    const auto negativeActionId = GetActionId(negativeAction);
+    const auto positiveActionId = GetActionId(positiveAction);
+    const auto axisId = GetAxisId(axisName);
+    _axes[axisId].SetAxis(negativeActionId, positiveActionId);
+    _EvaluateAxis(axisId);
+
+    return axisId;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void InputMap::MapAxis(const std::string& axisName, const std::string& negativeAction, const std::string& positiveAction)
+ActionId InputMap::GetActionId(const std::string& actionName)
 {
-    (*_inputAxisMap)[axisName].SetAxis(negativeAction, positiveAction);
+    const auto [actionId, isInserted] = _actionIds.try_emplace(actionName, static_cast<ActionId>(_actions.size()));
+    if (isInserted)
+    {
+        _actions.emplace_back();
+        _actionStates.push_back(0);
+    }
+
+    return actionId->second;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+AxisId InputMap::GetAxisId(const std::string& axisName)
+{
+    const auto [axisId, isInserted] = _axisIds.try_emplace(axisName, static_cast<AxisId>(_axes.size()));
+    if (isInserted)
+    {
+        _axes.emplace_back();
+        _axisPositions.push_back(0.0f);
+    }
+
+    return axisId->second;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InputMap::IsActionActive(const ActionId actionId) const
+{
+    return (actionId < _actionStates.size()) && _actionStates[actionId];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+float InputMap::GetAxisPosition(const AxisId axisId) const
+{
+    return (axisId < _axisPositions.size()) ? _axisPositions[axisId] : 0.0f;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,10 +141,10 @@ bool InputMap::IsActionActive(const std::string& actionName) const
     bool isActive(false);
 
     // Check if such action exist
-    const auto action = _inputActionMap->find(actionName);
-    if (action != _inputActionMap->end())
+    const auto actionId = _actionIds.find(actionName);
+    if (actionId != _actionIds.end())
     {
-        isActive = action->second.IsActive(_inputSystem);
+        isActive = IsActionActive(actionId->second);
     }
 
     return isActive;
@@ -71,13 +157,27 @@ float InputMap::GetAxisPosition(const std::string& axisName) const
     float axisPosition(0.0f);
 
     // Check if such axis exist
-    const auto axis = _inputAxisMap->find(axisName);
-    if (axis != _inputAxisMap->end())
+    const auto axisId = _axisIds.find(axisName);
+    if (axisId != _axisIds.end())
     {
-        axisPosition = axis->second.GetPosition(_inputSystem);
+        axisPosition = GetAxisPosition(axisId->second);
     }
 
     return axisPosition;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputMap::_EvaluateAction(const ActionId actionId)
+{
+    _actionStates[actionId] = _actions[actionId].IsActive(_snapshot);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InputMap::_EvaluateAxis(const AxisId axisId)
+{
+    _axisPositions[axisId] = _axes[axisId].GetPosition(_snapshot, *this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
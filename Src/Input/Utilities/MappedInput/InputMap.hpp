@@ -4,14 +4,17 @@
 #include "Input/Utilities/MappedInput/InputAxis.hpp"
 #include <string>
 #include <unordered_map>
-#include <memory>
+#include <vector>
 
 namespace  C2D
 {
-    class InputSystemInterface;
+    class InputSnapshot;
 
     /*!
      * \brief Manager that handles creating/updating/deleting of mapped input actions and axes.
+     *
+     * Actions and axes are stored in flat arrays by their ids. Update() evaluates all of them once per logic tick
+     * after the input snapshot is built, so queries only read the results.
      */
     class [[deprecated("Will be reimplemented")]] InputMap final : public InputMapInterface
     {
@@ -24,10 +27,15 @@ namespace  C2D
         ~InputMap() final = default;
 
         /*!
-         * \brief Default constructor that initializes maps of input actions and input axes.
-         * \param inputSystem - const reference to input system which will be used by inner actions and axes.
+         * \brief Default constructor.
+         * \param snapshot - input snapshot which will be used to evaluate actions and axes.
          */
-        explicit InputMap(const InputSystemInterface& inputSystem);
+        explicit InputMap(const InputSnapshot& snapshot);
+
+        /*!
+         * \brief Evaluates all actions and then all axes, called after the input snapshot is updated.
+         */
+        void Update();
 
         /*!
          * \brief Map specified action to a certain name.
@@ -35,9 +43,11 @@ namespace  C2D
          * \param state - button state to activate action.
          * \param keyBoardButton - keyboard button to check.
          * 
+         * \return Id of the action.
+         *
          * Only one action can be assigned to a certain name. If name was already used, its button will be rewritten.
          */
-        void MapAction(const std::string& actionName, ButtonState state, KeyboardButton keyBoardButton) final;
+        ActionId MapAction(const std::string& actionName, ButtonState state, KeyboardButton keyBoardButton) final;
 
         /*!
          * \brief Map specified action to a certain name.
@@ -45,9 +55,11 @@ namespace  C2D
          * \param state - button state to activate action.
          * \param mouseButton - mouse button to check.
          * 
+         * \return Id of the action.
+         *
          * Only one action can be assigned to a certain name. If name was already used, its button will be rewritten.
          */
-        void MapAction(const std::string& actionName, ButtonState state, MouseButton mouseButton) final;
+        ActionId MapAction(const std::string& actionName, ButtonState state, MouseButton mouseButton) final;
 
         /*!
          * \brief Map specified action to a certain name.
@@ -56,12 +68,14 @@ namespace  C2D
          * \param joystickId - id of joystick to check.
          * \param joystickButton - joystick button to check.
          * 
+         * \return Id of the action.
+         *
          * Only one action can be assigned to a certain name. If name was already used, its button will be rewritten.
          */
-        void MapAction(const std::string& actionName, 
-                       ButtonState state, 
-                       int joystickId, 
-                       JoystickButton joystickButton) final;
+        ActionId MapAction(const std::string& actionName,
+                           ButtonState state,
+                           int joystickId,
+                           JoystickButton joystickButton) final;
 
         /*!
          * \brief Map specified axis to a certain name.
@@ -69,9 +83,11 @@ namespace  C2D
          * \param joystickId - id of joystick to check.
          * \param axis - axis to check.
          * 
+         * \return Id of the axis.
+         *
          * Only one axis can be assigned to a certain name. If name was already used, its axis will be rewritten.
          */
-        void MapAxis(const std::string& axisName, int joystickId, JoystickAxis axis) final;
+        AxisId MapAxis(const std::string& axisName, int joystickId, JoystickAxis axis) final;
 
         /*!
          * \brief Map specified axis to a certain name.
@@ -79,14 +95,48 @@ namespace  C2D
          * \param negativeAction - name of the action that will be interpreted as the negative position of an axis.
          * \param positiveAction - name of the action that will be interpreted as the positive position of an axis.
          * 
+         * \return Id of the axis.
+         *
          * Only one axis can be assigned to a certain name. If name was already used, its axis will be rewritten.
          */
-        void MapAxis(const std::string& axisName, const std::string& negativeAction, const std::string& positiveAction) final;
+        AxisId MapAxis(const std::string& axisName,
+                       const std::string& negativeAction,
+                       const std::string& positiveAction) final;
+
+        /*!
+         * \brief Returns id of the action, the name is registered if it was not mapped yet.
+         * \param actionName - name of the action.
+         * \return Id of the action. Action that is not mapped is never active.
+         */
+        ActionId GetActionId(const std::string& actionName) final;
+
+        /*!
+         * \brief Returns id of the axis, the name is registered if it was not mapped yet.
+         * \param axisName - name of the axis.
+         * \return Id of the axis. Position of the axis that is not mapped is always 0.
+         */
+        AxisId GetAxisId(const std::string& axisName) final;
+
+        /*!
+         * \brief Checks if the action is active during the logic tick.
+         * \param actionId - id of the action.
+         * \return True if the action is active. Otherwise - false.
+         */
+        bool IsActionActive(ActionId actionId) const final;
+
+        /*!
+         * \brief Returns the position of the axis during the logic tick.
+         * \param axisId - id of the axis.
+         * \return The position of the axis.
+         */
+        float GetAxisPosition(AxisId axisId) const final;
 
         /*!
          * \brief Checks if any of associated with the named action input actions is active.
          * \param actionName -  name to associate with.
          * \return True if at least one input action is active.
+         *
+         * Hashes the name on every call, the overload with id should be preferred.
          */
         bool IsActionActive(const std::string& actionName) const final;
 
@@ -94,14 +144,37 @@ namespace  C2D
          * \brief Returns the position of the biggest by absolute value input axis.
          * \param axisName -  name to associate with.
          * \return The position of the biggest by absolute value input axis.
+         *
+         * Hashes the name on every call, the overload with id should be preferred.
          */
         float GetAxisPosition(const std::string& axisName) const final;
 
     private:
-        const InputSystemInterface& _inputSystem;
-        /*! Map of named actions that stores array of input actions. */
-        std::unique_ptr<std::unordered_map<std::string, InputAction>> _inputActionMap;
-        /*! Map of named axes that stores array of input axes. */
-        std::unique_ptr<std::unordered_map<std::string, InputAxis>> _inputAxisMap;
+        /*!
+         * \brief Evaluates the action and stores its state.
+         * \param actionId - id of the action.
+         */
+        void _EvaluateAction(ActionId actionId);
+
+        /*!
+         * \brief Evaluates the axis and stores its position.
+         * \param axisId - id of the axis.
+         */
+        void _EvaluateAxis(AxisId axisId);
+
+        /*! Input snapshot which is used to evaluate actions and axes. */
+        const InputSnapshot& _snapshot;
+        /*! Ids of actions by names. */
+        std::unordered_map<std::string, ActionId> _actionIds;
+        /*! Actions by ids. */
+        std::vector<InputAction> _actions;
+        /*! States of actions during the logic tick by ids. */
+        std::vector<uint8_t> _actionStates;
+        /*! Ids of axes by names. */
+        std::unordered_map<std::string, AxisId> _axisIds;
+        /*! Axes by ids. */
+        std::vector<InputAxis> _axes;
+        /*! Positions of axes during the logic tick by ids. */
+        std::vector<float> _axisPositions;
     };
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 
 namespace C2D
@@ -11,8 +12,16 @@ namespace C2D
     class InputAction;
     class InputAxis;
 
+    /*! Id of the mapped action, it is assigned once per name and never changes. */
+    using ActionId = uint32_t;
+    /*! Id of the mapped axis, it is assigned once per name and never changes. */
+    using AxisId = uint32_t;
+
     /*!
      * \brief Public interface for input map.
+     *
+     * Names of actions and axes are interned to ids, all of them are evaluated once per logic tick.
+     * Queries by id are array reads, so ids should be requested once and stored by the game logic.
      */
     class [[deprecated("Will be reimplemented")]] InputMapInterface
     {
@@ -30,9 +39,11 @@ namespace C2D
          * \param state - button state to activate action.
          * \param keyBoardButton - keyboard button to check.
          *
+         * \return Id of the action.
+         *
          * Only one action can be assigned to a certain name. If name was already used, its button will be rewritten.
          */
-        virtual void MapAction(const std::string& actionName, ButtonState state, KeyboardButton keyBoardButton) = 0;
+        virtual ActionId MapAction(const std::string& actionName, ButtonState state, KeyboardButton keyBoardButton) = 0;
 
         /*!
          * \brief Map specified action to a certain name.
@@ -40,9 +51,11 @@ namespace C2D
          * \param state - button state to activate action.
          * \param mouseButton - mouse button to check.
          * 
+         * \return Id of the action.
+         *
          * Only one action can be assigned to a certain name. If name was already used, its button will be rewritten.
          */
-        virtual void MapAction(const std::string& actionName, ButtonState state, MouseButton mouseButton) = 0;
+        virtual ActionId MapAction(const std::string& actionName, ButtonState state, MouseButton mouseButton) = 0;
 
         /*!
          * \brief Map specified action to a certain name.
@@ -51,12 +64,14 @@ namespace C2D
          * \param joystickId - id of joystick to check.
          * \param joystickButton - joystick button to check.
          *
+         * \return Id of the action.
+         *
          * Only one action can be assigned to a certain name. If name was already used, its button will be rewritten.
          */
-        virtual void MapAction(const std::string& actionName, 
-                               ButtonState state, 
-                               int joystickId, 
-                               JoystickButton joystickButton) = 0;
+        virtual ActionId MapAction(const std::string& actionName,
+                                   ButtonState state,
+                                   int joystickId,
+                                   JoystickButton joystickButton) = 0;
 
         /*!
          * \brief Map specified axis to a certain name.
@@ -64,9 +79,11 @@ namespace C2D
          * \param joystickId - id of joystick to check.
          * \param axis - axis to check.
          *
+         * \return Id of the axis.
+         *
          * Only one axis can be assigned to a certain name. If name was already used, its axis will be rewritten.
          */
-        virtual void MapAxis(const std::string& axisName, int joystickId, JoystickAxis axis) = 0;
+        virtual AxisId MapAxis(const std::string& axisName, int joystickId, JoystickAxis axis) = 0;
 
         /*!
          * \brief Map specified axis to a certain name.
@@ -74,14 +91,48 @@ namespace C2D
          * \param negativeAction - name of the action that will be interpreted as the negative position of an axis.
          * \param positiveAction - name of the action that will be interpreted as the positive position of an axis.
          *
+         * \return Id of the axis.
+         *
          * Only one axis can be assigned to a certain name. If name was already used, its axis will be rewritten.
          */
-        virtual void MapAxis(const std::string& axisName, const std::string& negativeAction, const std::string& positiveAction) = 0;
+        virtual AxisId MapAxis(const std::string& axisName,
+                               const std::string& negativeAction,
+                               const std::string& positiveAction) = 0;
+
+        /*!
+         * \brief Returns id of the action, the name is registered if it was not mapped yet.
+         * \param actionName - name of the action.
+         * \return Id of the action. Action that is not mapped is never active.
+         */
+        virtual ActionId GetActionId(const std::string& actionName) = 0;
+
+        /*!
+         * \brief Returns id of the axis, the name is registered if it was not mapped yet.
+         * \param axisName - name of the axis.
+         * \return Id of the axis. Position of the axis that is not mapped is always 0.
+         */
+        virtual AxisId GetAxisId(const std::string& axisName) = 0;
+
+        /*!
+         * \brief Checks if the action is active during the logic tick.
+         * \param actionId - id of the action.
+         * \return True if the action is active. Otherwise - false.
+         */
+        virtual bool IsActionActive(ActionId actionId) const = 0;
+
+        /*!
+         * \brief Returns the position of the axis during the logic tick.
+         * \param axisId - id of the axis.
+         * \return The position of the axis.
+         */
+        virtual float GetAxisPosition(AxisId axisId) const = 0;
 
         /*!
          * \brief Checks if any of associated with the named action input actions is active.
          * \param actionName -  name to associate with.
          * \return True if at least one input action is active.
+         *
+         * Hashes the name on every call, the overload with id should be preferred.
          */
         virtual bool IsActionActive(const std::string& actionName) const = 0;
 
@@ -89,6 +140,8 @@ namespace C2D
          * \brief Returns the position of the biggest by absolute value input axis.
          * \param axisName -  name to associate with.
          * \return The position of the biggest by absolute value input axis.
+         *
+         * Hashes the name on every call, the overload with id should be preferred.
          */
         virtual float GetAxisPosition(const std::string& axisName) const = 0;
     };
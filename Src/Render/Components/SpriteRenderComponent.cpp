@@ -28,9 +28,9 @@ SpriteRenderComponent::SpriteRenderComponent(std::weak_ptr<SceneObject>&& sceneO
 
 void SpriteRenderComponent::SetTextureCoordinates(const sf::IntRect& rect)
 {
-    const auto left = static_cast<float>(rect.left);
+    const auto left = static_cast<float>(_textureRect.left + rect.left);
     const auto right = left + rect.width;
-    const auto top = static_cast<float>(rect.top);
+    const auto top = static_cast<float>(_textureRect.top + rect.top);
     const auto bottom = top + rect.height;
 
     _vertices[0].texCoords = { left, top };
@@ -38,6 +38,8 @@ void SpriteRenderComponent::SetTextureCoordinates(const sf::IntRect& rect)
     _vertices[2].texCoords = { right, bottom };
     _vertices[3].texCoords = { right, top };
     _vertices[4].texCoords = { left, top };
+
+    InvalidateGlobalVertices();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,7 +57,7 @@ void SpriteRenderComponent::_OnTextureChanged()
 {
     if (const auto texture = _texture.lock())
     {
-        SetTextureCoordinates(sf::IntRect(0, 0, texture->getSize().x, texture->getSize().y));
+        SetTextureCoordinates(sf::IntRect(0, 0, _textureRect.width, _textureRect.height));
     }
 }
 
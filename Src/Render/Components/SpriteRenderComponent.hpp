@@ -20,6 +20,9 @@ namespace C2D
         /*!
          * \brief Sets texture coordinates.
          * \param rect - rectangle from which texture coordinates will be assigned to vertices.
+         *
+         * Rectangle is relative to the image of the texture region, so it stays the same
+         * when the image is packed into an atlas page.
          */
         void SetTextureCoordinates(const sf::IntRect& rect);
 
@@ -1,5 +1,8 @@
 #include "RenderSystem.hpp"
 #include "Engine/EngineInterface.hpp"
+#include "Utility/Math/MathConstants.hpp"
+#include "Utility/Threading/WorkerPool.hpp"
+#include <cmath>
 
 using namespace C2D;
 
@@ -16,16 +19,15 @@ RenderSystem::RenderSystem()
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void RenderSystem::Start(const RenderableSceneMapInterface& sceneMap,
-                         InputSystemHandlerInterface& inputSystem
-                         /*TimeSpan& renderLoopTimeSpan*/)
+                         InputSystemHandlerInterface& inputSystem,
+                         TimeSpan& renderLoopTimeSpan)
 {
     //DEV_LOG(LogLevel::Debug, "Render loop has started");
 
     if (!_working)
     {
         _working = true;
-        //renderLoopTimeSpan.SetNewEnd(Time::CurrentTime());
-        //renderLoopTimeSpan.SetNewEnd(Time::CurrentTime());
+        renderLoopTimeSpan.Reset(EngineClock::now());
 
         // If render was started, window is open and scene map is not nullptr, render
         while (_working && _window.IsOpen())
@@ -49,29 +51,14 @@ void RenderSystem::Start(const RenderableSceneMapInterface& sceneMap,
                 const auto cameraSet = sceneMap.GetCameraComponentsFromScene(sceneName);
                 if (renderableSet && cameraSet)
                 {
-                    // Go through every camera component in the obtained set
-                    for (auto& cameraComponent : (*cameraSet))
-                    {
-                        // Go through every renderable component in the obtained set
-                        for (auto& renderableComponent : (*renderableSet))
-                        {
-                            if (const auto renderable = renderableComponent.lock())
-                            {
-                                // Renderable component should be visible in current camera
-                                if (renderable->IsVisible(cameraComponent))
-                                {
-                                    _window.Draw(*renderable);
-                                }
-                            }
-                        }
-                    }
+                    _DrawScene(*renderableSet, *cameraSet);
                 }
             }
 
             _window.EndDraw();
 
             // Update time span
-            //renderLoopTimeSpan.SetNewEnd(Time::CurrentTime());
+            renderLoopTimeSpan.SetNewEnd(EngineClock::now());
         }
 
         _working = false;
@@ -249,6 +236,106 @@ void RenderSystem::SetMouseCursorGrabbed(const bool grabbed)
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void RenderSystem::_DrawScene(const RenderableSet& renderableSet, const CameraSet& cameraSet)
+{
+    _CollectRenderables(renderableSet);
+    _BuildCameraBatches(cameraSet);
+
+    for (const auto& batch : _cameraBatches)
+    {
+        if (batch.visible.empty())
+        {
+            continue;
+        }
+
+        _window.SetView(batch.view);
+        for (const auto index : batch.visible)
+        {
+            _window.Draw(*_renderables[index]);
+        }
+    }
+
+    // Pointers are valid only while the scene does not apply its changes
+    _renderables.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void RenderSystem::_CollectRenderables(const RenderableSet& renderableSet)
+{
+    _renderables.clear();
+    _renderableBounds.clear();
+    for (const auto& renderable : renderableSet)
+    {
+        // Vertices are transformed here, so visibility jobs and cameras only read them
+        const auto bounds = renderable->GetGlobalBounds();
+        _renderableBounds.push_back({ Vector2f(bounds.left, bounds.top),
+                                      Vector2f(bounds.left + bounds.width, bounds.top + bounds.height) });
+        _renderables.push_back(renderable.get());
+    }
+
+    _spatialGrid.Build(_renderableBounds);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void RenderSystem::_BuildCameraBatches(const CameraSet& cameraSet)
+{
+    size_t batchCount(0);
+    for (const auto& camera : cameraSet)
+    {
+        if (batchCount == _cameraBatches.size())
+        {
+            _cameraBatches.emplace_back();
+        }
+
+        auto& batch = _cameraBatches[batchCount++];
+        batch.camera = camera;
+        batch.view = static_cast<sf::View>(*camera);
+        batch.area = _GetViewArea(batch.view);
+    }
+    _cameraBatches.resize(batchCount);
+
+    // Workers of the shared pool are persistent, so cameras do not start threads every frame
+    WorkerPool::GetShared().ParallelFor(_cameraBatches.size(), [this](size_t camera, size_t)
+    {
+        _BuildVisibilityList(_cameraBatches[camera]);
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void RenderSystem::_BuildVisibilityList(CameraBatch& batch) const
+{
+    _spatialGrid.Query(batch.area, batch.visible);
+
+    // Renderables can hide themselves from certain cameras
+    std::erase_if(batch.visible, [this, &batch](const uint32_t index)
+    {
+        return !_renderables[index]->IsVisible(batch.camera);
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+VectorKernels::Bounds RenderSystem::_GetViewArea(const sf::View& view)
+{
+    const auto center = view.getCenter();
+    const auto size = view.getSize();
+    const auto radians = view.getRotation() * FromDegToRad;
+    const auto cosine = std::abs(std::cos(radians));
+    const auto sine = std::abs(std::sin(radians));
+
+    // Half extents of the rotated rectangle, views can also flip axes with negative sizes
+    const auto halfWidth = (cosine * std::abs(size.x) + sine * std::abs(size.y)) / 2.0f;
+    const auto halfHeight = (sine * std::abs(size.x) + cosine * std::abs(size.y)) / 2.0f;
+
+    return { Vector2f(center.x - halfWidth, center.y - halfHeight),
+             Vector2f(center.x + halfWidth, center.y + halfHeight) };
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void RenderSystem::_UpdateWindow()
 {
     if (_recreateWindow || _updateWindowParameters)
@@ -3,7 +3,11 @@
 #include "Input/InputSystemHandlerInterface.hpp"
 #include "Render/RenderSystemInterface.hpp"
 #include "Render/Window/Window.hpp"
+#include "Utility/Spatial/SpatialGrid.hpp"
+#include "Utility/Time/TimeSpan.hpp"
+#include <SFML/Graphics/View.hpp>
 #include <mutex>
+#include <vector>
 
 namespace C2D
 {
@@ -11,6 +15,11 @@ namespace C2D
      * \brief System that handles render process.
      * 
      * Render system require SceneMap from which it will gather data to render.
+     *
+     * Each frame renderables of a scene are transformed once and put to a spatial grid that is shared by all cameras
+     * of the scene. Visibility lists of cameras are built from the grid in parallel by the shared WorkerPool,
+     * then each camera draws its list with its own view, so split screens and minimaps cost a draw per visible
+     * renderable instead of a pass over the whole scene.
      */
     class RenderSystem final : public RenderSystemInterface
     {
@@ -33,8 +42,8 @@ namespace C2D
          * \param renderLoopTimeSpan - time span of render loop.
          */
         void Start(const RenderableSceneMapInterface& sceneMap,
-                   InputSystemHandlerInterface& inputSystem
-                   /*TimeSpan& renderLoopTimeSpan*/);
+                   InputSystemHandlerInterface& inputSystem,
+                   TimeSpan& renderLoopTimeSpan);
 
         /*!
          * \brief Stops render process.
@@ -110,6 +119,57 @@ namespace C2D
         void SetMouseCursorGrabbed(bool grabbed) final;
 
     private:
+        /*!
+         * \brief Renderables that are visible by a camera.
+         */
+        struct CameraBatch
+        {
+            /*! Camera whose view is used to draw renderables. */
+            std::weak_ptr<CameraComponent> camera;
+            /*! View of the camera, applied once before its renderables are drawn. */
+            sf::View view;
+            /*! Area of the world that is seen by the camera. */
+            VectorKernels::Bounds area;
+            /*! Indices of visible renderables in the array of renderables of the scene, in the render order. */
+            std::vector<uint32_t> visible;
+        };
+
+        /*!
+         * \brief Draws a scene with each of its cameras.
+         * \param renderableSet - renderable components of the scene, in the render order.
+         * \param cameraSet - camera components of the scene, in the order of their priorities.
+         */
+        void _DrawScene(const RenderableSet& renderableSet, const CameraSet& cameraSet);
+
+        /*!
+         * \brief Collects renderables of a scene, transforms their vertices and puts them to the spatial grid.
+         * \param renderableSet - renderable components of the scene, in the render order.
+         */
+        void _CollectRenderables(const RenderableSet& renderableSet);
+
+        /*!
+         * \brief Builds visibility lists of all cameras, one task of the shared WorkerPool per camera.
+         * \param cameraSet - camera components of the scene, in the order of their priorities.
+         *
+         * The calling thread takes part in the work, so a scene with one camera does not wake up other workers.
+         */
+        void _BuildCameraBatches(const CameraSet& cameraSet);
+
+        /*!
+         * \brief Builds visibility list of a camera.
+         * \param batch - batch of the camera, its view and area must be set.
+         *
+         * Only reads the spatial grid and renderables, so it is called concurrently for different batches.
+         */
+        void _BuildVisibilityList(CameraBatch& batch) const;
+
+        /*!
+         * \brief Returns area of the world that is seen through a view.
+         * \param view - view of a camera.
+         * \return Axis-aligned box that contains the rotated rectangle of the view.
+         */
+        static VectorKernels::Bounds _GetViewArea(const sf::View& view);
+
         /*!
          * \brief Updates window.
          * 
@@ -131,5 +191,13 @@ namespace C2D
         WindowSettings _settings;
         /*! Window to which render system is drawing everything and from which polling events. */
         Window _window;
+        /*! Renderables of the scene that is drawn, kept alive by the set of the scene during the frame. */
+        std::vector<RenderableComponent*> _renderables;
+        /*! Bounding boxes of the renderables in the world. */
+        std::vector<VectorKernels::Bounds> _renderableBounds;
+        /*! Spatial grid of the renderables, shared by all cameras of the scene. */
+        SpatialGrid _spatialGrid;
+        /*! Batches of the cameras of the scene, reused between frames to keep allocated visibility lists. */
+        std::vector<CameraBatch> _cameraBatches;
     };
 }
@@ -170,11 +170,19 @@ void Window::PollEvents(InputSystemHandlerInterface& inputSystem) const
 
 void Window::BeginDraw() const
 {
+    _renderWindow->setView(_renderWindow->getDefaultView());
     _renderWindow->clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void Window::SetView(const sf::View& view) const
+{
+    _renderWindow->setView(view);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void Window::Draw(const sf::Drawable& drawable) const
 {
     _renderWindow->draw(drawable);
@@ -4,7 +4,7 @@
 #include <atomic>
 #include <memory>
 
-namespace sf { class RenderWindow; class Drawable; class Image; }
+namespace sf { class RenderWindow; class Drawable; class Image; class View; }
 
 namespace C2D
 {
@@ -118,6 +118,14 @@ namespace C2D
          */
         void BeginDraw() const;
 
+        /*!
+         * \brief Sets view which is used by the following draws.
+         * \param view - view of a camera, its viewport defines part of the window to which it is drawn.
+         *
+         * View is reset to the default one at the beginning of each frame.
+         */
+        void SetView(const sf::View& view) const;
+
         /*!
          * \brief Draws a specified drawable thing.
          * \param drawable - drawable entity.
@@ -5,8 +5,14 @@
 #include <VkWrapper/Application.hpp>
 #include <Logger/Logger.hpp>
 
-int main()
+#include <string>
+#include <string_view>
+
+int main(int argc, char** argv)
 {
+    // Frames are drawn on the main thread only to compare the input latency with the render thread
+    const bool renderOnMainThread = argc > 1 && std::string_view(argv[1]) == "--main-thread-rendering";
+
     Logger::ChangeLevel(Logger::Level::Info);
 
     GLFWWrapper::Context glfwContext;
@@ -16,6 +22,7 @@ int main()
 
     GLFWWrapper::Window window;
     window.Create();//.SetTitle("Conure2D").SetSize(800, 600);
+    window.SetIdleMode(true);
 
     VkWrapper::ApplicationConfiguration configuration =
     {
@@ -26,12 +33,32 @@ int main()
         }
     };
     VkWrapper::Application application(configuration);
+    if (!renderOnMainThread)
+    {
+        application.StartRenderThread();
+    }
 
     while (window.IsNotClosed())
     {
-        glfwPollEvents();
-        application.DrawFrame();
+        // Waits for events instead of spinning while the window is minimized or in the background
+        window.ProcessEvents();
+
+        // There is no input system in the test app, so events are only drained
+        GLFWWrapper::InputEvent event{};
+        while (window.GetEventQueue().TryPop(event));
+
+        if (renderOnMainThread)
+        {
+            application.DrawFrame();
+        }
     }
+    application.StopRenderThread();
+
+    const auto toMicroseconds = [](std::chrono::nanoseconds time) { return std::to_string(time.count() / 1000); };
+    const auto inputLatency = application.GetInputLatency();
+    Logger::LogInfo("Input to present latency over " + std::to_string(inputLatency.frameCount) + " frames: average " +
+                    toMicroseconds(inputLatency.average) + " us, max " + toMicroseconds(inputLatency.max) + " us",
+                    __PRETTY_FUNCTION__);
 
     return 0;
 }
\ No newline at end of file
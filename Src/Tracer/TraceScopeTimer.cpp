@@ -1,4 +1,5 @@
 #include "TraceScopeTimer.hpp"
+#include "TraceTimeline.hpp"
 #include <iostream>
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -13,6 +14,12 @@ TraceScopeTimer::TraceScopeTimer(std::string name)
 TraceScopeTimer::~TraceScopeTimer()
 {
     auto end = std::chrono::steady_clock::now();
+    if (TraceTimeline::IsEnabled())
+    {
+        TraceTimeline::AddZone({ std::move(_name), TraceTimeline::GetThreadTrack(), _start, end });
+        return;
+    }
+
     std::cout << _name << " : " << (end - _start).count() << "ns" << std::endl;
 }
 
@@ -0,0 +1,144 @@
+#include "TraceTimeline.hpp"
+#include <map>
+#include <thread>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    std::string EscapeJson(std::string_view text)
+    {
+        std::string escaped;
+        escaped.reserve(text.size());
+        for (const auto symbol : text)
+        {
+            if (symbol == '"' || symbol == '\\')
+            {
+                escaped.push_back('\\');
+            }
+            escaped.push_back(symbol);
+        }
+
+        return escaped;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::atomic_bool TraceTimeline::_isEnabled = false;
+std::mutex TraceTimeline::_mutex;
+std::deque<TraceZone> TraceTimeline::_zones;
+size_t TraceTimeline::_capacity = 0;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void TraceTimeline::Enable(size_t capacity)
+{
+    std::lock_guard lock(_mutex);
+    _capacity = capacity;
+    _isEnabled = true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void TraceTimeline::Disable()
+{
+    _isEnabled = false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool TraceTimeline::IsEnabled()
+{
+    return _isEnabled;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void TraceTimeline::AddZone(TraceZone zone)
+{
+    if (!_isEnabled)
+    {
+        return;
+    }
+
+    std::lock_guard lock(_mutex);
+    if (_zones.size() >= _capacity && !_zones.empty())
+    {
+        _zones.pop_front();
+    }
+    _zones.push_back(std::move(zone));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::vector<TraceZone> TraceTimeline::TakeZones()
+{
+    std::lock_guard lock(_mutex);
+    std::vector<TraceZone> zones(std::make_move_iterator(_zones.begin()), std::make_move_iterator(_zones.end()));
+    _zones.clear();
+
+    return zones;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool TraceTimeline::WriteChromeTrace(const std::filesystem::path& path)
+{
+    const auto zones = TakeZones();
+
+    std::ofstream file(path);
+    if (!file)
+    {
+        return false;
+    }
+
+    // Tracks are displayed as threads, their ids are assigned in order of appearance
+    std::map<std::string, size_t> trackIds;
+    for (const auto& zone : zones)
+    {
+        trackIds.try_emplace(zone.track, trackIds.size());
+    }
+
+    const auto toMicroseconds = [](std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    };
+
+    // Timestamps are large numbers, so the default precision would round them to milliseconds
+    file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    bool isFirst(true);
+    for (const auto& [track, id] : trackIds)
+    {
+        file << (isFirst ? "" : ",")
+             << R"({"name":"thread_name","ph":"M","pid":0,"tid":)" << id
+             << R"(,"args":{"name":")" << EscapeJson(track) << "\"}}";
+        isFirst = false;
+    }
+    for (const auto& zone : zones)
+    {
+        file << (isFirst ? "" : ",")
+             << R"({"name":")" << EscapeJson(zone.name)
+             << R"(","ph":"X","pid":0,"tid":)" << trackIds[zone.track]
+             << ",\"ts\":" << toMicroseconds(zone.start.time_since_epoch())
+             << ",\"dur\":" << toMicroseconds(zone.end - zone.start) << "}";
+        isFirst = false;
+    }
+    file << "]}";
+
+    return static_cast<bool>(file);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::string TraceTimeline::GetThreadTrack()
+{
+    std::ostringstream track;
+    track << "CPU " << std::this_thread::get_id();
+    return track.str();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <filesystem>
+
+/*!
+ * Zone of the timeline. CPU zones are put to the track of their thread, GPU zones to the track of their queue,
+ * all zones use the steady clock, so they can be displayed on the same timeline.
+ */
+struct TraceZone
+{
+    std::string name;
+    std::string track;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+};
+
+/*!
+ * Collects zones of CPU and GPU profiling. Collection is disabled by default, in that case TraceScopeTimer
+ * prints its measurement to the standard output as before.
+ */
+class TraceTimeline final
+{
+public:
+    /*!
+     * Enables the collection. Only the latest zones are kept if the capacity is exceeded.
+     */
+    static void Enable(size_t capacity = 65536);
+    static void Disable();
+
+    [[nodiscard]]
+    static bool IsEnabled();
+
+    static void AddZone(TraceZone zone);
+
+    /*!
+     * \return All collected zones, the timeline is cleared.
+     */
+    [[nodiscard]]
+    static std::vector<TraceZone> TakeZones();
+
+    /*!
+     * Writes collected zones in the Chrome trace event format (chrome://tracing, Perfetto), the timeline is cleared.
+     *
+     * \return True if the file was written. Otherwise - false.
+     */
+    static bool WriteChromeTrace(const std::filesystem::path& path);
+
+    /*!
+     * \return Name of the track of the calling thread.
+     */
+    [[nodiscard]]
+    static std::string GetThreadTrack();
+
+private:
+    static std::atomic_bool _isEnabled;
+    static std::mutex _mutex;
+    static std::deque<TraceZone> _zones;
+    static size_t _capacity;
+};
\ No newline at end of file
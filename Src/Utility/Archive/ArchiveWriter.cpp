@@ -0,0 +1,102 @@
+#include "ArchiveWriter.hpp"
+#include <fstream>
+#include "Lz4.hpp"
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    uint64_t Align(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ArchiveWriter::Add(std::string_view path, std::span<const std::byte> data, bool compress)
+{
+    const auto hash = AssetArchive::HashPath(path);
+    if (_blobs.contains(hash))
+    {
+        return false;
+    }
+
+    Blob blob{ AssetArchive::Compression::None, data.size(), { data.begin(), data.end() } };
+    if (compress)
+    {
+        auto compressed = Lz4::Compress(data);
+        if (compressed.size() <= data.size() - data.size() / 8)
+        {
+            blob.compression = AssetArchive::Compression::Lz4;
+            blob.data = std::move(compressed);
+        }
+    }
+
+    _blobs.emplace(hash, std::move(blob));
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ArchiveWriter::Write(const std::filesystem::path& path) const
+{
+    const AssetArchive::Header header =
+    {
+        .magicNumber = AssetArchive::magicNumber,
+        .version = AssetArchive::version,
+        .entryCount = _blobs.size()
+    };
+
+    std::vector<AssetArchive::Entry> entries;
+    entries.reserve(_blobs.size());
+    auto offset = Align(sizeof(header) + _blobs.size() * sizeof(AssetArchive::Entry), AssetArchive::blobAlignment);
+    for (const auto& [hash, blob] : _blobs)
+    {
+        entries.push_back(
+        {
+            .pathHash = hash,
+            .offset = offset,
+            .storedSize = blob.data.size(),
+            .size = blob.size,
+            .compression = blob.compression,
+            .reserved = 0
+        });
+        offset = Align(offset + blob.data.size(), AssetArchive::blobAlignment);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()),
+               static_cast<std::streamsize>(entries.size() * sizeof(AssetArchive::Entry)));
+
+    const char padding[AssetArchive::blobAlignment] = {};
+    auto blob = _blobs.begin();
+    for (const auto& entry : entries)
+    {
+        const auto position = static_cast<uint64_t>(file.tellp());
+        file.write(padding, static_cast<std::streamsize>(entry.offset - position));
+        file.write(reinterpret_cast<const char*>(blob->second.data.data()),
+                   static_cast<std::streamsize>(blob->second.data.size()));
+        ++blob;
+    }
+
+    return file.good();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t ArchiveWriter::GetEntryCount() const
+{
+    return _blobs.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
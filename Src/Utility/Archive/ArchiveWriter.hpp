@@ -0,0 +1,60 @@
+#pragma once
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <filesystem>
+#include "AssetArchive.hpp"
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Collects assets and writes them as an AssetArchive.
+     */
+    class ArchiveWriter final
+    {
+    public:
+        /*!
+         * \brief Adds the asset to the archive.
+         * \param path - path of the asset.
+         * \param data - content of the asset.
+         * \param compress - compress the asset with LZ4, it is stored uncompressed anyway if compression saves less
+         *                   than 1/8 of the size, since uncompressed assets are read without copies.
+         * \return True if the asset was added. False if the archive already has an asset with the same path hash.
+         */
+        bool Add(std::string_view path, std::span<const std::byte> data, bool compress = false);
+
+        /*!
+         * \brief Writes the archive.
+         * \param path - path to the archive file.
+         * \return True if the archive was written. False if the file can not be written.
+         */
+        bool Write(const std::filesystem::path& path) const;
+
+        /*!
+         * \brief Returns number of added assets.
+         * \return Number of assets.
+         */
+        size_t GetEntryCount() const;
+
+    private:
+        /*!
+         * \brief Asset as it is stored in the archive.
+         */
+        struct Blob
+        {
+            /*! Compression of the data. */
+            AssetArchive::Compression compression;
+            /*! Size of the asset after decompression. */
+            uint64_t size;
+            /*! Stored data. */
+            std::vector<std::byte> data;
+        };
+
+        /*! Blobs by hashes of paths, sorted by the hash as entries of the archive. */
+        std::map<uint64_t, Blob> _blobs;
+    };
+}
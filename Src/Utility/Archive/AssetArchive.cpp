@@ -0,0 +1,165 @@
+#include "AssetArchive.hpp"
+#include <cstring>
+#include <algorithm>
+#include "Lz4.hpp"
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+AssetBlob::AssetBlob(std::shared_ptr<const MappedFile> file, std::span<const std::byte> data)
+: _file(std::move(file))
+, _view(data)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+AssetBlob::AssetBlob(std::vector<std::byte>&& data)
+: _buffer(std::move(data))
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::span<const std::byte> AssetBlob::GetData() const
+{
+    return IsView() ? _view : std::span<const std::byte>(_buffer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool AssetBlob::IsView() const
+{
+    return _file != nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+AssetArchive::AssetArchive(const std::filesystem::path& path)
+{
+    auto file = std::make_shared<const MappedFile>(path);
+    if (!file->IsOpen())
+    {
+        return;
+    }
+
+    const auto data = file->GetData();
+    Header header{};
+    if (data.size() < sizeof(header))
+    {
+        return;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (header.magicNumber != magicNumber || header.version != version ||
+        header.entryCount > (data.size() - sizeof(header)) / sizeof(Entry))
+    {
+        return;
+    }
+
+    // The table is small, the copy makes entries properly aligned objects
+    std::vector<Entry> entries(header.entryCount);
+    std::memcpy(entries.data(), data.data() + sizeof(header), entries.size() * sizeof(Entry));
+
+    const auto isValid = [&data](const Entry& entry)
+    {
+        return entry.offset <= data.size() && entry.storedSize <= data.size() - entry.offset &&
+               (entry.compression == Compression::Lz4 ||
+                (entry.compression == Compression::None && entry.storedSize == entry.size));
+    };
+    const auto isSorted = std::is_sorted(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs)
+    {
+        return lhs.pathHash < rhs.pathHash;
+    });
+    if (!isSorted || !std::all_of(entries.begin(), entries.end(), isValid))
+    {
+        return;
+    }
+
+    _file = std::move(file);
+    _entries = std::move(entries);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool AssetArchive::IsOpen() const
+{
+    return _file != nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool AssetArchive::Contains(std::string_view path) const
+{
+    return _Find(path) != nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::optional<AssetBlob> AssetArchive::Read(std::string_view path) const
+{
+    const auto* entry = _Find(path);
+    if (entry == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    const auto storedData = _file->GetData().subspan(entry->offset, entry->storedSize);
+    if (entry->compression == Compression::None)
+    {
+        return AssetBlob(_file, storedData);
+    }
+
+    auto data = Lz4::Decompress(storedData, entry->size);
+    if (!data.has_value())
+    {
+        return std::nullopt;
+    }
+
+    return AssetBlob(std::move(data.value()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t AssetArchive::GetEntryCount() const
+{
+    return _entries.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t AssetArchive::HashPath(std::string_view path)
+{
+    while (path.starts_with("./") || path.starts_with(".\\"))
+    {
+        path.remove_prefix(2);
+    }
+
+    uint64_t hash(14695981039346656037ull);
+    for (const auto symbol : path)
+    {
+        hash ^= static_cast<uint8_t>(symbol == '\\' ? '/' : symbol);
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const AssetArchive::Entry* AssetArchive::_Find(std::string_view path) const
+{
+    const auto hash = HashPath(path);
+    const auto entry = std::lower_bound(_entries.begin(), _entries.end(), hash, [](const Entry& entry, uint64_t value)
+    {
+        return entry.pathHash < value;
+    });
+
+    if (entry == _entries.end() || entry->pathHash != hash)
+    {
+        return nullptr;
+    }
+
+    return &*entry;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,181 @@
+#pragma once
+#include <span>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <filesystem>
+#include <string_view>
+#include "MappedFile.hpp"
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Content of an asset.
+     *
+     * Uncompressed entries of archives are views of the mapped archive which keep the mapping alive,
+     * compressed entries and loose files own their bytes.
+     */
+    class AssetBlob final
+    {
+    public:
+        /*!
+         * \brief Default constructor, the blob is empty.
+         */
+        AssetBlob() = default;
+
+        /*!
+         * \brief Creates a view of the mapped file.
+         * \param file - mapped file that is kept alive by the blob.
+         * \param data - content of the asset in the mapping.
+         */
+        AssetBlob(std::shared_ptr<const MappedFile> file, std::span<const std::byte> data);
+
+        /*!
+         * \brief Creates a blob that owns its content.
+         * \param data - content of the asset.
+         */
+        explicit AssetBlob(std::vector<std::byte>&& data);
+
+        /*!
+         * \brief Returns content of the asset.
+         * \return Content of the asset, valid for the lifetime of the blob.
+         */
+        std::span<const std::byte> GetData() const;
+
+        /*!
+         * \brief Checks if the blob is a view of the mapped file.
+         * \return True if the content is not copied. Otherwise - false.
+         */
+        bool IsView() const;
+
+    private:
+        /*! Mapped file of the view, nullptr if the blob owns its content. */
+        std::shared_ptr<const MappedFile> _file;
+        /*! Content of the asset in the mapping. */
+        std::span<const std::byte> _view;
+        /*! Content of the asset that is owned by the blob. */
+        std::vector<std::byte> _buffer;
+    };
+
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Read-only archive of assets which is mapped to memory, so opening it costs a single open() no matter
+     *        how many assets it contains.
+     *
+     * Layout, all numbers are little-endian:
+     *  - Header
+     *  - Entry per asset, sorted by the hash of the path, so lookup is a binary search
+     *  - blobs, each aligned to blobAlignment, so e.g. SPIR-V can be read as words directly from the mapping
+     *
+     * Paths are not stored, only their 64-bit FNV-1a hashes, ArchiveWriter rejects colliding paths.
+     * Archive is thread-safe, it is immutable after construction.
+     */
+    class AssetArchive final
+    {
+    public:
+        /*! Magic number of archives, "C2DA" in little-endian. */
+        static constexpr uint32_t magicNumber = 0x41443243;
+        /*! Version of the format of archives. */
+        static constexpr uint32_t version = 1;
+        /*! Alignment of blobs from the beginning of the archive. */
+        static constexpr uint64_t blobAlignment = 16;
+
+        /*!
+         * \brief Compression of a blob.
+         */
+        enum class Compression : uint32_t
+        {
+            None, /*!< Blob is stored as it is.   */
+            Lz4   /*!< LZ4 block, see Lz4.hpp.    */
+        };
+
+        /*!
+         * \brief Header of the archive.
+         */
+        struct Header
+        {
+            /*! Magic number, must be equal to magicNumber. */
+            uint32_t magicNumber;
+            /*! Version of the format, must be equal to version. */
+            uint32_t version;
+            /*! Number of entries that follow the header. */
+            uint64_t entryCount;
+        };
+
+        /*!
+         * \brief Entry of the asset in the archive.
+         */
+        struct Entry
+        {
+            /*! Hash of the path, see HashPath. */
+            uint64_t pathHash;
+            /*! Offset of the blob from the beginning of the archive. */
+            uint64_t offset;
+            /*! Size of the blob in the archive. */
+            uint64_t storedSize;
+            /*! Size of the asset after decompression. */
+            uint64_t size;
+            /*! Compression of the blob. */
+            Compression compression;
+            /*! Reserved, must be zero. */
+            uint32_t reserved;
+        };
+
+        /*!
+         * \brief Maps the archive, it is left closed if the file can not be mapped or is not a valid archive.
+         * \param path - path to the archive.
+         */
+        explicit AssetArchive(const std::filesystem::path& path);
+
+        /*!
+         * \brief Checks if the archive is open.
+         * \return True if the archive is open. Otherwise - false.
+         */
+        bool IsOpen() const;
+
+        /*!
+         * \brief Checks if the archive contains the asset.
+         * \param path - path of the asset.
+         * \return True if the archive contains the asset. Otherwise - false.
+         */
+        bool Contains(std::string_view path) const;
+
+        /*!
+         * \brief Reads the asset.
+         * \param path - path of the asset.
+         * \return Content of the asset or nothing if there is no such asset or it can not be decompressed.
+         */
+        std::optional<AssetBlob> Read(std::string_view path) const;
+
+        /*!
+         * \brief Returns number of assets in the archive.
+         * \return Number of assets.
+         */
+        size_t GetEntryCount() const;
+
+        /*!
+         * \brief Hashes the path in the generic form, so "Shaders\\Sprites.vert" and "./Shaders/Sprites.vert"
+         *        are the same.
+         * \param path - path of the asset.
+         * \return 64-bit FNV-1a hash.
+         */
+        static uint64_t HashPath(std::string_view path);
+
+    private:
+        /*!
+         * \brief Finds the entry of the asset.
+         * \param path - path of the asset.
+         * \return Entry of the asset or nullptr if there is no such asset.
+         */
+        const Entry* _Find(std::string_view path) const;
+
+        /*! Mapped archive, nullptr if the archive is closed. */
+        std::shared_ptr<const MappedFile> _file;
+        /*! Entries sorted by hashes of paths. */
+        std::vector<Entry> _entries;
+    };
+}
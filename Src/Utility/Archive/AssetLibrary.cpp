@@ -0,0 +1,81 @@
+#include "AssetLibrary.hpp"
+#include <fstream>
+#include <mutex>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+AssetLibrary::AssetLibrary(std::filesystem::path looseRoot, bool areLooseFilesAllowed)
+: _looseRoot(std::move(looseRoot))
+, _areLooseFilesAllowed(areLooseFilesAllowed)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool AssetLibrary::Mount(const std::filesystem::path& archivePath)
+{
+    auto archive = std::make_unique<AssetArchive>(archivePath);
+    if (!archive->IsOpen())
+    {
+        return false;
+    }
+
+    std::unique_lock lock(_mutex);
+    _archives.push_back(std::move(archive));
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::optional<AssetBlob> AssetLibrary::Read(std::string_view path) const
+{
+    {
+        std::shared_lock lock(_mutex);
+        for (auto archive = _archives.rbegin(); archive != _archives.rend(); ++archive)
+        {
+            if ((*archive)->Contains(path))
+            {
+                return (*archive)->Read(path);
+            }
+        }
+    }
+
+    if (!_areLooseFilesAllowed)
+    {
+        return std::nullopt;
+    }
+
+    return _ReadLooseFile(path);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t AssetLibrary::GetArchiveCount() const
+{
+    std::shared_lock lock(_mutex);
+    return _archives.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::optional<AssetBlob> AssetLibrary::_ReadLooseFile(std::string_view path) const
+{
+    std::ifstream file(_looseRoot / path, std::ios::ate | std::ios::binary);
+    if (!file.is_open())
+    {
+        return std::nullopt;
+    }
+
+    std::vector<std::byte> content(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(content.data()), static_cast<std::streamsize>(content.size())))
+    {
+        return std::nullopt;
+    }
+
+    return AssetBlob(std::move(content));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,74 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include <optional>
+#include <filesystem>
+#include <shared_mutex>
+#include <string_view>
+#include "AssetArchive.hpp"
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Reads assets from mounted archives.
+     *
+     * Paths that are not found in any archive are read as loose files relative to the root directory, so during
+     * development assets can be edited without rebuilding archives. Library is thread-safe.
+     */
+    class AssetLibrary final
+    {
+    public:
+        AssetLibrary(const AssetLibrary& other) = delete;
+        AssetLibrary(AssetLibrary&& other) = delete;
+        AssetLibrary& operator=(const AssetLibrary& other) = delete;
+        AssetLibrary& operator=(AssetLibrary&& other) = delete;
+        ~AssetLibrary() = default;
+
+        /*!
+         * \brief Constructor.
+         * \param looseRoot - directory of loose files.
+         * \param areLooseFilesAllowed - disable to make sure that shipped builds use only archives.
+         */
+        explicit AssetLibrary(std::filesystem::path looseRoot = ".", bool areLooseFilesAllowed = true);
+
+        /*!
+         * \brief Mounts the archive. Archives that are mounted later override assets with the same path
+         *        in the earlier ones, e.g. patches.
+         * \param archivePath - path to the archive.
+         * \return True if the archive was mounted. False if the archive can not be opened.
+         */
+        bool Mount(const std::filesystem::path& archivePath);
+
+        /*!
+         * \brief Reads the asset.
+         * \param path - path of the asset.
+         * \return Content of the asset or nothing if it is found neither in archives nor among loose files.
+         */
+        std::optional<AssetBlob> Read(std::string_view path) const;
+
+        /*!
+         * \brief Returns number of mounted archives.
+         * \return Number of archives.
+         */
+        size_t GetArchiveCount() const;
+
+    private:
+        /*!
+         * \brief Reads the loose file.
+         * \param path - path of the file relative to the root directory.
+         * \return Content of the file or nothing if it can not be read.
+         */
+        std::optional<AssetBlob> _ReadLooseFile(std::string_view path) const;
+
+        /*! Directory of loose files. */
+        std::filesystem::path _looseRoot;
+        /*! Whether assets can be read from loose files. */
+        bool _areLooseFilesAllowed;
+        /*! Mutex that is used to lock the archives. */
+        mutable std::shared_mutex _mutex;
+        /*! Mounted archives in the order of mounting. */
+        std::vector<std::unique_ptr<AssetArchive>> _archives;
+    };
+}
@@ -0,0 +1,199 @@
+#include "Lz4.hpp"
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    constexpr size_t minMatch = 4;
+    constexpr size_t lastLiterals = 5;       // The block always ends with at least 5 literals
+    constexpr size_t matchSafeDistance = 12; // The last match starts at least 12 bytes before the end of the block
+    constexpr size_t maxOffset = 65535;
+    constexpr size_t lengthMask = 15;
+    constexpr uint32_t hashBits = 16;
+    constexpr size_t noPosition = std::numeric_limits<size_t>::max();
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    uint32_t Read32(std::span<const std::byte> source, size_t position)
+    {
+        uint32_t value;
+        std::memcpy(&value, source.data() + position, sizeof(value));
+        return value;
+    }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Lengths that do not fit the token are continued by bytes, 255 means that one more byte follows
+    void WriteLength(std::vector<std::byte>& destination, size_t length)
+    {
+        length -= lengthMask;
+        while (length >= 255)
+        {
+            destination.push_back(std::byte{ 255 });
+            length -= 255;
+        }
+        destination.push_back(static_cast<std::byte>(length));
+    }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::optional<size_t> ReadLength(std::span<const std::byte> source, size_t& position, size_t length)
+    {
+        if (length != lengthMask)
+        {
+            return length;
+        }
+
+        uint8_t byte;
+        do
+        {
+            if (position >= source.size())
+            {
+                return std::nullopt;
+            }
+            byte = static_cast<uint8_t>(source[position++]);
+            length += byte;
+        }
+        while (byte == 255);
+
+        return length;
+    }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // The last sequence has no match, it is marked by the match length 0
+    void WriteSequence(std::vector<std::byte>& destination,
+                       std::span<const std::byte> literals,
+                       size_t offset,
+                       size_t matchLength)
+    {
+        const auto matchCode = matchLength == 0 ? 0 : matchLength - minMatch;
+        const auto token = std::min(literals.size(), lengthMask) << 4 | std::min(matchCode, lengthMask);
+        destination.push_back(static_cast<std::byte>(token));
+        if (literals.size() >= lengthMask)
+        {
+            WriteLength(destination, literals.size());
+        }
+        destination.insert(destination.end(), literals.begin(), literals.end());
+
+        if (matchLength == 0)
+        {
+            return;
+        }
+
+        destination.push_back(static_cast<std::byte>(offset & 0xFF));
+        destination.push_back(static_cast<std::byte>(offset >> 8));
+        if (matchCode >= lengthMask)
+        {
+            WriteLength(destination, matchCode);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<std::byte> Lz4::Compress(std::span<const std::byte> source)
+{
+    std::vector<std::byte> destination;
+    destination.reserve(source.size() + source.size() / 255 + 16);
+
+    std::vector<size_t> table(size_t(1) << hashBits, noPosition);
+    const auto size = source.size();
+    const auto matchLimit = size > matchSafeDistance ? size - matchSafeDistance : 0;
+    size_t anchor(0);
+    size_t position(0);
+    while (position < matchLimit)
+    {
+        const auto sequence = Read32(source, position);
+        const auto hash = (sequence * 2654435761u) >> (32 - hashBits);
+        const auto candidate = table[hash];
+        table[hash] = position;
+
+        if (candidate == noPosition || position - candidate > maxOffset || Read32(source, candidate) != sequence)
+        {
+            ++position;
+            continue;
+        }
+
+        auto length = minMatch;
+        while (position + length < size - lastLiterals && source[candidate + length] == source[position + length])
+        {
+            ++length;
+        }
+
+        WriteSequence(destination, source.subspan(anchor, position - anchor), position - candidate, length);
+        position += length;
+        anchor = position;
+    }
+
+    WriteSequence(destination, source.subspan(anchor), 0, 0);
+
+    return destination;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::optional<std::vector<std::byte>> Lz4::Decompress(std::span<const std::byte> source, size_t size)
+{
+    std::vector<std::byte> destination(size);
+    size_t input(0);
+    size_t output(0);
+    while (input < source.size())
+    {
+        const auto token = static_cast<uint8_t>(source[input++]);
+
+        const auto literalLength = ReadLength(source, input, token >> 4);
+        if (!literalLength.has_value() ||
+            literalLength.value() > source.size() - input || literalLength.value() > size - output)
+        {
+            return std::nullopt;
+        }
+        std::copy_n(source.begin() + static_cast<std::ptrdiff_t>(input), literalLength.value(),
+                    destination.begin() + static_cast<std::ptrdiff_t>(output));
+        input += literalLength.value();
+        output += literalLength.value();
+
+        if (input == source.size())
+        {
+            break;
+        }
+
+        if (source.size() - input < 2)
+        {
+            return std::nullopt;
+        }
+        const auto offset = static_cast<size_t>(source[input]) | static_cast<size_t>(source[input + 1]) << 8;
+        input += 2;
+
+        auto matchLength = ReadLength(source, input, token & lengthMask);
+        if (offset == 0 || offset > output || !matchLength.has_value() ||
+            matchLength.value() + minMatch > size - output)
+        {
+            return std::nullopt;
+        }
+
+        // Match can overlap the output, e.g. offset 1 repeats the last byte, so it is copied byte by byte
+        const auto* match = destination.data() + output - offset;
+        auto* target = destination.data() + output;
+        for (size_t i = 0; i < matchLength.value() + minMatch; ++i)
+        {
+            target[i] = match[i];
+        }
+        output += matchLength.value() + minMatch;
+    }
+
+    if (output != size)
+    {
+        return std::nullopt;
+    }
+
+    return destination;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
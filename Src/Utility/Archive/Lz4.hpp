@@ -0,0 +1,34 @@
+#pragma once
+#include <span>
+#include <vector>
+#include <cstddef>
+#include <optional>
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Codec of the LZ4 block format (without the frame).
+     *
+     * Blobs can be produced and consumed by the reference LZ4 library as well. Compression is greedy with a single
+     * hash table probe, it favours speed over the ratio.
+     */
+    namespace Lz4
+    {
+        /*!
+         * \brief Compresses the data to a single LZ4 block.
+         * \param source - data to compress.
+         * \return Compressed block.
+         */
+        std::vector<std::byte> Compress(std::span<const std::byte> source);
+
+        /*!
+         * \brief Decompresses the LZ4 block.
+         * \param source - compressed block.
+         * \param size - size of the decompressed data, it is not stored in the block.
+         * \return Decompressed data or nothing if the block is malformed or does not decompress to the exact size.
+         */
+        std::optional<std::vector<std::byte>> Decompress(std::span<const std::byte> source, size_t size);
+    }
+}
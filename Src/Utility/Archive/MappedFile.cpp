@@ -0,0 +1,134 @@
+#include "MappedFile.hpp"
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+#ifdef _WIN32
+    _file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                        nullptr);
+    if (_file == INVALID_HANDLE_VALUE)
+    {
+        _file = nullptr;
+        return;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(_file, &size))
+    {
+        _Close();
+        return;
+    }
+    _size = static_cast<size_t>(size.QuadPart);
+
+    // Empty files can not be mapped, but they are still valid files
+    if (_size > 0)
+    {
+        _mapping = CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        _data = _mapping != nullptr
+              ? static_cast<const std::byte*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0))
+              : nullptr;
+        if (_data == nullptr)
+        {
+            _Close();
+            return;
+        }
+    }
+#else
+    const auto file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0)
+    {
+        return;
+    }
+
+    struct stat status{};
+    if (fstat(file, &status) != 0)
+    {
+        close(file);
+        return;
+    }
+    _size = static_cast<size_t>(status.st_size);
+
+    // Empty files can not be mapped, but they are still valid files
+    if (_size > 0)
+    {
+        auto* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data == MAP_FAILED)
+        {
+            close(file);
+            return;
+        }
+        _data = static_cast<const std::byte*>(data);
+    }
+
+    // The mapping keeps its own reference to the file
+    close(file);
+#endif
+
+    _isOpen = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MappedFile::~MappedFile()
+{
+    _Close();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MappedFile::IsOpen() const
+{
+    return _isOpen;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::span<const std::byte> MappedFile::GetData() const
+{
+    return { _data, _size };
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MappedFile::_Close()
+{
+#ifdef _WIN32
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+    }
+    if (_mapping != nullptr)
+    {
+        CloseHandle(_mapping);
+    }
+    if (_file != nullptr)
+    {
+        CloseHandle(_file);
+    }
+    _file = nullptr;
+    _mapping = nullptr;
+#else
+    if (_data != nullptr)
+    {
+        munmap(const_cast<std::byte*>(_data), _size);
+    }
+#endif
+
+    _isOpen = false;
+    _data = nullptr;
+    _size = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
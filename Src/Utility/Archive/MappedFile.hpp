@@ -0,0 +1,66 @@
+#pragma once
+#include <span>
+#include <cstddef>
+#include <filesystem>
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Read-only memory mapping of the whole file.
+     *
+     * Pages are loaded by the OS on the first access and are shared with the page cache, so reading through
+     * the mapping needs neither syscalls nor copies.
+     */
+    class MappedFile final
+    {
+    public:
+        MappedFile(const MappedFile& other) = delete;
+        MappedFile(MappedFile&& other) = delete;
+        MappedFile& operator=(const MappedFile& other) = delete;
+        MappedFile& operator=(MappedFile&& other) = delete;
+
+        /*!
+         * \brief Maps the file, it is left closed if it can not be opened or mapped.
+         * \param path - path to the file.
+         */
+        explicit MappedFile(const std::filesystem::path& path);
+
+        /*!
+         * \brief Destructor, unmaps the file.
+         */
+        ~MappedFile();
+
+        /*!
+         * \brief Checks if the file is mapped.
+         * \return True if the file is mapped. Otherwise - false.
+         */
+        bool IsOpen() const;
+
+        /*!
+         * \brief Returns content of the file.
+         * \return Content of the file, valid for the lifetime of the object.
+         */
+        std::span<const std::byte> GetData() const;
+
+    private:
+        /*!
+         * \brief Unmaps and closes the file.
+         */
+        void _Close();
+
+        /*! Whether the file is mapped. */
+        bool _isOpen = false;
+        /*! Beginning of the mapping, nullptr for empty files. */
+        const std::byte* _data = nullptr;
+        /*! Size of the file. */
+        size_t _size = 0;
+#ifdef _WIN32
+        /*! Handle of the file. */
+        void* _file = nullptr;
+        /*! Handle of the mapping. */
+        void* _mapping = nullptr;
+#endif
+    };
+}
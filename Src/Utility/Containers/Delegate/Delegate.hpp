@@ -0,0 +1,140 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace C2D
+{
+    template <class Signature>
+    class Delegate;
+
+    /*!
+     * \brief Container that stores a function, a class method or a small functor with the specified signature.
+     * \tparam Ret - returning type of a stored function.
+     * \tparam Args - list of arguments of a stored function.
+     *
+     * Unlike std::function, the callable is always stored inside of the delegate, so creating, copying and calling
+     * it never allocates memory. Callables that do not fit the storage are rejected at compile time, as well as
+     * callables that can not be called with the arguments of the signature.
+     */
+    template <class Ret, class ... Args>
+    class Delegate<Ret(Args...)> final
+    {
+    public:
+        /*! Size of the storage, fits a pointer to an object together with a pointer to its method. */
+        static constexpr size_t storageSize = 4 * sizeof(void*);
+
+        Delegate() = default;
+        ~Delegate();
+
+        /*!
+         * \brief Copy constructor.
+         * \param other - delegate whose callable will be copied.
+         */
+        Delegate(const Delegate& other);
+
+        /*!
+         * \brief Move constructor.
+         * \param other - delegate whose callable will be moved, it stays empty.
+         */
+        Delegate(Delegate&& other) noexcept;
+
+        /*!
+         * \brief Copy assignment operator.
+         * \param other - delegate whose callable will be copied.
+         * \return Reference to this delegate.
+         */
+        Delegate& operator=(const Delegate& other);
+
+        /*!
+         * \brief Move assignment operator.
+         * \param other - delegate whose callable will be moved, it stays empty.
+         * \return Reference to this delegate.
+         */
+        Delegate& operator=(Delegate&& other) noexcept;
+
+        /*!
+         * \brief Constructor that creates delegate from a function pointer, a lambda or any other functor.
+         * \tparam Callable - type of the callable.
+         * \param callable - callable that will be stored in the delegate.
+         */
+        template <class Callable,
+                  class = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, Delegate> &&
+                                           std::is_invocable_r_v<Ret, std::decay_t<Callable>&, Args...>>>
+        Delegate(Callable&& callable);
+
+        /*!
+         * \brief Constructor that creates delegate from the pointer to a class method.
+         * \tparam UserClass - class type.
+         * \param userClass - a pointer to a class whose method will be called, must outlive the delegate.
+         * \param method - a pointer to a method which will be called.
+         */
+        template <class UserClass>
+        Delegate(UserClass* userClass, Ret(UserClass::*method)(Args...));
+
+        /*!
+         * \brief Constructor that creates delegate from the pointer to a const class method.
+         * \tparam UserClass - class type.
+         * \param userClass - a pointer to a class whose method will be called, must outlive the delegate.
+         * \param method - a pointer to a method which will be called.
+         */
+        template <class UserClass>
+        Delegate(const UserClass* userClass, Ret(UserClass::*method)(Args...) const);
+
+        /*!
+         * \brief Function call operator.
+         * \param args - arguments that will be used in call of stored callable.
+         * \return Result of the stored callable.
+         *
+         * Throws std::bad_function_call if the delegate is empty.
+         */
+        Ret operator()(Args ... args) const;
+
+        /*!
+         * \brief Checks if the delegate stores a callable.
+         * \return True if the delegate is not empty.
+         */
+        explicit operator bool() const;
+
+    private:
+        /*! Operations on the stored callable that depend on its type. */
+        enum class Operation
+        {
+            Copy,
+            Move,
+            Destroy
+        };
+
+        /*!
+         * \brief Stores the callable and functions that know its type.
+         * \tparam Callable - type of the callable.
+         * \param callable - callable that will be stored in the delegate.
+         */
+        template <class Callable>
+        void _Store(Callable&& callable);
+
+        /*!
+         * \brief Copies or moves callable of the other delegate to this empty one.
+         * \param other - delegate whose callable will be taken.
+         * \param operation - Copy or Move.
+         */
+        void _Take(const Delegate& other, Operation operation);
+
+        /*!
+         * \brief Destroys the stored callable, the delegate becomes empty.
+         */
+        void _Reset();
+
+        /*! Function that calls the stored callable. */
+        Ret(*_invoke)(const void* storage, Args&& ... args) = nullptr;
+        /*! Function that copies, moves or destroys the callable, null for trivially copyable callables. */
+        void(*_manage)(Operation operation, void* storage, const void* other) = nullptr;
+        /*! Storage of the callable. */
+        alignas(std::max_align_t) std::byte _storage[storageSize];
+    };
+
+#include "Delegate.inl"
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+Delegate<Ret(Args...)>::~Delegate()
+{
+    _Reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+Delegate<Ret(Args...)>::Delegate(const Delegate& other)
+{
+    _Take(other, Operation::Copy);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+Delegate<Ret(Args...)>::Delegate(Delegate&& other) noexcept
+{
+    _Take(other, Operation::Move);
+    other._Reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+Delegate<Ret(Args...)>& Delegate<Ret(Args...)>::operator=(const Delegate& other)
+{
+    if (this != &other)
+    {
+        _Reset();
+        _Take(other, Operation::Copy);
+    }
+
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+Delegate<Ret(Args...)>& Delegate<Ret(Args...)>::operator=(Delegate&& other) noexcept
+{
+    if (this != &other)
+    {
+        _Reset();
+        _Take(other, Operation::Move);
+        other._Reset();
+    }
+
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+template <class Callable, class>
+Delegate<Ret(Args...)>::Delegate(Callable&& callable)
+{
+    _Store(std::forward<Callable>(callable));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+template <class UserClass>
+Delegate<Ret(Args...)>::Delegate(UserClass* userClass, Ret(UserClass::*method)(Args...))
+{
+    _Store([userClass, method](Args ... args) -> Ret
+    {
+        return (userClass->*method)(std::forward<Args>(args)...);
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+template <class UserClass>
+Delegate<Ret(Args...)>::Delegate(const UserClass* userClass, Ret(UserClass::*method)(Args...) const)
+{
+    _Store([userClass, method](Args ... args) -> Ret
+    {
+        return (userClass->*method)(std::forward<Args>(args)...);
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+Ret Delegate<Ret(Args...)>::operator()(Args ... args) const
+{
+    if (_invoke == nullptr)
+    {
+        throw std::bad_function_call();
+    }
+
+    return _invoke(_storage, std::forward<Args>(args)...);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+Delegate<Ret(Args...)>::operator bool() const
+{
+    return _invoke != nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+template <class Callable>
+void Delegate<Ret(Args...)>::_Store(Callable&& callable)
+{
+    using Stored = std::decay_t<Callable>;
+    static_assert(sizeof(Stored) <= storageSize, "Callable does not fit the storage of the delegate");
+    static_assert(alignof(Stored) <= alignof(std::max_align_t), "Callable is over-aligned");
+    static_assert(std::is_nothrow_move_constructible_v<Stored>, "Callable must be nothrow move constructible");
+
+    new (_storage) Stored(std::forward<Callable>(callable));
+
+    _invoke = [](const void* storage, Args&& ... args) -> Ret
+    {
+        // Functors are stored in non-const storage, so their call operators can change their state
+        auto& stored = *static_cast<Stored*>(const_cast<void*>(storage));
+        return std::invoke(stored, std::forward<Args>(args)...);
+    };
+
+    // Trivially copyable callables, e.g. function pointers and lambdas that capture pointers, are copied as bytes
+    if constexpr (!std::is_trivially_copyable_v<Stored>)
+    {
+        _manage = [](const Operation operation, void* storage, const void* other)
+        {
+            switch (operation)
+            {
+                case Operation::Copy:
+                    new (storage) Stored(*static_cast<const Stored*>(other));
+                    break;
+                case Operation::Move:
+                    new (storage) Stored(std::move(*static_cast<Stored*>(const_cast<void*>(other))));
+                    break;
+                case Operation::Destroy:
+                    static_cast<Stored*>(storage)->~Stored();
+                    break;
+            }
+        };
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+void Delegate<Ret(Args...)>::_Take(const Delegate& other, const Operation operation)
+{
+    if (other._manage != nullptr)
+    {
+        other._manage(operation, _storage, other._storage);
+    }
+    else if (other._invoke != nullptr)
+    {
+        std::memcpy(_storage, other._storage, storageSize);
+    }
+
+    _invoke = other._invoke;
+    _manage = other._manage;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Ret, class ... Args>
+void Delegate<Ret(Args...)>::_Reset()
+{
+    if (_manage != nullptr)
+    {
+        _manage(Operation::Destroy, _storage, nullptr);
+    }
+
+    _invoke = nullptr;
+    _manage = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,127 @@
+#pragma once
+#include "Utility/Containers/Delegate/Delegate.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace C2D
+{
+    /*!
+     * \brief Multicast event that calls all subscribed handlers.
+     * \tparam Args - list of arguments of the event.
+     *
+     * Subscriptions are stored in a flat vector of delegates that is copied on write: invocation takes a snapshot
+     * of the vector by a reference count, and a change of subscriptions copies the vector only while a snapshot
+     * is held. So invocation is a linear pass that neither allocates nor copies delegates. Handlers can subscribe
+     * and unsubscribe during invocation: new handlers are called starting from the next invocation, removed handlers
+     * are not called anymore.
+     *
+     * Event can also be invoked later: Enqueue() stores the arguments and Dispatch() invokes the event for all
+     * of them in the same order, e.g. once at the end of a tick. Queues keep their memory between ticks, so batched
+     * invocation does not allocate after the first ticks either. Only Enqueue() is thread-safe.
+     */
+    template <class ... Args>
+    class Event final
+    {
+    public:
+        /*! Type of the handlers. */
+        using Handler = Delegate<void(Args...)>;
+        /*! Identifier of the subscription that is used to unsubscribe, 0 is never used. */
+        using SubscriptionId = uint32_t;
+
+        Event() = default;
+        Event(const Event& other) = delete;
+        Event(Event&& other) = delete;
+        Event& operator=(const Event& other) = delete;
+        Event& operator=(Event&& other) = delete;
+        ~Event() = default;
+
+        /*!
+         * \brief Subscribes the handler to the event.
+         * \param handler - delegate that will be called upon invocation of the event.
+         * \return Identifier of the subscription.
+         */
+        SubscriptionId Subscribe(Handler handler);
+
+        /*!
+         * \brief Subscribes the class method to the event.
+         * \tparam UserClass - class type.
+         * \param userClass - a pointer to a class whose method will be called, must outlive the subscription.
+         * \param method - a pointer to a method which will be called.
+         * \return Identifier of the subscription.
+         */
+        template <class UserClass>
+        SubscriptionId Subscribe(UserClass* userClass, void(UserClass::*method)(Args...));
+
+        /*!
+         * \brief Removes the subscription, unknown identifiers are ignored.
+         * \param subscriptionId - identifier returned by Subscribe().
+         */
+        void Unsubscribe(SubscriptionId subscriptionId);
+
+        /*!
+         * \brief Calls all subscribed handlers immediately.
+         * \param args - arguments that will be passed to every handler.
+         */
+        void Invoke(Args ... args);
+
+        /*!
+         * \brief Stores the arguments, so the event is invoked with them upon the next call of Dispatch().
+         * \param args - arguments that will be passed to every handler.
+         *
+         * Thread-safe, can be called concurrently with other calls of Enqueue() and with Dispatch().
+         */
+        void Enqueue(Args ... args);
+
+        /*!
+         * \brief Invokes the event for all enqueued arguments in the order they were enqueued.
+         *
+         * Events that are enqueued by handlers are left for the next call. Must not be called by handlers.
+         */
+        void Dispatch();
+
+        /*!
+         * \brief Returns number of subscribed handlers.
+         * \return Number of subscribed handlers.
+         */
+        size_t GetSubscriberCount() const;
+
+    private:
+        struct Subscription
+        {
+            /*! Identifier of the subscription. */
+            SubscriptionId id;
+            /*! Handler of the subscription. */
+            Handler handler;
+        };
+
+        /*! Type of stored arguments of enqueued events. */
+        using Arguments = std::tuple<std::decay_t<Args>...>;
+
+        /*!
+         * \brief Returns subscriptions that can be modified, they are copied if an invocation holds a snapshot.
+         * \return Array of subscriptions that is not shared with invocations.
+         */
+        std::vector<Subscription>& _GetWritableSubscriptions();
+
+        /*! Array of subscriptions in the order of subscription, shared with invocations as a snapshot. */
+        std::shared_ptr<std::vector<Subscription>> _subscriptions = std::make_shared<std::vector<Subscription>>();
+        /*! Identifier of the next subscription. */
+        SubscriptionId _nextId = 1;
+        /*! Number of nested invocations. */
+        uint32_t _invocationDepth = 0;
+        /*! Subscriptions removed during invocation, snapshots still contain them, so invocations skip them. */
+        std::vector<SubscriptionId> _removedDuringInvocation;
+        /*! Arguments of enqueued events. */
+        std::vector<Arguments> _queue;
+        /*! Arguments of events that are being dispatched, swapped with the queue so both keep their memory. */
+        std::vector<Arguments> _dispatchQueue;
+        /*! Mutex that is used to lock the queue. */
+        std::mutex _queueMutex;
+    };
+
+#include "Event.inl"
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ... Args>
+typename Event<Args...>::SubscriptionId Event<Args...>::Subscribe(Handler handler)
+{
+    const auto id = _nextId++;
+    _GetWritableSubscriptions().push_back({ id, std::move(handler) });
+
+    return id;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ... Args>
+template <class UserClass>
+typename Event<Args...>::SubscriptionId Event<Args...>::Subscribe(UserClass* userClass,
+                                                                  void(UserClass::*method)(Args...))
+{
+    return Subscribe(Handler(userClass, method));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ... Args>
+void Event<Args...>::Unsubscribe(const SubscriptionId subscriptionId)
+{
+    const auto isRemoved = [subscriptionId](const Subscription& subscription)
+    {
+        return subscription.id == subscriptionId;
+    };
+    if (subscriptionId == 0 || std::none_of(_subscriptions->begin(), _subscriptions->end(), isRemoved))
+    {
+        return;
+    }
+
+    auto& subscriptions = _GetWritableSubscriptions();
+    subscriptions.erase(std::find_if(subscriptions.begin(), subscriptions.end(), isRemoved));
+
+    // Snapshots of running invocations still contain the handler
+    if (_invocationDepth > 0)
+    {
+        _removedDuringInvocation.push_back(subscriptionId);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ... Args>
+void Event<Args...>::Invoke(Args ... args)
+{
+    // Snapshot keeps handlers alive and in place even if they change subscriptions, handlers that are subscribed
+    // during invocation are not in it and are not called this time
+    const auto subscriptions = _subscriptions;
+    ++_invocationDepth;
+
+    for (const auto& subscription : *subscriptions)
+    {
+        const auto isRemoved = !_removedDuringInvocation.empty() &&
+                               std::find(_removedDuringInvocation.begin(),
+                                         _removedDuringInvocation.end(),
+                                         subscription.id) != _removedDuringInvocation.end();
+        if (!isRemoved)
+        {
+            subscription.handler(args...);
+        }
+    }
+
+    // Memory is kept for the next invocation
+    if (--_invocationDepth == 0)
+    {
+        _removedDuringInvocation.clear();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ... Args>
+void Event<Args...>::Enqueue(Args ... args)
+{
+    std::lock_guard lock(_queueMutex);
+    _queue.emplace_back(std::move(args)...);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ... Args>
+void Event<Args...>::Dispatch()
+{
+    {
+        std::lock_guard lock(_queueMutex);
+        std::swap(_queue, _dispatchQueue);
+    }
+
+    for (auto& arguments : _dispatchQueue)
+    {
+        std::apply([this](auto& ... unpacked) { Invoke(unpacked...); }, arguments);
+    }
+
+    // Memory is kept for the next tick
+    _dispatchQueue.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ... Args>
+size_t Event<Args...>::GetSubscriberCount() const
+{
+    return _subscriptions->size();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ... Args>
+std::vector<typename Event<Args...>::Subscription>& Event<Args...>::_GetWritableSubscriptions()
+{
+    // Only running invocations share the array, so it is copied only when handlers change subscriptions
+    if (_subscriptions.use_count() > 1)
+    {
+        _subscriptions = std::make_shared<std::vector<Subscription>>(*_subscriptions);
+    }
+
+    return *_subscriptions;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
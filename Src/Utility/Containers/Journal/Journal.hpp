@@ -0,0 +1,93 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace C2D
+{
+    /*!
+     * \brief Unbounded lock-free journal for any number of producer threads and a single consumer thread.
+     * \tparam T Type of entries that will be stored within the journal.
+     *
+     * Entries are appended to a linked list with a single compare-and-swap and the consumer takes the whole list
+     * with a single exchange, so the consumer pays only for the entries that were appended since the last call.
+     * Each entry is allocated separately, so the journal suits rare events, e.g. changes of a scene,
+     * rather than streams of data.
+     *
+     * Usage example:
+     * \code
+     * C2D::Journal<Change> journal;
+     * // Any thread
+     * journal.Append(Change{ ... });
+     * // Consumer thread
+     * journal.Consume([](Change& change) { Apply(change); });
+     * \endcode
+     */
+    template <class T>
+    class Journal final
+    {
+    public:
+        Journal() = default;
+        Journal(const Journal&) = delete;
+        Journal(Journal&&) = delete;
+        Journal& operator=(const Journal&) = delete;
+        Journal& operator=(Journal&&) = delete;
+
+        /*!
+         * \brief Destroys entries that were not consumed.
+         */
+        ~Journal();
+
+        /*!
+         * \brief Appends new entry to the journal.
+         * \param entry New entry that will be added to the journal as a copy of provided one.
+         */
+        void Append(const T& entry);
+
+        /*!
+         * \brief Appends new entry to the journal.
+         * \param entry New entry that will be moved to the journal.
+         */
+        void Append(T&& entry);
+
+        /*!
+         * \brief (Consumer only) Takes all appended entries and passes them to the function in the order of appending.
+         * \param function Function that is called with a reference to each entry.
+         * \return Number of consumed entries.
+         *
+         * Entries that are appended while the function is called are left for the next call.
+         */
+        template <class Function>
+        size_t Consume(Function&& function);
+
+        /*!
+         * \brief Checks if there are no entries, exact only if no thread appends at the moment.
+         * \return True if the journal is empty.
+         */
+        bool IsEmpty() const;
+
+    private:
+        /*!
+         * \brief Node of the linked list.
+         */
+        struct Node
+        {
+            /*! Stored entry. */
+            T entry;
+            /*! Entry that was appended before this one. */
+            Node* previous;
+        };
+
+        /*!
+         * \brief Links the node to the journal.
+         * \param node Node that becomes the last entry of the journal.
+         */
+        void _Link(Node* node);
+
+        /*! The last appended entry, the list goes from the newest entries to the oldest ones. */
+        std::atomic<Node*> _last = nullptr;
+    };
+
+#include "Journal.inl"
+
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+Journal<T>::~Journal()
+{
+    Consume([](T&) { });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+void Journal<T>::Append(const T& entry)
+{
+    _Link(new Node{ entry, nullptr });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+void Journal<T>::Append(T&& entry)
+{
+    _Link(new Node{ std::move(entry), nullptr });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+template <class Function>
+size_t Journal<T>::Consume(Function&& function)
+{
+    // Acquire makes entries visible to the consumer, the list is private after the exchange
+    auto* node = _last.exchange(nullptr, std::memory_order_acquire);
+
+    // The list is reversed, so entries are passed in the order of appending
+    Node* first(nullptr);
+    while (node)
+    {
+        auto* previous = node->previous;
+        node->previous = first;
+        first = node;
+        node = previous;
+    }
+
+    size_t count(0);
+    while (first)
+    {
+        auto* next = first->previous;
+        function(first->entry);
+        delete first;
+        first = next;
+        ++count;
+    }
+
+    return count;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+bool Journal<T>::IsEmpty() const
+{
+    return _last.load(std::memory_order_relaxed) == nullptr;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T>
+void Journal<T>::_Link(Node* node)
+{
+    // Release publishes the entry together with the node, failed attempts only reload the last node
+    node->previous = _last.load(std::memory_order_relaxed);
+    while (!_last.compare_exchange_weak(node->previous, node, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
@@ -2,12 +2,20 @@
 #include <vector>
 #include <limits>
 #include <algorithm>
+#include <bit>
+#include <span>
+#include <utility>
 
 namespace C2D
 {
     /*!
      * \brief Container that uses a single, fixed-size buffer as if it were connected end-to-end.
      * \tparam T - type of used data.
+     *
+     * Indices are wrapped in constant time. If the size is a power of two, they are wrapped by a mask,
+     * otherwise by a single subtraction. Stored entries occupy at most two contiguous parts of the buffer,
+     * which are available through GetSpans() for bulk copies and reductions.
+     * For exchange of entries between two threads SpscQueue should be used.
      */
     template <class T, class A = std::allocator<T>>
     class RingBuffer
@@ -192,6 +200,46 @@ namespace C2D
          */
         void EmplaceBack(T&& entry);
 
+        /*!
+         * \brief Adds new entries to the end of ring buffer.
+         * \param entries - new entries that will be copied to the ring buffer.
+         *
+         * Entries are copied by at most two contiguous blocks. If there are more entries than the size of the buffer,
+         * only the last ones are kept.
+         */
+        void PushBack(std::span<const T> entries);
+
+        /*!
+         * \brief Removes all entries, the size of the buffer is not changed.
+         */
+        void Clear();
+
+        /*!
+         * \brief Grabs number of stored entries.
+         * \return Number of stored entries, not greater than the size.
+         */
+        size_type GetCount() const;
+
+        /*!
+         * \brief Accesses stored entry.
+         * \param index - index of the entry, 0 is the oldest one. Must be less than GetCount().
+         * \return Reference to the entry.
+         */
+        T& operator[](size_type index);
+
+        /*!
+         * \brief Accesses stored entry.
+         * \param index - index of the entry, 0 is the oldest one. Must be less than GetCount().
+         * \return Const reference to the entry.
+         */
+        const T& operator[](size_type index) const;
+
+        /*!
+         * \brief Grabs stored entries as two contiguous parts of the buffer.
+         * \return Older entries and newer entries, the second part is empty if entries are not wrapped.
+         */
+        std::pair<std::span<const T>, std::span<const T>> GetSpans() const;
+
         /*!
          * \brief Returns an iterator to the beginning of the ring buffer.
          * \return An iterator to the beginning of the ring buffer.
@@ -225,12 +273,36 @@ namespace C2D
         bool _ValidateIndex(size_type index);
 
         /*!
-         * \brief Changes specified index by specified value
-         *        and make sure that new index value will be in the range of buffer indices.
-         * \param index - index that will be changed.
-         * \param diff - diff of value.
+         * \brief Wraps index to the range of buffer indices.
+         * \param index - index that is less than twice the size of the buffer.
+         * \return Wrapped index.
+         */
+        size_type _Wrap(size_type index) const;
+
+        /*!
+         * \brief Returns index of the next entry in the buffer.
+         * \param index - index of the entry.
+         * \return Index of the next entry, wrapped to the start of the buffer.
+         */
+        size_type _NextIndex(size_type index) const;
+
+        /*!
+         * \brief Returns index of the previous entry in the buffer.
+         * \param index - index of the entry.
+         * \return Index of the previous entry, wrapped to the end of the buffer.
+         */
+        size_type _PreviousIndex(size_type index) const;
+
+        /*!
+         * \brief Moves the tail to the slot of a new entry, the head is moved if the oldest entry is overwritten.
+         * \return Index of the slot for a new entry.
+         */
+        size_type _PushIndex();
+
+        /*!
+         * \brief Updates the indexing mode after the size of the buffer is changed.
          */
-        void _ChangeIndex(size_type& index, size_type diff) const;
+        void _UpdateIndexing();
 
         /*! Simple index that is used by "end" iterator. */
         static const size_type EndIndex = std::numeric_limits<size_type>::max();
@@ -240,6 +312,8 @@ namespace C2D
         size_type _tailIndex;
         /*! Simple inner flag that shows if ring buffer currently is empty or not. */
         bool _empty;
+        /*! Flag that shows if the size is a power of two, so indices are wrapped by mask. */
+        bool _isPowerOfTwo;
         /*! Buffer that stores data. */
         std::vector<T, A> _buffer;
     };
@@ -3,9 +3,10 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <class T, class A>
-RingBuffer<T, A>::RingBuffer() : _headIndex(0), _tailIndex(0), _empty(true)
+RingBuffer<T, A>::RingBuffer() : _headIndex(0), _tailIndex(0), _empty(true), _isPowerOfTwo(false)
 {
     _buffer.resize(10);
+    _UpdateIndexing();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,6 +67,7 @@ void RingBuffer<T, A>::Resize(size_type newSize)
 
             // Resize buffer
             _buffer.resize(newSize);
+            _UpdateIndexing();
         }
         // If a new size is bigger than a current one, we should rotate vector in such way
         // that head of the ring would be at the start of the vector
@@ -92,6 +94,7 @@ void RingBuffer<T, A>::Resize(size_type newSize)
 
             // Resize buffer
             _buffer.resize(newSize);
+            _UpdateIndexing();
         }
     }
 }
@@ -109,57 +112,102 @@ typename RingBuffer<T, A>::size_type RingBuffer<T, A>::GetSize() const
 template <class T, class A>
 void RingBuffer<T, A>::PushBack(const T& entry)
 {
-    // If empty flag is true and tail and head indexes are equal, that means buffer is empty
-    // and we should just assign new value to the first buffer element
-    if (_empty && (_tailIndex == _headIndex))
-    {
-        _buffer[_tailIndex] = entry;
+    _buffer[_PushIndex()] = entry;
+}
 
-        _empty = false;
-    }
-    // If tail and head indexes are different then just do a common indexes shifts and other operations
-    else
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, class A>
+void RingBuffer<T, A>::EmplaceBack(T&& entry)
+{
+    _buffer[_PushIndex()] = std::move(entry);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, class A>
+void RingBuffer<T, A>::PushBack(std::span<const T> entries)
+{
+    if (entries.empty())
     {
-        _ChangeIndex(_tailIndex, 1);
-        //_IncreaseIndex(_tailIndex);
+        return;
+    }
 
-        // If tail and head indexes are equal, increase head index
-        if (_tailIndex == _headIndex)
-        {
-            _ChangeIndex(_headIndex, 1);
-        }
+    const auto bufferSize = _buffer.size();
 
-        _buffer[_tailIndex] = entry;
+    // Older entries would be overwritten anyway, so only the last ones are copied
+    if (entries.size() > bufferSize)
+    {
+        entries = entries.last(bufferSize);
     }
+
+    const auto count = GetCount();
+    const auto first = _empty ? _tailIndex : _NextIndex(_tailIndex);
+
+    // Entries are copied up to the end of the buffer and the rest is copied to its start
+    const auto firstPart = std::min(entries.size(), bufferSize - first);
+    std::copy(entries.begin(), entries.begin() + firstPart, _buffer.begin() + first);
+    std::copy(entries.begin() + firstPart, entries.end(), _buffer.begin());
+
+    const auto newCount = std::min(count + entries.size(), bufferSize);
+    _tailIndex = _Wrap(first + entries.size() - 1);
+    _headIndex = _Wrap(_tailIndex + bufferSize - newCount + 1);
+    _empty = false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <class T, class A>
-void RingBuffer<T, A>::EmplaceBack(T&& entry)
+void RingBuffer<T, A>::Clear()
 {
-    // If empty flag is true and tail and head indexes are equal, that means buffer is empty
-    // and we should just assign new value to the first buffer element
-    if (_empty && (_tailIndex == _headIndex))
-    {
-        _buffer[_tailIndex] = entry;
+    _headIndex = 0;
+    _tailIndex = 0;
+    _empty = true;
+}
 
-        _empty = false;
-    }
-    // If tail and head indexes are different then just do a common indexes shifts and other operations
-    else
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, class A>
+typename RingBuffer<T, A>::size_type RingBuffer<T, A>::GetCount() const
+{
+    return _empty ? 0 : _Wrap(_tailIndex + _buffer.size() - _headIndex) + 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, class A>
+T& RingBuffer<T, A>::operator[](const size_type index)
+{
+    return _buffer[_Wrap(_headIndex + index)];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, class A>
+const T& RingBuffer<T, A>::operator[](const size_type index) const
+{
+    return _buffer[_Wrap(_headIndex + index)];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, class A>
+std::pair<std::span<const T>, std::span<const T>> RingBuffer<T, A>::GetSpans() const
+{
+    if (_empty)
     {
-        _ChangeIndex(_tailIndex, 1);
-        //_IncreaseIndex(_tailIndex);
+        return {};
+    }
 
-        // If tail and head indexes are equal, increase head index
-        if (_tailIndex == _headIndex)
-        {
-            _ChangeIndex(_headIndex, 1);
-        }
+    const std::span<const T> buffer(_buffer);
 
-        _buffer[_tailIndex] = entry;
+    // If the tail is not wrapped, all entries are in one part
+    if (_headIndex <= _tailIndex)
+    {
+        return { buffer.subspan(_headIndex, _tailIndex - _headIndex + 1), {} };
     }
+
+    return { buffer.subspan(_headIndex), buffer.first(_tailIndex + 1) };
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -236,26 +284,60 @@ bool RingBuffer<T, A>::_ValidateIndex(const size_type index)
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <class T, class A>
-void RingBuffer<T, A>::_ChangeIndex(size_type &index, size_type diff) const
+typename RingBuffer<T, A>::size_type RingBuffer<T, A>::_Wrap(const size_type index) const
 {
-    index += diff;
     const auto bufferSize = _buffer.size();
 
-    // If the new index value is bigger than buffer size
-    // then we should continuously make it is smaller
-    // until it will be in the range
-    while (index >= bufferSize)
+    // Power-of-two sizes are wrapped by mask, other sizes by a single conditional subtraction
+    return _isPowerOfTwo ? (index & (bufferSize - 1)) : (index - (index >= bufferSize) * bufferSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, class A>
+typename RingBuffer<T, A>::size_type RingBuffer<T, A>::_NextIndex(const size_type index) const
+{
+    return _Wrap(index + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, class A>
+typename RingBuffer<T, A>::size_type RingBuffer<T, A>::_PreviousIndex(const size_type index) const
+{
+    // Size is added first, so the unsigned index does not underflow
+    return _Wrap(index + _buffer.size() - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, class A>
+typename RingBuffer<T, A>::size_type RingBuffer<T, A>::_PushIndex()
+{
+    // If buffer is empty, head and tail indexes are equal and the first entry is stored at the tail
+    if (_empty)
     {
-        index -= bufferSize;
+        _empty = false;
+        return _tailIndex;
     }
 
-    // If the new index value is lesser than buffer size
-    // then we should continuously make it is bigger
-    // until it will be in the range
-    while (index < 0)
+    _tailIndex = _NextIndex(_tailIndex);
+
+    // If tail and head indexes are equal, the oldest entry is overwritten, so increase head index
+    if (_tailIndex == _headIndex)
     {
-        index += bufferSize;
+        _headIndex = _NextIndex(_headIndex);
     }
+
+    return _tailIndex;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, class A>
+void RingBuffer<T, A>::_UpdateIndexing()
+{
+    _isPowerOfTwo = std::has_single_bit(_buffer.size());
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,7 +28,7 @@ typename RingBuffer<T, A>::Iterator& RingBuffer<T, A>::Iterator::operator++()
             else
             {
                 // Increase index
-                _ringBuffer->_ChangeIndex(_index, 1);
+                _index = _ringBuffer->_NextIndex(_index);
             }
         }
     }
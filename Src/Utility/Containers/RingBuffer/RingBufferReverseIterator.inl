@@ -27,7 +27,7 @@ typename RingBuffer<T, A>::ReverseIterator& RingBuffer<T, A>::ReverseIterator::o
             else
             {
                 // Decrease index
-                _ringBuffer->_ChangeIndex(_index, -1);
+                _index = _ringBuffer->_PreviousIndex(_index);
             }
         }
     }
@@ -0,0 +1,102 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace C2D
+{
+    /*!
+     * \brief Bounded lock-free queue for a single producer thread and a single consumer thread.
+     * \tparam T Type of items that will be stored within the queue.
+     * \tparam Capacity Maximum number of items in the queue, must be a power of two.
+     *
+     * Items are stored in a fixed array, so pushing and popping never allocate. Indices of the producer and
+     * the consumer live on separate cache lines, so threads do not invalidate each other's caches on every operation.
+     */
+    template <class T, size_t Capacity>
+    class SpscQueue final
+    {
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+        static_assert(std::is_default_constructible_v<T>, "Items must be default constructible");
+
+        /*! Size of the cache line that is used to separate indices of the producer and the consumer. */
+        static constexpr size_t cacheLineSize = 64;
+
+    public:
+        SpscQueue() = default;
+        ~SpscQueue() = default;
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue(SpscQueue&&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+        SpscQueue& operator=(SpscQueue&&) = delete;
+
+        /*!
+         * \brief (Producer only) Pushes new item to the queue.
+         * \param item New item that will be added to the queue as a copy of provided one.
+         * \return True if the item was pushed. False if the queue is full.
+         */
+        bool TryPush(const T& item);
+
+        /*!
+         * \brief (Producer only) Pushes new item to the queue.
+         * \param item New item that will be moved to the queue.
+         * \return True if the item was pushed. False if the queue is full, then the item is not moved.
+         */
+        bool TryPush(T&& item);
+
+        /*!
+         * \brief (Consumer only) Pops item from the queue.
+         * \param item Item that receives the front of the queue.
+         * \return True if the item was popped. False if the queue is empty.
+         */
+        bool TryPop(T& item);
+
+        /*!
+         * \brief (Consumer only) Returns the front item without popping it.
+         * \return Pointer to the front item or nullptr if the queue is empty.
+         *         Pointer is valid until the item is popped.
+         */
+        const T* Front() const;
+
+        /*!
+         * \brief (Consumer only) Removes the front item, the queue must not be empty.
+         */
+        void Pop();
+
+        /*!
+         * \brief Returns approximate number of items, exact only when called by the producer or the consumer
+         *        while the other thread is idle.
+         * \return Number of items in the queue.
+         */
+        size_t GetSize() const;
+
+        /*!
+         * \brief Returns maximum number of items in the queue.
+         * \return Capacity of the queue.
+         */
+        static constexpr size_t GetCapacity();
+
+    private:
+        /*!
+         * \brief Pushes the item that is forwarded to the storage.
+         * \param item Item that will be added to the queue.
+         * \return True if the item was pushed. False if the queue is full.
+         */
+        template <class U>
+        bool _Push(U&& item);
+
+        /*! Mask that wraps indices to the array. */
+        static constexpr size_t indexMask = Capacity - 1;
+
+        /*! Index of the next item to pop, written by the consumer only. */
+        alignas(cacheLineSize) std::atomic<size_t> _head = 0;
+        /*! Index of the next item to push, written by the producer only. */
+        alignas(cacheLineSize) std::atomic<size_t> _tail = 0;
+        /*! Items of the queue. */
+        alignas(cacheLineSize) std::array<T, Capacity> _items;
+    };
+
+#include "SpscQueue.inl"
+
+}
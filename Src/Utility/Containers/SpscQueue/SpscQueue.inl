@@ -0,0 +1,95 @@
+#pragma once
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T, size_t Capacity>
+bool SpscQueue<T, Capacity>::TryPush(const T& item)
+{
+    return _Push(item);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T, size_t Capacity>
+bool SpscQueue<T, Capacity>::TryPush(T&& item)
+{
+    return _Push(std::move(item));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T, size_t Capacity>
+bool SpscQueue<T, Capacity>::TryPop(T& item)
+{
+    const auto head = _head.load(std::memory_order_relaxed);
+    if (head == _tail.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    item = std::move(_items[head & indexMask]);
+    // Release makes the slot available to the producer only after the item was moved out of it
+    _head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T, size_t Capacity>
+const T* SpscQueue<T, Capacity>::Front() const
+{
+    const auto head = _head.load(std::memory_order_relaxed);
+    if (head == _tail.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    return &_items[head & indexMask];
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T, size_t Capacity>
+void SpscQueue<T, Capacity>::Pop()
+{
+    _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T, size_t Capacity>
+size_t SpscQueue<T, Capacity>::GetSize() const
+{
+    return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T, size_t Capacity>
+constexpr size_t SpscQueue<T, Capacity>::GetCapacity()
+{
+    return Capacity;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+template <class T, size_t Capacity>
+template <class U>
+bool SpscQueue<T, Capacity>::_Push(U&& item)
+{
+    // Indices grow monotonically and are wrapped only to access the array, so a full queue differs from the empty one
+    const auto tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _head.load(std::memory_order_acquire) == Capacity)
+    {
+        return false;
+    }
+
+    _items[tail & indexMask] = std::forward<U>(item);
+    // Release publishes the item to the consumer together with the new index
+    _tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
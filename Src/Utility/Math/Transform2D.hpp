@@ -0,0 +1,146 @@
+#pragma once
+#include "Utility/Math/FastMath.hpp"
+#include "Utility/Math/MathConstants.hpp"
+#include "Utility/Math/Vector2.hpp"
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Compact affine transform of 2D space.
+     *
+     * Stores only the top two rows of the 3x3 matrix, 6 floats instead of 16 floats of sf::Transform:
+     * \code
+     * | a  b  tx |
+     * | c  d  ty |
+     * | 0  0  1  |
+     * \endcode
+     * So a point is transformed as x' = a * x + b * y + tx, y' = c * x + d * y + ty.
+     * All operations except creation of rotations are constexpr. Rotations use SinCos() approximation.
+     *
+     * Usage example:
+     * \code
+     * const auto transform = C2D::Transform2D::Translation(10.0f, 0.0f) * C2D::Transform2D::Rotation(90.0f);
+     * const auto point = transform.TransformPoint(C2D::Vector2f(1.0f, 0.0f)); // (10, 1)
+     * \endcode
+     */
+    class Transform2D
+    {
+    public:
+        /*!
+         * \brief Default constructor that creates identity transform.
+         */
+        constexpr Transform2D();
+
+        /*!
+         * \brief Constructor from the elements of the matrix.
+         * \param aValue Element of the first row and the first column.
+         * \param bValue Element of the first row and the second column.
+         * \param txValue Translation along x axis.
+         * \param cValue Element of the second row and the first column.
+         * \param dValue Element of the second row and the second column.
+         * \param tyValue Translation along y axis.
+         */
+        constexpr Transform2D(float aValue, float bValue, float txValue, float cValue, float dValue, float tyValue);
+
+        /*!
+         * \brief Creates translation.
+         * \param x Offset along x axis.
+         * \param y Offset along y axis.
+         * \return Transform that moves points by the offset.
+         */
+        static constexpr Transform2D Translation(float x, float y);
+
+        /*!
+         * \brief Creates scaling relative to the origin of coordinates.
+         * \param x Factor along x axis.
+         * \param y Factor along y axis.
+         * \return Transform that scales points.
+         */
+        static constexpr Transform2D Scaling(float x, float y);
+
+        /*!
+         * \brief Creates rotation around the origin of coordinates.
+         * \param degrees Angle in degrees, positive angles rotate clockwise on the screen as TransformComponent does.
+         * \return Transform that rotates points.
+         */
+        static constexpr Transform2D Rotation(float degrees);
+
+        /*!
+         * \brief Creates transform from the components in the same way as TransformComponent.
+         * \param origin Origin of the object, it is placed at the position.
+         * \param position Position of the object.
+         * \param degrees Rotation of the object in degrees.
+         * \param scale Scale of the object.
+         * \return Transform that is equal to
+         *         Translation(position) * Rotation(degrees) * Scaling(scale) * Translation(-origin).
+         */
+        static constexpr Transform2D FromComponents(const Vector2f& origin,
+                                                    const Vector2f& position,
+                                                    float degrees,
+                                                    const Vector2f& scale);
+
+        /*!
+         * \brief Combines transforms.
+         * \param right Transform that is applied before this one.
+         * \return Transform that applies right transform and then this one.
+         */
+        constexpr Transform2D operator*(const Transform2D& right) const;
+
+        /*!
+         * \brief Combines transforms and assigns the result.
+         * \param right Transform that is applied before this one.
+         * \return Reference to the transform after assignment.
+         */
+        constexpr Transform2D& operator*=(const Transform2D& right);
+
+        /*!
+         * \brief Equality operator.
+         * \param right Other transform.
+         * \return True if all elements are equal. Otherwise - false.
+         */
+        constexpr bool operator==(const Transform2D& right) const;
+
+        /*!
+         * \brief Transforms the point.
+         * \param point Point to transform.
+         * \return Transformed point.
+         */
+        constexpr Vector2f TransformPoint(const Vector2f& point) const;
+
+        /*!
+         * \brief Transforms the direction, translation is not applied.
+         * \param vector Direction to transform.
+         * \return Transformed direction.
+         */
+        constexpr Vector2f TransformVector(const Vector2f& vector) const;
+
+        /*!
+         * \brief Returns determinant of the linear part.
+         * \return Determinant, zero if the transform can not be inverted.
+         */
+        constexpr float GetDeterminant() const;
+
+        /*!
+         * \brief Returns the inverse transform.
+         * \return Inverse transform or identity if the determinant is zero.
+         */
+        constexpr Transform2D GetInverse() const;
+
+        /*! Element of the first row and the first column. */
+        float a;
+        /*! Element of the first row and the second column. */
+        float b;
+        /*! Translation along x axis. */
+        float tx;
+        /*! Element of the second row and the first column. */
+        float c;
+        /*! Element of the second row and the second column. */
+        float d;
+        /*! Translation along y axis. */
+        float ty;
+    };
+
+#include <Utility/Math/Transform2D.inl>
+}
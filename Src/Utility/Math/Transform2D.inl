@@ -0,0 +1,135 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Transform2D::Transform2D() : a(1.0f), b(0.0f), tx(0.0f), c(0.0f), d(1.0f), ty(0.0f)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Transform2D::Transform2D(const float aValue,
+                                   const float bValue,
+                                   const float txValue,
+                                   const float cValue,
+                                   const float dValue,
+                                   const float tyValue)
+: a(aValue)
+, b(bValue)
+, tx(txValue)
+, c(cValue)
+, d(dValue)
+, ty(tyValue)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Transform2D Transform2D::Translation(const float x, const float y)
+{
+    return Transform2D(1.0f, 0.0f, x, 0.0f, 1.0f, y);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Transform2D Transform2D::Scaling(const float x, const float y)
+{
+    return Transform2D(x, 0.0f, 0.0f, 0.0f, y, 0.0f);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Transform2D Transform2D::Rotation(const float degrees)
+{
+    float sine(0.0f), cosine(0.0f);
+    SinCos(-degrees * FromDegToRad, sine, cosine);
+
+    return Transform2D(cosine, sine, 0.0f, -sine, cosine, 0.0f);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Transform2D Transform2D::FromComponents(const Vector2f& origin,
+                                                  const Vector2f& position,
+                                                  const float degrees,
+                                                  const Vector2f& scale)
+{
+    float sine(0.0f), cosine(0.0f);
+    SinCos(-degrees * FromDegToRad, sine, cosine);
+
+    // Same expansion of the product as in TransformComponent::GetTransform()
+    const auto sxc = scale.x * cosine;
+    const auto syc = scale.y * cosine;
+    const auto sxs = scale.x * sine;
+    const auto sys = scale.y * sine;
+
+    return Transform2D(sxc, sys, -origin.x * sxc - origin.y * sys + position.x,
+                       -sxs, syc, origin.x * sxs - origin.y * syc + position.y);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Transform2D Transform2D::operator*(const Transform2D& right) const
+{
+    return Transform2D(a * right.a + b * right.c,
+                       a * right.b + b * right.d,
+                       a * right.tx + b * right.ty + tx,
+                       c * right.a + d * right.c,
+                       c * right.b + d * right.d,
+                       c * right.tx + d * right.ty + ty);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Transform2D& Transform2D::operator*=(const Transform2D& right)
+{
+    *this = *this * right;
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr bool Transform2D::operator==(const Transform2D& right) const
+{
+    return a == right.a && b == right.b && tx == right.tx && c == right.c && d == right.d && ty == right.ty;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Vector2f Transform2D::TransformPoint(const Vector2f& point) const
+{
+    return Vector2f(a * point.x + b * point.y + tx, c * point.x + d * point.y + ty);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Vector2f Transform2D::TransformVector(const Vector2f& vector) const
+{
+    return Vector2f(a * vector.x + b * vector.y, c * vector.x + d * vector.y);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr float Transform2D::GetDeterminant() const
+{
+    return a * d - b * c;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr Transform2D Transform2D::GetInverse() const
+{
+    const auto determinant = GetDeterminant();
+    if (determinant == 0.0f)
+    {
+        return Transform2D();
+    }
+
+    const auto inverse = 1.0f / determinant;
+    return Transform2D(d * inverse,
+                       -b * inverse,
+                       (b * ty - d * tx) * inverse,
+                       -c * inverse,
+                       a * inverse,
+                       (c * tx - a * ty) * inverse);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
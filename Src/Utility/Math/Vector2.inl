@@ -147,9 +147,6 @@ template <typename T, bool IsAtomic>
 template <bool RightVectorIsAtomic>
 constexpr bool Vector2<T, IsAtomic>::operator==(const Vector2<T, RightVectorIsAtomic>& rightVector) const
 {
-    T otherVectorX;
-    T otherVectorY;
-
     if constexpr (RightVectorIsAtomic)
     {
         if constexpr (IsAtomic)
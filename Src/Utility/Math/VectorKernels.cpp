@@ -0,0 +1,262 @@
+#include "VectorKernels.hpp"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX2__)
+    #define C2D_VECTOR_KERNELS_AVX2
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define C2D_VECTOR_KERNELS_SSE2
+    #include <emmintrin.h>
+#endif
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Kernels load vectors as arrays of floats
+    static_assert(sizeof(Vector2f) == 2 * sizeof(float));
+    static_assert(std::is_standard_layout_v<Vector2f>);
+
+    const float* AsFloats(std::span<const Vector2f> vectors)
+    {
+        return reinterpret_cast<const float*>(vectors.data());
+    }
+
+    float* AsFloats(std::span<Vector2f> vectors)
+    {
+        return reinterpret_cast<float*>(vectors.data());
+    }
+
+#if defined(C2D_VECTOR_KERNELS_AVX2)
+    /*! Number of vectors that are processed by one iteration of the main loop. */
+    constexpr size_t vectorsPerStep = 4;
+#elif defined(C2D_VECTOR_KERNELS_SSE2)
+    /*! Number of vectors that are processed by one iteration of the main loop. */
+    constexpr size_t vectorsPerStep = 2;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void VectorKernels::TransformPoints(const Transform2D& transform,
+                                    std::span<const Vector2f> input,
+                                    std::span<Vector2f> output)
+{
+    size_t processed(0);
+
+#if defined(C2D_VECTOR_KERNELS_AVX2)
+    // Each point is [x y], so x' = [a c] * xx + [b d] * yy + [tx ty] for every pair of lanes
+    const auto ac = _mm256_setr_ps(transform.a, transform.c, transform.a, transform.c,
+                                   transform.a, transform.c, transform.a, transform.c);
+    const auto bd = _mm256_setr_ps(transform.b, transform.d, transform.b, transform.d,
+                                   transform.b, transform.d, transform.b, transform.d);
+    const auto t = _mm256_setr_ps(transform.tx, transform.ty, transform.tx, transform.ty,
+                                  transform.tx, transform.ty, transform.tx, transform.ty);
+    const auto* source = AsFloats(input);
+    auto* destination = AsFloats(output);
+    for (; processed + vectorsPerStep <= input.size(); processed += vectorsPerStep)
+    {
+        const auto points = _mm256_loadu_ps(source + processed * 2);
+        const auto xx = _mm256_permute_ps(points, _MM_SHUFFLE(2, 2, 0, 0));
+        const auto yy = _mm256_permute_ps(points, _MM_SHUFFLE(3, 3, 1, 1));
+        const auto result = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ac, xx), _mm256_mul_ps(bd, yy)), t);
+        _mm256_storeu_ps(destination + processed * 2, result);
+    }
+#elif defined(C2D_VECTOR_KERNELS_SSE2)
+    // Each point is [x y], so x' = [a c] * xx + [b d] * yy + [tx ty] for every pair of lanes
+    const auto ac = _mm_setr_ps(transform.a, transform.c, transform.a, transform.c);
+    const auto bd = _mm_setr_ps(transform.b, transform.d, transform.b, transform.d);
+    const auto t = _mm_setr_ps(transform.tx, transform.ty, transform.tx, transform.ty);
+    const auto* source = AsFloats(input);
+    auto* destination = AsFloats(output);
+    for (; processed + vectorsPerStep <= input.size(); processed += vectorsPerStep)
+    {
+        const auto points = _mm_loadu_ps(source + processed * 2);
+        const auto xx = _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+        const auto yy = _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+        const auto result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ac, xx), _mm_mul_ps(bd, yy)), t);
+        _mm_storeu_ps(destination + processed * 2, result);
+    }
+#endif
+
+    Scalar::TransformPoints(transform, input.subspan(processed), output.subspan(processed));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void VectorKernels::Normalize(std::span<const Vector2f> input, std::span<Vector2f> output)
+{
+    size_t processed(0);
+
+#if defined(C2D_VECTOR_KERNELS_AVX2)
+    const auto zero = _mm256_setzero_ps();
+    const auto* source = AsFloats(input);
+    auto* destination = AsFloats(output);
+    for (; processed + vectorsPerStep <= input.size(); processed += vectorsPerStep)
+    {
+        const auto vectors = _mm256_loadu_ps(source + processed * 2);
+        const auto squares = _mm256_mul_ps(vectors, vectors);
+        // Both lanes of a vector get x * x + y * y
+        const auto lengthSquares = _mm256_add_ps(squares, _mm256_permute_ps(squares, _MM_SHUFFLE(2, 3, 0, 1)));
+        const auto normalized = _mm256_div_ps(vectors, _mm256_sqrt_ps(lengthSquares));
+        const auto nonZero = _mm256_cmp_ps(lengthSquares, zero, _CMP_GT_OQ);
+        _mm256_storeu_ps(destination + processed * 2, _mm256_and_ps(normalized, nonZero));
+    }
+#elif defined(C2D_VECTOR_KERNELS_SSE2)
+    const auto zero = _mm_setzero_ps();
+    const auto* source = AsFloats(input);
+    auto* destination = AsFloats(output);
+    for (; processed + vectorsPerStep <= input.size(); processed += vectorsPerStep)
+    {
+        const auto vectors = _mm_loadu_ps(source + processed * 2);
+        const auto squares = _mm_mul_ps(vectors, vectors);
+        // Both lanes of a vector get x * x + y * y
+        const auto lengthSquares = _mm_add_ps(squares, _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(2, 3, 0, 1)));
+        const auto normalized = _mm_div_ps(vectors, _mm_sqrt_ps(lengthSquares));
+        const auto nonZero = _mm_cmpgt_ps(lengthSquares, zero);
+        _mm_storeu_ps(destination + processed * 2, _mm_and_ps(normalized, nonZero));
+    }
+#endif
+
+    Scalar::Normalize(input.subspan(processed), output.subspan(processed));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void VectorKernels::Dot(std::span<const Vector2f> left, std::span<const Vector2f> right, std::span<float> output)
+{
+    size_t processed(0);
+
+#if defined(C2D_VECTOR_KERNELS_AVX2)
+    const auto* leftSource = AsFloats(left);
+    const auto* rightSource = AsFloats(right);
+    for (; processed + vectorsPerStep * 2 <= left.size(); processed += vectorsPerStep * 2)
+    {
+        const auto products0 = _mm256_mul_ps(_mm256_loadu_ps(leftSource + processed * 2),
+                                             _mm256_loadu_ps(rightSource + processed * 2));
+        const auto products1 = _mm256_mul_ps(_mm256_loadu_ps(leftSource + processed * 2 + 8),
+                                             _mm256_loadu_ps(rightSource + processed * 2 + 8));
+        // Shuffles work within 128-bit halves, so sums are in order 0 1 4 5 2 3 6 7
+        const auto sums = _mm256_add_ps(_mm256_shuffle_ps(products0, products1, _MM_SHUFFLE(2, 0, 2, 0)),
+                                        _mm256_shuffle_ps(products0, products1, _MM_SHUFFLE(3, 1, 3, 1)));
+        const auto ordered = _mm256_permute4x64_pd(_mm256_castps_pd(sums), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_ps(output.data() + processed, _mm256_castpd_ps(ordered));
+    }
+#elif defined(C2D_VECTOR_KERNELS_SSE2)
+    const auto* leftSource = AsFloats(left);
+    const auto* rightSource = AsFloats(right);
+    for (; processed + vectorsPerStep * 2 <= left.size(); processed += vectorsPerStep * 2)
+    {
+        const auto products0 = _mm_mul_ps(_mm_loadu_ps(leftSource + processed * 2),
+                                          _mm_loadu_ps(rightSource + processed * 2));
+        const auto products1 = _mm_mul_ps(_mm_loadu_ps(leftSource + processed * 2 + 4),
+                                          _mm_loadu_ps(rightSource + processed * 2 + 4));
+        const auto sums = _mm_add_ps(_mm_shuffle_ps(products0, products1, _MM_SHUFFLE(2, 0, 2, 0)),
+                                     _mm_shuffle_ps(products0, products1, _MM_SHUFFLE(3, 1, 3, 1)));
+        _mm_storeu_ps(output.data() + processed, sums);
+    }
+#endif
+
+    Scalar::Dot(left.subspan(processed), right.subspan(processed), output.subspan(processed));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+VectorKernels::Bounds VectorKernels::GetBounds(std::span<const Vector2f> points)
+{
+    size_t processed(0);
+    auto bounds = Scalar::GetBounds({});
+
+#if defined(C2D_VECTOR_KERNELS_AVX2)
+    if (points.size() >= vectorsPerStep)
+    {
+        const auto* source = AsFloats(points);
+        auto minimum = _mm256_loadu_ps(source);
+        auto maximum = minimum;
+        for (processed = vectorsPerStep; processed + vectorsPerStep <= points.size(); processed += vectorsPerStep)
+        {
+            const auto vectors = _mm256_loadu_ps(source + processed * 2);
+            minimum = _mm256_min_ps(minimum, vectors);
+            maximum = _mm256_max_ps(maximum, vectors);
+        }
+
+        auto minimumHalf = _mm_min_ps(_mm256_castps256_ps128(minimum), _mm256_extractf128_ps(minimum, 1));
+        auto maximumHalf = _mm_max_ps(_mm256_castps256_ps128(maximum), _mm256_extractf128_ps(maximum, 1));
+        minimumHalf = _mm_min_ps(minimumHalf, _mm_movehl_ps(minimumHalf, minimumHalf));
+        maximumHalf = _mm_max_ps(maximumHalf, _mm_movehl_ps(maximumHalf, maximumHalf));
+
+        alignas(16) float result[8];
+        _mm_store_ps(result, minimumHalf);
+        _mm_store_ps(result + 4, maximumHalf);
+        bounds = { Vector2f(result[0], result[1]), Vector2f(result[4], result[5]) };
+    }
+#elif defined(C2D_VECTOR_KERNELS_SSE2)
+    if (points.size() >= vectorsPerStep)
+    {
+        const auto* source = AsFloats(points);
+        auto minimum = _mm_loadu_ps(source);
+        auto maximum = minimum;
+        for (processed = vectorsPerStep; processed + vectorsPerStep <= points.size(); processed += vectorsPerStep)
+        {
+            const auto vectors = _mm_loadu_ps(source + processed * 2);
+            minimum = _mm_min_ps(minimum, vectors);
+            maximum = _mm_max_ps(maximum, vectors);
+        }
+
+        minimum = _mm_min_ps(minimum, _mm_movehl_ps(minimum, minimum));
+        maximum = _mm_max_ps(maximum, _mm_movehl_ps(maximum, maximum));
+
+        alignas(16) float result[8];
+        _mm_store_ps(result, minimum);
+        _mm_store_ps(result + 4, maximum);
+        bounds = { Vector2f(result[0], result[1]), Vector2f(result[4], result[5]) };
+    }
+#endif
+
+    const auto tail = Scalar::GetBounds(points.subspan(processed));
+    bounds.min.x = std::min(bounds.min.x, tail.min.x);
+    bounds.min.y = std::min(bounds.min.y, tail.min.y);
+    bounds.max.x = std::max(bounds.max.x, tail.max.x);
+    bounds.max.y = std::max(bounds.max.y, tail.max.y);
+
+    return bounds;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const char* VectorKernels::GetImplementationName()
+{
+#if defined(C2D_VECTOR_KERNELS_AVX2)
+    return "AVX2";
+#elif defined(C2D_VECTOR_KERNELS_SSE2)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void VectorKernels::Scalar::Normalize(std::span<const Vector2f> input, std::span<Vector2f> output)
+{
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        const auto x = input[i].x;
+        const auto y = input[i].y;
+        const auto lengthSquare = x * x + y * y;
+        if (lengthSquare > 0.0f)
+        {
+            const auto length = std::sqrt(lengthSquare);
+            output[i] = Vector2f(x / length, y / length);
+        }
+        else
+        {
+            output[i] = Vector2f(0.0f, 0.0f);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
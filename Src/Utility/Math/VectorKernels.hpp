@@ -0,0 +1,118 @@
+#pragma once
+#include "Utility/Math/Transform2D.hpp"
+#include "Utility/Math/Vector2.hpp"
+#include <limits>
+#include <span>
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Batch operations over arrays of C2D::Vector2f.
+     *
+     * Functions process whole arrays, so the overhead of a call is paid once per array instead of once per vector,
+     * which matters for transformation of vertices, culling and particles.
+     * Implementation is selected at compile time: AVX2 processes 4 vectors per instruction, SSE2 processes 2 vectors,
+     * other platforms use the scalar implementation from VectorKernels::Scalar, which is also used for the tails
+     * of arrays. Results of all implementations are equal up to rounding of floats.
+     *
+     * Usage example:
+     * \code
+     * std::vector<C2D::Vector2f> local(vertexCount), global(vertexCount);
+     * C2D::VectorKernels::TransformPoints(transform, local, global);
+     * const auto bounds = C2D::VectorKernels::GetBounds(global);
+     * \endcode
+     */
+    namespace VectorKernels
+    {
+        /*!
+         * \brief Axis-aligned bounding box of points.
+         */
+        struct Bounds
+        {
+            /*! Minimal coordinates. */
+            Vector2f min;
+            /*! Maximal coordinates. */
+            Vector2f max;
+        };
+
+        /*!
+         * \brief Transforms points.
+         * \param transform Transform to apply.
+         * \param input Points to transform.
+         * \param output Transformed points, must be of the same size as input. Can be the same array as input.
+         */
+        void TransformPoints(const Transform2D& transform, std::span<const Vector2f> input, std::span<Vector2f> output);
+
+        /*!
+         * \brief Normalizes vectors, zero vectors stay zero.
+         * \param input Vectors to normalize.
+         * \param output Normalized vectors, must be of the same size as input. Can be the same array as input.
+         */
+        void Normalize(std::span<const Vector2f> input, std::span<Vector2f> output);
+
+        /*!
+         * \brief Computes dot products of the pairs of vectors.
+         * \param left Left vectors.
+         * \param right Right vectors, must be of the same size as left ones.
+         * \param output Dot products, must be of the same size as left vectors.
+         */
+        void Dot(std::span<const Vector2f> left, std::span<const Vector2f> right, std::span<float> output);
+
+        /*!
+         * \brief Computes bounding box of points.
+         * \param points Points to bound.
+         * \return Bounding box, minimal coordinates are greater than maximal ones if there are no points.
+         */
+        Bounds GetBounds(std::span<const Vector2f> points);
+
+        /*!
+         * \brief Name of the implementation that is selected at compile time.
+         * \return "AVX2", "SSE2" or "Scalar".
+         */
+        const char* GetImplementationName();
+
+        /*!
+         * \brief Scalar implementations, they are used on platforms without SIMD and as a reference in tests.
+         */
+        namespace Scalar
+        {
+            /*!
+             * \brief Transforms points.
+             * \param transform Transform to apply.
+             * \param input Points to transform.
+             * \param output Transformed points, must be of the same size as input.
+             */
+            constexpr void TransformPoints(const Transform2D& transform,
+                                           std::span<const Vector2f> input,
+                                           std::span<Vector2f> output);
+
+            /*!
+             * \brief Normalizes vectors, zero vectors stay zero.
+             * \param input Vectors to normalize.
+             * \param output Normalized vectors, must be of the same size as input.
+             */
+            void Normalize(std::span<const Vector2f> input, std::span<Vector2f> output);
+
+            /*!
+             * \brief Computes dot products of the pairs of vectors.
+             * \param left Left vectors.
+             * \param right Right vectors, must be of the same size as left ones.
+             * \param output Dot products, must be of the same size as left vectors.
+             */
+            constexpr void Dot(std::span<const Vector2f> left,
+                               std::span<const Vector2f> right,
+                               std::span<float> output);
+
+            /*!
+             * \brief Computes bounding box of points.
+             * \param points Points to bound.
+             * \return Bounding box, minimal coordinates are greater than maximal ones if there are no points.
+             */
+            constexpr Bounds GetBounds(std::span<const Vector2f> points);
+        }
+    }
+
+#include <Utility/Math/VectorKernels.inl>
+}
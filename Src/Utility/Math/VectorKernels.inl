@@ -0,0 +1,44 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr void VectorKernels::Scalar::TransformPoints(const Transform2D& transform,
+                                                      std::span<const Vector2f> input,
+                                                      std::span<Vector2f> output)
+{
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        output[i] = transform.TransformPoint(input[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr void VectorKernels::Scalar::Dot(std::span<const Vector2f> left,
+                                          std::span<const Vector2f> right,
+                                          std::span<float> output)
+{
+    for (size_t i = 0; i < left.size(); ++i)
+    {
+        output[i] = left[i].x * right[i].x + left[i].y * right[i].y;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr VectorKernels::Bounds VectorKernels::Scalar::GetBounds(std::span<const Vector2f> points)
+{
+    constexpr auto infinity = std::numeric_limits<float>::infinity();
+    Bounds bounds{ Vector2f(infinity, infinity), Vector2f(-infinity, -infinity) };
+    for (const auto& point : points)
+    {
+        bounds.min.x = point.x < bounds.min.x ? point.x : bounds.min.x;
+        bounds.min.y = point.y < bounds.min.y ? point.y : bounds.min.y;
+        bounds.max.x = point.x > bounds.max.x ? point.x : bounds.max.x;
+        bounds.max.y = point.y > bounds.max.y ? point.y : bounds.max.y;
+    }
+
+    return bounds;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
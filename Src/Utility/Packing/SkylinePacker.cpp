@@ -0,0 +1,156 @@
+#include "SkylinePacker.hpp"
+#include <algorithm>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SkylinePacker::SkylinePacker(const uint32_t width, const uint32_t height)
+: _width(width)
+, _height(height)
+, _usedArea(0)
+{
+    Clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::optional<SkylinePacker::Position> SkylinePacker::Insert(const uint32_t width, const uint32_t height)
+{
+    if (width == 0 || height == 0)
+    {
+        return std::nullopt;
+    }
+
+    // The lowest top wins, ties are broken by the narrower segment to leave wide ones for wide rectangles
+    size_t bestSegment = _skyline.size();
+    uint32_t bestTop = UINT32_MAX;
+    uint32_t bestWidth = UINT32_MAX;
+    for (size_t i = 0; i < _skyline.size(); ++i)
+    {
+        const auto y = _Fit(i, width, height);
+        if (!y.has_value())
+        {
+            continue;
+        }
+
+        const auto top = y.value() + height;
+        if (top < bestTop || (top == bestTop && _skyline[i].width < bestWidth))
+        {
+            bestSegment = i;
+            bestTop = top;
+            bestWidth = _skyline[i].width;
+        }
+    }
+
+    if (bestSegment == _skyline.size())
+    {
+        return std::nullopt;
+    }
+
+    const Position position = { _skyline[bestSegment].x, bestTop - height };
+
+    // The new segment covers the rectangle, segments below it are shrunk or removed
+    _skyline.insert(_skyline.begin() + static_cast<std::ptrdiff_t>(bestSegment), { position.x, bestTop, width });
+    const auto right = position.x + width;
+    for (auto i = bestSegment + 1; i < _skyline.size();)
+    {
+        auto& segment = _skyline[i];
+        if (segment.x >= right)
+        {
+            break;
+        }
+
+        const auto segmentRight = segment.x + segment.width;
+        if (segmentRight <= right)
+        {
+            _skyline.erase(_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+
+        segment.width = segmentRight - right;
+        segment.x = right;
+        break;
+    }
+    _MergeSegments();
+
+    _usedArea += static_cast<uint64_t>(width) * height;
+
+    return position;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SkylinePacker::Clear()
+{
+    _skyline.assign(1, { 0, 0, _width });
+    _usedArea = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t SkylinePacker::GetWidth() const
+{
+    return _width;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t SkylinePacker::GetHeight() const
+{
+    return _height;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+float SkylinePacker::GetOccupancy() const
+{
+    const auto area = static_cast<uint64_t>(_width) * _height;
+    return area != 0 ? static_cast<float>(static_cast<double>(_usedArea) / static_cast<double>(area)) : 0.0f;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::optional<uint32_t> SkylinePacker::_Fit(const size_t segment, const uint32_t width, const uint32_t height) const
+{
+    const auto x = _skyline[segment].x;
+    if (x + static_cast<uint64_t>(width) > _width)
+    {
+        return std::nullopt;
+    }
+
+    // The rectangle rests on the highest segment below it
+    uint32_t y(0);
+    uint64_t widthLeft = width;
+    for (auto i = segment; widthLeft > 0; ++i)
+    {
+        y = std::max(y, _skyline[i].y);
+        if (y + static_cast<uint64_t>(height) > _height)
+        {
+            return std::nullopt;
+        }
+        widthLeft -= std::min<uint64_t>(widthLeft, _skyline[i].width);
+    }
+
+    return y;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SkylinePacker::_MergeSegments()
+{
+    for (size_t i = 1; i < _skyline.size();)
+    {
+        if (_skyline[i - 1].y == _skyline[i].y)
+        {
+            _skyline[i - 1].width += _skyline[i].width;
+            _skyline.erase(_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
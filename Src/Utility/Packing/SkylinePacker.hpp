@@ -0,0 +1,105 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <optional>
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Packs rectangles into a fixed-size area with the skyline bottom-left heuristic.
+     *
+     * Only the upper contour of packed rectangles is stored, so insertion is linear in the number of contour
+     * segments. Space below the contour is never reused, rectangles can not be removed one by one.
+     */
+    class SkylinePacker final
+    {
+    public:
+        /*!
+         * \brief Top-left corner of a packed rectangle.
+         */
+        struct Position
+        {
+            /*! X coordinate. */
+            uint32_t x;
+            /*! Y coordinate. */
+            uint32_t y;
+        };
+
+        /*!
+         * \brief Constructor.
+         * \param width - width of the area.
+         * \param height - height of the area.
+         */
+        SkylinePacker(uint32_t width, uint32_t height);
+
+        /*!
+         * \brief Packs a rectangle.
+         * \param width - width of the rectangle.
+         * \param height - height of the rectangle.
+         * \return Top-left corner of the rectangle or nothing if there is no space for it.
+         */
+        std::optional<Position> Insert(uint32_t width, uint32_t height);
+
+        /*!
+         * \brief Removes all rectangles.
+         */
+        void Clear();
+
+        /*!
+         * \brief Returns width of the area.
+         * \return Width of the area.
+         */
+        uint32_t GetWidth() const;
+
+        /*!
+         * \brief Returns height of the area.
+         * \return Height of the area.
+         */
+        uint32_t GetHeight() const;
+
+        /*!
+         * \brief Returns ratio of the packed area to the whole area.
+         * \return Ratio in range [0, 1].
+         */
+        float GetOccupancy() const;
+
+    private:
+        /*!
+         * \brief Horizontal segment of the upper contour.
+         */
+        struct Segment
+        {
+            /*! X coordinate of the left end. */
+            uint32_t x;
+            /*! Y coordinate of the contour. */
+            uint32_t y;
+            /*! Width of the segment. */
+            uint32_t width;
+        };
+
+        /*!
+         * \brief Finds where the rectangle rests if it is placed at the beginning of the segment.
+         * \param segment - index of the segment.
+         * \param width - width of the rectangle.
+         * \param height - height of the rectangle.
+         * \return Top of the rectangle or nothing if it does not fit the area there.
+         */
+        std::optional<uint32_t> _Fit(size_t segment, uint32_t width, uint32_t height) const;
+
+        /*!
+         * \brief Merges neighbour segments of the same height.
+         */
+        void _MergeSegments();
+
+        /*! Width of the area. */
+        uint32_t _width;
+        /*! Height of the area. */
+        uint32_t _height;
+        /*! Area of all packed rectangles. */
+        uint64_t _usedArea;
+        /*! Upper contour of packed rectangles, ordered from left to right. */
+        std::vector<Segment> _skyline;
+    };
+}
@@ -0,0 +1,42 @@
+#include "Pcg32.hpp"
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Pcg32::Pcg32(const uint64_t seed, const uint64_t stream)
+: _state(0)
+, _increment((stream << 1u) | 1u)
+{
+    // Same initialization as in the reference implementation, so sequences can be compared with it
+    (*this)();
+    _state += seed;
+    (*this)();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Pcg32::Advance(uint64_t delta)
+{
+    // Applying the step N times is the same as a single step with accumulated multiplier and increment,
+    // which are computed by squaring, so it takes O(log N) steps
+    uint64_t accumulatedMultiplier(1);
+    uint64_t accumulatedIncrement(0);
+    uint64_t currentMultiplier(multiplier);
+    uint64_t currentIncrement(_increment);
+    while (delta > 0)
+    {
+        if (delta & 1u)
+        {
+            accumulatedMultiplier *= currentMultiplier;
+            accumulatedIncrement = accumulatedIncrement * currentMultiplier + currentIncrement;
+        }
+        currentIncrement = (currentMultiplier + 1) * currentIncrement;
+        currentMultiplier *= currentMultiplier;
+        delta >>= 1u;
+    }
+
+    _state = accumulatedMultiplier * _state + accumulatedIncrement;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace C2D
+{
+    /*!
+     * \brief PCG32 random number generator (PCG-XSH-RR with 64-bit state).
+     *
+     * It has only 16 bytes of state and generates 32-bit numbers. Generators with different stream indices
+     * produce different sequences from the same seed, and the generator can be advanced by any number of steps
+     * in logarithmic time.
+     */
+    class Pcg32 final
+    {
+    public:
+        using result_type = uint32_t;
+
+        /*!
+         * \brief Constructor.
+         * \param seed - initial state.
+         * \param stream - index of the sequence, only lower 63 bits are used.
+         */
+        Pcg32(uint64_t seed, uint64_t stream);
+
+        /*!
+         * \brief Generates next random number.
+         * \return A random 32-bit number.
+         */
+        uint32_t operator()()
+        {
+            const auto state = _state;
+            _state = state * multiplier + _increment;
+
+            const auto xorShifted = static_cast<uint32_t>(((state >> 18) ^ state) >> 27);
+            const auto rotation = static_cast<uint32_t>(state >> 59);
+            return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+        }
+
+        /*!
+         * \brief Advances the generator, as if the specified number of values were generated.
+         * \param delta - number of skipped values.
+         */
+        void Advance(uint64_t delta);
+
+        static constexpr uint32_t min() { return 0; }
+        static constexpr uint32_t max() { return std::numeric_limits<uint32_t>::max(); }
+
+    private:
+        /*! Multiplier of the linear congruential generator. */
+        static constexpr uint64_t multiplier = 6364136223846793005ull;
+
+        /*! State of the linear congruential generator. */
+        uint64_t _state;
+        /*! Odd increment that selects the stream. */
+        uint64_t _increment;
+    };
+}
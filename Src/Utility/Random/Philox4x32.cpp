@@ -0,0 +1,215 @@
+#include "Philox4x32.hpp"
+#include <algorithm>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    /*! Multipliers of the rounds. */
+    constexpr uint64_t multiplier0 = 0xD2511F53;
+    constexpr uint64_t multiplier1 = 0xCD9E8D57;
+    /*! Increments of the key between rounds. */
+    constexpr uint32_t weyl0 = 0x9E3779B9;
+    constexpr uint32_t weyl1 = 0xBB67AE85;
+    /*! Number of rounds, 10 is the minimum that passes statistical tests with a safety margin. */
+    constexpr int roundCount = 10;
+    /*! Number of values in a block. */
+    constexpr uint64_t blockSize = 4;
+    /*! Number of blocks that are computed together by bulk generation. */
+    constexpr size_t laneCount = 8;
+    /*! Index that does not match any block, so the first block is always computed. */
+    constexpr uint64_t invalidBlock = std::numeric_limits<uint64_t>::max();
+
+    /*!
+     * \brief Converts random bits to a real number in range [0, 1).
+     * \param value - random 32-bit number.
+     * \return Real number with 24 random bits.
+     */
+    inline float ToUnitFloat(const uint32_t value)
+    {
+        return static_cast<float>(value >> 8) * 0x1.0p-24f;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Philox4x32::Philox4x32(const uint64_t seed, const uint64_t stream)
+: _key({ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) })
+, _stream(stream)
+, _index(0)
+, _block()
+, _blockIndex(invalidBlock)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Philox4x32::Block Philox4x32::Generate(Block counter, std::array<uint32_t, 2> key)
+{
+    for (int round = 0; round < roundCount; ++round)
+    {
+        const auto product0 = multiplier0 * counter[0];
+        const auto product1 = multiplier1 * counter[2];
+        counter =
+        {
+            static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+            static_cast<uint32_t>(product1),
+            static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+            static_cast<uint32_t>(product0)
+        };
+        key[0] += weyl0;
+        key[1] += weyl1;
+    }
+
+    return counter;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t Philox4x32::Get(const uint64_t index) const
+{
+    return _GenerateBlock(index / blockSize)[index % blockSize];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t Philox4x32::operator()()
+{
+    const auto block = _index / blockSize;
+    if (block != _blockIndex)
+    {
+        _block = _GenerateBlock(block);
+        _blockIndex = block;
+    }
+
+    return _block[_index++ % blockSize];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Philox4x32::Seek(const uint64_t index)
+{
+    _index = index;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Philox4x32::Discard(const uint64_t delta)
+{
+    _index += delta;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Philox4x32::Fill(const std::span<uint32_t> values)
+{
+    // Values before the first whole block
+    size_t i(0);
+    for (; i < values.size() && _index % blockSize != 0; ++i)
+    {
+        values[i] = (*this)();
+    }
+
+    // Whole blocks do not depend on each other, groups of them are computed in parallel
+    const auto firstBlock = _index / blockSize;
+    const auto blockCount = (values.size() - i) / blockSize;
+    size_t block(0);
+    for (; block + laneCount <= blockCount; block += laneCount)
+    {
+        _GenerateLanes(firstBlock + block, values.subspan(i + block * blockSize, laneCount * blockSize));
+    }
+    for (; block < blockCount; ++block)
+    {
+        const auto numbers = _GenerateBlock(firstBlock + block);
+        std::copy(numbers.begin(), numbers.end(), values.begin() + static_cast<ptrdiff_t>(i + block * blockSize));
+    }
+    i += blockCount * blockSize;
+    _index += blockCount * blockSize;
+
+    // Values after the last whole block
+    for (; i < values.size(); ++i)
+    {
+        values[i] = (*this)();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Philox4x32::Fill(const std::span<float> values, const float from, const float to)
+{
+    // Random bits are generated by chunks, so the conversion loop is vectorized as well
+    constexpr size_t chunkSize = 256;
+    std::array<uint32_t, chunkSize> bits;
+
+    const auto range = to - from;
+    for (size_t i = 0; i < values.size(); i += chunkSize)
+    {
+        const auto count = std::min(chunkSize, values.size() - i);
+        Fill(std::span<uint32_t>(bits).first(count));
+        for (size_t j = 0; j < count; ++j)
+        {
+            values[i + j] = from + range * ToUnitFloat(bits[j]);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Philox4x32::Block Philox4x32::_GenerateBlock(const uint64_t block) const
+{
+    return Generate(
+    {
+        static_cast<uint32_t>(block),
+        static_cast<uint32_t>(block >> 32),
+        static_cast<uint32_t>(_stream),
+        static_cast<uint32_t>(_stream >> 32)
+    }, _key);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Philox4x32::_GenerateLanes(const uint64_t firstBlock, const std::span<uint32_t> values) const
+{
+    // Words of the counters are stored by lanes, so every round is a set of independent operations
+    // on arrays, which the compiler turns into SIMD instructions
+    std::array<uint32_t, laneCount> counter0;
+    std::array<uint32_t, laneCount> counter1;
+    std::array<uint32_t, laneCount> counter2;
+    std::array<uint32_t, laneCount> counter3;
+    for (size_t lane = 0; lane < laneCount; ++lane)
+    {
+        counter0[lane] = static_cast<uint32_t>(firstBlock + lane);
+        counter1[lane] = static_cast<uint32_t>((firstBlock + lane) >> 32);
+        counter2[lane] = static_cast<uint32_t>(_stream);
+        counter3[lane] = static_cast<uint32_t>(_stream >> 32);
+    }
+
+    auto key = _key;
+    for (int round = 0; round < roundCount; ++round)
+    {
+        for (size_t lane = 0; lane < laneCount; ++lane)
+        {
+            const auto product0 = multiplier0 * counter0[lane];
+            const auto product1 = multiplier1 * counter2[lane];
+            const auto word0 = static_cast<uint32_t>(product1 >> 32) ^ counter1[lane] ^ key[0];
+            const auto word2 = static_cast<uint32_t>(product0 >> 32) ^ counter3[lane] ^ key[1];
+            counter1[lane] = static_cast<uint32_t>(product1);
+            counter3[lane] = static_cast<uint32_t>(product0);
+            counter0[lane] = word0;
+            counter2[lane] = word2;
+        }
+        key[0] += weyl0;
+        key[1] += weyl1;
+    }
+
+    for (size_t lane = 0; lane < laneCount; ++lane)
+    {
+        values[lane * blockSize] = counter0[lane];
+        values[lane * blockSize + 1] = counter1[lane];
+        values[lane * blockSize + 2] = counter2[lane];
+        values[lane * blockSize + 3] = counter3[lane];
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,106 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace C2D
+{
+    /*!
+     * \brief Counter-based Philox4x32-10 random number generator.
+     *
+     * Every block of four numbers is computed only from the key and the index of the block, so the n-th number
+     * of the sequence is available directly and arrays are filled without dependencies between elements,
+     * which lets the compiler vectorize the loop. The key is the seed and the upper half of the counter is
+     * the stream index, so jobs of a parallel simulation can use the same seed and their own streams.
+     */
+    class Philox4x32 final
+    {
+    public:
+        using result_type = uint32_t;
+        using Block = std::array<uint32_t, 4>;
+
+        /*!
+         * \brief Constructor.
+         * \param seed - key of the generator.
+         * \param stream - index of the sequence.
+         */
+        Philox4x32(uint64_t seed, uint64_t stream);
+
+        /*!
+         * \brief Computes a block of numbers.
+         * \param counter - counter of the block.
+         * \param key - key of the generator.
+         * \return Four random 32-bit numbers.
+         */
+        static Block Generate(Block counter, std::array<uint32_t, 2> key);
+
+        /*!
+         * \brief Computes the number of the sequence without changing the position of the generator.
+         * \param index - index of the number in the sequence.
+         * \return A random 32-bit number.
+         */
+        uint32_t Get(uint64_t index) const;
+
+        /*!
+         * \brief Generates next random number of the sequence.
+         * \return A random 32-bit number.
+         */
+        uint32_t operator()();
+
+        /*!
+         * \brief Moves the generator to the specified position of the sequence.
+         * \param index - index of the next generated number.
+         */
+        void Seek(uint64_t index);
+
+        /*!
+         * \brief Advances the generator, as if the specified number of values were generated.
+         * \param delta - number of skipped values.
+         */
+        void Discard(uint64_t delta);
+
+        /*!
+         * \brief Fills the array with consecutive numbers of the sequence and advances the generator past them.
+         * \param values - array to fill.
+         */
+        void Fill(std::span<uint32_t> values);
+
+        /*!
+         * \brief Fills the array with random real numbers and advances the generator past them.
+         * \param values - array to fill.
+         * \param from - min value that can be generated.
+         * \param to - upper bound of generated values, it is not included.
+         */
+        void Fill(std::span<float> values, float from, float to);
+
+        static constexpr uint32_t min() { return 0; }
+        static constexpr uint32_t max() { return std::numeric_limits<uint32_t>::max(); }
+
+    private:
+        /*!
+         * \brief Computes the block of the sequence.
+         * \param block - index of the block.
+         * \return Four random 32-bit numbers.
+         */
+        Block _GenerateBlock(uint64_t block) const;
+
+        /*!
+         * \brief Computes consecutive blocks of the sequence at once.
+         * \param firstBlock - index of the first block.
+         * \param values - array for numbers of the blocks, its size must be 32.
+         */
+        void _GenerateLanes(uint64_t firstBlock, std::span<uint32_t> values) const;
+
+        /*! Key of the generator, made from the seed. */
+        std::array<uint32_t, 2> _key;
+        /*! Index of the sequence. */
+        uint64_t _stream;
+        /*! Index of the next generated number. */
+        uint64_t _index;
+        /*! Last computed block, numbers of the same block are returned from it. */
+        Block _block;
+        /*! Index of the last computed block. */
+        uint64_t _blockIndex;
+    };
+}
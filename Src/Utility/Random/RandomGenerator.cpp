@@ -1,30 +1,46 @@
 #include "RandomGenerator.hpp"
+#include "SplitMix64.hpp"
+#include <algorithm>
+#include <array>
 
 using namespace C2D;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 RandomGenerator::RandomGenerator()
-: _seed(std::random_device()())
-, _mtEngine(_seed)
-, _mtEngine64(_seed)
+: RandomGenerator(std::random_device()())
 { }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-RandomGenerator& RandomGenerator::Instance() 
+RandomGenerator::RandomGenerator(const uint32_t seed, const uint64_t stream)
+: _seed(seed)
+, _stream(stream)
+, _engine(_CreateEngine(seed, stream))
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+RandomGenerator& RandomGenerator::Instance()
 {
-    static RandomGenerator randomGenerator;
+    thread_local RandomGenerator randomGenerator;
     return randomGenerator;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void RandomGenerator::SetSeed(const uint32_t seed)
+{
+    SetSeed(seed, _stream);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void RandomGenerator::SetSeed(const uint32_t seed, const uint64_t stream)
 {
     _seed = seed;
-    _mtEngine.seed(_seed);
-    _mtEngine64.seed(_seed);
+    _stream = stream;
+    _engine = _CreateEngine(seed, stream);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,16 +52,89 @@ uint32_t RandomGenerator::GetSeed() const
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+uint64_t RandomGenerator::GetStream() const
+{
+    return _stream;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 uint32_t RandomGenerator::Get()
 {
-    return _mtEngine();
+    // Upper bits of Xoshiro256++ are the best ones
+    return static_cast<uint32_t>(_engine() >> 32);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 uint64_t RandomGenerator::Get64()
 {
-    return _mtEngine64();
+    return _engine();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void RandomGenerator::Fill(const std::span<uint32_t> values)
+{
+    // Every 64-bit number gives two values
+    size_t i(0);
+    for (; i + 1 < values.size(); i += 2)
+    {
+        const auto bits = _engine();
+        values[i] = static_cast<uint32_t>(bits >> 32);
+        values[i + 1] = static_cast<uint32_t>(bits);
+    }
+    if (i < values.size())
+    {
+        values[i] = Get();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void RandomGenerator::Fill(const std::span<int32_t> values, const int32_t from, const int32_t to)
+{
+    // Random bits are generated by chunks, so the conversion loop is vectorized
+    constexpr size_t chunkSize = 256;
+    std::array<uint32_t, chunkSize> bits;
+
+    const auto range = static_cast<uint64_t>(static_cast<int64_t>(to) - from) + 1;
+    for (size_t i = 0; i < values.size(); i += chunkSize)
+    {
+        const auto count = std::min(chunkSize, values.size() - i);
+        Fill(std::span<uint32_t>(bits).first(count));
+        for (size_t j = 0; j < count; ++j)
+        {
+            values[i + j] = static_cast<int32_t>(from + static_cast<int64_t>((bits[j] * range) >> 32));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void RandomGenerator::Fill(const std::span<float> values, const float from, const float to)
+{
+    constexpr size_t chunkSize = 256;
+    std::array<uint32_t, chunkSize> bits;
+
+    const auto range = to - from;
+    for (size_t i = 0; i < values.size(); i += chunkSize)
+    {
+        const auto count = std::min(chunkSize, values.size() - i);
+        Fill(std::span<uint32_t>(bits).first(count));
+        for (size_t j = 0; j < count; ++j)
+        {
+            values[i + j] = from + range * (static_cast<float>(bits[j] >> 8) * 0x1.0p-24f);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Xoshiro256 RandomGenerator::_CreateEngine(const uint32_t seed, const uint64_t stream)
+{
+    // Both values are scrambled, so close seeds and consecutive streams give unrelated states
+    return Xoshiro256(SplitMix64::Mix(SplitMix64::Mix(seed) + stream));
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,16 +1,21 @@
 #pragma once
+#include "Xoshiro256.hpp"
 #include <random>
+#include <span>
+#include <type_traits>
 
 namespace C2D
 {
     /*!
      * \brief Random number generator.
-     * 
-     * This random number generator uses Mersenne Twister algorithm from <random> STL and
-     * provides the simple interface to ease the use of it. This generator has static 
-     * instance so it can be used anywhere without creating your own instance.
-     * But Mersenne Twister algorithm is NOT thread-safe, so if this generator 
-     * should be used from different threads, instantiate generator for every thread.
+     *
+     * This random number generator uses Xoshiro256++ algorithm and provides the simple interface to ease the use
+     * of it. Every thread has its own static instance, so it can be used anywhere without creating your own
+     * instance and without synchronization. Seed of the static instance affects only the calling thread.
+     *
+     * For reproducible parallel simulation every job should create its own generator from the common seed
+     * and the index of the job as a stream. Streams of the same seed produce independent sequences, so results
+     * do not depend on which thread runs the job. Philox4x32 can be used if numbers should be accessed by index.
      */
     class RandomGenerator
     {
@@ -26,18 +31,32 @@ namespace C2D
          */
         RandomGenerator();
 
+        /*!
+         * \brief Constructor with specified seed and stream.
+         * \param seed - seed which will be used by random number generator.
+         * \param stream - index of the sequence, e.g. index of the job.
+         */
+        explicit RandomGenerator(uint32_t seed, uint64_t stream = 0);
+
         /*!
          * \brief Gets an instance of a random generator.
-         * \return The reference to the static instance of random generator.
+         * \return The reference to the thread-local instance of random generator.
          */
         static RandomGenerator& Instance();
 
         /*!
-         * \brief Sets specified seed to generators.
+         * \brief Sets specified seed to generators, the stream is not changed.
          * \param seed - new seed which will be used by random number generators.
          */
         void SetSeed(uint32_t seed);
 
+        /*!
+         * \brief Sets specified seed and stream to generators.
+         * \param seed - new seed which will be used by random number generators.
+         * \param stream - index of the sequence, e.g. index of the job.
+         */
+        void SetSeed(uint32_t seed, uint64_t stream);
+
         /*!
          * \brief Gets seed which is in use by generators.
          * \return The seed which represented by 32-bit number.
@@ -45,14 +64,20 @@ namespace C2D
         uint32_t GetSeed() const;
 
         /*!
-         * \brief Generates random 32-bit number in range [0, 2^32].
-         * \return A random 32-bit number in range [0, 2^32].
+         * \brief Gets index of the sequence which is in use by generators.
+         * \return Index of the sequence.
+         */
+        uint64_t GetStream() const;
+
+        /*!
+         * \brief Generates random 32-bit number in range [0, 2^32).
+         * \return A random 32-bit number in range [0, 2^32).
          */
         uint32_t Get();
 
         /*!
-         * \brief Generates random 64-bit number in range [0, 2^64].
-         * \return A random 64-bit number in range [0, 2^64].
+         * \brief Generates random 64-bit number in range [0, 2^64).
+         * \return A random 64-bit number in range [0, 2^64).
          */
         uint64_t Get64();
 
@@ -62,11 +87,8 @@ namespace C2D
          * \param from - min value that can be generated.
          * \param to - max value that can be generated.
          * \return A random number in specified range.
-         * 
-         * It is a template function, so it uses partial specialization for certain types:
-         * - For 64-bit types (uin64_t, int64_t, double, size_t(on 64-bit platforms) it will use 64-bit generator.
-         * - For 32-bit types will be used 32-bit generator.
-         * - For real numbers will be used uniform_real_distribution.
+         *
+         * Integers are generated with uniform_int_distribution, real numbers are made directly from random bits.
          */
         template <typename T>
         T Get(T from, T to);
@@ -89,16 +111,48 @@ namespace C2D
         template <typename T>
         T Get(std::uniform_real_distribution<T>& distribution);
 
+        /*!
+         * \brief Fills the array with random 32-bit numbers.
+         * \param values - array to fill.
+         */
+        void Fill(std::span<uint32_t> values);
+
+        /*!
+         * \brief Fills the array with random numbers in specified range.
+         * \param values - array to fill.
+         * \param from - min value that can be generated.
+         * \param to - max value that can be generated.
+         *
+         * Range is mapped by multiplication instead of rejection, the bias is less than (to - from) / 2^32.
+         */
+        void Fill(std::span<int32_t> values, int32_t from, int32_t to);
+
+        /*!
+         * \brief Fills the array with random real numbers in specified range.
+         * \param values - array to fill.
+         * \param from - min value that can be generated.
+         * \param to - upper bound of generated values, it is not included.
+         */
+        void Fill(std::span<float> values, float from, float to);
+
     private:
-        /*! Seed that is used by number generators. */
+        /*!
+         * \brief Makes the state of the engine from the seed and the stream.
+         * \param seed - seed of the generator.
+         * \param stream - index of the sequence.
+         * \return Engine that starts the sequence.
+         */
+        static Xoshiro256 _CreateEngine(uint32_t seed, uint64_t stream);
+
+        /*! Seed that is used by number generator. */
         uint32_t _seed;
-        /*! Mersenne Twister pseudo-random number generator for 32-bit numbers. */
-        std::mt19937 _mtEngine;
-        /*! Mersenne Twister pseudo-random number generator for 64-bit numbers. */
-        std::mt19937_64 _mtEngine64;
+        /*! Index of the sequence that is used by number generator. */
+        uint64_t _stream;
+        /*! Xoshiro256++ pseudo-random number generator. */
+        Xoshiro256 _engine;
     };
 
 #include "RandomGenerator.inl"
 }
 
-#define RANDOM Conure::Utility::RandomGenerator::Instance()
\ No newline at end of file
+#define RANDOM C2D::RandomGenerator::Instance()
@@ -5,44 +5,17 @@
 template <typename T>
 T RandomGenerator::Get(const T from, const T to)
 {
-    std::uniform_int_distribution<T> distribution(from, to);
-    return distribution(_mtEngine);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-template <>
-inline int64_t RandomGenerator::Get<int64_t>(const int64_t from, const int64_t to)
-{
-    std::uniform_int_distribution<int64_t> distribution(from, to);
-    return distribution(_mtEngine64);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-template <>
-inline uint64_t RandomGenerator::Get<uint64_t>(const uint64_t from, const uint64_t to)
-{
-    std::uniform_int_distribution<uint64_t> dist(from, to);
-    return dist(_mtEngine64);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-template <>
-inline float RandomGenerator::Get<float>(const float from, const float to)
-{
-    std::uniform_real_distribution<float> distribution(from, to);
-    return distribution(_mtEngine);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-template <>
-inline double RandomGenerator::Get<double>(const double from, const double to)
-{
-    std::uniform_real_distribution<double> distribution(from, to);
-    return distribution(_mtEngine64);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        // 53 random bits are enough for both float and double
+        const auto unit = static_cast<T>(static_cast<double>(_engine() >> 11) * 0x1.0p-53);
+        return from + (to - from) * unit;
+    }
+    else
+    {
+        std::uniform_int_distribution<T> distribution(from, to);
+        return distribution(_engine);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,39 +23,15 @@ inline double RandomGenerator::Get<double>(const double from, const double to)
 template <typename T>
 T RandomGenerator::Get(std::uniform_int_distribution<T>& distribution)
 {
-    return distribution(_mtEngine);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-template <>
-inline int64_t RandomGenerator::Get<int64_t>(std::uniform_int_distribution<int64_t>& distribution)
-{
-    return distribution(_mtEngine64);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-template <>
-inline uint64_t RandomGenerator::Get<uint64_t>(std::uniform_int_distribution<uint64_t>& distribution)
-{
-    return distribution(_mtEngine64);
+    return distribution(_engine);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template <>
-inline float RandomGenerator::Get<float>(std::uniform_real_distribution<float>& distribution)
-{
-    return distribution(_mtEngine);
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-template <>
-inline double RandomGenerator::Get<double>(std::uniform_real_distribution<double>& distribution)
+template <typename T>
+T RandomGenerator::Get(std::uniform_real_distribution<T>& distribution)
 {
-    return distribution(_mtEngine64);
+    return distribution(_engine);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace C2D
+{
+    /*!
+     * \brief SplitMix64 random number generator.
+     *
+     * It has only 64 bits of state and is too weak for general use, but its output is well distributed even
+     * for similar seeds, so it is used to expand seeds into states of other generators.
+     */
+    class SplitMix64 final
+    {
+    public:
+        using result_type = uint64_t;
+
+        /*!
+         * \brief Constructor.
+         * \param seed - initial state.
+         */
+        explicit constexpr SplitMix64(uint64_t seed) : _state(seed) { }
+
+        /*!
+         * \brief Scrambles bits of the value, different values always give different results.
+         * \param value - value to scramble.
+         * \return Scrambled value.
+         */
+        static constexpr uint64_t Mix(uint64_t value)
+        {
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+            return value ^ (value >> 31);
+        }
+
+        /*!
+         * \brief Generates next random number.
+         * \return A random 64-bit number.
+         */
+        constexpr uint64_t operator()()
+        {
+            _state += 0x9E3779B97F4A7C15ull;
+            return Mix(_state);
+        }
+
+        static constexpr uint64_t min() { return 0; }
+        static constexpr uint64_t max() { return std::numeric_limits<uint64_t>::max(); }
+
+    private:
+        /*! State that is increased by the golden ratio on every call. */
+        uint64_t _state;
+    };
+}
@@ -0,0 +1,62 @@
+#include "Xoshiro256.hpp"
+#include "SplitMix64.hpp"
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Xoshiro256::Xoshiro256(const uint64_t seed)
+{
+    SplitMix64 seeder(seed);
+    for (auto& word : _state)
+    {
+        word = seeder();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Xoshiro256::Xoshiro256(const std::array<uint64_t, 4>& state)
+: _state(state)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Xoshiro256::Fill(const std::span<uint64_t> values)
+{
+    for (auto& value : values)
+    {
+        value = (*this)();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Xoshiro256::Jump()
+{
+    constexpr std::array<uint64_t, 4> jump =
+    {
+        0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+    };
+
+    // State after the jump is a combination of states that correspond to set bits of the jump polynomial
+    std::array<uint64_t, 4> state{};
+    for (const auto word : jump)
+    {
+        for (int bit = 0; bit < 64; ++bit)
+        {
+            if (word & (1ull << bit))
+            {
+                for (size_t i = 0; i < state.size(); ++i)
+                {
+                    state[i] ^= _state[i];
+                }
+            }
+            (*this)();
+        }
+    }
+
+    _state = state;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
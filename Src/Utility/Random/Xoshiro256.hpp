@@ -0,0 +1,81 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace C2D
+{
+    /*!
+     * \brief Xoshiro256++ random number generator.
+     *
+     * It has 32 bytes of state, passes common statistical tests and is several times faster than Mersenne Twister.
+     * Generator is not thread-safe, every thread or job should use its own instance, which can be created
+     * from a common seed and a stream index, see RandomGenerator.
+     */
+    class Xoshiro256 final
+    {
+    public:
+        using result_type = uint64_t;
+
+        /*!
+         * \brief Constructor which expands the seed into the state with SplitMix64.
+         * \param seed - any 64-bit number, including 0.
+         */
+        explicit Xoshiro256(uint64_t seed);
+
+        /*!
+         * \brief Constructor which uses the state as is.
+         * \param state - state of the generator, must not be all zeros.
+         */
+        explicit Xoshiro256(const std::array<uint64_t, 4>& state);
+
+        /*!
+         * \brief Generates next random number.
+         * \return A random 64-bit number.
+         */
+        uint64_t operator()()
+        {
+            const auto result = _Rotate(_state[0] + _state[3], 23) + _state[0];
+            const auto t = _state[1] << 17;
+
+            _state[2] ^= _state[0];
+            _state[3] ^= _state[1];
+            _state[1] ^= _state[2];
+            _state[0] ^= _state[3];
+            _state[2] ^= t;
+            _state[3] = _Rotate(_state[3], 45);
+
+            return result;
+        }
+
+        /*!
+         * \brief Fills the array with random numbers.
+         * \param values - array to fill.
+         */
+        void Fill(std::span<uint64_t> values);
+
+        /*!
+         * \brief Advances the generator by 2^128 numbers, so sequences before and after the jump do not overlap.
+         */
+        void Jump();
+
+        static constexpr uint64_t min() { return 0; }
+        static constexpr uint64_t max() { return std::numeric_limits<uint64_t>::max(); }
+
+    private:
+        /*!
+         * \brief Rotates bits of the value to the left.
+         * \param value - value to rotate.
+         * \param shift - number of bits, in range (0, 64).
+         * \return Rotated value.
+         */
+        static constexpr uint64_t _Rotate(uint64_t value, int shift)
+        {
+            return (value << shift) | (value >> (64 - shift));
+        }
+
+        /*! State of the generator. */
+        std::array<uint64_t, 4> _state;
+    };
+}
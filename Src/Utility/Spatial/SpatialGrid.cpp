@@ -0,0 +1,228 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    /*! Cells per box that are allowed before cells are enlarged, so sparse worlds do not allocate huge grids. */
+    constexpr size_t maxCellsPerBox = 4;
+    /*! Number of cells that is always allowed, so small scenes still get a useful grid. */
+    constexpr size_t minCellLimit = 256;
+
+    /*!
+     * \brief Checks that a box is empty, boxes with NaN coordinates are empty as well.
+     * \param bounds - box to check.
+     * \return True if minimal coordinates are greater than maximal ones.
+     */
+    bool IsEmpty(const VectorKernels::Bounds& bounds)
+    {
+        return !(bounds.min.x <= bounds.max.x && bounds.min.y <= bounds.max.y);
+    }
+
+    /*!
+     * \brief Checks that a box can be stored in the grid. Infinite boxes can not, the grid would have to be
+     *        infinite and cells would be enlarged forever.
+     * \param bounds - box to check.
+     * \return True if the box is not empty and all its coordinates are finite.
+     */
+    bool IsValid(const VectorKernels::Bounds& bounds)
+    {
+        return !IsEmpty(bounds) && std::isfinite(bounds.min.x) && std::isfinite(bounds.min.y) &&
+               std::isfinite(bounds.max.x) && std::isfinite(bounds.max.y);
+    }
+
+    /*!
+     * \brief Checks that two boxes intersect, touching boxes intersect as well.
+     * \param left - first box.
+     * \param right - second box.
+     * \return True if boxes intersect.
+     */
+    bool Intersects(const VectorKernels::Bounds& left, const VectorKernels::Bounds& right)
+    {
+        return left.min.x <= right.max.x && right.min.x <= left.max.x &&
+               left.min.y <= right.max.y && right.min.y <= left.max.y;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SpatialGrid::SpatialGrid(const float cellSize)
+: _requestedCellSize(cellSize > 0.0f ? cellSize : 1.0f)
+, _cellSize(_requestedCellSize)
+, _columnCount(0)
+, _rowCount(0)
+, _cellOffsets(1, 0)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SpatialGrid::Build(const std::span<const VectorKernels::Bounds> bounds)
+{
+    _bounds.assign(bounds.begin(), bounds.end());
+    _cellItems.clear();
+    _columnCount = 0;
+    _rowCount = 0;
+    _cellOffsets.assign(1, 0);
+
+    VectorKernels::Bounds world{ Vector2f(std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+                                 Vector2f(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()) };
+    size_t validCount(0);
+    for (const auto& box : _bounds)
+    {
+        if (IsValid(box))
+        {
+            world.min.x = std::min(world.min.x, box.min.x);
+            world.min.y = std::min(world.min.y, box.min.y);
+            world.max.x = std::max(world.max.x, box.max.x);
+            world.max.y = std::max(world.max.y, box.max.y);
+            ++validCount;
+        }
+    }
+
+    if (validCount == 0)
+    {
+        return;
+    }
+
+    // Cells are doubled until the grid is small enough for the number of boxes
+    const auto cellLimit = std::max(minCellLimit, validCount * maxCellsPerBox);
+    const auto width = static_cast<double>(world.max.x) - world.min.x;
+    const auto height = static_cast<double>(world.max.y) - world.min.y;
+    double cellSize(_requestedCellSize);
+    double columns(std::floor(width / cellSize) + 1.0);
+    double rows(std::floor(height / cellSize) + 1.0);
+    while (columns * rows > static_cast<double>(cellLimit))
+    {
+        cellSize *= 2.0;
+        columns = std::floor(width / cellSize) + 1.0;
+        rows = std::floor(height / cellSize) + 1.0;
+    }
+
+    _cellSize = static_cast<float>(cellSize);
+    _origin = world.min;
+    _columnCount = static_cast<uint32_t>(columns);
+    _rowCount = static_cast<uint32_t>(rows);
+
+    // Boxes are counted per cell first, so all cells are stored in one array without reallocations
+    _cellOffsets.assign(static_cast<size_t>(_columnCount) * _rowCount + 1, 0);
+    for (const auto& box : _bounds)
+    {
+        if (!IsValid(box))
+        {
+            continue;
+        }
+
+        const auto range = _GetCellRange(box);
+        for (auto row = range.minRow; row <= range.maxRow; ++row)
+        {
+            for (auto column = range.minColumn; column <= range.maxColumn; ++column)
+            {
+                ++_cellOffsets[row * _columnCount + column + 1];
+            }
+        }
+    }
+
+    for (size_t cell = 1; cell < _cellOffsets.size(); ++cell)
+    {
+        _cellOffsets[cell] += _cellOffsets[cell - 1];
+    }
+
+    // Offsets are used as write cursors and end up shifted by one cell, so they are shifted back afterwards
+    _cellItems.resize(_cellOffsets.back());
+    for (uint32_t index = 0; index < _bounds.size(); ++index)
+    {
+        if (!IsValid(_bounds[index]))
+        {
+            continue;
+        }
+
+        const auto range = _GetCellRange(_bounds[index]);
+        for (auto row = range.minRow; row <= range.maxRow; ++row)
+        {
+            for (auto column = range.minColumn; column <= range.maxColumn; ++column)
+            {
+                _cellItems[_cellOffsets[row * _columnCount + column]++] = index;
+            }
+        }
+    }
+
+    std::rotate(_cellOffsets.rbegin(), _cellOffsets.rbegin() + 1, _cellOffsets.rend());
+    _cellOffsets.front() = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SpatialGrid::Query(const VectorKernels::Bounds& area, std::vector<uint32_t>& result) const
+{
+    result.clear();
+    // Queried area may be infinite, it is clamped to the grid
+    if (_columnCount == 0 || IsEmpty(area))
+    {
+        return;
+    }
+
+    const auto range = _GetCellRange(area);
+    for (auto row = range.minRow; row <= range.maxRow; ++row)
+    {
+        for (auto column = range.minColumn; column <= range.maxColumn; ++column)
+        {
+            const auto cell = row * _columnCount + column;
+            for (auto item = _cellOffsets[cell]; item < _cellOffsets[cell + 1]; ++item)
+            {
+                const auto index = _cellItems[item];
+                const auto& box = _bounds[index];
+                if (!Intersects(box, area))
+                {
+                    continue;
+                }
+
+                // The box is reported only by the first cell that it shares with the area
+                const auto boxRange = _GetCellRange(box);
+                if (column == std::max(boxRange.minColumn, range.minColumn) &&
+                    row == std::max(boxRange.minRow, range.minRow))
+                {
+                    result.push_back(index);
+                }
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t SpatialGrid::GetSize() const
+{
+    return _bounds.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+float SpatialGrid::GetCellSize() const
+{
+    return _cellSize;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SpatialGrid::CellRange SpatialGrid::_GetCellRange(const VectorKernels::Bounds& bounds) const
+{
+    // Coordinates are clamped as floats, so boxes far outside of the grid do not overflow integers
+    const auto toCell = [this](const float coordinate, const float origin, const uint32_t count)
+    {
+        const auto cell = std::floor((coordinate - origin) / _cellSize);
+        return static_cast<uint32_t>(std::clamp(cell, 0.0f, static_cast<float>(count - 1)));
+    };
+
+    return { toCell(bounds.min.x, _origin.x, _columnCount),
+             toCell(bounds.min.y, _origin.y, _rowCount),
+             toCell(bounds.max.x, _origin.x, _columnCount),
+             toCell(bounds.max.y, _origin.y, _rowCount) };
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
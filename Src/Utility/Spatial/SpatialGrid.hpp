@@ -0,0 +1,111 @@
+#pragma once
+#include "Utility/Math/VectorKernels.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Uniform grid of axis-aligned bounding boxes for queries of boxes that intersect an area.
+     *
+     * Grid is rebuilt from scratch when boxes change, e.g. once per frame, so it does not support insertion
+     * or removal of single boxes. Cells are stored in one array sorted by cells, so the rebuild does not allocate
+     * once arrays have grown to the number of boxes.
+     *
+     * A box that covers several cells is stored in each of them, but a query reports it only once, in the first cell
+     * of the overlap of the box and the queried area. Queries do not modify the grid, so several threads
+     * can query the same grid at once, e.g. one per camera.
+     *
+     * Usage example:
+     * \code
+     * C2D::SpatialGrid grid(256.0f);
+     * grid.Build(bounds);
+     * std::vector<uint32_t> visible;
+     * grid.Query(cameraBounds, visible); // Indices of the boxes in bounds, in ascending order
+     * \endcode
+     */
+    class SpatialGrid
+    {
+    public:
+        SpatialGrid(const SpatialGrid& other) = delete;
+        SpatialGrid(SpatialGrid&& other) = delete;
+        SpatialGrid& operator=(const SpatialGrid& other) = delete;
+        SpatialGrid& operator=(SpatialGrid&& other) = delete;
+        ~SpatialGrid() = default;
+
+        /*!
+         * \brief Default constructor.
+         * \param cellSize - width and height of a cell, it is increased if boxes span too many cells.
+         */
+        explicit SpatialGrid(float cellSize = 256.0f);
+
+        /*!
+         * \brief Replaces all boxes of the grid.
+         * \param bounds - boxes, their indices are reported by queries. Boxes with infinite or NaN coordinates
+         *                 and boxes whose minimal coordinates are greater than maximal ones are never reported.
+         */
+        void Build(std::span<const VectorKernels::Bounds> bounds);
+
+        /*!
+         * \brief Finds boxes that intersect the area, boxes that only touch its border are included.
+         * \param area - queried area, it can be infinite, e.g. to find all boxes.
+         * \param result - array to which indices of the boxes are written in ascending order, it is cleared first.
+         */
+        void Query(const VectorKernels::Bounds& area, std::vector<uint32_t>& result) const;
+
+        /*!
+         * \brief Returns number of boxes that were passed to the last build, including empty ones.
+         * \return Number of boxes.
+         */
+        size_t GetSize() const;
+
+        /*!
+         * \brief Returns size of a cell that is used by the last build.
+         * \return Width and height of a cell.
+         */
+        float GetCellSize() const;
+
+    private:
+        /*!
+         * \brief Range of cells covered by a box, bounds are inclusive.
+         */
+        struct CellRange
+        {
+            /*! First column. */
+            uint32_t minColumn;
+            /*! First row. */
+            uint32_t minRow;
+            /*! Last column. */
+            uint32_t maxColumn;
+            /*! Last row. */
+            uint32_t maxRow;
+        };
+
+        /*!
+         * \brief Returns cells covered by a box, the box is clamped to the grid.
+         * \param bounds - box in world coordinates.
+         * \return Range of covered cells.
+         */
+        CellRange _GetCellRange(const VectorKernels::Bounds& bounds) const;
+
+        /*! Cell size requested by the user. */
+        float _requestedCellSize;
+        /*! Cell size of the current build. */
+        float _cellSize;
+        /*! Top-left corner of the first cell. */
+        Vector2f _origin;
+        /*! Number of columns. */
+        uint32_t _columnCount;
+        /*! Number of rows. */
+        uint32_t _rowCount;
+        /*! Boxes of the current build. */
+        std::vector<VectorKernels::Bounds> _bounds;
+        /*! Offsets of the first box of each cell in the array of box indices, one more than the number of cells. */
+        std::vector<uint32_t> _cellOffsets;
+        /*! Indices of the boxes sorted by cells. */
+        std::vector<uint32_t> _cellItems;
+    };
+}
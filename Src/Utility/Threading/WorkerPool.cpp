@@ -0,0 +1,155 @@
+#include "WorkerPool.hpp"
+#include <algorithm>
+#include <utility>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+WorkerPool::WorkerPool(size_t workerCount)
+{
+    const auto threadCount = std::max<size_t>(workerCount, 1) - 1;
+    _threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        _threads.emplace_back(&WorkerPool::WorkerLoop, this, i + 1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard lock(_mutex);
+        _isStopping = true;
+    }
+    _jobStarted.notify_all();
+
+    for (auto& thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+WorkerPool& WorkerPool::GetShared()
+{
+    static WorkerPool pool(std::max(std::thread::hardware_concurrency(), 1u));
+    return pool;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t WorkerPool::GetWorkerCount() const
+{
+    return _threads.size() + 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t WorkerPool::GetActiveWorkerCount(size_t taskCount) const
+{
+    return std::clamp<size_t>(taskCount, 1, GetWorkerCount());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void WorkerPool::ParallelFor(size_t taskCount, const Job& job)
+{
+    if (GetActiveWorkerCount(taskCount) == 1)
+    {
+        for (size_t task = 0; task < taskCount; ++task)
+        {
+            job(task, 0);
+        }
+        return;
+    }
+
+    std::lock_guard dispatchLock(_dispatchMutex);
+    {
+        std::lock_guard lock(_mutex);
+        _job = &job;
+        _taskCount = taskCount;
+        _activeWorkerCount = GetActiveWorkerCount(taskCount);
+        _pendingWorkerCount = _activeWorkerCount - 1;
+        _exception = nullptr;
+        ++_generation;
+    }
+    _jobStarted.notify_all();
+
+    RunTasks(0);
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock lock(_mutex);
+        _jobFinished.wait(lock, [this]() { return _pendingWorkerCount == 0; });
+        _job = nullptr;
+        exception = std::exchange(_exception, nullptr);
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void WorkerPool::WorkerLoop(size_t worker)
+{
+    uint64_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock lock(_mutex);
+            _jobStarted.wait(lock, [this, generation]() { return _isStopping || _generation != generation; });
+            if (_isStopping)
+            {
+                return;
+            }
+
+            generation = _generation;
+            if (worker >= _activeWorkerCount)
+            {
+                // Job has fewer tasks than workers
+                continue;
+            }
+        }
+
+        RunTasks(worker);
+
+        bool isLast = false;
+        {
+            std::lock_guard lock(_mutex);
+            isLast = --_pendingWorkerCount == 0;
+        }
+        if (isLast)
+        {
+            _jobFinished.notify_one();
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void WorkerPool::RunTasks(size_t worker)
+{
+    // Job, task count and number of workers do not change until all workers are done
+    try
+    {
+        for (size_t task = worker; task < _taskCount; task += _activeWorkerCount)
+        {
+            (*_job)(task, worker);
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard lock(_mutex);
+        if (!_exception)
+        {
+            _exception = std::current_exception();
+        }
+    }
+}
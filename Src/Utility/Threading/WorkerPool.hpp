@@ -0,0 +1,123 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Persistent threads that run tasks of a frame in parallel, e.g. recording of render passes or culling
+     *        of cameras, so threads are not created every frame.
+     *
+     * Tasks are split statically: with n active workers, worker w runs tasks w, w + n, w + 2n and so on, so a task
+     * can use resources owned by its worker, e.g. a command pool, without synchronization. The calling thread is
+     * worker 0, so a pool of one worker runs everything on the calling thread.
+     *
+     * ParallelFor() calls from different threads are serialized. Jobs must not call ParallelFor() of the same pool.
+     *
+     * Usage example:
+     * \code
+     * C2D::WorkerPool::GetShared().ParallelFor(cameras.size(), [&](size_t task, size_t worker)
+     * {
+     *     Cull(cameras[task], visibleLists[task]);
+     * });
+     * \endcode
+     */
+    class WorkerPool
+    {
+    public:
+        /*!
+         * \brief Function of a task, receives index of the task and index of the worker that runs it.
+         */
+        using Job = std::function<void(size_t task, size_t worker)>;
+
+        WorkerPool(const WorkerPool& other) = delete;
+        WorkerPool(WorkerPool&& other) = delete;
+        WorkerPool& operator=(const WorkerPool& other) = delete;
+        WorkerPool& operator=(WorkerPool&& other) = delete;
+
+        /*!
+         * \brief Default constructor, starts the threads.
+         * \param workerCount - number of workers including the calling thread, at least one.
+         */
+        explicit WorkerPool(size_t workerCount);
+
+        /*!
+         * \brief Destructor, stops and joins the threads.
+         */
+        ~WorkerPool();
+
+        /*!
+         * \brief Returns the pool that is shared by all systems of the process, it has one worker per hardware
+         *        thread and is created on the first call.
+         * \return Shared pool.
+         */
+        static WorkerPool& GetShared();
+
+        /*!
+         * \brief Returns number of workers including the calling thread.
+         * \return Number of workers.
+         */
+        size_t GetWorkerCount() const;
+
+        /*!
+         * \brief Returns number of workers that run the given number of tasks.
+         * \param taskCount - number of tasks.
+         * \return Worker count limited by the task count, at least one.
+         */
+        size_t GetActiveWorkerCount(size_t taskCount) const;
+
+        /*!
+         * \brief Runs the job for every task and waits until all tasks are done. A single task is run
+         *        on the calling thread without waking up other workers. Exception of a task is rethrown
+         *        once all tasks are done.
+         * \param taskCount - number of tasks.
+         * \param job - function that is called for every task.
+         */
+        void ParallelFor(size_t taskCount, const Job& job);
+
+    private:
+        /*!
+         * \brief Loop of a thread, waits for jobs and runs tasks of the worker.
+         * \param worker - index of the worker.
+         */
+        void WorkerLoop(size_t worker);
+
+        /*!
+         * \brief Runs tasks of the worker in the current job and stores the first exception.
+         * \param worker - index of the worker.
+         */
+        void RunTasks(size_t worker);
+
+        /*! Threads of workers, the calling thread is not included. */
+        std::vector<std::thread> _threads;
+        /*! Serializes jobs that are started by different threads. */
+        std::mutex _dispatchMutex;
+        /*! Guards state of the current job. */
+        std::mutex _mutex;
+        /*! Wakes up workers when a job is started or the pool is stopped. */
+        std::condition_variable _jobStarted;
+        /*! Wakes up the calling thread when all workers are done. */
+        std::condition_variable _jobFinished;
+        /*! Current job, it is valid while ParallelFor() runs. */
+        const Job* _job = nullptr;
+        /*! Number of tasks of the current job. */
+        size_t _taskCount = 0;
+        /*! Number of workers that run the current job. */
+        size_t _activeWorkerCount = 0;
+        /*! Number of threads that have not finished the current job yet. */
+        size_t _pendingWorkerCount = 0;
+        /*! Incremented for every job, so workers do not run the same job twice. */
+        uint64_t _generation = 0;
+        /*! Flag that shows if threads must exit. */
+        bool _isStopping = false;
+        /*! First exception thrown by a task of the current job. */
+        std::exception_ptr _exception;
+    };
+}
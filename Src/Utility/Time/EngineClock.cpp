@@ -0,0 +1,209 @@
+#include "EngineClock.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define C2D_ENGINE_CLOCK_TSC
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+        #include <x86intrin.h>
+    #endif
+#endif
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    /*!
+     * \brief Calibration of the clock, it is done once and never changes, so reading it needs no synchronization.
+     */
+    struct Calibration
+    {
+        /*! Flag that defines if the time stamp counter is used. */
+        bool useTsc = false;
+        /*! Value of the time stamp counter at the epoch. */
+        uint64_t baseTicks = 0;
+        /*! Nanoseconds per tick in 32.32 fixed point. */
+        uint64_t multiplier = 0;
+        /*! Ticks per second. */
+        uint64_t frequency = 0;
+        /*! Steady time at the epoch. */
+        std::chrono::steady_clock::time_point baseSteadyTime;
+    };
+
+    /*! Time of calibration, longer calibration gives more precise frequency. */
+    constexpr auto calibrationTime = std::chrono::milliseconds(10);
+
+#if defined(C2D_ENGINE_CLOCK_TSC)
+    uint64_t ReadTsc()
+    {
+        return __rdtsc();
+    }
+
+    /*!
+     * \brief Checks if the counter ticks with constant rate in all power states and is synchronized between cores.
+     * \return True if the processor reports invariant TSC.
+     */
+    bool HasInvariantTsc()
+    {
+        constexpr uint32_t powerManagementLeaf = 0x80000007;
+        constexpr uint32_t invariantTscBit = 1u << 8;
+    #if defined(_MSC_VER)
+        int registers[4] = {};
+        __cpuid(registers, static_cast<int>(0x80000000));
+        if (static_cast<uint32_t>(registers[0]) < powerManagementLeaf)
+        {
+            return false;
+        }
+        __cpuid(registers, static_cast<int>(powerManagementLeaf));
+        return (static_cast<uint32_t>(registers[3]) & invariantTscBit) != 0;
+    #else
+        unsigned int eax(0), ebx(0), ecx(0), edx(0);
+        if (__get_cpuid_max(0x80000000, nullptr) < powerManagementLeaf ||
+            !__get_cpuid(powerManagementLeaf, &eax, &ebx, &ecx, &edx))
+        {
+            return false;
+        }
+        return (edx & invariantTscBit) != 0;
+    #endif
+    }
+
+    /*!
+     * \brief Converts ticks to nanoseconds.
+     * \param ticks - ticks since the epoch.
+     * \param multiplier - nanoseconds per tick in 32.32 fixed point.
+     * \return Nanoseconds since the epoch.
+     */
+    uint64_t TicksToNanoseconds(const uint64_t ticks, const uint64_t multiplier)
+    {
+    #if defined(_MSC_VER)
+        uint64_t high(0);
+        const auto low = _umul128(ticks, multiplier, &high);
+        return (high << 32) | (low >> 32);
+    #else
+        return static_cast<uint64_t>((static_cast<unsigned __int128>(ticks) * multiplier) >> 32);
+    #endif
+    }
+#endif
+
+    Calibration CreateCalibration()
+    {
+        Calibration calibration;
+
+#if defined(C2D_ENGINE_CLOCK_TSC)
+        if (HasInvariantTsc())
+        {
+            // Both clocks are read back to back, so the pair is taken when the reads are not interrupted
+            const auto readPair = [](uint64_t& ticks, std::chrono::steady_clock::time_point& steadyTime)
+            {
+                auto bestWindow = UINT64_MAX;
+                for (int attempt = 0; attempt < 8; ++attempt)
+                {
+                    const auto before = ReadTsc();
+                    const auto time = std::chrono::steady_clock::now();
+                    const auto after = ReadTsc();
+                    if (after - before < bestWindow)
+                    {
+                        bestWindow = after - before;
+                        ticks = before + (after - before) / 2;
+                        steadyTime = time;
+                    }
+                }
+            };
+
+            uint64_t startTicks(0), endTicks(0);
+            std::chrono::steady_clock::time_point startTime, endTime;
+            readPair(startTicks, startTime);
+            do
+            {
+                readPair(endTicks, endTime);
+            }
+            while (endTime - startTime < calibrationTime);
+
+            const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+            const auto ticks = endTicks - startTicks;
+            if (ticks > 0)
+            {
+                calibration.useTsc = true;
+                calibration.baseTicks = startTicks;
+                calibration.baseSteadyTime = startTime;
+                calibration.frequency = static_cast<uint64_t>(static_cast<double>(ticks) * 1e9 / nanoseconds);
+                calibration.multiplier = static_cast<uint64_t>(static_cast<double>(nanoseconds) * 4294967296.0 / ticks);
+                return calibration;
+            }
+        }
+#endif
+
+        calibration.baseSteadyTime = std::chrono::steady_clock::now();
+        return calibration;
+    }
+
+    const Calibration& GetCalibration()
+    {
+        static const Calibration calibration(CreateCalibration());
+        return calibration;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineClock::time_point EngineClock::now() noexcept
+{
+    const auto& calibration = GetCalibration();
+
+#if defined(C2D_ENGINE_CLOCK_TSC)
+    if (calibration.useTsc)
+    {
+        // Counter can be slightly behind the epoch on another core, such reads are clamped to the epoch
+        const auto ticks = ReadTsc() - calibration.baseTicks;
+        if (static_cast<int64_t>(ticks) < 0)
+        {
+            return time_point();
+        }
+        return time_point(duration(static_cast<rep>(TicksToNanoseconds(ticks, calibration.multiplier))));
+    }
+#endif
+
+    return time_point(std::chrono::duration_cast<duration>(std::chrono::steady_clock::now()
+                                                          - calibration.baseSteadyTime));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void EngineClock::Calibrate()
+{
+    GetCalibration();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool EngineClock::IsTscUsed()
+{
+    return GetCalibration().useTsc;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t EngineClock::GetTscFrequency()
+{
+    return GetCalibration().frequency;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::chrono::steady_clock::time_point EngineClock::ToSteadyTime(const time_point timePoint)
+{
+    return GetCalibration().baseSteadyTime
+           + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timePoint.time_since_epoch());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineClock::time_point EngineClock::FromSteadyTime(const std::chrono::steady_clock::time_point timePoint)
+{
+    return time_point(std::chrono::duration_cast<duration>(timePoint - GetCalibration().baseSteadyTime));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,84 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Monotonic high-resolution clock of the engine.
+     *
+     * On x86-64 processors with invariant TSC the clock reads the time stamp counter, which takes a few
+     * nanoseconds, and converts ticks to nanoseconds by a calibrated multiplier. On other platforms it falls back
+     * to std::chrono::steady_clock. So the clock is cheap enough to be called thousands of times per frame,
+     * e.g. by profiling scopes or for timestamps of input events.
+     *
+     * The clock satisfies requirements of the standard clocks, so it can be used with std::chrono.
+     * Its epoch is the moment of calibration, which happens on the first call and takes about 10 milliseconds,
+     * so Calibrate() should be called at startup.
+     *
+     * Usage example:
+     * \code
+     * const auto start = C2D::EngineClock::now();
+     * DoWork();
+     * const auto elapsed = C2D::EngineClock::now() - start;
+     * \endcode
+     */
+    class EngineClock final
+    {
+    public:
+        EngineClock() = delete;
+
+        using rep = int64_t;
+        using period = std::nano;
+        using duration = std::chrono::duration<rep, period>;
+        using time_point = std::chrono::time_point<EngineClock, duration>;
+
+        /*! Clock never goes backwards. */
+        static constexpr bool is_steady = true;
+
+        /*!
+         * \brief Returns current time.
+         * \return Current time point, time since the calibration.
+         */
+        static time_point now() noexcept;
+
+        /*!
+         * \brief Calibrates the clock if it was not calibrated yet, otherwise does nothing.
+         */
+        static void Calibrate();
+
+        /*!
+         * \brief Checks if the time stamp counter is used.
+         * \return True if the clock reads the time stamp counter, false if it falls back to the steady clock.
+         */
+        static bool IsTscUsed();
+
+        /*!
+         * \brief Returns frequency of the time stamp counter.
+         * \return Ticks per second or 0 if the time stamp counter is not used.
+         */
+        static uint64_t GetTscFrequency();
+
+        /*!
+         * \brief Converts time point of the engine clock to the steady clock.
+         * \param timePoint - time point of the engine clock.
+         * \return Time point of the steady clock.
+         */
+        static std::chrono::steady_clock::time_point ToSteadyTime(time_point timePoint);
+
+        /*!
+         * \brief Converts time point of the steady clock to the engine clock.
+         * \param timePoint - time point of the steady clock.
+         * \return Time point of the engine clock.
+         */
+        static time_point FromSteadyTime(std::chrono::steady_clock::time_point timePoint);
+    };
+
+    /*! Duration of the engine clock in nanoseconds. */
+    using EngineDuration = EngineClock::duration;
+
+    /*! Time point of the engine clock. */
+    using EngineTimePoint = EngineClock::time_point;
+}
@@ -0,0 +1,97 @@
+#include "FrameLimiter.hpp"
+#include <algorithm>
+#include <thread>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    /*! Spin margin before the first sleep is measured, typical overshoot of a coarse OS timer. */
+    constexpr EngineDuration initialSpinMargin = std::chrono::milliseconds(1);
+    /*! Spin margin never drops below it, since a single measurement says little about the worst case. */
+    constexpr EngineDuration minSpinMargin = std::chrono::microseconds(50);
+    /*! Spin margin never exceeds it, so a preempted sleep does not make the limiter spin for whole frames. */
+    constexpr EngineDuration maxSpinMargin = std::chrono::milliseconds(4);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+FrameLimiter::FrameLimiter(const double frameRate)
+: _interval(EngineDuration::zero())
+, _spinMargin(initialSpinMargin)
+{
+    SetFrameRate(frameRate);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FrameLimiter::SetFrameRate(const double frameRate)
+{
+    _interval = frameRate > 0.0
+        ? std::chrono::duration_cast<EngineDuration>(std::chrono::duration<double>(1.0 / frameRate))
+        : EngineDuration::zero();
+    _nextFrame = EngineTimePoint();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double FrameLimiter::GetFrameRate() const
+{
+    return _interval > EngineDuration::zero() ? 1.0 / std::chrono::duration<double>(_interval).count() : 0.0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineDuration FrameLimiter::GetInterval() const
+{
+    return _interval;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineDuration FrameLimiter::Wait()
+{
+    if (_interval == EngineDuration::zero())
+    {
+        return EngineDuration::zero();
+    }
+
+    const auto start = EngineClock::now();
+    if (_nextFrame == EngineTimePoint() || start - _nextFrame > _interval)
+    {
+        _nextFrame = start;
+    }
+
+    auto now = start;
+    while (now + _spinMargin < _nextFrame)
+    {
+        const auto sleepTime = _nextFrame - _spinMargin - now;
+        std::this_thread::sleep_for(sleepTime);
+        const auto wakeUp = EngineClock::now();
+
+        // The margin jumps up to a larger overshoot at once and decays slowly, so rare spikes are still covered
+        const auto overshoot = (wakeUp - now) - sleepTime;
+        _spinMargin = std::clamp(std::max(overshoot, _spinMargin - _spinMargin / 16), minSpinMargin, maxSpinMargin);
+        now = wakeUp;
+    }
+
+    while (now < _nextFrame)
+    {
+        std::this_thread::yield();
+        now = EngineClock::now();
+    }
+
+    _nextFrame += _interval;
+    return now - start;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineDuration FrameLimiter::GetSpinMargin() const
+{
+    return _spinMargin;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,84 @@
+#pragma once
+#include "Utility/Time/EngineClock.hpp"
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Limits the frame rate by sleeping until the start of the next frame.
+     *
+     * Sleep of the OS can overshoot by up to a millisecond or more, so the limiter sleeps until the deadline minus
+     * an estimate of the overshoot and spins the rest. The estimate follows the largest recent overshoot,
+     * so the limiter spins only as long as the OS requires.
+     *
+     * Deadlines are spaced by the frame interval and do not depend on when Wait() returns, so the frame rate does not
+     * drift. If a frame is late by more than an interval, the cadence starts over instead of catching up with
+     * a burst of frames.
+     *
+     * Limiter is not thread-safe, it is used by the thread that draws frames.
+     *
+     * Usage example:
+     * \code
+     * C2D::FrameLimiter frameLimiter(60.0);
+     * while (isRunning)
+     * {
+     *     frameLimiter.Wait();
+     *     DrawFrame();
+     * }
+     * \endcode
+     */
+    class FrameLimiter
+    {
+    public:
+        FrameLimiter(const FrameLimiter& other) = delete;
+        FrameLimiter(FrameLimiter&& other) = delete;
+        FrameLimiter& operator=(const FrameLimiter& other) = delete;
+        FrameLimiter& operator=(FrameLimiter&& other) = delete;
+        ~FrameLimiter() = default;
+
+        /*!
+         * \brief Default constructor.
+         * \param frameRate - maximal number of frames per second, 0 disables the limit.
+         */
+        explicit FrameLimiter(double frameRate = 0.0);
+
+        /*!
+         * \brief Sets the maximal frame rate, the cadence starts over from the next frame.
+         * \param frameRate - maximal number of frames per second, 0 or negative disables the limit.
+         */
+        void SetFrameRate(double frameRate);
+
+        /*!
+         * \brief Returns the maximal frame rate.
+         * \return Number of frames per second or 0 if the frame rate is not limited.
+         */
+        double GetFrameRate() const;
+
+        /*!
+         * \brief Returns the interval between frames.
+         * \return Interval or zero if the frame rate is not limited.
+         */
+        EngineDuration GetInterval() const;
+
+        /*!
+         * \brief Blocks until the start of the next frame.
+         * \return Time spent waiting.
+         */
+        EngineDuration Wait();
+
+        /*!
+         * \brief Returns the current estimate of the OS sleep overshoot.
+         * \return Part of the wait that is spun instead of slept.
+         */
+        EngineDuration GetSpinMargin() const;
+
+    private:
+        /*! Interval between frames, zero if the frame rate is not limited. */
+        EngineDuration _interval;
+        /*! Start of the next frame, the epoch if the cadence must start over. */
+        EngineTimePoint _nextFrame;
+        /*! Part of the wait that is spun instead of slept. */
+        EngineDuration _spinMargin;
+    };
+}
@@ -0,0 +1,92 @@
+#include "GameTime.hpp"
+#include <algorithm>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GameTime::GameTime(const EngineDuration maxDelta)
+: _maxDelta(maxDelta)
+, _scale(1.0f)
+, _isPaused(false)
+, _delta(0)
+, _time(0)
+, _realTime(0)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void GameTime::Advance(const EngineDuration realDelta)
+{
+    const auto clampedDelta = std::clamp(realDelta, EngineDuration::zero(), _maxDelta);
+    const auto delta = _isPaused ? 0 : static_cast<int64_t>(static_cast<double>(clampedDelta.count()) * _scale);
+
+    _delta = delta;
+    _time += delta;
+    _realTime += std::max(realDelta, EngineDuration::zero()).count();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void GameTime::SetScale(const float scale)
+{
+    _scale = std::max(scale, 0.0f);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+float GameTime::GetScale() const
+{
+    return _scale;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void GameTime::Pause()
+{
+    _isPaused = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void GameTime::Resume()
+{
+    _isPaused = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool GameTime::IsPaused() const
+{
+    return _isPaused;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineDuration GameTime::GetDelta() const
+{
+    return EngineDuration(_delta.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+float GameTime::GetDeltaSeconds() const
+{
+    return std::chrono::duration<float>(GetDelta()).count();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineDuration GameTime::GetTime() const
+{
+    return EngineDuration(_time.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineDuration GameTime::GetRealTime() const
+{
+    return EngineDuration(_realTime.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
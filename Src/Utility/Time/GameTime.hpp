@@ -0,0 +1,113 @@
+#pragma once
+#include "Utility/Time/EngineClock.hpp"
+#include <atomic>
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Time of the game world, it can be scaled for slow motion and paused.
+     *
+     * Logic loop advances the game time by the real duration of its tick, the game delta is then the real delta
+     * multiplied by the scale, or zero while the game is paused. Real deltas are clamped to the maximal delta,
+     * so a hitch, e.g. loading or a breakpoint, does not make the simulation jump.
+     *
+     * Scale and pause can be changed from any thread, the time is advanced by the logic thread only.
+     *
+     * Usage example:
+     * \code
+     * C2D::GameTime gameTime;
+     * gameTime.SetScale(0.5f);
+     * gameTime.Advance(logicLoopTimeSpan.GetDelta());
+     * MoveObjects(gameTime.GetDeltaSeconds());
+     * \endcode
+     */
+    class GameTime
+    {
+    public:
+        GameTime(const GameTime& other) = delete;
+        GameTime(GameTime&& other) = delete;
+        GameTime& operator=(const GameTime& other) = delete;
+        GameTime& operator=(GameTime&& other) = delete;
+        ~GameTime() = default;
+
+        /*!
+         * \brief Default constructor.
+         * \param maxDelta - maximal real delta of one tick.
+         */
+        explicit GameTime(EngineDuration maxDelta = std::chrono::milliseconds(250));
+
+        /*!
+         * \brief Advances the game time.
+         * \param realDelta - real duration of the tick.
+         */
+        void Advance(EngineDuration realDelta);
+
+        /*!
+         * \brief Sets the scale of the game time.
+         * \param scale - multiplier of real deltas, negative values are treated as zero.
+         */
+        void SetScale(float scale);
+
+        /*!
+         * \brief Returns the scale of the game time.
+         * \return Multiplier of real deltas.
+         */
+        float GetScale() const;
+
+        /*!
+         * \brief Pauses the game time, game deltas are zero until Resume() is called.
+         */
+        void Pause();
+
+        /*!
+         * \brief Resumes the game time.
+         */
+        void Resume();
+
+        /*!
+         * \brief Checks if the game time is paused.
+         * \return True if the game time is paused.
+         */
+        bool IsPaused() const;
+
+        /*!
+         * \brief Returns game duration of the last tick.
+         * \return Scaled and clamped delta, zero if the game time is paused.
+         */
+        EngineDuration GetDelta() const;
+
+        /*!
+         * \brief Returns game duration of the last tick in seconds.
+         * \return Scaled and clamped delta in seconds.
+         */
+        float GetDeltaSeconds() const;
+
+        /*!
+         * \brief Returns time of the game world.
+         * \return Sum of game deltas.
+         */
+        EngineDuration GetTime() const;
+
+        /*!
+         * \brief Returns real time the game time was advanced by.
+         * \return Sum of real deltas, including the paused ones.
+         */
+        EngineDuration GetRealTime() const;
+
+    private:
+        /*! Maximal real delta of one tick. */
+        const EngineDuration _maxDelta;
+        /*! Multiplier of real deltas. */
+        std::atomic<float> _scale;
+        /*! Flag that defines if the game time is paused. */
+        std::atomic<bool> _isPaused;
+        /*! Game duration of the last tick in nanoseconds. */
+        std::atomic<int64_t> _delta;
+        /*! Sum of game deltas in nanoseconds. */
+        std::atomic<int64_t> _time;
+        /*! Sum of real deltas in nanoseconds. */
+        std::atomic<int64_t> _realTime;
+    };
+}
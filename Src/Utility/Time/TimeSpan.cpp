@@ -0,0 +1,92 @@
+#include "TimeSpan.hpp"
+#include <algorithm>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TimeSpan::TimeSpan(const float smoothingFactor)
+: _smoothingFactor(std::clamp(smoothingFactor, 0.0f, 1.0f))
+, _start(0)
+, _end(0)
+, _delta(0)
+, _smoothedDelta(0)
+, _iterationCount(0)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TimeSpan::Reset(const EngineTimePoint start)
+{
+    const auto nanoseconds = start.time_since_epoch().count();
+    _start = nanoseconds;
+    _end = nanoseconds;
+    _delta = 0;
+    _smoothedDelta = 0;
+    _iterationCount = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TimeSpan::SetNewEnd(const EngineTimePoint end)
+{
+    const auto previousEnd = _end.load(std::memory_order_relaxed);
+    const auto nanoseconds = std::max(end.time_since_epoch().count(), previousEnd);
+    const auto delta = nanoseconds - previousEnd;
+
+    // The first iteration has no history, so it is not averaged with zero
+    const auto smoothedDelta = _iterationCount.load(std::memory_order_relaxed) == 0
+                               ? delta
+                               : _smoothedDelta.load(std::memory_order_relaxed);
+
+    _start = previousEnd;
+    _end = nanoseconds;
+    _delta = delta;
+    _smoothedDelta = smoothedDelta + static_cast<int64_t>(static_cast<double>(delta - smoothedDelta)
+                                                          * _smoothingFactor);
+    ++_iterationCount;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineTimePoint TimeSpan::GetStart() const
+{
+    return EngineTimePoint(EngineDuration(_start.load()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineTimePoint TimeSpan::GetEnd() const
+{
+    return EngineTimePoint(EngineDuration(_end.load()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineDuration TimeSpan::GetDelta() const
+{
+    return EngineDuration(_delta.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+float TimeSpan::GetDeltaSeconds() const
+{
+    return std::chrono::duration<float>(GetDelta()).count();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineDuration TimeSpan::GetSmoothedDelta() const
+{
+    return EngineDuration(_smoothedDelta.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t TimeSpan::GetIterationCount() const
+{
+    return _iterationCount.load();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
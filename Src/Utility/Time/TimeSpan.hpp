@@ -0,0 +1,107 @@
+#pragma once
+#include "Utility/Time/EngineClock.hpp"
+#include <atomic>
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Time span of the last iteration of a loop, e.g. a frame of the render loop or a tick of the logic loop.
+     *
+     * The loop calls SetNewEnd() once per iteration, the previous end becomes the new start. Besides the raw delta
+     * the span keeps an exponentially smoothed delta, which is better for displaying FPS or for adaptive quality,
+     * since single hitches do not make it jump.
+     *
+     * Values are atomic, so the span can be written by its loop and read from other threads. A reader can see
+     * values of two neighbouring iterations, e.g. the start of the new one with the delta of the previous one.
+     *
+     * Usage example:
+     * \code
+     * C2D::TimeSpan loopTimeSpan;
+     * loopTimeSpan.Reset(C2D::EngineClock::now());
+     * while (working)
+     * {
+     *     Update(loopTimeSpan.GetDeltaSeconds());
+     *     loopTimeSpan.SetNewEnd(C2D::EngineClock::now());
+     * }
+     * \endcode
+     */
+    class TimeSpan
+    {
+    public:
+        TimeSpan(const TimeSpan& other) = delete;
+        TimeSpan(TimeSpan&& other) = delete;
+        TimeSpan& operator=(const TimeSpan& other) = delete;
+        TimeSpan& operator=(TimeSpan&& other) = delete;
+        ~TimeSpan() = default;
+
+        /*!
+         * \brief Default constructor.
+         * \param smoothingFactor - weight of the new delta in the smoothed delta, from 0 to 1.
+         */
+        explicit TimeSpan(float smoothingFactor = 0.1f);
+
+        /*!
+         * \brief Starts the span anew, start and end are set to the time point and deltas are reset.
+         * \param start - time point of the start.
+         */
+        void Reset(EngineTimePoint start);
+
+        /*!
+         * \brief Finishes the iteration, the previous end becomes the start.
+         * \param end - time point of the end, if it is before the previous end, the delta is zero.
+         */
+        void SetNewEnd(EngineTimePoint end);
+
+        /*!
+         * \brief Returns start of the last iteration.
+         * \return Time point of the start.
+         */
+        EngineTimePoint GetStart() const;
+
+        /*!
+         * \brief Returns end of the last iteration.
+         * \return Time point of the end.
+         */
+        EngineTimePoint GetEnd() const;
+
+        /*!
+         * \brief Returns duration of the last iteration.
+         * \return Duration of the last iteration.
+         */
+        EngineDuration GetDelta() const;
+
+        /*!
+         * \brief Returns duration of the last iteration in seconds.
+         * \return Duration in seconds.
+         */
+        float GetDeltaSeconds() const;
+
+        /*!
+         * \brief Returns smoothed duration of iterations.
+         * \return Exponential moving average of durations, it is equal to the delta after the first iteration.
+         */
+        EngineDuration GetSmoothedDelta() const;
+
+        /*!
+         * \brief Returns number of iterations since the reset.
+         * \return Number of calls of SetNewEnd().
+         */
+        uint64_t GetIterationCount() const;
+
+    private:
+        /*! Weight of the new delta in the smoothed delta. */
+        const float _smoothingFactor;
+        /*! Start of the last iteration in nanoseconds. */
+        std::atomic<int64_t> _start;
+        /*! End of the last iteration in nanoseconds. */
+        std::atomic<int64_t> _end;
+        /*! Duration of the last iteration in nanoseconds. */
+        std::atomic<int64_t> _delta;
+        /*! Smoothed duration of iterations in nanoseconds. */
+        std::atomic<int64_t> _smoothedDelta;
+        /*! Number of iterations since the reset. */
+        std::atomic<uint64_t> _iterationCount;
+    };
+}
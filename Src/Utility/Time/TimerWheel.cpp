@@ -0,0 +1,188 @@
+#include "TimerWheel.hpp"
+#include <algorithm>
+#include <bit>
+
+using namespace C2D;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    /*!
+     * \brief Orders entries of the min-heap, timers with the same expiration fire in the order of scheduling.
+     */
+    template <class Entry>
+    bool FiresLater(const Entry& left, const Entry& right)
+    {
+        return left.expiration != right.expiration ? left.expiration > right.expiration : left.id > right.id;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TimerWheel::TimerWheel(const EngineDuration resolution, const size_t slotCount)
+: _resolution(std::max(resolution, EngineDuration(1)))
+, _slots(std::bit_ceil(std::max(slotCount, size_t(1))))
+, _time(0)
+, _nextId(1)
+{ }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TimerWheel::TimerId TimerWheel::Schedule(const EngineDuration delay, Callback callback)
+{
+    return _Add(_time + std::max(delay, EngineDuration::zero()), EngineDuration::zero(), std::move(callback));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TimerWheel::TimerId TimerWheel::ScheduleRepeating(const EngineDuration interval, Callback callback)
+{
+    // Shorter intervals would fire many times per slot without any benefit
+    const auto period = std::max(interval, _resolution);
+    return _Add(_time + period, period, std::move(callback));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool TimerWheel::Cancel(const TimerId id)
+{
+    const auto timer = _timers.find(id);
+    if (timer == _timers.end())
+    {
+        return false;
+    }
+
+    // Timer that is being called is not in any slot, so it is just removed from the map
+    auto& slot = _GetSlot(timer->second.expiration);
+    const auto entry = std::find_if(slot.begin(), slot.end(), [id](const SlotEntry& entry) { return entry.id == id; });
+    if (entry != slot.end())
+    {
+        *entry = slot.back();
+        slot.pop_back();
+    }
+    _timers.erase(timer);
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TimerWheel::Advance(const EngineDuration elapsed)
+{
+    if (elapsed <= EngineDuration::zero())
+    {
+        return;
+    }
+
+    const auto firstTick = static_cast<uint64_t>(_time / _resolution);
+    _time += elapsed;
+    const auto lastTick = static_cast<uint64_t>(_time / _resolution);
+
+    // Slots of all elapsed ticks are checked, but no more than once each
+    const auto tickCount = std::min<uint64_t>(lastTick - firstTick + 1, _slots.size());
+    for (uint64_t tick = firstTick; tick < firstTick + tickCount; ++tick)
+    {
+        _CollectExpired(_slots[tick & (_slots.size() - 1)], _time);
+    }
+
+    while (!_expired.empty())
+    {
+        std::pop_heap(_expired.begin(), _expired.end(), FiresLater<SlotEntry>);
+        const auto entry = _expired.back();
+        _expired.pop_back();
+
+        const auto timer = _timers.find(entry.id);
+        if (timer == _timers.end())
+        {
+            continue;
+        }
+
+        // Callback is moved out, so it stays alive even if the callback cancels its own timer
+        auto callback = std::move(timer->second.callback);
+        const auto interval = timer->second.interval;
+        if (interval == EngineDuration::zero())
+        {
+            _timers.erase(timer);
+            callback();
+            continue;
+        }
+
+        callback();
+
+        const auto repeated = _timers.find(entry.id);
+        if (repeated != _timers.end())
+        {
+            repeated->second.callback = std::move(callback);
+            repeated->second.expiration = entry.expiration + interval;
+
+            // Repeating timer catches up if the wheel was advanced by several intervals
+            const SlotEntry next{ repeated->second.expiration, entry.id };
+            if (next.expiration <= _time)
+            {
+                _expired.push_back(next);
+                std::push_heap(_expired.begin(), _expired.end(), FiresLater<SlotEntry>);
+            }
+            else
+            {
+                _GetSlot(next.expiration).push_back(next);
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EngineDuration TimerWheel::GetTime() const
+{
+    return _time;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t TimerWheel::GetCount() const
+{
+    return _timers.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TimerWheel::TimerId TimerWheel::_Add(const EngineDuration expiration,
+                                     const EngineDuration interval,
+                                     Callback callback)
+{
+    const auto id = _nextId++;
+    _timers.emplace(id, Timer{ expiration, interval, std::move(callback) });
+    _GetSlot(expiration).push_back(SlotEntry{ expiration, id });
+
+    return id;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<TimerWheel::SlotEntry>& TimerWheel::_GetSlot(const EngineDuration expiration)
+{
+    return _slots[static_cast<uint64_t>(expiration / _resolution) & (_slots.size() - 1)];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TimerWheel::_CollectExpired(std::vector<SlotEntry>& slot, const EngineDuration time)
+{
+    for (size_t i = 0; i < slot.size();)
+    {
+        if (slot[i].expiration <= time)
+        {
+            _expired.push_back(slot[i]);
+            std::push_heap(_expired.begin(), _expired.end(), FiresLater<SlotEntry>);
+            slot[i] = slot.back();
+            slot.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
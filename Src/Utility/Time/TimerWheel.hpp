@@ -0,0 +1,152 @@
+#pragma once
+#include "Utility/Containers/Delegate/Delegate.hpp"
+#include "Utility/Time/EngineClock.hpp"
+#include <unordered_map>
+#include <vector>
+
+namespace C2D
+{
+    /*!
+     * \ingroup Utility
+     *
+     * \brief Hashed timer wheel that calls callbacks after delays or with intervals.
+     *
+     * Timers are placed to slots by their expiration time divided by the resolution, so scheduling and canceling
+     * take constant time and advancing visits only slots of the elapsed ticks, regardless of the number of timers.
+     * Timers fire at the first Advance() after their expiration, in the order of expiration times. Repeating timers
+     * keep their phase: the next expiration is the previous one plus the interval, so they do not drift, and they
+     * fire several times if the wheel is advanced by several intervals at once.
+     *
+     * The wheel is advanced by durations, not by the clock, so it can run either on real time or on game time,
+     * e.g. with GameTime::GetDelta() timers stop while the game is paused.
+     *
+     * Callbacks can schedule and cancel timers, including their own. Timers that are scheduled from callbacks
+     * fire not earlier than the next Advance(). The wheel is not thread-safe.
+     *
+     * Usage example:
+     * \code
+     * C2D::TimerWheel timers;
+     * const auto id = timers.ScheduleRepeating(std::chrono::seconds(1), []() { SpawnEnemy(); });
+     * timers.Schedule(std::chrono::seconds(10), [&timers, id]() { timers.Cancel(id); });
+     * timers.Advance(gameTime.GetDelta());
+     * \endcode
+     */
+    class TimerWheel
+    {
+    public:
+        TimerWheel(const TimerWheel& other) = delete;
+        TimerWheel(TimerWheel&& other) = delete;
+        TimerWheel& operator=(const TimerWheel& other) = delete;
+        TimerWheel& operator=(TimerWheel&& other) = delete;
+        ~TimerWheel() = default;
+
+        /*! Id of a timer, 0 is never used. */
+        using TimerId = uint64_t;
+
+        /*! Callback of a timer. */
+        using Callback = Delegate<void()>;
+
+        /*!
+         * \brief Default constructor.
+         * \param resolution - duration of one slot, shorter resolution means fewer timers checked per slot.
+         * \param slotCount - number of slots, rounded up to a power of two.
+         */
+        explicit TimerWheel(EngineDuration resolution = std::chrono::milliseconds(1), size_t slotCount = 256);
+
+        /*!
+         * \brief Schedules a callback that is called once.
+         * \param delay - time from now after which the callback is called.
+         * \param callback - callback of the timer.
+         * \return Id of the timer.
+         */
+        TimerId Schedule(EngineDuration delay, Callback callback);
+
+        /*!
+         * \brief Schedules a callback that is called periodically until the timer is canceled.
+         * \param interval - period of the timer, it is not shorter than the resolution.
+         * \param callback - callback of the timer.
+         * \return Id of the timer.
+         */
+        TimerId ScheduleRepeating(EngineDuration interval, Callback callback);
+
+        /*!
+         * \brief Cancels the timer.
+         * \param id - id of the timer.
+         * \return True if the timer was scheduled, false if it has already fired or was canceled.
+         */
+        bool Cancel(TimerId id);
+
+        /*!
+         * \brief Advances time of the wheel and calls callbacks of the expired timers.
+         * \param elapsed - time since the previous advance.
+         */
+        void Advance(EngineDuration elapsed);
+
+        /*!
+         * \brief Returns time of the wheel.
+         * \return Sum of the advanced durations.
+         */
+        EngineDuration GetTime() const;
+
+        /*!
+         * \brief Returns number of scheduled timers.
+         * \return Number of scheduled timers.
+         */
+        size_t GetCount() const;
+
+    private:
+        struct Timer
+        {
+            /*! Time of the expiration. */
+            EngineDuration expiration;
+            /*! Period of the repeating timer, zero for the timers that are called once. */
+            EngineDuration interval;
+            /*! Callback of the timer. */
+            Callback callback;
+        };
+
+        struct SlotEntry
+        {
+            /*! Time of the expiration. */
+            EngineDuration expiration;
+            /*! Id of the timer. */
+            TimerId id;
+        };
+
+        /*!
+         * \brief Adds the timer and places it to the slot.
+         * \param expiration - time of the expiration.
+         * \param interval - period of the timer, zero for the timers that are called once.
+         * \param callback - callback of the timer.
+         * \return Id of the timer.
+         */
+        TimerId _Add(EngineDuration expiration, EngineDuration interval, Callback callback);
+
+        /*!
+         * \brief Returns slot of the expiration time.
+         * \param expiration - time of the expiration.
+         * \return Reference to the slot.
+         */
+        std::vector<SlotEntry>& _GetSlot(EngineDuration expiration);
+
+        /*!
+         * \brief Moves entries of the slot that expire not later than the time to the list of expired entries.
+         * \param slot - slot to check.
+         * \param time - current time of the wheel.
+         */
+        void _CollectExpired(std::vector<SlotEntry>& slot, EngineDuration time);
+
+        /*! Duration of one slot. */
+        const EngineDuration _resolution;
+        /*! Slots, each of them stores timers whose expiration tick modulo the number of slots is the slot index. */
+        std::vector<std::vector<SlotEntry>> _slots;
+        /*! Timers by ids. */
+        std::unordered_map<TimerId, Timer> _timers;
+        /*! Entries that expired during the current advance, it is a min-heap by expiration. */
+        std::vector<SlotEntry> _expired;
+        /*! Time of the wheel. */
+        EngineDuration _time;
+        /*! Id of the next timer. */
+        TimerId _nextId;
+    };
+}
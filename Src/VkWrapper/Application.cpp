@@ -9,17 +9,47 @@ using namespace VkWrapper;
 
 ApplicationConfiguration::ApplicationConfiguration(GLFWWrapper::Window& window,
                                                    std::string pDeviceName,
-                                                   std::vector<std::string>&& shadersList)
-: _window(window)
+                                                   std::vector<std::string>&& shadersList,
+                                                   const PresentConfiguration& presentConfiguration)
+: _window(&window)
 , _pDeviceName(std::move(pDeviceName))
 , _shadersList(std::move(shadersList))
+, _presentConfiguration(presentConfiguration)
 { }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+ApplicationConfiguration::ApplicationConfiguration(VkExtent2D offscreenExtent,
+                                                   std::string pDeviceName,
+                                                   std::vector<std::string>&& shadersList,
+                                                   const PresentConfiguration& presentConfiguration)
+: _window(nullptr)
+, _offscreenExtent(offscreenExtent)
+, _pDeviceName(std::move(pDeviceName))
+, _shadersList(std::move(shadersList))
+, _presentConfiguration(presentConfiguration)
+{ }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool ApplicationConfiguration::IsHeadless() const
+{
+    return _offscreenExtent.has_value();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 GLFWWrapper::Window& ApplicationConfiguration::GetWindow() const
 {
-    return _window;
+    Assert(_window != nullptr, "There is no window in the headless mode");
+    return *_window;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::optional<VkExtent2D>& ApplicationConfiguration::GetOffscreenExtent() const
+{
+    return _offscreenExtent;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -38,47 +68,102 @@ const std::vector<std::string>& ApplicationConfiguration::GetShadersList() const
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-namespace
+const PresentConfiguration& ApplicationConfiguration::GetPresentConfiguration() const
 {
-    constexpr int maxFramesInFlight = 2;
+    return _presentConfiguration;
+}
 
-    size_t SelectSuitableDevice(std::string_view pDeviceName, const std::vector<SuitablePDevice>& suitablePDevices)
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    std::unique_ptr<Surface> CreateSurface(const Context& context, const ApplicationConfiguration& configuration)
     {
-        if (pDeviceName.empty())
+        if (configuration.IsHeadless())
         {
-            return suitablePDevices.size() - 1;
+            return nullptr;
         }
 
-        for (size_t i = 0; i > suitablePDevices.size(); ++i)
+        return std::make_unique<Surface>(context, configuration.GetWindow());
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    size_t SelectSuitableDevice(std::string_view pDeviceName, const std::vector<SuitablePDevice>& suitablePDevices)
+    {
+        std::vector<std::reference_wrapper<const PDevice>> pDevices;
+        pDevices.reserve(suitablePDevices.size());
+        for (const auto& suitablePDevice : suitablePDevices)
         {
-            if (suitablePDevices[i].GetPDevice().GetProperties().deviceName == pDeviceName)
-            {
-                return i;
-            }
+            pDevices.emplace_back(suitablePDevice.GetPDevice());
         }
 
-        return suitablePDevices.size() - 1;
+        return SelectPDevice(pDevices, pDeviceName);
     }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    // Part of the frame which can be spent on the creation and upload of loaded textures
+    constexpr std::chrono::microseconds assetFinalizeBudget(2000);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
 Application::Application(const ApplicationConfiguration& configuration)
 : _configuration(configuration)
+, _extensions(!configuration.IsHeadless())
 , _context(_validationLayers, _extensions)
 #ifndef NDEBUG
 , _debugMessenger(_context)
 #endif
-, _surface(_context, _configuration.GetWindow())
-, _suitableDevices(GetSuitablePDevicesForSurface(_context.GetPhysicalDevices(), _surface))
+, _surface(CreateSurface(_context, _configuration))
+, _suitableDevices(GetSuitablePDevices(_context.GetPhysicalDevices(), _surface.get()))
+, _shaderManager(_configuration.GetShadersList())
 , _selectedSuitableDevice(SelectSuitableDevice(_configuration.GetPDeviceName(), _suitableDevices))
+, _presentConfiguration(_configuration.GetPresentConfiguration())
+, _frameLimiter(_presentConfiguration.frameRateLimit)
 {
-    _configuration.GetWindow().AddFramebufferResizedCallback([this] { OnFrameBufferResized(); });
+    Assert(!_configuration.GetShadersList().empty(), "At least one shader must be specified");
 
-    const auto& pipelineShader = _shaderManager.GetPipelineShader("./shader");
+    if (!_configuration.IsHeadless())
+    {
+        auto& window = _configuration.GetWindow();
+        const auto [width, height] = window.GetFrameBufferSize();
+        _frameBufferExtent = { static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
+        _isMinimized = window.IsMinimized();
+
+        SetWindowState(_frameBufferExtent, _isMinimized);
+        _isWindowStateChanged.store(false, std::memory_order_relaxed);
+
+        // Callbacks are called on the main thread only, so they can read the state that they do not change
+        window.AddFramebufferResizedCallback([this](int32_t newWidth, int32_t newHeight)
+        {
+            SetWindowState({ static_cast<uint32_t>(newWidth), static_cast<uint32_t>(newHeight) },
+                           _isWindowMinimized.load(std::memory_order_relaxed));
+        });
+        window.AddIconifiedCallback([this](bool iconified)
+        {
+            const auto packedExtent = _windowExtent.load(std::memory_order_relaxed);
+            SetWindowState({ static_cast<uint32_t>(packedExtent >> 32), static_cast<uint32_t>(packedExtent) },
+                           iconified);
+        });
+    }
+
+    // Shaders are compiled in the background since the construction of the shader manager
+    const auto& pipelineShader = _shaderManager.GetPipelineShader(_configuration.GetShadersList().front());
+#ifndef NDEBUG
+    _shaderManager.EnableHotReload();
+#endif
 
     CreateNewLogicalDevice();
-    CreateNewSwapChain();
+    if (_configuration.IsHeadless())
+    {
+        CreateOffscreenTarget();
+    }
+    else
+    {
+        CreateNewSwapChain();
+    }
     CreateRenderPipeline(pipelineShader);
 }
 
@@ -86,6 +171,7 @@ Application::Application(const ApplicationConfiguration& configuration)
 
 Application::~Application()
 {
+    StopRenderThread();
     vkDeviceWaitIdle(_lDevice->GetHandle());
 }
 
@@ -93,32 +179,255 @@ Application::~Application()
 
 void Application::DrawFrame()
 {
-    auto result = _renderPipeline->DrawFrame();
-    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || _mustRecreateSwapChain)
+    const auto mustRecreateSwapChain = HandleStateChanges();
+    if (!_configuration.IsHeadless())
     {
-        // In case if the window was minimized we should wait until it will be restored
-        auto [width, height] = _configuration.GetWindow().GetFrameBufferSize();
-        while (width == 0 || height == 0)
+        if (IsFrameBufferEmpty())
         {
-            glfwWaitEvents();
-            auto [newWidth, newHeight] = _configuration.GetWindow().GetFrameBufferSize();
-            width = newWidth;
-            height = newHeight;
+            return;
         }
 
-        vkDeviceWaitIdle(_lDevice->GetHandle());
-        RecreateSwapChain();
+        if (mustRecreateSwapChain)
+        {
+            RecreateSwapChain();
+        }
+
+        // Presentation engine can still use the retired swap chain until a frame of the new one is completed
+        if (_retiredSwapChain != nullptr && GetFrameScheduler().IsFrameCompleted(_firstFrameOfSwapChain))
+        {
+            _retiredSwapChain.reset();
+        }
+    }
+
+    // Sleeping before the frame is begun, rather than before the present, lets the frame see the newest input
+    _frameLimiter.Wait();
+
+    ApplyReloadedShaders();
+
+    // Uploads are submitted before the frame, so its commands see the uploaded data
+    _assetManager->Finalize(assetFinalizeBudget);
+    _stagingUploader->Submit();
+
+    if (_configuration.IsHeadless())
+    {
+        Assert(_renderPipeline->DrawFrame() == VK_SUCCESS, "Failed to render offscreen frame");
+        return;
+    }
+
+    // Input that arrives while the frame is drawn can not affect it, so the time is sampled before drawing
+    const auto inputTime = _configuration.GetWindow().GetLastInputTime();
+    const auto result = _renderPipeline->DrawFrame();
+    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
+    {
+        // The window could be minimized, then the swap chain is recreated when it is restored
+        HandleStateChanges();
+        if (!IsFrameBufferEmpty())
+        {
+            RecreateSwapChain();
+        }
         return;
     }
 
     Assert(result == VK_SUCCESS, "Failed to obtain or present image");
+    UpdateInputLatency(inputTime, C2D::EngineClock::now());
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Application::StartRenderThread()
+{
+    Assert(!_isRenderThreadRunning.load(), "Render thread is already running");
+
+    _isRenderThreadRunning.store(true);
+    _renderThread = std::thread(&Application::RunRenderThread, this);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Application::StopRenderThread()
+{
+    if (!_renderThread.joinable())
+    {
+        return;
+    }
+
+    // The thread can sleep until the next state change, so it is woken up to see the request
+    _isRenderThreadRunning.store(false);
+    NotifyRenderThread();
+    _renderThread.join();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool Application::IsRenderThreadRunning() const
+{
+    return _isRenderThreadRunning.load();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Application::SetPresentConfiguration(const PresentConfiguration& presentConfiguration)
+{
+    {
+        std::lock_guard lock(_pendingPresentConfigurationMutex);
+        _pendingPresentConfiguration = presentConfiguration;
+    }
+    _isPresentConfigurationChanged.store(true, std::memory_order_release);
+    NotifyRenderThread();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+Application::InputLatency Application::GetInputLatency() const
+{
+    const auto frameCount = _inputLatencyFrameCount.load(std::memory_order_relaxed);
+    const auto sum = _inputLatencySum.load(std::memory_order_relaxed);
+
+    return
+    {
+        .last = std::chrono::nanoseconds(_lastInputLatency.load(std::memory_order_relaxed)),
+        .average = std::chrono::nanoseconds(frameCount != 0 ? sum / static_cast<int64_t>(frameCount) : 0),
+        .max = std::chrono::nanoseconds(_maxInputLatency.load(std::memory_order_relaxed)),
+        .frameCount = frameCount
+    };
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+FrameScheduler& Application::GetFrameScheduler()
+{
+    return _renderPipeline->GetFrameScheduler();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+StagingUploader& Application::GetStagingUploader()
+{
+    return *_stagingUploader;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+AssetManager& Application::GetAssetManager()
+{
+    return *_assetManager;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+RenderPipeline& Application::GetRenderPipeline()
+{
+    return *_renderPipeline;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-void Application::OnFrameBufferResized()
+void Application::SetWindowState(VkExtent2D extent, bool isMinimized)
 {
-    _mustRecreateSwapChain = true;
+    _windowExtent.store(static_cast<uint64_t>(extent.width) << 32 | extent.height, std::memory_order_relaxed);
+    _isWindowMinimized.store(isMinimized, std::memory_order_relaxed);
+    _isWindowStateChanged.store(true, std::memory_order_release);
+    NotifyRenderThread();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Application::NotifyRenderThread()
+{
+    _stateChangeCount.fetch_add(1, std::memory_order_release);
+    _stateChangeCount.notify_one();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool Application::HandleStateChanges()
+{
+    bool mustRecreateSwapChain(false);
+
+    // A change that is made after the flag is cleared sets it again, so it is handled by the next frame
+    if (_isWindowStateChanged.exchange(false, std::memory_order_acquire))
+    {
+        const auto packedExtent = _windowExtent.load(std::memory_order_relaxed);
+        _frameBufferExtent = { static_cast<uint32_t>(packedExtent >> 32), static_cast<uint32_t>(packedExtent) };
+        _isMinimized = _isWindowMinimized.load(std::memory_order_relaxed);
+
+        // The window can be resized while it is minimized, so the swap chain is recreated after any change
+        mustRecreateSwapChain = true;
+    }
+
+    if (_isPresentConfigurationChanged.exchange(false, std::memory_order_acquire))
+    {
+        PresentConfiguration presentConfiguration;
+        {
+            std::lock_guard lock(_pendingPresentConfigurationMutex);
+            presentConfiguration = _pendingPresentConfiguration;
+        }
+        mustRecreateSwapChain |= ApplyPresentConfiguration(presentConfiguration);
+    }
+
+    return mustRecreateSwapChain;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool Application::IsFrameBufferEmpty() const
+{
+    return _isMinimized || _frameBufferExtent.width == 0 || _frameBufferExtent.height == 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Application::RunRenderThread()
+{
+    Logger::LogInfo("Render thread is started", __PRETTY_FUNCTION__);
+
+    while (_isRenderThreadRunning.load())
+    {
+        // Changes made after this point change the counter, so the wait below can not miss them
+        const auto stateChangeCount = _stateChangeCount.load(std::memory_order_acquire);
+        DrawFrame();
+        if (!_configuration.IsHeadless() && IsFrameBufferEmpty())
+        {
+            _stateChangeCount.wait(stateChangeCount, std::memory_order_acquire);
+        }
+    }
+
+    Logger::LogInfo("Render thread is stopped", __PRETTY_FUNCTION__);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Application::UpdateInputLatency(C2D::EngineTimePoint inputTime, C2D::EngineTimePoint presentTime)
+{
+    // Only the first frame after the input reacts to it, the following ones would add their frame time
+    if (inputTime <= _lastPresentedInputTime)
+    {
+        return;
+    }
+    _lastPresentedInputTime = inputTime;
+
+    const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(presentTime - inputTime).count();
+    _lastInputLatency.store(latency, std::memory_order_relaxed);
+    _inputLatencySum.fetch_add(latency, std::memory_order_relaxed);
+    _inputLatencyFrameCount.fetch_add(1, std::memory_order_relaxed);
+    if (latency > _maxInputLatency.load(std::memory_order_relaxed))
+    {
+        _maxInputLatency.store(latency, std::memory_order_relaxed);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Application::ApplyReloadedShaders()
+{
+    for (const auto& shaderName : _shaderManager.ApplyReloadedShaders())
+    {
+        // Only the first shader is used by the render pipeline for now
+        if (shaderName == _configuration.GetShadersList().front())
+        {
+            _renderPipeline->RebuildGraphicsPipeline();
+        }
+    }
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -126,6 +435,29 @@ void Application::OnFrameBufferResized()
 void Application::CreateNewLogicalDevice()
 {
     _lDevice = std::make_unique<LDevice>(_suitableDevices[_selectedSuitableDevice], _validationLayers);
+    _stagingUploader = std::make_unique<StagingUploader>(*_lDevice, _suitableDevices[_selectedSuitableDevice]);
+    _assetManager = std::make_unique<AssetManager>(_lDevice->GetHandle(),
+                                                   _suitableDevices[_selectedSuitableDevice].GetPDevice(),
+                                                   *_stagingUploader);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool Application::ApplyPresentConfiguration(const PresentConfiguration& presentConfiguration)
+{
+    if (presentConfiguration.framesInFlight != _presentConfiguration.framesInFlight)
+    {
+        // Semaphores of the frames can still be waited on by the presentation engine, not only by the GPU
+        vkDeviceWaitIdle(_lDevice->GetHandle());
+        _renderPipeline->SetFramesInFlight(presentConfiguration.framesInFlight);
+    }
+    _frameLimiter.SetFrameRate(presentConfiguration.frameRateLimit);
+
+    const auto mustRecreateSwapChain = presentConfiguration.policy != _presentConfiguration.policy ||
+                                       presentConfiguration.imageCount != _presentConfiguration.imageCount;
+    _presentConfiguration = presentConfiguration;
+
+    return mustRecreateSwapChain;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -133,23 +465,57 @@ void Application::CreateNewLogicalDevice()
 void Application::CreateNewSwapChain()
 {
     _swapChain = std::make_unique<SwapChain>(_lDevice->GetHandle(),
-                                             _surface.GetHandle(),
+                                             _surface->GetHandle(),
                                              _suitableDevices[_selectedSuitableDevice],
-                                             _configuration.GetWindow());
+                                             _frameBufferExtent,
+                                             _presentConfiguration);
     _swapChainImageViews = std::make_unique<SwapChainImageViews>(_lDevice->GetHandle(), *_swapChain);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+void Application::CreateOffscreenTarget()
+{
+    // One image per frame in flight, so the next frame never waits for the previous one to be rendered
+    _offscreenTarget = std::make_unique<OffscreenTarget>(_lDevice->GetHandle(),
+                                                         _suitableDevices[_selectedSuitableDevice].GetPDevice(),
+                                                         _configuration.GetOffscreenExtent().value(),
+                                                         _presentConfiguration.framesInFlight);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 void Application::RecreateSwapChain()
 {
+    const auto surfaceExtent =
+        _suitableDevices[_selectedSuitableDevice].GetSwapChainDetails().GetCapabilities().currentExtent;
+    if (surfaceExtent.width == 0 || surfaceExtent.height == 0)
+    {
+        return;
+    }
+
     Logger::LogInfo("Start of the swap chain recreation", __PRETTY_FUNCTION__);
 
-    _mustRecreateSwapChain = false;
-    _swapChain.reset();
-    _swapChainImageViews.reset();
-    CreateNewSwapChain();
+    // Only submitted frames use the old swap chain and the resources that are destroyed below, so the device
+    // does not have to be idle and uploads or other queues keep running
+    auto& frameScheduler = GetFrameScheduler();
+    frameScheduler.WaitForSubmittedFrames();
+
+    // The new swap chain is created while the old one is still alive so its resources can be handed over
+    auto newSwapChain = std::make_unique<SwapChain>(_lDevice->GetHandle(),
+                                                    _surface->GetHandle(),
+                                                    _suitableDevices[_selectedSuitableDevice],
+                                                    _frameBufferExtent,
+                                                    _presentConfiguration,
+                                                    _swapChain->GetHandle());
+
+    // Only resources that depend on the swap chain images are destroyed, everything else is reused
     _renderPipeline->Clean();
+    _swapChainImageViews.reset();
+    _retiredSwapChain = std::move(_swapChain);
+    _swapChain = std::move(newSwapChain);
+    _firstFrameOfSwapChain = frameScheduler.GetSubmittedFrame() + 1;
+    _swapChainImageViews = std::make_unique<SwapChainImageViews>(_lDevice->GetHandle(), *_swapChain);
     _renderPipeline->Recreate(std::ref(_swapChain), std::ref(_swapChainImageViews));
 
     Logger::LogInfo("End of the swap chain recreation", __PRETTY_FUNCTION__);
@@ -159,11 +525,22 @@ void Application::RecreateSwapChain()
 
 void Application::CreateRenderPipeline(const PipelineShader& pipeLineShader)
 {
+    if (_configuration.IsHeadless())
+    {
+        _renderPipeline = std::make_unique<RenderPipeline>(_lDevice,
+                                                           _suitableDevices[_selectedSuitableDevice],
+                                                           pipeLineShader,
+                                                           *_offscreenTarget,
+                                                           _presentConfiguration.framesInFlight);
+        return;
+    }
+
     _renderPipeline = std::make_unique<RenderPipeline>(_lDevice,
                                                        _suitableDevices[_selectedSuitableDevice],
                                                        pipeLineShader,
                                                        std::ref(_swapChain),
-                                                       std::ref(_swapChainImageViews));
+                                                       std::ref(_swapChainImageViews),
+                                                       _presentConfiguration.framesInFlight);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
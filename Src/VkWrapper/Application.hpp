@@ -2,6 +2,13 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <optional>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <Utility/Time/EngineClock.hpp>
+#include <Utility/Time/FrameLimiter.hpp>
 #include <GLFWWrapper/Window.hpp>
 #include <VkWrapper/ValidationLayers.hpp>
 #include <VkWrapper/Extensions.hpp>
@@ -11,10 +18,14 @@
 #endif
 #include <VkWrapper/Surface.hpp>
 #include <VkWrapper/SuitablePDevice.hpp>
-#include <VkWrapper/ShaderManager.hpp>
+#include <VkWrapper/Shader/ShaderManager.hpp>
 #include <VkWrapper/LDevice.hpp>
+#include <VkWrapper/StagingUploader.hpp>
+#include <VkWrapper/Assets/AssetManager.hpp>
+#include <VkWrapper/PresentConfiguration.hpp>
 #include <VkWrapper/SwapChain.hpp>
 #include <VkWrapper/SwapChainImageViews.hpp>
+#include <VkWrapper/OffscreenTarget.hpp>
 #include <VkWrapper/RenderPipeline.hpp>
 
 namespace VkWrapper
@@ -24,36 +35,188 @@ namespace VkWrapper
     public:
         ApplicationConfiguration(GLFWWrapper::Window& window,
                                  std::string pDeviceName,
-                                 std::vector<std::string>&& shadersList);
+                                 std::vector<std::string>&& shadersList,
+                                 const PresentConfiguration& presentConfiguration = {});
 
+        /*!
+         * Configuration of the headless mode, frames are rendered to offscreen images of the specified size
+         * instead of the window surface, so neither window nor display is required.
+         */
+        ApplicationConfiguration(VkExtent2D offscreenExtent,
+                                 std::string pDeviceName,
+                                 std::vector<std::string>&& shadersList,
+                                 const PresentConfiguration& presentConfiguration = {});
+
+        [[nodiscard]]
+        bool IsHeadless() const;
+
+        /*!
+         * \attention Must not be called in the headless mode.
+         */
         [[nodiscard]]
         GLFWWrapper::Window& GetWindow() const;
 
+        [[nodiscard]]
+        const std::optional<VkExtent2D>& GetOffscreenExtent() const;
+
+        /*!
+         * \return Name of the physical device that must be used. If it is empty or there is no such suitable device,
+         *         the device with the highest score is selected (see PDevice).
+         */
         [[nodiscard]]
         std::string_view GetPDeviceName() const;
 
         [[nodiscard]]
         const std::vector<std::string>& GetShadersList() const;
 
+        /*!
+         * \return Initial present configuration, it can be changed later by Application::SetPresentConfiguration().
+         */
+        [[nodiscard]]
+        const PresentConfiguration& GetPresentConfiguration() const;
+
     private:
-        GLFWWrapper::Window& _window;
+        GLFWWrapper::Window* _window;
+        std::optional<VkExtent2D> _offscreenExtent;
         std::string _pDeviceName;
-        const std::vector<std::string>& _shadersList;
+        std::vector<std::string> _shadersList;
+        PresentConfiguration _presentConfiguration;
     };
 
+    /*!
+     * Renders frames either on the calling thread (see DrawFrame()) or on a dedicated render thread
+     * (see StartRenderThread()). Window events are received on the main thread, where GLFW calls callbacks, and
+     * passed to the thread that draws frames as messages through a lock-free queue, so the swap chain is recreated
+     * and drawing is paused without any state shared between the threads.
+     */
     class Application final
     {
     public:
+        /*!
+         * Latency from the newest input event to the present of the first frame that was drawn after it.
+         * The return from vkQueuePresentKHR is the latest point that is visible to the application, so the time
+         * that the image waits for the scan-out is not included.
+         */
+        struct InputLatency
+        {
+            std::chrono::nanoseconds last = std::chrono::nanoseconds::zero();
+            std::chrono::nanoseconds average = std::chrono::nanoseconds::zero();
+            std::chrono::nanoseconds max = std::chrono::nanoseconds::zero();
+            uint64_t frameCount = 0; // Number of frames that were drawn after new input
+        };
+
         explicit Application(const ApplicationConfiguration& configuration);
         ~Application();
 
+        /*!
+         * Handles pending window messages and draws a frame. Nothing is drawn while the window is minimized.
+         *
+         * \attention Must not be called while the render thread is running.
+         */
         void DrawFrame();
 
+        /*!
+         * Starts the thread that draws frames until StopRenderThread() is called, so the main thread only
+         * processes window events and a present that blocks in the FIFO mode does not delay input sampling.
+         * While the window is minimized the thread sleeps until the window state changes.
+         *
+         * \attention Objects returned by the getters are used by the render thread, so other threads can call only
+         *            their thread-safe methods.
+         */
+        void StartRenderThread();
+
+        /*!
+         * Stops the render thread and waits until the frame that is being drawn is submitted.
+         * Called by the destructor.
+         */
+        void StopRenderThread();
+
+        /*!
+         * \threadSafety Thread-safe.
+         */
+        [[nodiscard]]
+        bool IsRenderThreadRunning() const;
+
+        /*!
+         * Changes the present policy, the number of swap chain images, frames in flight and the frame rate limit.
+         * The latest change is applied before the next frame through the swap chain recreation.
+         *
+         * \threadSafety Thread-safe.
+         */
+        void SetPresentConfiguration(const PresentConfiguration& presentConfiguration);
+
+        /*!
+         * \return Latency from input to present, e.g. to compare drawing on the main thread with the render thread.
+         *         Always zero in the headless mode.
+         *
+         * \threadSafety Thread-safe. Values are updated independently, so they can belong to different frames.
+         */
+        [[nodiscard]]
+        InputLatency GetInputLatency() const;
+
+        /*!
+         * Gives access to the frame scheduler, e.g. to check if resources used by a past frame can be recycled,
+         * to install a frame pacing hook or to read the CPU wait time of the last frame.
+         */
+        [[nodiscard]]
+        FrameScheduler& GetFrameScheduler();
+
+        /*!
+         * Uploads recorded through the uploader are submitted at the beginning of the next frame.
+         */
+        [[nodiscard]]
+        StagingUploader& GetStagingUploader();
+
+        /*!
+         * Loaded images are uploaded at the beginning of each frame within a small time budget.
+         */
+        [[nodiscard]]
+        AssetManager& GetAssetManager();
+
+        /*!
+         * Gives access to the render pipeline, e.g. to read back the last frame in the headless mode
+         * or to get the timings of the last frame.
+         */
+        [[nodiscard]]
+        RenderPipeline& GetRenderPipeline();
+
     private:
-        void OnFrameBufferResized();
+        /*!
+         * Called on the main thread by the window callbacks, the latest state is kept, so no change is lost.
+         */
+        void SetWindowState(VkExtent2D extent, bool isMinimized);
+
+        /*!
+         * Wakes up the render thread that sleeps while the window is minimized.
+         */
+        void NotifyRenderThread();
+
+        /*!
+         * Reads the window state and the present configuration that were changed since the previous call.
+         *
+         * \return True if the swap chain must be recreated.
+         */
+        bool HandleStateChanges();
+
+        [[nodiscard]]
+        bool IsFrameBufferEmpty() const;
+
+        void RunRenderThread();
+        void UpdateInputLatency(C2D::EngineTimePoint inputTime, C2D::EngineTimePoint presentTime);
+        void ApplyReloadedShaders();
 
         void CreateNewLogicalDevice();
+        /*!
+         * \return True if the swap chain must be recreated.
+         */
+        bool ApplyPresentConfiguration(const PresentConfiguration& presentConfiguration);
         void CreateNewSwapChain();
+        void CreateOffscreenTarget();
+        /*!
+         * Keeps the current swap chain if the surface is empty, e.g. the window was minimized but the render thread
+         * has not seen it yet. Waits only for the submitted frames, the old swap chain is passed to the new one
+         * as retired and destroyed once the first frame of the new one is completed.
+         */
         void RecreateSwapChain();
         void CreateRenderPipeline(const PipelineShader& pipeLineShader);
 
@@ -65,16 +228,43 @@ namespace VkWrapper
 #ifndef NDEBUG
         DebugMessenger _debugMessenger;
 #endif
-        Surface _surface;
+        std::unique_ptr<Surface> _surface;
         std::vector<SuitablePDevice> _suitableDevices;
         ShaderManager _shaderManager;
         size_t _selectedSuitableDevice;
         std::unique_ptr<LDevice> _lDevice;
+        std::unique_ptr<StagingUploader> _stagingUploader;
+        std::unique_ptr<AssetManager> _assetManager;
+
+        // Written by the main thread and read by the thread that draws frames, the latest value wins
+        std::atomic<uint64_t> _windowExtent = 0; // Width in the high half, height in the low half
+        std::atomic<bool> _isWindowMinimized = false;
+        std::atomic<bool> _isWindowStateChanged = false;
+        std::mutex _pendingPresentConfigurationMutex;
+        PresentConfiguration _pendingPresentConfiguration;
+        std::atomic<bool> _isPresentConfigurationChanged = false;
+        std::atomic<uint32_t> _stateChangeCount = 0; // The render thread waits on it while minimized
+
+        // Used only by the thread that draws frames
+        VkExtent2D _frameBufferExtent{};
+        bool _isMinimized = false;
+        PresentConfiguration _presentConfiguration;
+        C2D::FrameLimiter _frameLimiter;
+
+        std::thread _renderThread;
+        std::atomic<bool> _isRenderThreadRunning = false;
 
-        bool _mustRecreateSwapChain = false;
+        C2D::EngineTimePoint _lastPresentedInputTime;
+        std::atomic<int64_t> _lastInputLatency = 0;
+        std::atomic<int64_t> _maxInputLatency = 0;
+        std::atomic<int64_t> _inputLatencySum = 0;
+        std::atomic<uint64_t> _inputLatencyFrameCount = 0;
 
         std::unique_ptr<SwapChain> _swapChain;
+        std::unique_ptr<SwapChain> _retiredSwapChain; // Old swap chain, destroyed once the new one is in use
+        uint64_t _firstFrameOfSwapChain = 0;
         std::unique_ptr<SwapChainImageViews> _swapChainImageViews;
+        std::unique_ptr<OffscreenTarget> _offscreenTarget;
 
         std::unique_ptr<RenderPipeline> _renderPipeline;
     };
@@ -0,0 +1,286 @@
+#include "AssetDecoder.hpp"
+#include <array>
+#include <algorithm>
+#include <cstring>
+#include <charconv>
+#include <string_view>
+#include <png.h>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    constexpr uint32_t spirVMagicNumber = 0x07230203;
+    constexpr size_t spirVHeaderSize = 5 * sizeof(uint32_t);
+    constexpr uint32_t maxChannelValue = 255;
+    // Larger images are not supported by most devices, the limit also bounds memory requested by damaged headers
+    constexpr uint32_t maxPngDimension = 16384;
+    constexpr std::array<uint8_t, 8> pngSignature = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+    struct NetpbmHeader
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t depth = 0;
+        uint32_t maxValue = 0;
+        size_t dataOffset = 0;
+    };
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    bool IsWhitespace(uint8_t symbol)
+    {
+        return symbol == ' ' || symbol == '\t' || symbol == '\n' || symbol == '\r' || symbol == '\v' || symbol == '\f';
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    // Comments start with '#' and last until the end of the line
+    std::optional<std::string_view> ReadToken(std::span<const uint8_t> data, size_t& position)
+    {
+        while (position < data.size() && (IsWhitespace(data[position]) || data[position] == '#'))
+        {
+            if (data[position] == '#')
+            {
+                while (position < data.size() && data[position] != '\n')
+                {
+                    ++position;
+                }
+                continue;
+            }
+            ++position;
+        }
+
+        const auto begin = position;
+        while (position < data.size() && !IsWhitespace(data[position]) && data[position] != '#')
+        {
+            ++position;
+        }
+
+        if (begin == position)
+        {
+            return std::nullopt;
+        }
+
+        return std::string_view(reinterpret_cast<const char*>(data.data()) + begin, position - begin);
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    std::optional<uint32_t> ReadNumber(std::span<const uint8_t> data, size_t& position)
+    {
+        const auto token = ReadToken(data, position);
+        if (!token.has_value())
+        {
+            return std::nullopt;
+        }
+
+        uint32_t value(0);
+        const auto end = token->data() + token->size();
+        const auto [pointer, error] = std::from_chars(token->data(), end, value);
+        if (error != std::errc() || pointer != end)
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    std::optional<NetpbmHeader> ReadPpmHeader(std::span<const uint8_t> data, size_t& position)
+    {
+        const auto width = ReadNumber(data, position);
+        const auto height = width.has_value() ? ReadNumber(data, position) : std::nullopt;
+        const auto maxValue = height.has_value() ? ReadNumber(data, position) : std::nullopt;
+
+        // Exactly one whitespace separates the header from pixels, pixels themselves may look like whitespaces
+        if (!maxValue.has_value() || position >= data.size() || !IsWhitespace(data[position]))
+        {
+            return std::nullopt;
+        }
+
+        return NetpbmHeader
+        {
+            .width = width.value(),
+            .height = height.value(),
+            .depth = 3,
+            .maxValue = maxValue.value(),
+            .dataOffset = position + 1
+        };
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    std::optional<NetpbmHeader> ReadPamHeader(std::span<const uint8_t> data, size_t& position)
+    {
+        NetpbmHeader header;
+        while (const auto key = ReadToken(data, position))
+        {
+            if (key == "ENDHDR")
+            {
+                if (position >= data.size() || data[position] != '\n')
+                {
+                    return std::nullopt;
+                }
+
+                header.dataOffset = position + 1;
+                return header;
+            }
+
+            // Tuple type is informational, the layout of pixels is defined by the depth
+            if (key == "TUPLTYPE")
+            {
+                while (position < data.size() && data[position] != '\n')
+                {
+                    ++position;
+                }
+                continue;
+            }
+
+            const auto value = ReadNumber(data, position);
+            if (!value.has_value())
+            {
+                return std::nullopt;
+            }
+
+            if (key == "WIDTH")
+            {
+                header.width = value.value();
+            }
+            else if (key == "HEIGHT")
+            {
+                header.height = value.value();
+            }
+            else if (key == "DEPTH")
+            {
+                header.depth = value.value();
+            }
+            else if (key == "MAXVAL")
+            {
+                header.maxValue = value.value();
+            }
+            else
+            {
+                return std::nullopt;
+            }
+        }
+
+        return std::nullopt;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::optional<DecodedImage> VkWrapper::DecodeNetpbm(std::span<const uint8_t> data)
+{
+    size_t position(0);
+    const auto magic = ReadToken(data, position);
+
+    std::optional<NetpbmHeader> header;
+    if (magic == "P6")
+    {
+        header = ReadPpmHeader(data, position);
+    }
+    else if (magic == "P7")
+    {
+        header = ReadPamHeader(data, position);
+    }
+
+    if (!header.has_value() || header->width == 0 || header->height == 0 ||
+        header->depth == 0 || header->depth > 4 || header->maxValue == 0 || header->maxValue > maxChannelValue)
+    {
+        return std::nullopt;
+    }
+
+    const auto depth = header->depth;
+    const auto pixelCount = static_cast<size_t>(header->width) * header->height;
+    if ((data.size() - header->dataOffset) / depth < pixelCount)
+    {
+        return std::nullopt;
+    }
+
+    // Scaling through the table is cheaper than the division per channel
+    std::array<uint8_t, maxChannelValue + 1> scaled{};
+    for (uint32_t value = 0; value <= maxChannelValue; ++value)
+    {
+        const auto clamped = std::min(value, header->maxValue);
+        scaled[value] = static_cast<uint8_t>((clamped * maxChannelValue + header->maxValue / 2) / header->maxValue);
+    }
+
+    DecodedImage image{ { header->width, header->height }, std::vector<uint8_t>(pixelCount * 4) };
+
+    const auto isGrayscale = depth < 3;
+    const auto hasAlpha = depth % 2 == 0;
+    const auto* source = data.data() + header->dataOffset;
+    auto* destination = image.pixels.data();
+    for (size_t i = 0; i < pixelCount; ++i, source += depth, destination += 4)
+    {
+        destination[0] = scaled[source[0]];
+        destination[1] = isGrayscale ? destination[0] : scaled[source[1]];
+        destination[2] = isGrayscale ? destination[0] : scaled[source[2]];
+        destination[3] = hasAlpha ? scaled[source[depth - 1]] : static_cast<uint8_t>(maxChannelValue);
+    }
+
+    return image;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::optional<DecodedImage> VkWrapper::DecodePng(std::span<const uint8_t> data)
+{
+    // Simplified API of libpng converts any color type and bit depth to the requested format
+    png_image png{};
+    png.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_memory(&png, data.data(), data.size()))
+    {
+        return std::nullopt;
+    }
+
+    if (png.width > maxPngDimension || png.height > maxPngDimension)
+    {
+        png_image_free(&png);
+        return std::nullopt;
+    }
+
+    png.format = PNG_FORMAT_RGBA;
+    DecodedImage image{ { png.width, png.height }, std::vector<uint8_t>(PNG_IMAGE_SIZE(png)) };
+    if (!png_image_finish_read(&png, nullptr, image.pixels.data(), 0, nullptr))
+    {
+        png_image_free(&png);
+        return std::nullopt;
+    }
+
+    return image;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::optional<DecodedImage> VkWrapper::DecodeImage(std::span<const uint8_t> data)
+{
+    if (data.size() >= pngSignature.size() && std::equal(pngSignature.begin(), pngSignature.end(), data.begin()))
+    {
+        return DecodePng(data);
+    }
+
+    return DecodeNetpbm(data);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool VkWrapper::IsSpirV(std::span<const uint8_t> data)
+{
+    if (data.size() < spirVHeaderSize || data.size() % sizeof(uint32_t) != 0)
+    {
+        return false;
+    }
+
+    uint32_t magicNumber(0);
+    std::memcpy(&magicNumber, data.data(), sizeof(magicNumber));
+
+    return magicNumber == spirVMagicNumber;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
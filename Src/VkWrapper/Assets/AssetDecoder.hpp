@@ -0,0 +1,48 @@
+#pragma once
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <vulkan/vulkan.h>
+
+namespace VkWrapper
+{
+    struct DecodedImage
+    {
+        VkExtent2D extent{};
+        std::vector<uint8_t> pixels; // Tightly packed rows of VK_FORMAT_R8G8B8A8_UNORM pixels
+    };
+
+    /*!
+     * Decodes binary Netpbm images: PPM (P6) and PAM (P7) with 1 to 4 channels (grayscale, grayscale with alpha,
+     * RGB and RGBA) and at most 8 bits per channel. Channels are scaled to the full 8-bit range, missing
+     * channels are expanded, missing alpha is opaque.
+     *
+     * \return Decoded image or nothing if the data is not a supported or complete image.
+     */
+    [[nodiscard]]
+    std::optional<DecodedImage> DecodeNetpbm(std::span<const uint8_t> data);
+
+    /*!
+     * Decodes PNG images of any color type and bit depth with libpng, channels are converted to 8-bit RGBA, missing
+     * alpha is opaque. Images larger than 16384 pixels in any dimension are rejected.
+     *
+     * \return Decoded image or nothing if the data is not a valid PNG image.
+     */
+    [[nodiscard]]
+    std::optional<DecodedImage> DecodePng(std::span<const uint8_t> data);
+
+    /*!
+     * Decodes PNG or Netpbm image, the format is detected by the signature of the data.
+     *
+     * \return Decoded image or nothing if the data is not a supported or complete image.
+     */
+    [[nodiscard]]
+    std::optional<DecodedImage> DecodeImage(std::span<const uint8_t> data);
+
+    /*!
+     * Checks the header of a SPIR-V module in the host byte order, the module itself is validated by the driver.
+     */
+    [[nodiscard]]
+    bool IsSpirV(std::span<const uint8_t> data);
+}
\ No newline at end of file
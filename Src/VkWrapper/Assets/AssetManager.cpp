@@ -0,0 +1,388 @@
+#include "AssetManager.hpp"
+#include <algorithm>
+#include <VkWrapper/Assets/AssetDecoder.hpp>
+#include <Utility/Assert.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+#include <Logger/Logger.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    // Opaque mid-gray, noticeable on screen but does not flash
+    constexpr uint8_t placeholderPixel[] = { 128, 128, 128, 255 };
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    bool HasHigherPriority(const std::shared_ptr<Asset>& lhs, const std::shared_ptr<Asset>& rhs)
+    {
+        return lhs->GetPriority() > rhs->GetPriority();
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+Asset::Asset(std::string path, AssetType type, int priority)
+: _path(std::move(path))
+, _type(type)
+, _priority(priority)
+{ }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::string& Asset::GetPath() const
+{
+    return _path;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+AssetType Asset::GetType() const
+{
+    return _type;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+AssetState Asset::GetState() const
+{
+    return _state.load(std::memory_order_acquire);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool Asset::IsReady() const
+{
+    return GetState() == AssetState::Ready;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int Asset::GetPriority() const
+{
+    return _priority.load(std::memory_order_relaxed);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::span<const uint8_t> Asset::GetData() const
+{
+    if (!IsReady())
+    {
+        return {};
+    }
+
+    const auto data = _blob.GetData();
+    return { reinterpret_cast<const uint8_t*>(data.data()), data.size() };
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkExtent2D Asset::GetExtent() const
+{
+    if (_type != AssetType::Image || !IsReady())
+    {
+        return {};
+    }
+
+    return _extent;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool AssetManager::Progress::IsCompleted() const
+{
+    return ready + failed == requested;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+float AssetManager::Progress::GetRatio() const
+{
+    if (requested == 0)
+    {
+        return 1.0f;
+    }
+
+    return static_cast<float>(ready + failed) / static_cast<float>(requested);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+AssetManager::AssetManager(VkDevice lDevice,
+                           const PDevice& pDevice,
+                           StagingUploader& stagingUploader,
+                           size_t workerCount)
+: _lDevice(lDevice)
+, _pDevice(pDevice)
+, _stagingUploader(stagingUploader)
+{
+    TraceIt;
+
+    CreatePlaceholder();
+
+    if (workerCount == 0)
+    {
+        // One hardware thread is left to the render thread
+        workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    }
+
+    _workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        _workers.emplace_back(&AssetManager::RunWorker, this);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+AssetManager::~AssetManager()
+{
+    {
+        std::lock_guard lock(_queueMutex);
+        _isStopping = true;
+    }
+    _queueCondition.notify_all();
+
+    for (auto& worker : _workers)
+    {
+        worker.join();
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+AssetHandle AssetManager::Load(const std::string& path, AssetType type, int priority)
+{
+    std::shared_ptr<Asset> asset;
+    {
+        std::lock_guard lock(_assetsMutex);
+        auto& cachedAsset = _assets[{ path, type }];
+        if (cachedAsset)
+        {
+            return cachedAsset;
+        }
+
+        cachedAsset = std::make_shared<Asset>(path, type, priority);
+        asset = cachedAsset;
+    }
+
+    {
+        std::lock_guard lock(_queueMutex);
+        _queue.push_back(asset);
+    }
+    _queueCondition.notify_one();
+
+    return asset;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void AssetManager::SetPriority(const AssetHandle& handle, int priority)
+{
+    std::lock_guard lock(_assetsMutex);
+    const auto asset = _assets.find({ handle->GetPath(), handle->GetType() });
+    Assert(asset != _assets.end() && asset->second == handle, "Asset does not belong to the manager");
+
+    asset->second->_priority.store(priority, std::memory_order_relaxed);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+size_t AssetManager::Finalize(std::chrono::microseconds budget)
+{
+    TraceIt;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::shared_ptr<Asset>> decoded;
+    {
+        std::lock_guard lock(_decodedMutex);
+        decoded.swap(_decoded);
+    }
+
+    if (decoded.empty())
+    {
+        return 0;
+    }
+
+    std::stable_sort(decoded.begin(), decoded.end(), HasHigherPriority);
+
+    size_t uploadedCount(0);
+    while (uploadedCount < decoded.size() &&
+           (uploadedCount == 0 || std::chrono::steady_clock::now() - start < budget))
+    {
+        auto& asset = *decoded[uploadedCount];
+        asset._texture = std::make_unique<Texture>(_lDevice, _pDevice, asset._extent);
+        _stagingUploader.UploadImage(asset._texture->GetImage(),
+                                     asset._pixels.data(),
+                                     asset._pixels.size(),
+                                     { asset._extent.width, asset._extent.height, 1 });
+
+        // The staging buffer has its own copy, so pixels are not needed anymore
+        asset._pixels = {};
+        ++uploadedCount;
+    }
+
+    // Images become ready only after the submission, so every command that can see them also sees their content
+    _stagingUploader.Submit();
+    for (size_t i = 0; i < uploadedCount; ++i)
+    {
+        decoded[i]->_state.store(AssetState::Ready, std::memory_order_release);
+    }
+    _readyCount += uploadedCount;
+
+    if (uploadedCount < decoded.size())
+    {
+        std::lock_guard lock(_decodedMutex);
+        _decoded.insert(_decoded.end(), decoded.begin() + static_cast<ptrdiff_t>(uploadedCount), decoded.end());
+    }
+
+    return uploadedCount;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkImageView AssetManager::GetImageView(const AssetHandle& handle) const
+{
+    if (handle && handle->GetType() == AssetType::Image && handle->IsReady())
+    {
+        return handle->_texture->GetImageView();
+    }
+
+    return _placeholder->GetImageView();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+AssetManager::Progress AssetManager::GetProgress() const
+{
+    Progress progress;
+    {
+        std::lock_guard lock(_assetsMutex);
+        progress.requested = _assets.size();
+    }
+    progress.ready = _readyCount.load();
+    progress.failed = _failedCount.load();
+
+    return progress;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+C2D::AssetLibrary& AssetManager::GetLibrary()
+{
+    return _library;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+size_t AssetManager::AssetKeyHash::operator()(const AssetKey& key) const
+{
+    // Types are few, so they are mixed into the hash of the path with an odd multiplier
+    return std::hash<std::string>()(key.first) ^ (static_cast<size_t>(key.second) * 0x9E3779B97F4A7C15ull);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void AssetManager::RunWorker()
+{
+    while (true)
+    {
+        std::shared_ptr<Asset> asset;
+        {
+            std::unique_lock lock(_queueMutex);
+            _queueCondition.wait(lock, [this] { return _isStopping || !_queue.empty(); });
+            if (_isStopping)
+            {
+                return;
+            }
+
+            // Priorities can be changed while assets are queued, so the queue is not kept sorted
+            const auto next = std::min_element(_queue.begin(), _queue.end(), HasHigherPriority);
+            asset = *next;
+            _queue.erase(next);
+        }
+
+        LoadAsset(*asset);
+
+        if (asset->GetState() == AssetState::Decoded)
+        {
+            std::lock_guard lock(_decodedMutex);
+            _decoded.push_back(std::move(asset));
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void AssetManager::LoadAsset(Asset& asset)
+{
+    TraceIt;
+
+    asset._state.store(AssetState::Loading, std::memory_order_relaxed);
+
+    const auto fail = [this, &asset](const std::string& reason)
+    {
+        Logger::LogError("Failed to load asset '" + asset._path + "': " + reason, __PRETTY_FUNCTION__);
+        asset._state.store(AssetState::Failed, std::memory_order_release);
+        ++_failedCount;
+    };
+
+    auto blob = _library.Read(asset._path);
+    if (!blob.has_value())
+    {
+        fail("it is found neither in archives nor among loose files");
+        return;
+    }
+
+    const auto bytes = blob->GetData();
+    const std::span<const uint8_t> content(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+    switch (asset._type)
+    {
+        case AssetType::Raw:
+            asset._blob = std::move(blob.value());
+            break;
+
+        case AssetType::SpirV:
+            if (!IsSpirV(content))
+            {
+                fail("it is not a SPIR-V module");
+                return;
+            }
+            asset._blob = std::move(blob.value());
+            break;
+
+        case AssetType::Image:
+        {
+            auto image = DecodeImage(content);
+            if (!image.has_value())
+            {
+                fail("it is not a supported image");
+                return;
+            }
+            asset._extent = image->extent;
+            asset._pixels = std::move(image->pixels);
+
+            // Textures are created and uploaded by the render thread
+            asset._state.store(AssetState::Decoded, std::memory_order_release);
+            return;
+        }
+    }
+
+    asset._state.store(AssetState::Ready, std::memory_order_release);
+    ++_readyCount;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void AssetManager::CreatePlaceholder()
+{
+    _placeholder = std::make_unique<Texture>(_lDevice, _pDevice, VkExtent2D{ 1, 1 });
+    _stagingUploader.UploadImage(_placeholder->GetImage(), placeholderPixel, sizeof(placeholderPixel), { 1, 1, 1 });
+    _stagingUploader.Submit();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
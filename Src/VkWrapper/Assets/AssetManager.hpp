@@ -0,0 +1,210 @@
+#pragma once
+#include <span>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <condition_variable>
+#include <vulkan/vulkan.h>
+#include <Utility/Archive/AssetLibrary.hpp>
+#include <VkWrapper/PDevice.hpp>
+#include <VkWrapper/Texture.hpp>
+#include <VkWrapper/StagingUploader.hpp>
+
+namespace VkWrapper
+{
+    enum class AssetType
+    {
+        Raw,   // Bytes of the file as they are
+        SpirV, // Shader module, the header is validated
+        Image  // PNG or Netpbm image which is decoded to RGBA and uploaded to a texture
+    };
+
+    enum class AssetState
+    {
+        Queued,
+        Loading, // Read and decoded by a worker
+        Decoded, // Image waits for the upload on the render thread
+        Ready,
+        Failed
+    };
+
+    /*!
+     * Asset which is loaded by the AssetManager. Everything except the priority is immutable once the asset is ready,
+     * so ready assets can be read from any thread.
+     */
+    class Asset final
+    {
+    public:
+        Asset(std::string path, AssetType type, int priority);
+
+        [[nodiscard]]
+        const std::string& GetPath() const;
+
+        [[nodiscard]]
+        AssetType GetType() const;
+
+        [[nodiscard]]
+        AssetState GetState() const;
+
+        [[nodiscard]]
+        bool IsReady() const;
+
+        [[nodiscard]]
+        int GetPriority() const;
+
+        /*!
+         * \return Content of raw and SPIR-V assets or nothing until the asset is ready. Pixels of images are
+         *         released after the upload, so images have no data.
+         */
+        [[nodiscard]]
+        std::span<const uint8_t> GetData() const;
+
+        /*!
+         * \return Extent of the decoded image, zero for other types.
+         */
+        [[nodiscard]]
+        VkExtent2D GetExtent() const;
+
+    private:
+        friend class AssetManager;
+
+        std::string _path;
+        AssetType _type;
+        std::atomic_int _priority;
+        std::atomic<AssetState> _state = AssetState::Queued;
+
+        // Written by a worker before the state is changed to Decoded or Ready
+        C2D::AssetBlob _blob;
+        std::vector<uint8_t> _pixels;
+        VkExtent2D _extent{};
+
+        // Written by the render thread before the state is changed to Ready
+        std::unique_ptr<Texture> _texture;
+    };
+
+    using AssetHandle = std::shared_ptr<const Asset>;
+
+    /*!
+     * Loads assets without stalling the render thread.
+     *
+     * Reading and decoding are done by background workers, assets with a higher priority are taken first. Assets are
+     * read through the AssetLibrary, so they come from mounted archives or from loose files.
+     * Decoded images are uploaded to textures by Finalize() which is called by the render thread once per frame
+     * and stops when the time budget is spent, so a burst of loaded images is spread over several frames.
+     * Until the image is ready, a 1x1 placeholder texture is returned instead of it, so handles can be bound
+     * right after Load().
+     *
+     * Assets are cached by the path and the type, so the same file can be loaded e.g. as an image and as raw bytes.
+     * They live as long as the manager.
+     *
+     * \threadSafety Load(), SetPriority() and GetProgress() can be called from any thread, Finalize() and
+     *               GetImageView() must be called from the thread that submits rendering commands.
+     */
+    class AssetManager final
+    {
+    public:
+        struct Progress
+        {
+            size_t requested = 0;
+            size_t ready = 0;
+            size_t failed = 0;
+
+            [[nodiscard]]
+            bool IsCompleted() const;
+
+            /*!
+             * \return Share of finished assets in [0, 1], failed assets are finished too.
+             */
+            [[nodiscard]]
+            float GetRatio() const;
+        };
+
+        /*!
+         * \param workerCount Number of background workers, if it is 0, all hardware threads except one are used.
+         */
+        AssetManager(VkDevice lDevice,
+                     const PDevice& pDevice,
+                     StagingUploader& stagingUploader,
+                     size_t workerCount = 0);
+        ~AssetManager();
+
+        AssetManager(const AssetManager& other) = delete;
+        AssetManager& operator=(const AssetManager& other) = delete;
+
+        /*!
+         * Queues the asset or returns the cached one with the same path and type, the priority of the cached asset
+         * is kept.
+         */
+        AssetHandle Load(const std::string& path, AssetType type, int priority = 0);
+
+        /*!
+         * Changes the order in which queued assets are loaded and decoded images are uploaded,
+         * e.g. to raise assets that became visible.
+         */
+        void SetPriority(const AssetHandle& handle, int priority);
+
+        /*!
+         * Uploads decoded images, starting with the highest priority, until the budget is spent. At least one image
+         * is uploaded per call, so the progress is made even with a tiny budget.
+         *
+         * \return Number of images that became ready.
+         */
+        size_t Finalize(std::chrono::microseconds budget);
+
+        /*!
+         * \return View of the texture of the image or view of the placeholder if the image is not ready or failed.
+         */
+        [[nodiscard]]
+        VkImageView GetImageView(const AssetHandle& handle) const;
+
+        [[nodiscard]]
+        Progress GetProgress() const;
+
+        /*!
+         * Archives must be mounted before assets from them are loaded.
+         */
+        [[nodiscard]]
+        C2D::AssetLibrary& GetLibrary();
+
+    private:
+        void RunWorker();
+        void LoadAsset(Asset& asset);
+        void CreatePlaceholder();
+
+        using AssetKey = std::pair<std::string, AssetType>;
+
+        struct AssetKeyHash
+        {
+            [[nodiscard]]
+            size_t operator()(const AssetKey& key) const;
+        };
+
+        VkDevice _lDevice;
+        const PDevice& _pDevice;
+        StagingUploader& _stagingUploader;
+        C2D::AssetLibrary _library;
+        std::unique_ptr<Texture> _placeholder;
+
+        mutable std::mutex _assetsMutex;
+        std::unordered_map<AssetKey, std::shared_ptr<Asset>, AssetKeyHash> _assets;
+
+        std::mutex _queueMutex;
+        std::condition_variable _queueCondition;
+        std::vector<std::shared_ptr<Asset>> _queue;
+        bool _isStopping = false;
+
+        std::mutex _decodedMutex;
+        std::vector<std::shared_ptr<Asset>> _decoded;
+
+        std::atomic_size_t _readyCount = 0;
+        std::atomic_size_t _failedCount = 0;
+
+        std::vector<std::thread> _workers;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "Buffer.hpp"
+#include <cstring>
+#include <Utility/Assert.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+Buffer::Buffer(VkDevice lDevice,
+               const PDevice& pDevice,
+               VkDeviceSize size,
+               VkBufferUsageFlags usage,
+               VkMemoryPropertyFlags memoryProperties)
+: _lDevice(lDevice)
+, _buffer(nullptr)
+, _memory(nullptr)
+, _size(size)
+{
+    TraceIt;
+
+    VkBufferCreateInfo createInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .size = _size,
+        .usage = usage,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE
+    };
+
+    Assert(vkCreateBuffer(_lDevice, &createInfo, nullptr, &_buffer) == VK_SUCCESS, "Failed to create buffer");
+
+    VkMemoryRequirements memoryRequirements;
+    vkGetBufferMemoryRequirements(_lDevice, _buffer, &memoryRequirements);
+
+    const auto memoryType = pDevice.FindMemoryType(memoryRequirements.memoryTypeBits, memoryProperties);
+    Assert(memoryType.has_value(), "Failed to find suitable memory type for buffer");
+
+    VkMemoryAllocateInfo allocateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .allocationSize = memoryRequirements.size,
+        .memoryTypeIndex = memoryType.value()
+    };
+
+    Assert(vkAllocateMemory(_lDevice, &allocateInfo, nullptr, &_memory) == VK_SUCCESS,
+           "Failed to allocate buffer memory");
+    vkBindBufferMemory(_lDevice, _buffer, _memory, 0);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+Buffer::~Buffer()
+{
+    vkDestroyBuffer(_lDevice, _buffer, nullptr);
+    vkFreeMemory(_lDevice, _memory, nullptr);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkBuffer Buffer::GetHandle() const
+{
+    return _buffer;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkDeviceSize Buffer::GetSize() const
+{
+    return _size;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Buffer::Write(const void* data, VkDeviceSize size, VkDeviceSize offset)
+{
+    Assert(offset + size <= _size, "Data does not fit into the buffer");
+
+    void* mappedMemory(nullptr);
+    Assert(vkMapMemory(_lDevice, _memory, offset, size, 0, &mappedMemory) == VK_SUCCESS,
+           "Failed to map buffer memory");
+    std::memcpy(mappedMemory, data, static_cast<size_t>(size));
+    vkUnmapMemory(_lDevice, _memory);
+}
+
+//
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void Buffer::Read(void* data, VkDeviceSize size, VkDeviceSize offset) const
+{
+    Assert(offset + size <= _size, "Requested range is out of the buffer");
+
+    void* mappedMemory(nullptr);
+    Assert(vkMapMemory(_lDevice, _memory, offset, size, 0, &mappedMemory) == VK_SUCCESS,
+           "Failed to map buffer memory");
+    std::memcpy(data, mappedMemory, static_cast<size_t>(size));
+    vkUnmapMemory(_lDevice, _memory);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+#include <vulkan/vulkan.h>
+#include <VkWrapper/PDevice.hpp>
+
+namespace VkWrapper
+{
+    /*!
+     * Buffer with its own device memory allocation. Buffers are created with the exclusive sharing mode,
+     * so the access from another queue family requires the ownership transfer.
+     */
+    class Buffer final
+    {
+    public:
+        Buffer(VkDevice lDevice,
+               const PDevice& pDevice,
+               VkDeviceSize size,
+               VkBufferUsageFlags usage,
+               VkMemoryPropertyFlags memoryProperties);
+        ~Buffer();
+
+        [[nodiscard]]
+        VkBuffer GetHandle() const;
+
+        [[nodiscard]]
+        VkDeviceSize GetSize() const;
+
+        /*!
+         * Copies the data to the memory of the buffer.
+         *
+         * \attention Memory must be host visible and coherent.
+         */
+        void Write(const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
+
+        /*!
+         * Copies the data from the memory of the buffer.
+         *
+         * \attention Memory must be host visible and coherent.
+         */
+        void Read(void* data, VkDeviceSize size, VkDeviceSize offset = 0) const;
+
+    private:
+        VkDevice _lDevice;
+        VkBuffer _buffer;
+        VkDeviceMemory _memory;
+        VkDeviceSize _size;
+    };
+}
\ No newline at end of file
@@ -6,14 +6,16 @@ using namespace VkWrapper;
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-CommandBuffers::CommandBuffers(VkDevice lDevice,
-                               size_t size,
-                               VkCommandPool commandPool,
-                               VkRenderPass renderPass,
-                               const std::vector<VkFramebuffer>& frameBuffers,
-                               VkExtent2D swapChainExtent,
-                               VkPipeline pipeline)
+namespace
+{
+    constexpr VkClearValue clearValue = {{{0.0f, 0.0f, 0.0f, 1.0f}}};
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+CommandBuffers::CommandBuffers(VkDevice lDevice, size_t size, VkCommandPool commandPool)
 : _lDevice(lDevice)
+, _commandPool(commandPool)
 {
     TraceIt;
 
@@ -22,48 +24,91 @@ CommandBuffers::CommandBuffers(VkDevice lDevice,
     VkCommandBufferAllocateInfo createInfo =
     {
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-        .commandPool = commandPool,
+        .commandPool = _commandPool,
         .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
         .commandBufferCount = static_cast<uint32_t>(size)
     };
 
     Assert(vkAllocateCommandBuffers(_lDevice, &createInfo, _commandBuffers.data()) == VK_SUCCESS,
            "Failed to allocate command buffers");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+CommandBuffers::~CommandBuffers()
+{
+    vkFreeCommandBuffers(_lDevice,
+                         _commandPool,
+                         static_cast<uint32_t>(_commandBuffers.size()),
+                         _commandBuffers.data());
+}
 
-    for (size_t i = 0; i < size; ++i)
+// ---------------------------------------------------------------------------------------------------------------------
+
+void CommandBuffers::Record(VkRenderPass renderPass,
+                            const std::vector<VkFramebuffer>& frameBuffers,
+                            VkExtent2D swapChainExtent,
+                            VkPipeline pipeline,
+                            const DrawParameters& drawParameters,
+                            GpuProfiler* profiler)
+{
+    TraceIt;
+
+    Assert(frameBuffers.size() == _commandBuffers.size(), "Number of framebuffers and command buffers must be equal");
+
+    for (size_t i = 0; i < _commandBuffers.size(); ++i)
     {
-        VkCommandBufferBeginInfo beginInfo =
-        {
-            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
-            .flags = 0,
-            .pInheritanceInfo = nullptr
-        };
+        Record(i, renderPass, frameBuffers[i], swapChainExtent, pipeline, drawParameters, profiler);
+    }
+}
 
-        Assert(vkBeginCommandBuffer(_commandBuffers[i], &beginInfo) == VK_SUCCESS,
-               "Failed to begin recording command buffer");
+// ---------------------------------------------------------------------------------------------------------------------
+
+void CommandBuffers::Record(size_t index,
+                            VkRenderPass renderPass,
+                            VkFramebuffer frameBuffer,
+                            VkExtent2D swapChainExtent,
+                            VkPipeline pipeline,
+                            const DrawParameters& drawParameters,
+                            GpuProfiler* profiler)
+{
+    Assert(index < _commandBuffers.size(), "Command buffer index is out of range");
 
-        VkClearValue clearValue = {{{0.0f, 0.0f, 0.0f, 1.0f}}};
-        VkRenderPassBeginInfo renderPassBeginInfo =
+    auto commandBuffer = _commandBuffers[index];
+    const auto frameZone = BeginRecording(index, profiler);
+
+    VkRenderPassBeginInfo renderPassBeginInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+        .renderPass = renderPass,
+        .framebuffer = frameBuffer,
+        .renderArea =
         {
-            .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-            .renderPass = renderPass,
-            .framebuffer = frameBuffers[i],
-            .renderArea =
-            {
-                .offset = {0, 0},
-                .extent = swapChainExtent,
-            },
-            .clearValueCount = 1,
-            .pClearValues = &clearValue
-        };
-
-        vkCmdBeginRenderPass(_commandBuffers[i], &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
-            vkCmdBindPipeline(_commandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
-            vkCmdDraw(_commandBuffers[i], 3, 1, 0, 0);
-        vkCmdEndRenderPass(_commandBuffers[i]);
-
-        Assert(vkEndCommandBuffer(_commandBuffers[i]) == VK_SUCCESS, "Failed to record command buffer");
-    }
+            .offset = {0, 0},
+            .extent = swapChainExtent,
+        },
+        .clearValueCount = 1,
+        .pClearValues = &clearValue
+    };
+
+    vkCmdBeginRenderPass(commandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+        RecordDraw(commandBuffer, swapChainExtent, pipeline, drawParameters, profiler, static_cast<uint32_t>(index));
+    vkCmdEndRenderPass(commandBuffer);
+
+    EndRecording(index, profiler, frameZone);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void CommandBuffers::Record(size_t index, RenderGraph& renderGraph, GpuProfiler* profiler)
+{
+    Assert(index < _commandBuffers.size(), "Command buffer index is out of range");
+
+    // Statistics queries that are active in the primary command buffer are not inherited by secondary ones
+    const auto withStatistics = !renderGraph.UsesSecondaryCommandBuffers();
+    const auto frameZone = BeginRecording(index, profiler, withStatistics);
+    renderGraph.Execute(_commandBuffers[index], static_cast<uint32_t>(index));
+    EndRecording(index, profiler, frameZone, withStatistics);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -73,4 +118,91 @@ const std::vector<VkCommandBuffer>& CommandBuffers::GetCommandBuffers() const
     return _commandBuffers;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint32_t CommandBuffers::BeginRecording(size_t index, GpuProfiler* profiler, bool withStatistics)
+{
+    VkCommandBufferBeginInfo beginInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = 0,
+        .pInheritanceInfo = nullptr
+    };
+
+    // Begin implicitly resets the command buffer because its pool is created with the reset flag
+    auto commandBuffer = _commandBuffers[index];
+    Assert(vkBeginCommandBuffer(commandBuffer, &beginInfo) == VK_SUCCESS,
+           "Failed to begin recording command buffer");
+
+    // Queries are reset outside of the rendering, zones and statistics are recorded around it
+    if (!profiler)
+    {
+        return 0;
+    }
+
+    const auto range = static_cast<uint32_t>(index);
+    profiler->BeginRange(commandBuffer, range);
+    const auto frameZone = profiler->BeginZone(commandBuffer, range, "Frame");
+    if (withStatistics)
+    {
+        profiler->BeginStatistics(commandBuffer, range);
+    }
+
+    return frameZone;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void CommandBuffers::RecordDraw(VkCommandBuffer commandBuffer,
+                                VkExtent2D extent,
+                                VkPipeline pipeline,
+                                const DrawParameters& drawParameters,
+                                GpuProfiler* profiler,
+                                uint32_t range)
+{
+    const VkViewport viewport =
+    {
+        .x = 0.0f,
+        .y = 0.0f,
+        .width = static_cast<float>(extent.width),
+        .height = static_cast<float>(extent.height),
+        .minDepth = 0.0f,
+        .maxDepth = 1.0f
+    };
+
+    const VkRect2D scissor =
+    {
+        .offset = {0, 0},
+        .extent = extent
+    };
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    const auto drawZone = profiler ? profiler->BeginZone(commandBuffer, range, "Draw") : 0;
+    vkCmdDraw(commandBuffer, drawParameters.vertexCount, drawParameters.instanceCount, 0, 0);
+    if (profiler)
+    {
+        profiler->EndZone(commandBuffer, range, drawZone);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void CommandBuffers::EndRecording(size_t index, GpuProfiler* profiler, uint32_t frameZone, bool withStatistics)
+{
+    auto commandBuffer = _commandBuffers[index];
+    if (profiler)
+    {
+        const auto range = static_cast<uint32_t>(index);
+        if (withStatistics)
+        {
+            profiler->EndStatistics(commandBuffer, range);
+        }
+        profiler->EndZone(commandBuffer, range, frameZone);
+    }
+
+    Assert(vkEndCommandBuffer(commandBuffer) == VK_SUCCESS, "Failed to record command buffer");
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -1,31 +1,91 @@
 #pragma once
 #include <vector>
 #include <vulkan/vulkan.h>
+#include <VkWrapper/GpuProfiler.hpp>
+#include <VkWrapper/RenderGraph/RenderGraph.hpp>
 
 namespace VkWrapper
 {
     /*!
+     * Parameters of the draw call. Geometry is generated by the vertex shader from the vertex and instance indices.
+     */
+    struct DrawParameters
+    {
+        uint32_t vertexCount = 3;
+        uint32_t instanceCount = 1;
+    };
+
+    /*!
+     * Set of primary command buffers, one per swap chain framebuffer.
      *
-     *
-     * \note Command buffers will be automatically freed when their command pool is destroyed,
-     *       so there is no need an explicit cleanup.
+     * \note Command buffers are allocated once and can be re-recorded via Record() when framebuffers are rebuilt
+     *       (e.g. on swap chain recreation), so resizing does not require new allocations.
      */
     class CommandBuffers final
     {
     public:
-        CommandBuffers(VkDevice lDevice,
-                       size_t size,
-                       VkCommandPool commandPool,
-                       VkRenderPass renderPass,
-                       const std::vector<VkFramebuffer>& frameBuffers,
-                       VkExtent2D swapChainExtent,
-                       VkPipeline pipeline);
+        CommandBuffers(VkDevice lDevice, size_t size, VkCommandPool commandPool);
+        ~CommandBuffers();
+
+        void Record(VkRenderPass renderPass,
+                    const std::vector<VkFramebuffer>& frameBuffers,
+                    VkExtent2D swapChainExtent,
+                    VkPipeline pipeline,
+                    const DrawParameters& drawParameters = {},
+                    GpuProfiler* profiler = nullptr);
+
+        /*!
+         * Re-records only one command buffer, e.g. when the content is changed every frame.
+         *
+         * \param profiler If set, the frame and the draw call are measured in the query range with the same index
+         *                 as the command buffer.
+         *
+         * \attention Command buffer must not be in use by the GPU.
+         */
+        void Record(size_t index,
+                    VkRenderPass renderPass,
+                    VkFramebuffer frameBuffer,
+                    VkExtent2D swapChainExtent,
+                    VkPipeline pipeline,
+                    const DrawParameters& drawParameters = {},
+                    GpuProfiler* profiler = nullptr);
+
+        /*!
+         * Re-records only one command buffer with the commands of the compiled render graph, the index of
+         * the command buffer is used as the slot of the graph.
+         *
+         * \param profiler If set, the frame is measured in the query range with the same index as the command buffer.
+         *                 Pipeline statistics are not collected if passes are recorded to secondary command buffers.
+         *
+         * \attention Command buffer must not be in use by the GPU.
+         */
+        void Record(size_t index, RenderGraph& renderGraph, GpuProfiler* profiler = nullptr);
 
         [[nodiscard]]
         const std::vector<VkCommandBuffer>& GetCommandBuffers() const;
 
+        /*!
+         * Records the draw call with the viewport and scissor that cover the extent, e.g. by a pass of the render
+         * graph.
+         *
+         * \param profiler If set, the draw call is measured in the query range.
+         */
+        static void RecordDraw(VkCommandBuffer commandBuffer,
+                               VkExtent2D extent,
+                               VkPipeline pipeline,
+                               const DrawParameters& drawParameters,
+                               GpuProfiler* profiler,
+                               uint32_t range);
+
     private:
+        /*!
+         * \return Index of the profiler zone of the whole frame.
+         */
+        uint32_t BeginRecording(size_t index, GpuProfiler* profiler, bool withStatistics = true);
+        void EndRecording(size_t index, GpuProfiler* profiler, uint32_t frameZone, bool withStatistics = true);
+
         VkDevice _lDevice;
+        VkCommandPool _commandPool;
         std::vector<VkCommandBuffer> _commandBuffers;
     };
 }
\ No newline at end of file
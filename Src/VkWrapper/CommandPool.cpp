@@ -6,7 +6,7 @@ using namespace VkWrapper;
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-CommandPool::CommandPool(VkDevice lDevice, uint32_t graphicsFamilyIndex)
+CommandPool::CommandPool(VkDevice lDevice, uint32_t graphicsFamilyIndex, VkCommandPoolCreateFlags flags)
 : _lDevice(lDevice)
 , _commandPool(nullptr)
 {
@@ -15,7 +15,7 @@ CommandPool::CommandPool(VkDevice lDevice, uint32_t graphicsFamilyIndex)
     VkCommandPoolCreateInfo createInfo =
     {
         .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
-        .flags = 0,
+        .flags = flags,
         .queueFamilyIndex = graphicsFamilyIndex
     };
 
@@ -6,7 +6,7 @@ namespace VkWrapper
     class CommandPool final
     {
     public:
-        CommandPool(VkDevice lDevice, uint32_t graphicsFamilyIndex);
+        CommandPool(VkDevice lDevice, uint32_t graphicsFamilyIndex, VkCommandPoolCreateFlags flags = 0);
         ~CommandPool();
 
         [[nodiscard]]
@@ -0,0 +1,94 @@
+#include "DynamicRendering.hpp"
+#include <Utility/Assert.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    // The extension depends on depth stencil resolve, which in turn depends on render pass 2 and its dependencies
+    const std::vector<const char*> requiredExtensions = { VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME,
+                                                          VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME,
+                                                          VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME,
+                                                          VK_KHR_MULTIVIEW_EXTENSION_NAME,
+                                                          VK_KHR_MAINTENANCE2_EXTENSION_NAME };
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+DynamicRendering::DynamicRendering(VkDevice lDevice)
+{
+    TraceIt;
+
+    // Functions of the extension are not exported by the loader, so they must be obtained from the device
+    _beginRendering = reinterpret_cast<PFN_vkCmdBeginRenderingKHR>(
+            vkGetDeviceProcAddr(lDevice, "vkCmdBeginRenderingKHR"));
+    _endRendering = reinterpret_cast<PFN_vkCmdEndRenderingKHR>(vkGetDeviceProcAddr(lDevice, "vkCmdEndRenderingKHR"));
+    Assert(_beginRendering != nullptr && _endRendering != nullptr, "Dynamic rendering functions are not available");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void DynamicRendering::Begin(VkCommandBuffer commandBuffer,
+                             VkImageView imageView,
+                             VkExtent2D extent,
+                             const VkClearValue& clearValue) const
+{
+    VkRenderingAttachmentInfoKHR colorAttachment =
+    {
+        .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR,
+        .imageView = imageView,
+        .imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+        .resolveMode = VK_RESOLVE_MODE_NONE,
+        .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+        .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+        .clearValue = clearValue
+    };
+    VkRenderingInfoKHR renderingInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR,
+        .renderArea =
+        {
+            .offset = {0, 0},
+            .extent = extent
+        },
+        .layerCount = 1,
+        .colorAttachmentCount = 1,
+        .pColorAttachments = &colorAttachment
+    };
+    _beginRendering(commandBuffer, &renderingInfo);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void DynamicRendering::End(VkCommandBuffer commandBuffer) const
+{
+    _endRendering(commandBuffer);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::vector<const char*>& DynamicRendering::GetRequiredExtensions()
+{
+    return requiredExtensions;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool DynamicRendering::IsSupported(const PDevice& pDevice)
+{
+    // The feature is mandatory for devices that expose the extension, so extensions are enough to check
+    for (const auto* extension : requiredExtensions)
+    {
+        if (!pDevice.IsExtensionSupported(extension))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
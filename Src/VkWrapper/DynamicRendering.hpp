@@ -0,0 +1,42 @@
+#pragma once
+#include <vector>
+#include <vulkan/vulkan.h>
+#include <VkWrapper/PDevice.hpp>
+
+namespace VkWrapper
+{
+    /*!
+     * Renders directly to image views with VK_KHR_dynamic_rendering, so neither render pass nor framebuffers are
+     * created. Layout transitions that the render pass did implicitly are recorded by the render graph.
+     */
+    class DynamicRendering final
+    {
+    public:
+        explicit DynamicRendering(VkDevice lDevice);
+
+        /*!
+         * Clears the image and begins rendering to it.
+         *
+         * \attention The image must be in the color attachment layout.
+         */
+        void Begin(VkCommandBuffer commandBuffer,
+                   VkImageView imageView,
+                   VkExtent2D extent,
+                   const VkClearValue& clearValue) const;
+
+        void End(VkCommandBuffer commandBuffer) const;
+
+        /*!
+         * \return Device extensions that must be enabled, the dynamic rendering one and its dependencies.
+         */
+        [[nodiscard]]
+        static const std::vector<const char*>& GetRequiredExtensions();
+
+        [[nodiscard]]
+        static bool IsSupported(const PDevice& pDevice);
+
+    private:
+        PFN_vkCmdBeginRenderingKHR _beginRendering = nullptr;
+        PFN_vkCmdEndRenderingKHR _endRendering = nullptr;
+    };
+}
\ No newline at end of file
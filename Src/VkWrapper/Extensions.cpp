@@ -10,14 +10,19 @@ using namespace VkWrapper;
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-Extensions::Extensions()
+Extensions::Extensions(bool isSurfaceRequired)
 {
     TraceIt;
 
-    uint32_t glfwExtensionCount = 0;
-    const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+    if (isSurfaceRequired)
+    {
+        uint32_t glfwExtensionCount = 0;
+        const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
 
-    _requiredExtensions = std::vector<const char*>(glfwExtensions, glfwExtensions + glfwExtensionCount);
+        _requiredExtensions = std::vector<const char*>(glfwExtensions, glfwExtensions + glfwExtensionCount);
+    }
+    // Device extensions that add features (timeline semaphores, dynamic rendering) depend on it
+    _requiredExtensions.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
 #ifndef NDEBUG
     _requiredExtensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
 #endif
@@ -6,7 +6,11 @@ namespace VkWrapper
     class Extensions final
     {
     public:
-        Extensions();
+        /*!
+         * \param isSurfaceRequired If false, extensions required by GLFW for the window surface are not requested
+         *                          (e.g. in the headless mode).
+         */
+        explicit Extensions(bool isSurfaceRequired = true);
 
         [[nodiscard]]
         const std::vector<const char*>& GetExtensions() const;
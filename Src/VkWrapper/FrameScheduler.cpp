@@ -0,0 +1,135 @@
+#include "FrameScheduler.hpp"
+#include <Utility/Assert.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+FrameScheduler::FrameScheduler(VkDevice lDevice, uint32_t framesInFlight)
+: _timelineSemaphore(lDevice, 0)
+, _framesInFlight(framesInFlight)
+{
+    TraceIt;
+
+    Assert(_framesInFlight > 0, "At least one frame must be allowed to be in flight");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint32_t FrameScheduler::GetFramesInFlight() const
+{
+    return _framesInFlight;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void FrameScheduler::SetFramesInFlight(uint32_t framesInFlight)
+{
+    Assert(framesInFlight > 0, "At least one frame must be allowed to be in flight");
+    Assert(IsFrameCompleted(_submittedFrame), "Frames in flight can be changed only when no frame is in flight");
+
+    _framesInFlight = framesInFlight;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint64_t FrameScheduler::BeginFrame()
+{
+    _cpuWaitTime = std::chrono::nanoseconds::zero();
+
+    const auto frameNumber = _submittedFrame + 1;
+    if (_pacingHook)
+    {
+        _pacingHook(frameNumber);
+    }
+
+    // The frame that used the same slot must be finished before its resources are reused
+    if (frameNumber > _framesInFlight)
+    {
+        WaitForFrame(frameNumber - _framesInFlight);
+    }
+
+    return frameNumber;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void FrameScheduler::EndFrame(uint64_t frameNumber)
+{
+    Assert(frameNumber == _submittedFrame + 1, "Frames must be submitted in order");
+    _submittedFrame = frameNumber;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void FrameScheduler::WaitForFrame(uint64_t frameNumber)
+{
+    // Querying the counter is cheaper than a wait call, and usually the frame is already finished
+    if (IsFrameCompleted(frameNumber))
+    {
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    Assert(_timelineSemaphore.Wait(frameNumber), "Failed to wait for the frame");
+    _cpuWaitTime += std::chrono::steady_clock::now() - start;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void FrameScheduler::WaitForSubmittedFrames()
+{
+    WaitForFrame(_submittedFrame);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool FrameScheduler::IsFrameCompleted(uint64_t frameNumber) const
+{
+    return _timelineSemaphore.GetValue() >= frameNumber;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint64_t FrameScheduler::GetCompletedFrame() const
+{
+    return _timelineSemaphore.GetValue();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint64_t FrameScheduler::GetSubmittedFrame() const
+{
+    return _submittedFrame;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint32_t FrameScheduler::GetFrameSlot(uint64_t frameNumber) const
+{
+    return static_cast<uint32_t>(frameNumber % _framesInFlight);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkSemaphore FrameScheduler::GetTimelineSemaphore() const
+{
+    return _timelineSemaphore.GetHandle();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::chrono::nanoseconds FrameScheduler::GetCpuWaitTime() const
+{
+    return _cpuWaitTime;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void FrameScheduler::SetPacingHook(PacingHook hook)
+{
+    _pacingHook = std::move(hook);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
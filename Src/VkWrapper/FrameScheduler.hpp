@@ -0,0 +1,96 @@
+#pragma once
+#include <chrono>
+#include <functional>
+#include <vulkan/vulkan.h>
+#include <VkWrapper/TimelineSemaphore.hpp>
+
+namespace VkWrapper
+{
+    /*!
+     * Limits the number of frames that are processed by the GPU at the same time.
+     * Every submitted frame gets a number (starting from 1) and signals it on the timeline semaphore,
+     * so the completion of any past frame can be checked without a fence per frame.
+     */
+    class FrameScheduler final
+    {
+    public:
+        using PacingHook = std::function<void(uint64_t frameNumber)>;
+
+        FrameScheduler(VkDevice lDevice, uint32_t framesInFlight);
+
+        [[nodiscard]]
+        uint32_t GetFramesInFlight() const;
+
+        /*!
+         * Changes the number of frames in flight, frame slots of the next frames are computed from the new number.
+         *
+         * \attention All submitted frames must be completed, so no slot is in use.
+         */
+        void SetFramesInFlight(uint32_t framesInFlight);
+
+        /*!
+         * Waits until the number of frames in flight allows to start the next one.
+         *
+         * \return Number of the frame which must be passed to EndFrame after the submission.
+         * \attention If the frame was not submitted, the next call returns the same number.
+         */
+        uint64_t BeginFrame();
+
+        /*!
+         * Marks the frame as submitted, so its number is signaled by the GPU.
+         */
+        void EndFrame(uint64_t frameNumber);
+
+        /*!
+         * Blocks until the frame is processed by the GPU. Time of waiting is added to the CPU wait time of the
+         * current frame.
+         */
+        void WaitForFrame(uint64_t frameNumber);
+
+        /*!
+         * Blocks until all submitted frames are processed by the GPU.
+         */
+        void WaitForSubmittedFrames();
+
+        /*!
+         * Non-blocking check if the frame is already processed by the GPU.
+         * Can be used to recycle per-frame resources (e.g. staging buffers) without waiting.
+         */
+        [[nodiscard]]
+        bool IsFrameCompleted(uint64_t frameNumber) const;
+
+        [[nodiscard]]
+        uint64_t GetCompletedFrame() const;
+
+        [[nodiscard]]
+        uint64_t GetSubmittedFrame() const;
+
+        /*!
+         * \return Index of the set of per-frame resources that is used by the frame.
+         */
+        [[nodiscard]]
+        uint32_t GetFrameSlot(uint64_t frameNumber) const;
+
+        [[nodiscard]]
+        VkSemaphore GetTimelineSemaphore() const;
+
+        /*!
+         * \return Time the CPU was blocked by the GPU during the last begun frame.
+         */
+        [[nodiscard]]
+        std::chrono::nanoseconds GetCpuWaitTime() const;
+
+        /*!
+         * Sets the function that is called at the beginning of every frame before waiting for the GPU.
+         * Can be used for CPU-side frame pacing (e.g. sleeping to limit the frame rate).
+         */
+        void SetPacingHook(PacingHook hook);
+
+    private:
+        TimelineSemaphore _timelineSemaphore;
+        uint32_t _framesInFlight;
+        uint64_t _submittedFrame = 0;
+        std::chrono::nanoseconds _cpuWaitTime = std::chrono::nanoseconds::zero();
+        PacingHook _pacingHook;
+    };
+}
\ No newline at end of file
@@ -7,14 +7,13 @@ using namespace VkWrapper;
 // ---------------------------------------------------------------------------------------------------------------------
 
 Framebuffers::Framebuffers(VkDevice lDevice,
-                           const SwapChainImageViews& swapChainImageViews,
+                           const std::vector<VkImageView>& imageViews,
                            VkRenderPass renderPass,
                            VkExtent2D swapChainExtent)
 : _lDevice(lDevice)
 {
     TraceIt;
 
-    const auto& imageViews = swapChainImageViews.GetImageViews();
     _framebuffers.resize(imageViews.size());
     for (size_t i = 0; i < imageViews.size(); ++i)
     {
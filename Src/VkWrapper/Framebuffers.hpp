@@ -1,5 +1,6 @@
 #pragma once
-#include <VkWrapper/SwapChainImageViews.hpp>
+#include <vector>
+#include <vulkan/vulkan.h>
 
 namespace VkWrapper
 {
@@ -7,7 +8,7 @@ namespace VkWrapper
     {
     public:
         Framebuffers(VkDevice lDevice,
-                     const SwapChainImageViews& swapChainImageViews,
+                     const std::vector<VkImageView>& imageViews,
                      VkRenderPass renderPass,
                      VkExtent2D swapChainExtent);
         ~Framebuffers();
@@ -0,0 +1,349 @@
+#include "GpuProfiler.hpp"
+#include <VkWrapper/CommandPool.hpp>
+#include <Utility/Assert.hpp>
+#include <Logger/Logger.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+#include <Tracer/TraceTimeline.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    constexpr VkQueryPipelineStatisticFlags statisticFlags =
+            VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+            VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
+    constexpr std::string_view gpuTrack = "GPU";
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+GpuProfiler::GpuProfiler(VkDevice lDevice,
+                         const PDevice& pDevice,
+                         uint32_t queueFamilyIndex,
+                         VkQueue queue,
+                         uint32_t rangeCount,
+                         uint32_t maxZonesPerRange)
+: _lDevice(lDevice)
+, _queueFamilyIndex(queueFamilyIndex)
+, _queue(queue)
+, _maxZonesPerRange(maxZonesPerRange)
+, _timestampPeriod(pDevice.GetProperties().limits.timestampPeriod)
+, _ranges(rangeCount)
+{
+    TraceIt;
+
+    // Timestamps are supported if the family reports valid bits
+    uint32_t queueFamilyCount(0);
+    vkGetPhysicalDeviceQueueFamilyProperties(pDevice.GetHandle(), &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(pDevice.GetHandle(), &queueFamilyCount, queueFamilies.data());
+    const auto validBits = _queueFamilyIndex < queueFamilyCount
+                           ? queueFamilies[_queueFamilyIndex].timestampValidBits
+                           : 0;
+    if (validBits == 0 || _timestampPeriod <= 0.0)
+    {
+        Logger::LogWarning("Timestamp queries are not supported, GPU profiling is disabled", __PRETTY_FUNCTION__);
+        return;
+    }
+    _timestampMask = validBits >= 64 ? UINT64_MAX : (uint64_t(1) << validBits) - 1;
+
+    // Two queries per zone and one more for the calibration
+    VkQueryPoolCreateInfo timestampCreateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = rangeCount * _maxZonesPerRange * 2 + 1
+    };
+    Assert(vkCreateQueryPool(_lDevice, &timestampCreateInfo, nullptr, &_timestampPool) == VK_SUCCESS,
+           "Failed to create timestamp query pool");
+
+    // The feature is enabled by the logical device if the physical one supports it
+    if (pDevice.GetFeatures().pipelineStatisticsQuery)
+    {
+        VkQueryPoolCreateInfo statisticsCreateInfo =
+        {
+            .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+            .queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+            .queryCount = rangeCount,
+            .pipelineStatistics = statisticFlags
+        };
+        Assert(vkCreateQueryPool(_lDevice, &statisticsCreateInfo, nullptr, &_statisticsPool) == VK_SUCCESS,
+               "Failed to create pipeline statistics query pool");
+    }
+
+    Calibrate();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+GpuProfiler::~GpuProfiler()
+{
+    vkDestroyQueryPool(_lDevice, _statisticsPool, nullptr);
+    vkDestroyQueryPool(_lDevice, _timestampPool, nullptr);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool GpuProfiler::IsSupported() const
+{
+    return _timestampPool != VK_NULL_HANDLE;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool GpuProfiler::IsPipelineStatisticsSupported() const
+{
+    return _statisticsPool != VK_NULL_HANDLE;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GpuProfiler::BeginRange(VkCommandBuffer commandBuffer, uint32_t range)
+{
+    if (!IsSupported())
+    {
+        return;
+    }
+
+    Assert(range < _ranges.size(), "Query range is out of bounds");
+
+    _ranges[range].zoneNames.clear();
+    _ranges[range].hasStatistics = false;
+    vkCmdResetQueryPool(commandBuffer, _timestampPool, GetTimestampQuery(range, 0), _maxZonesPerRange * 2);
+    if (IsPipelineStatisticsSupported())
+    {
+        vkCmdResetQueryPool(commandBuffer, _statisticsPool, range, 1);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint32_t GpuProfiler::BeginZone(VkCommandBuffer commandBuffer, uint32_t range, std::string name)
+{
+    if (!IsSupported())
+    {
+        return 0;
+    }
+
+    auto& zoneNames = _ranges[range].zoneNames;
+    Assert(zoneNames.size() < _maxZonesPerRange, "Too many zones in the query range");
+
+    const auto zone = static_cast<uint32_t>(zoneNames.size());
+    zoneNames.push_back(std::move(name));
+    vkCmdWriteTimestamp(commandBuffer,
+                        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                        _timestampPool,
+                        GetTimestampQuery(range, zone));
+
+    return zone;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GpuProfiler::EndZone(VkCommandBuffer commandBuffer, uint32_t range, uint32_t zone)
+{
+    if (!IsSupported())
+    {
+        return;
+    }
+
+    vkCmdWriteTimestamp(commandBuffer,
+                        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                        _timestampPool,
+                        GetTimestampQuery(range, zone) + 1);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GpuProfiler::BeginStatistics(VkCommandBuffer commandBuffer, uint32_t range)
+{
+    if (!IsPipelineStatisticsSupported())
+    {
+        return;
+    }
+
+    Assert(!_ranges[range].hasStatistics, "Pipeline statistics can be counted only once per range");
+    _ranges[range].hasStatistics = true;
+    vkCmdBeginQuery(commandBuffer, _statisticsPool, range, 0);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GpuProfiler::EndStatistics(VkCommandBuffer commandBuffer, uint32_t range)
+{
+    if (!IsPipelineStatisticsSupported())
+    {
+        return;
+    }
+
+    vkCmdEndQuery(commandBuffer, _statisticsPool, range);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool GpuProfiler::CollectResults(uint32_t range)
+{
+    if (!IsSupported() || _ranges[range].zoneNames.empty())
+    {
+        return false;
+    }
+
+    // Every query is followed by its availability, results which are not ready yet are not waited for
+    const auto& zoneNames = _ranges[range].zoneNames;
+    const auto queryCount = static_cast<uint32_t>(zoneNames.size() * 2);
+    std::vector<uint64_t> timestamps(queryCount * 2);
+    const auto timestampsResult = vkGetQueryPoolResults(_lDevice,
+                                                        _timestampPool,
+                                                        GetTimestampQuery(range, 0),
+                                                        queryCount,
+                                                        timestamps.size() * sizeof(uint64_t),
+                                                        timestamps.data(),
+                                                        2 * sizeof(uint64_t),
+                                                        VK_QUERY_RESULT_64_BIT |
+                                                        VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+    if (timestampsResult != VK_SUCCESS)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < queryCount; ++i)
+    {
+        if (timestamps[i * 2 + 1] == 0)
+        {
+            return false;
+        }
+    }
+
+    _lastZones.clear();
+    for (size_t zone = 0; zone < zoneNames.size(); ++zone)
+    {
+        Zone result =
+        {
+            .name = zoneNames[zone],
+            .start = ToCpuTime(timestamps[zone * 4]),
+            .end = ToCpuTime(timestamps[zone * 4 + 2])
+        };
+        TraceTimeline::AddZone({ result.name, std::string(gpuTrack), result.start, result.end });
+        _lastZones.push_back(std::move(result));
+    }
+
+    // Results are written in the order of bits: vertex invocations, fragment invocations, availability
+    if (_ranges[range].hasStatistics)
+    {
+        uint64_t statistics[3] = {};
+        const auto statisticsResult = vkGetQueryPoolResults(_lDevice,
+                                                            _statisticsPool,
+                                                            range,
+                                                            1,
+                                                            sizeof(statistics),
+                                                            statistics,
+                                                            sizeof(statistics),
+                                                            VK_QUERY_RESULT_64_BIT |
+                                                            VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+        if (statisticsResult == VK_SUCCESS && statistics[2] != 0)
+        {
+            _lastPipelineStatistics = PipelineStatistics
+            {
+                .vertexShaderInvocations = statistics[0],
+                .fragmentShaderInvocations = statistics[1]
+            };
+        }
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::vector<GpuProfiler::Zone>& GpuProfiler::GetLastZones() const
+{
+    return _lastZones;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::optional<GpuProfiler::PipelineStatistics>& GpuProfiler::GetLastPipelineStatistics() const
+{
+    return _lastPipelineStatistics;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GpuProfiler::Calibrate()
+{
+    if (!IsSupported())
+    {
+        return;
+    }
+
+    CommandPool commandPool(_lDevice, _queueFamilyIndex, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+    VkCommandBufferAllocateInfo allocateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool = commandPool.GetHandle(),
+        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = 1
+    };
+    VkCommandBuffer commandBuffer(VK_NULL_HANDLE);
+    Assert(vkAllocateCommandBuffers(_lDevice, &allocateInfo, &commandBuffer) == VK_SUCCESS,
+           "Failed to allocate calibration command buffer");
+
+    VkCommandBufferBeginInfo beginInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+    };
+    const auto calibrationQuery = static_cast<uint32_t>(_ranges.size()) * _maxZonesPerRange * 2;
+    vkBeginCommandBuffer(commandBuffer, &beginInfo);
+    vkCmdResetQueryPool(commandBuffer, _timestampPool, calibrationQuery, 1);
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, _timestampPool, calibrationQuery);
+    vkEndCommandBuffer(commandBuffer);
+
+    VkSubmitInfo submitInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &commandBuffer
+    };
+
+    // The timestamp is written right before the queue becomes idle, the error is the latency of the wake-up
+    Assert(vkQueueSubmit(_queue, 1, &submitInfo, VK_NULL_HANDLE) == VK_SUCCESS, "Failed to submit calibration");
+    vkQueueWaitIdle(_queue);
+    _calibrationTime = std::chrono::steady_clock::now();
+    vkGetQueryPoolResults(_lDevice,
+                          _timestampPool,
+                          calibrationQuery,
+                          1,
+                          sizeof(_calibrationTimestamp),
+                          &_calibrationTimestamp,
+                          sizeof(_calibrationTimestamp),
+                          VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+    _calibrationTimestamp &= _timestampMask;
+
+    vkFreeCommandBuffers(_lDevice, commandPool.GetHandle(), 1, &commandBuffer);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint32_t GpuProfiler::GetTimestampQuery(uint32_t range, uint32_t zone) const
+{
+    return (range * _maxZonesPerRange + zone) * 2;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::chrono::steady_clock::time_point GpuProfiler::ToCpuTime(uint64_t timestamp) const
+{
+    // Difference is computed in the valid bits, so a wrap-around of the counter does not break it
+    const auto ticks = static_cast<int64_t>((timestamp - _calibrationTimestamp) & _timestampMask);
+    const auto signedTicks = ticks > static_cast<int64_t>(_timestampMask >> 1)
+                             ? ticks - static_cast<int64_t>(_timestampMask) - 1
+                             : ticks;
+    const auto nanoseconds = static_cast<int64_t>(static_cast<double>(signedTicks) * _timestampPeriod);
+
+    return _calibrationTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::nanoseconds(nanoseconds));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+#include <chrono>
+#include <string>
+#include <vector>
+#include <optional>
+#include <vulkan/vulkan.h>
+#include <VkWrapper/PDevice.hpp>
+
+namespace VkWrapper
+{
+    /*!
+     * Measures GPU time of named zones with timestamp queries and, where supported, counts shader invocations
+     * with pipeline statistics queries.
+     *
+     * Queries are split into ranges, one range per command buffer that can be in flight. Results of a range are
+     * read without waiting when the command buffer is reused, i.e. when the frame that used it is already
+     * finished, so the readback never stalls the GPU. GPU timestamps are converted to the steady clock and
+     * are added to the TraceTimeline, so they are displayed together with CPU zones.
+     */
+    class GpuProfiler final
+    {
+    public:
+        struct Zone
+        {
+            std::string name;
+            std::chrono::steady_clock::time_point start;
+            std::chrono::steady_clock::time_point end;
+        };
+
+        struct PipelineStatistics
+        {
+            uint64_t vertexShaderInvocations = 0;
+            uint64_t fragmentShaderInvocations = 0;
+        };
+
+        /*!
+         * \param queue Queue of the family to which profiled command buffers are submitted,
+         *              it is used to calibrate GPU timestamps against the CPU clock.
+         */
+        GpuProfiler(VkDevice lDevice,
+                    const PDevice& pDevice,
+                    uint32_t queueFamilyIndex,
+                    VkQueue queue,
+                    uint32_t rangeCount,
+                    uint32_t maxZonesPerRange = 16);
+        ~GpuProfiler();
+
+        /*!
+         * \return False if the queue family does not support timestamps, in that case all commands are ignored.
+         */
+        [[nodiscard]]
+        bool IsSupported() const;
+
+        [[nodiscard]]
+        bool IsPipelineStatisticsSupported() const;
+
+        /*!
+         * Resets queries of the range. Must be recorded outside of a render pass before any zone of the range.
+         */
+        void BeginRange(VkCommandBuffer commandBuffer, uint32_t range);
+
+        /*!
+         * \return Index of the zone which must be passed to EndZone.
+         */
+        uint32_t BeginZone(VkCommandBuffer commandBuffer, uint32_t range, std::string name);
+        void EndZone(VkCommandBuffer commandBuffer, uint32_t range, uint32_t zone);
+
+        /*!
+         * Pipeline statistics are counted between these commands, only once per range.
+         */
+        void BeginStatistics(VkCommandBuffer commandBuffer, uint32_t range);
+        void EndStatistics(VkCommandBuffer commandBuffer, uint32_t range);
+
+        /*!
+         * Reads results of the range if they are available, never waits for them.
+         *
+         * \return True if results were read. Otherwise - false.
+         */
+        bool CollectResults(uint32_t range);
+
+        [[nodiscard]]
+        const std::vector<Zone>& GetLastZones() const;
+
+        [[nodiscard]]
+        const std::optional<PipelineStatistics>& GetLastPipelineStatistics() const;
+
+        /*!
+         * Matches the GPU clock with the CPU one. Clocks can drift apart, so it can be called from time to time.
+         *
+         * \attention Waits until the queue is idle.
+         */
+        void Calibrate();
+
+    private:
+        struct Range
+        {
+            std::vector<std::string> zoneNames;
+            bool hasStatistics = false;
+        };
+
+        [[nodiscard]]
+        uint32_t GetTimestampQuery(uint32_t range, uint32_t zone) const;
+
+        [[nodiscard]]
+        std::chrono::steady_clock::time_point ToCpuTime(uint64_t timestamp) const;
+
+        VkDevice _lDevice;
+        uint32_t _queueFamilyIndex;
+        VkQueue _queue;
+        uint32_t _maxZonesPerRange;
+        double _timestampPeriod;
+        uint64_t _timestampMask = 0;
+        VkQueryPool _timestampPool = VK_NULL_HANDLE;
+        VkQueryPool _statisticsPool = VK_NULL_HANDLE;
+        std::vector<Range> _ranges;
+
+        uint64_t _calibrationTimestamp = 0;
+        std::chrono::steady_clock::time_point _calibrationTime;
+
+        std::vector<Zone> _lastZones;
+        std::optional<PipelineStatistics> _lastPipelineStatistics;
+    };
+}
\ No newline at end of file
@@ -8,12 +8,53 @@ using namespace VkWrapper;
 
 GraphicsPipeline::GraphicsPipeline(VkDevice lDevice,
                                    const PipelineShader& pipelineShader,
-                                   VkExtent2D swapChainExtent,
                                    VkRenderPass renderPass)
 : _lDevice(lDevice)
 {
     TraceIt;
 
+    CreatePipeline(pipelineShader, renderPass, nullptr);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+GraphicsPipeline::GraphicsPipeline(VkDevice lDevice,
+                                   const PipelineShader& pipelineShader,
+                                   VkFormat colorAttachmentFormat)
+: _lDevice(lDevice)
+{
+    TraceIt;
+
+    // Formats of attachments are specified instead of the render pass
+    VkPipelineRenderingCreateInfoKHR renderingCreateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR,
+        .colorAttachmentCount = 1,
+        .pColorAttachmentFormats = &colorAttachmentFormat
+    };
+
+    CreatePipeline(pipelineShader, VK_NULL_HANDLE, &renderingCreateInfo);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+GraphicsPipeline::~GraphicsPipeline()
+{
+    vkDestroyPipeline(_lDevice, _pipeline, nullptr);
+    vkDestroyPipelineLayout(_lDevice, _pipelineLayout, nullptr);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkPipeline GraphicsPipeline::GetHandle() const
+{
+    return _pipeline;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void GraphicsPipeline::CreatePipeline(const PipelineShader& pipelineShader, VkRenderPass renderPass, const void* next)
+{
     auto vertexShaderCreationInfo = pipelineShader.GetVertexShaderCreationInfo(_lDevice);
     auto fragmentShaderCreationInfo = pipelineShader.GetFragmentShaderCreationInfo(_lDevice);
     VkPipelineShaderStageCreateInfo shaderStages[] =
@@ -24,25 +65,26 @@ GraphicsPipeline::GraphicsPipeline(VkDevice lDevice,
 
     auto vertexInputInfo = CreateVertexInputStateInfo();
     auto inputAssemblyStateInfo = CreateInputAssemblyStateInfo();
-    auto viewport = CreateViewport(swapChainExtent);
-    auto scissor = CreateScissor(swapChainExtent);
-    auto viewportStateInfo = CreateViewportStateInfo(viewport, scissor);
+    auto viewportStateInfo = CreateViewportStateInfo();
     auto rasterizationStateInfo = CreateRasterizationStateInfo();
     auto multisampleStateInfo = CreateMultisampleStateInfo();
     auto colorBlendAttachmentState = CreateColorBlendAttachmentState();
     auto colorBlendStateInfo = CreateColorBlendStateInfo(colorBlendAttachmentState);
-   /* VkDynamicState dynamicStates[] =
+    // Viewport and scissor are set while recording command buffers,
+    // so the pipeline does not depend on the swap chain extent and survives resizes
+    const VkDynamicState dynamicStates[] =
     {
         VK_DYNAMIC_STATE_VIEWPORT,
-        VK_DYNAMIC_STATE_LINE_WIDTH
+        VK_DYNAMIC_STATE_SCISSOR
     };
-    auto dynamicStateInfo = CreateDynamicStateInfo(dynamicStates, static_cast<uint32_t>(std::size(dynamicStates)));*/
+    auto dynamicStateInfo = CreateDynamicStateInfo(dynamicStates, static_cast<uint32_t>(std::size(dynamicStates)));
 
     CreatePipelineLayout();
 
     VkGraphicsPipelineCreateInfo createInfo =
     {
         .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext = next,
         .stageCount = static_cast<uint32_t>(std::size(shaderStages)),
         .pStages = shaderStages,
         .pVertexInputState = &vertexInputInfo,
@@ -52,7 +94,7 @@ GraphicsPipeline::GraphicsPipeline(VkDevice lDevice,
         .pMultisampleState = &multisampleStateInfo,
         .pDepthStencilState = nullptr,
         .pColorBlendState = &colorBlendStateInfo,
-        .pDynamicState = nullptr,//&dynamicStateInfo,
+        .pDynamicState = &dynamicStateInfo,
         .layout = _pipelineLayout,
         .renderPass = renderPass,
         .subpass = 0,
@@ -66,21 +108,6 @@ GraphicsPipeline::GraphicsPipeline(VkDevice lDevice,
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-GraphicsPipeline::~GraphicsPipeline()
-{
-    vkDestroyPipeline(_lDevice, _pipeline, nullptr);
-    vkDestroyPipelineLayout(_lDevice, _pipelineLayout, nullptr);
-}
-
-// ---------------------------------------------------------------------------------------------------------------------
-
-VkPipeline GraphicsPipeline::GetHandle() const
-{
-    return _pipeline;
-}
-
-// ---------------------------------------------------------------------------------------------------------------------
-
 void GraphicsPipeline::CreatePipelineLayout()
 {
     VkPipelineLayoutCreateInfo createInfo =
@@ -128,46 +155,16 @@ VkPipelineInputAssemblyStateCreateInfo GraphicsPipeline::CreateInputAssemblyStat
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-VkViewport GraphicsPipeline::CreateViewport(const VkExtent2D& swapChainExtent)
-{
-    VkViewport viewport =
-    {
-        .x = 0.0f,
-        .y = 0.0f,
-        .width = static_cast<float>(swapChainExtent.width),
-        .height = static_cast<float>(swapChainExtent.height),
-        .minDepth = 0.0f,
-        .maxDepth = 1.0f
-    };
-
-    return viewport;
-}
-
-// ---------------------------------------------------------------------------------------------------------------------
-
-VkRect2D GraphicsPipeline::CreateScissor(const VkExtent2D& swapChainExtent)
-{
-    VkRect2D scissor =
-    {
-        .offset = {0, 0},
-        .extent = swapChainExtent
-    };
-
-    return scissor;
-}
-
-// ---------------------------------------------------------------------------------------------------------------------
-
-VkPipelineViewportStateCreateInfo GraphicsPipeline::CreateViewportStateInfo(const VkViewport& viewport,
-                                                                            const VkRect2D& scissor)
+VkPipelineViewportStateCreateInfo GraphicsPipeline::CreateViewportStateInfo()
 {
+    // Actual viewport and scissor are dynamic states, so only their number is specified here
     VkPipelineViewportStateCreateInfo createInfo =
     {
         .sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
         .viewportCount = 1,
-        .pViewports = &viewport,
+        .pViewports = nullptr,
         .scissorCount = 1,
-        .pScissors = &scissor
+        .pScissors = nullptr
     };
 
     return createInfo;
@@ -267,7 +264,7 @@ VkPipelineColorBlendStateCreateInfo GraphicsPipeline::CreateColorBlendStateInfo(
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-VkPipelineDynamicStateCreateInfo GraphicsPipeline::CreateDynamicStateInfo(VkDynamicState* dynamicStates,
+VkPipelineDynamicStateCreateInfo GraphicsPipeline::CreateDynamicStateInfo(const VkDynamicState* dynamicStates,
                                                                           uint32_t size)
 {
     VkPipelineDynamicStateCreateInfo createInfo =
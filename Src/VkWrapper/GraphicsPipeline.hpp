@@ -9,28 +9,33 @@ namespace VkWrapper
     public:
         GraphicsPipeline(VkDevice lDevice,
                          const PipelineShader& pipelineShader,
-                         VkExtent2D swapChainExtent,
                          VkRenderPass renderPass);
+
+        /*!
+         * Creates the pipeline for dynamic rendering to a color attachment of the specified format.
+         */
+        GraphicsPipeline(VkDevice lDevice,
+                         const PipelineShader& pipelineShader,
+                         VkFormat colorAttachmentFormat);
         ~GraphicsPipeline();
 
         [[nodiscard]]
         VkPipeline GetHandle() const;
 
     private:
+        void CreatePipeline(const PipelineShader& pipelineShader, VkRenderPass renderPass, const void* next);
         void CreatePipelineLayout();
 
         static VkPipelineVertexInputStateCreateInfo CreateVertexInputStateInfo();
         static VkPipelineInputAssemblyStateCreateInfo CreateInputAssemblyStateInfo();
-        static VkViewport CreateViewport(const VkExtent2D& swapChainExtent);
-        static VkRect2D CreateScissor(const VkExtent2D& swapChainExtent);
-        static VkPipelineViewportStateCreateInfo CreateViewportStateInfo(const VkViewport& viewport,
-                                                                         const VkRect2D& scissor);
+        static VkPipelineViewportStateCreateInfo CreateViewportStateInfo();
         static VkPipelineRasterizationStateCreateInfo CreateRasterizationStateInfo();
         static VkPipelineMultisampleStateCreateInfo CreateMultisampleStateInfo();
         static VkPipelineColorBlendAttachmentState CreateColorBlendAttachmentState();
         static VkPipelineColorBlendStateCreateInfo CreateColorBlendStateInfo(
                 const VkPipelineColorBlendAttachmentState& colorBlendAttachment);
-        static VkPipelineDynamicStateCreateInfo CreateDynamicStateInfo(VkDynamicState* dynamicStates, uint32_t size);
+        static VkPipelineDynamicStateCreateInfo CreateDynamicStateInfo(const VkDynamicState* dynamicStates,
+                                                                       uint32_t size);
 
         VkDevice _lDevice;
         VkPipelineLayout _pipelineLayout{};
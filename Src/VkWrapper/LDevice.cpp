@@ -15,10 +15,32 @@ LDevice::LDevice(const SuitablePDevice& device, const ValidationLayers& layers)
     // Physical device features that are gonna be used
     VkPhysicalDeviceFeatures deviceFeatures{};
 
+    // Pipeline statistics are used by the GPU profiler if the device supports them
+    deviceFeatures.pipelineStatisticsQuery = device.GetPDevice().GetFeatures().pipelineStatisticsQuery;
+
+    // Timeline semaphores are used to track frames in flight
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures =
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+        .timelineSemaphore = VK_TRUE
+    };
+
+    // Render pass and framebuffers are not used if dynamic rendering is available
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures =
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR,
+        .dynamicRendering = VK_TRUE
+    };
+    if (device.IsDynamicRenderingSupported())
+    {
+        timelineSemaphoreFeatures.pNext = &dynamicRenderingFeatures;
+    }
+
     // Fill create info
     VkDeviceCreateInfo createInfo =
     {
         .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+        .pNext = &timelineSemaphoreFeatures,
         .queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfo.size()),
         .pQueueCreateInfos = queueCreateInfo.data(),
 #ifndef NDEBUG
@@ -36,8 +58,27 @@ LDevice::LDevice(const SuitablePDevice& device, const ValidationLayers& layers)
            "Failed to create logical device");
 
     // Create all queues
-    vkGetDeviceQueue(_device, device.GetQueueFamilyIndices().GetGraphicsFamily().value(), 0, &_graphicsQueue);
-    vkGetDeviceQueue(_device, device.GetQueueFamilyIndices().GetPresentFamily().value(), 0, &_presentQueue);
+    const auto& queueFamilyIndices = device.GetQueueFamilyIndices();
+    vkGetDeviceQueue(_device, queueFamilyIndices.GetGraphicsFamily().value(), 0, &_graphicsQueue);
+
+    // Headless applications have no surface, so there is no present family
+    _presentQueue = _graphicsQueue;
+    if (queueFamilyIndices.GetPresentFamily().has_value())
+    {
+        vkGetDeviceQueue(_device, queueFamilyIndices.GetPresentFamily().value(), 0, &_presentQueue);
+    }
+
+    // Devices without dedicated families do everything on the graphics queue
+    _transferQueue = _graphicsQueue;
+    if (queueFamilyIndices.GetTransferFamily().has_value())
+    {
+        vkGetDeviceQueue(_device, queueFamilyIndices.GetTransferFamily().value(), 0, &_transferQueue);
+    }
+    _computeQueue = _graphicsQueue;
+    if (queueFamilyIndices.GetComputeFamily().has_value())
+    {
+        vkGetDeviceQueue(_device, queueFamilyIndices.GetComputeFamily().value(), 0, &_computeQueue);
+    }
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -68,4 +109,18 @@ VkQueue LDevice::GetPresentQueue() const
     return _presentQueue;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkQueue LDevice::GetTransferQueue() const
+{
+    return _transferQueue;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkQueue LDevice::GetComputeQueue() const
+{
+    return _computeQueue;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
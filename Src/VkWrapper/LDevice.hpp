@@ -16,12 +16,31 @@ namespace VkWrapper
         [[nodiscard]]
         VkQueue GetGraphicsQueue() const;
 
+        /*!
+         * \return Queue of the present family or the graphics queue if the device was created without a surface.
+         */
         [[nodiscard]]
         VkQueue GetPresentQueue() const;
 
+        /*!
+         * \return Queue of the dedicated transfer family or the graphics queue if the device has none.
+         */
+        [[nodiscard]]
+        VkQueue GetTransferQueue() const;
+
+        /*!
+         * \return Queue of the async compute family or the graphics queue if the device has none.
+         * \attention If there is no transfer-only family, the transfer queue is the same queue,
+         *            so submissions to them must be externally synchronized.
+         */
+        [[nodiscard]]
+        VkQueue GetComputeQueue() const;
+
     private:
         VkQueue _graphicsQueue{};
         VkQueue _presentQueue{};
+        VkQueue _transferQueue{};
+        VkQueue _computeQueue{};
         VkDevice _device{};
     };
 }
\ No newline at end of file
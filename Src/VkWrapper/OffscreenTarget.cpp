@@ -0,0 +1,211 @@
+#include "OffscreenTarget.hpp"
+#include <VkWrapper/Buffer.hpp>
+#include <Utility/Assert.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    constexpr VkDeviceSize bytesPerPixel = 4;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+OffscreenTarget::OffscreenTarget(VkDevice lDevice,
+                                 const PDevice& pDevice,
+                                 VkExtent2D extent,
+                                 size_t imageCount,
+                                 VkFormat format)
+: _lDevice(lDevice)
+, _pDevice(pDevice)
+, _extent(extent)
+, _format(format)
+{
+    TraceIt;
+
+    Assert(_format == VK_FORMAT_R8G8B8A8_UNORM || _format == VK_FORMAT_B8G8R8A8_UNORM,
+           "Only 8-bit RGBA and BGRA formats are supported by the offscreen target");
+
+    _images.resize(imageCount, VK_NULL_HANDLE);
+    _memories.resize(imageCount, VK_NULL_HANDLE);
+    _imageViews.resize(imageCount, VK_NULL_HANDLE);
+    for (size_t i = 0; i < imageCount; ++i)
+    {
+        VkImageCreateInfo imageCreateInfo =
+        {
+            .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+            .imageType = VK_IMAGE_TYPE_2D,
+            .format = _format,
+            .extent = { _extent.width, _extent.height, 1 },
+            .mipLevels = 1,
+            .arrayLayers = 1,
+            .samples = VK_SAMPLE_COUNT_1_BIT,
+            .tiling = VK_IMAGE_TILING_OPTIMAL,
+            .usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
+        };
+        Assert(vkCreateImage(_lDevice, &imageCreateInfo, nullptr, &_images[i]) == VK_SUCCESS,
+               "Failed to create offscreen image");
+
+        VkMemoryRequirements memoryRequirements;
+        vkGetImageMemoryRequirements(_lDevice, _images[i], &memoryRequirements);
+        const auto memoryType = _pDevice.FindMemoryType(memoryRequirements.memoryTypeBits,
+                                                        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        Assert(memoryType.has_value(), "Failed to find suitable memory type for offscreen image");
+
+        VkMemoryAllocateInfo allocateInfo =
+        {
+            .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+            .allocationSize = memoryRequirements.size,
+            .memoryTypeIndex = memoryType.value()
+        };
+        Assert(vkAllocateMemory(_lDevice, &allocateInfo, nullptr, &_memories[i]) == VK_SUCCESS,
+               "Failed to allocate offscreen image memory");
+        vkBindImageMemory(_lDevice, _images[i], _memories[i], 0);
+
+        VkImageViewCreateInfo viewCreateInfo =
+        {
+            .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+            .image = _images[i],
+            .viewType = VK_IMAGE_VIEW_TYPE_2D,
+            .format = _format,
+            .components =
+            {
+                .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .a = VK_COMPONENT_SWIZZLE_IDENTITY,
+            },
+            .subresourceRange =
+            {
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .baseMipLevel = 0,
+                .levelCount = 1,
+                .baseArrayLayer = 0,
+                .layerCount = 1
+            }
+        };
+        Assert(vkCreateImageView(_lDevice, &viewCreateInfo, nullptr, &_imageViews[i]) == VK_SUCCESS,
+               "Failed to create offscreen image view");
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+OffscreenTarget::~OffscreenTarget()
+{
+    for (size_t i = 0; i < _images.size(); ++i)
+    {
+        vkDestroyImageView(_lDevice, _imageViews[i], nullptr);
+        vkDestroyImage(_lDevice, _images[i], nullptr);
+        vkFreeMemory(_lDevice, _memories[i], nullptr);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkFormat OffscreenTarget::GetImageFormat() const
+{
+    return _format;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const VkExtent2D& OffscreenTarget::GetExtent() const
+{
+    return _extent;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::vector<VkImage>& OffscreenTarget::GetImages() const
+{
+    return _images;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::vector<VkImageView>& OffscreenTarget::GetImageViews() const
+{
+    return _imageViews;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::vector<uint8_t> OffscreenTarget::ReadBack(size_t imageIndex, VkCommandPool commandPool, VkQueue queue) const
+{
+    TraceIt;
+
+    Assert(imageIndex < _images.size(), "Image index is out of range");
+
+    const VkDeviceSize size = static_cast<VkDeviceSize>(_extent.width) * _extent.height * bytesPerPixel;
+    Buffer readbackBuffer(_lDevice,
+                          _pDevice,
+                          size,
+                          VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    VkCommandBufferAllocateInfo allocateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool = commandPool,
+        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = 1
+    };
+    VkCommandBuffer commandBuffer(VK_NULL_HANDLE);
+    Assert(vkAllocateCommandBuffers(_lDevice, &allocateInfo, &commandBuffer) == VK_SUCCESS,
+           "Failed to allocate readback command buffer");
+
+    VkCommandBufferBeginInfo beginInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+    };
+    Assert(vkBeginCommandBuffer(commandBuffer, &beginInfo) == VK_SUCCESS, "Failed to begin readback command buffer");
+
+    // Render pass leaves the image in the transfer source layout and its outgoing dependency makes
+    // the color writes visible to transfer commands, so no barrier is required here
+    VkBufferImageCopy region =
+    {
+        .bufferOffset = 0,
+        .bufferRowLength = 0,
+        .bufferImageHeight = 0,
+        .imageSubresource =
+        {
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .mipLevel = 0,
+            .baseArrayLayer = 0,
+            .layerCount = 1
+        },
+        .imageOffset = { 0, 0, 0 },
+        .imageExtent = { _extent.width, _extent.height, 1 }
+    };
+    vkCmdCopyImageToBuffer(commandBuffer,
+                           _images[imageIndex],
+                           VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           readbackBuffer.GetHandle(),
+                           1,
+                           &region);
+    Assert(vkEndCommandBuffer(commandBuffer) == VK_SUCCESS, "Failed to record readback command buffer");
+
+    VkSubmitInfo submitInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &commandBuffer
+    };
+    Assert(vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE) == VK_SUCCESS, "Failed to submit readback");
+    vkQueueWaitIdle(queue);
+    vkFreeCommandBuffers(_lDevice, commandPool, 1, &commandBuffer);
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(size));
+    readbackBuffer.Read(pixels.data(), size);
+
+    return pixels;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+#include <vector>
+#include <vulkan/vulkan.h>
+#include <VkWrapper/PDevice.hpp>
+
+namespace VkWrapper
+{
+    /*!
+     * Set of device local color images that are used instead of the swap chain images in the headless mode.
+     * After rendering images are left in the transfer source layout, so their content can be read back.
+     */
+    class OffscreenTarget final
+    {
+    public:
+        OffscreenTarget(VkDevice lDevice,
+                        const PDevice& pDevice,
+                        VkExtent2D extent,
+                        size_t imageCount,
+                        VkFormat format = VK_FORMAT_R8G8B8A8_UNORM);
+        ~OffscreenTarget();
+
+        [[nodiscard]]
+        VkFormat GetImageFormat() const;
+
+        [[nodiscard]]
+        const VkExtent2D& GetExtent() const;
+
+        [[nodiscard]]
+        const std::vector<VkImage>& GetImages() const;
+
+        [[nodiscard]]
+        const std::vector<VkImageView>& GetImageViews() const;
+
+        /*!
+         * Copies the content of the image to the host memory.
+         *
+         * \param commandPool Pool of the family of the queue.
+         * \return Tightly packed rows of pixels in the format of the target.
+         * \attention Blocks until the queue is idle, so all rendering submitted to the queue is finished.
+         */
+        [[nodiscard]]
+        std::vector<uint8_t> ReadBack(size_t imageIndex, VkCommandPool commandPool, VkQueue queue) const;
+
+    private:
+        VkDevice _lDevice;
+        const PDevice& _pDevice;
+        VkExtent2D _extent;
+        VkFormat _format;
+        std::vector<VkImage> _images;
+        std::vector<VkDeviceMemory> _memories;
+        std::vector<VkImageView> _imageViews;
+    };
+}
\ No newline at end of file
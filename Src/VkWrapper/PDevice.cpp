@@ -1,10 +1,29 @@
 #include "PDevice.hpp"
+#include <algorithm>
+#include <Utility/Assert.hpp>
+#include <Logger/Logger.hpp>
 #include <Tracer/TraceScopeTimer.hpp>
 
 using namespace VkWrapper;
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+namespace
+{
+    // Capabilities are capped, so their sum has an upper bound that the spacing of device type tiers exceeds
+    constexpr uint32_t maxMemoryScore = 2048;          // 32 GiB
+    constexpr uint32_t dedicatedQueueScore = 500;      // Transfer and compute
+    constexpr uint32_t extensionScore = 300;           // Three extensions
+    constexpr uint32_t maxImageDimensionScore = 2048;  // 32768 pixels
+    constexpr uint32_t maxPushConstantsScore = 64;     // 256 bytes
+    constexpr uint32_t maxCapabilityScore = maxMemoryScore + dedicatedQueueScore * 2 + extensionScore * 3 +
+                                            maxImageDimensionScore + maxPushConstantsScore;
+    constexpr uint32_t deviceTypeTierScore = 10000;
+    static_assert(maxCapabilityScore < deviceTypeTierScore, "Capabilities must not outweigh the device type");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 PDevice::PDevice(VkPhysicalDevice device)
 : _device(device)
 {
@@ -20,6 +39,30 @@ PDevice::PDevice(VkPhysicalDevice device)
     _extensions.resize(extensionCount);
     vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, _extensions.data());
 
+    // Get queue families
+    uint32_t queueFamilyCount(0);
+    vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, nullptr);
+    _queueFamilies.resize(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, _queueFamilies.data());
+
+    CalcScore();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+PDevice::PDevice(VkPhysicalDevice device,
+                 const VkPhysicalDeviceProperties& properties,
+                 const VkPhysicalDeviceMemoryProperties& memoryProperties,
+                 const VkPhysicalDeviceFeatures& features,
+                 std::vector<VkExtensionProperties> extensions,
+                 std::vector<VkQueueFamilyProperties> queueFamilies)
+: _device(device)
+, _properties(properties)
+, _memoryProperties(memoryProperties)
+, _features(features)
+, _extensions(std::move(extensions))
+, _queueFamilies(std::move(queueFamilies))
+{
     CalcScore();
 }
 
@@ -35,7 +78,9 @@ PDevice::PDevice(PDevice&& other) noexcept
 , _memoryProperties(other._memoryProperties)
 , _features(other._features)
 , _extensions(std::move(other._extensions))
+, _queueFamilies(std::move(other._queueFamilies))
 , _score(other._score)
+, _scoreDescription(std::move(other._scoreDescription))
 { }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -49,7 +94,9 @@ PDevice& PDevice::operator=(const PDevice& other)
         _memoryProperties = other._memoryProperties;
         _features = other._features;
         _extensions = other._extensions;
+        _queueFamilies = other._queueFamilies;
         _score = other._score;
+        _scoreDescription = other._scoreDescription;
     }
 
     return *this;
@@ -64,7 +111,9 @@ PDevice& PDevice::operator=(PDevice&& other) noexcept
     _memoryProperties = other._memoryProperties;
     _features = other._features;
     _extensions = std::move(other._extensions);
+    _queueFamilies = std::move(other._queueFamilies);
     _score = other._score;
+    _scoreDescription = std::move(other._scoreDescription);
 
     return *this;
 }
@@ -106,6 +155,28 @@ const std::vector<VkExtensionProperties>& PDevice::GetExtensions() const
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+const std::vector<VkQueueFamilyProperties>& PDevice::GetQueueFamilies() const
+{
+    return _queueFamilies;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool PDevice::IsExtensionSupported(std::string_view extensionName) const
+{
+    for (const auto& extension : _extensions)
+    {
+        if (extensionName == extension.extensionName)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 uint32_t PDevice::GetScore() const
 {
     return _score;
@@ -113,6 +184,28 @@ uint32_t PDevice::GetScore() const
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+const std::string& PDevice::GetScoreDescription() const
+{
+    return _scoreDescription;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::optional<uint32_t> PDevice::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const
+{
+    for (uint32_t i = 0; i < _memoryProperties.memoryTypeCount; ++i)
+    {
+        if ((typeFilter & (1u << i)) && (_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+        {
+            return i;
+        }
+    }
+
+    return std::nullopt;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 bool PDevice::operator<(const PDevice& other) const
 {
     return _score < other._score;
@@ -122,16 +215,130 @@ bool PDevice::operator<(const PDevice& other) const
 
 void PDevice::CalcScore()
 {
-    if (!_features.geometryShader)
+    _score = 0;
+    _scoreDescription.clear();
+    const auto addScore = [this](uint32_t score, const std::string& reason)
     {
-        return;
+        _score += score;
+        _scoreDescription += (_scoreDescription.empty() ? "" : ", ") + reason + " +" + std::to_string(score);
+    };
+
+    // Device type outweighs everything else, software rasterizers are used only if there is nothing else
+    switch (_properties.deviceType)
+    {
+        case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:   addScore(deviceTypeTierScore * 4, "discrete GPU");   break;
+        case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU: addScore(deviceTypeTierScore * 3, "integrated GPU"); break;
+        case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:    addScore(deviceTypeTierScore * 2, "virtual GPU");    break;
+        case VK_PHYSICAL_DEVICE_TYPE_CPU:            addScore(deviceTypeTierScore, "CPU");                break;
+        default:                                     addScore(0, "unknown type");                         break;
     }
 
-    if (_properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU)
+    // 1 point per 16 MiB of device local memory, up to 32 GiB
+    VkDeviceSize deviceLocalMemory(0);
+    for (uint32_t i = 0; i < _memoryProperties.memoryHeapCount; ++i)
+    {
+        if (_memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+        {
+            deviceLocalMemory += _memoryProperties.memoryHeaps[i].size;
+        }
+    }
+    const auto deviceLocalMemoryMiB = deviceLocalMemory / (1024 * 1024);
+    addScore(static_cast<uint32_t>(std::min<VkDeviceSize>(deviceLocalMemoryMiB / 16, maxMemoryScore)),
+             std::to_string(deviceLocalMemoryMiB) + " MiB VRAM");
+
+    // Dedicated queues let uploads and compute work run alongside rendering
+    bool hasTransferQueue(false);
+    bool hasComputeQueue(false);
+    for (const auto& queueFamily : _queueFamilies)
     {
-        _score += 1000;
+        const auto isGraphics = (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0;
+        const auto isCompute = (queueFamily.queueFlags & VK_QUEUE_COMPUTE_BIT) != 0;
+        hasTransferQueue |= !isGraphics && !isCompute && (queueFamily.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0;
+        hasComputeQueue |= !isGraphics && isCompute;
     }
-    _score += _properties.limits.maxImageDimension2D;
+    if (hasTransferQueue)
+    {
+        addScore(dedicatedQueueScore, "dedicated transfer queue");
+    }
+    if (hasComputeQueue)
+    {
+        addScore(dedicatedQueueScore, "async compute queue");
+    }
+
+    // Extensions which are promoted to the core are available without them since the corresponding version
+    const auto addExtensionScore = [this, &addScore](const char* extensionName, uint32_t coreVersion)
+    {
+        if (_properties.apiVersion >= coreVersion || IsExtensionSupported(extensionName))
+        {
+            addScore(extensionScore, extensionName);
+        }
+    };
+    addExtensionScore(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME, VK_API_VERSION_1_2);
+    addExtensionScore(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, VK_API_VERSION_1_2);
+    addExtensionScore(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME, VK_API_VERSION_1_3);
+
+    // Limits, devices of the same class differ mostly by them
+    addScore(std::min(_properties.limits.maxImageDimension2D / 16, maxImageDimensionScore), "max image dimension");
+    addScore(std::min(_properties.limits.maxPushConstantsSize / 4, maxPushConstantsScore), "push constants size");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+size_t VkWrapper::SelectPDevice(const std::vector<std::reference_wrapper<const PDevice>>& pDevices,
+                                std::string_view forcedName)
+{
+    TraceIt;
+
+    Assert(!pDevices.empty(), "There are no devices to select from");
+
+    for (const auto& pDevice : pDevices)
+    {
+        Logger::LogInfo(std::string("Candidate ") + pDevice.get().GetProperties().deviceName + ", score " +
+                        std::to_string(pDevice.get().GetScore()) + ": " + pDevice.get().GetScoreDescription(),
+                        __PRETTY_FUNCTION__);
+    }
+
+    std::optional<size_t> selected;
+    std::string reason;
+    if (!forcedName.empty())
+    {
+        for (size_t i = 0; i < pDevices.size(); ++i)
+        {
+            if (forcedName == pDevices[i].get().GetProperties().deviceName)
+            {
+                selected = i;
+                reason = "forced by configuration";
+                break;
+            }
+        }
+
+        if (!selected.has_value())
+        {
+            Logger::LogWarning(std::string("Forced device ") + std::string(forcedName) +
+                               " is not found or not suitable, selecting by score",
+                               __PRETTY_FUNCTION__);
+        }
+    }
+
+    if (!selected.has_value())
+    {
+        selected = 0;
+        for (size_t i = 1; i < pDevices.size(); ++i)
+        {
+            if (pDevices[selected.value()].get() < pDevices[i].get())
+            {
+                selected = i;
+            }
+        }
+        reason = "highest score " + std::to_string(pDevices[selected.value()].get().GetScore()) + " (" +
+                 pDevices[selected.value()].get().GetScoreDescription() + ")";
+    }
+
+    Logger::LogInfo(std::string("Selected device ") + pDevices[selected.value()].get().GetProperties().deviceName +
+                    ": " + reason,
+                    __PRETTY_FUNCTION__);
+
+    return selected.value();
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
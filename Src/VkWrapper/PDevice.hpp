@@ -1,13 +1,34 @@
 #pragma once
+#include <string>
 #include <vector>
+#include <optional>
+#include <functional>
+#include <string_view>
 #include <vulkan/vulkan.h>
 
 namespace VkWrapper
 {
+    /*!
+     * Physical device with its capabilities and the score which is used to choose between several devices.
+     *
+     * Score is based on the device type, the size of device local memory, dedicated transfer and compute queues,
+     * optional extensions (descriptor indexing, timeline semaphores, dynamic rendering) and a few limits.
+     */
     class PDevice final
     {
     public:
         explicit PDevice(VkPhysicalDevice device);
+
+        /*!
+         * Creates the device from already known capabilities without querying them, e.g. to describe mock devices.
+         */
+        PDevice(VkPhysicalDevice device,
+                const VkPhysicalDeviceProperties& properties,
+                const VkPhysicalDeviceMemoryProperties& memoryProperties,
+                const VkPhysicalDeviceFeatures& features,
+                std::vector<VkExtensionProperties> extensions,
+                std::vector<VkQueueFamilyProperties> queueFamilies);
+
         PDevice(const PDevice& other);
         PDevice(PDevice&& other) noexcept;
 
@@ -29,9 +50,29 @@ namespace VkWrapper
         [[nodiscard]]
         const std::vector<VkExtensionProperties>& GetExtensions() const;
 
+        [[nodiscard]]
+        const std::vector<VkQueueFamilyProperties>& GetQueueFamilies() const;
+
+        [[nodiscard]]
+        bool IsExtensionSupported(std::string_view extensionName) const;
+
         [[nodiscard]]
         uint32_t GetScore() const;
 
+        /*!
+         * \return Human readable list of the parts of the score, e.g. "discrete GPU +40000, 8192 MiB VRAM +512".
+         */
+        [[nodiscard]]
+        const std::string& GetScoreDescription() const;
+
+        /*!
+         * \param typeFilter Bit mask of allowed memory types (e.g. from VkMemoryRequirements).
+         * \param properties Properties which the memory type must have.
+         * \return Index of the first suitable memory type or empty if there is none.
+         */
+        [[nodiscard]]
+        std::optional<uint32_t> FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+
         bool operator<(const PDevice& other) const;
 
     private:
@@ -42,6 +83,18 @@ namespace VkWrapper
         VkPhysicalDeviceMemoryProperties _memoryProperties{};
         VkPhysicalDeviceFeatures _features{};
         std::vector<VkExtensionProperties> _extensions;
+        std::vector<VkQueueFamilyProperties> _queueFamilies;
         uint32_t _score{};
+        std::string _scoreDescription;
     };
+
+    /*!
+     * Chooses the device with the highest score, ties are resolved in favor of the first one.
+     *
+     * \param forcedName Name of the device which must be selected regardless of its score. Ignored if it is empty
+     *                   or there is no such device, in the latter case a warning is logged.
+     * \return Index of the selected device. The choice and its reason are logged.
+     */
+    size_t SelectPDevice(const std::vector<std::reference_wrapper<const PDevice>>& pDevices,
+                         std::string_view forcedName);
 }
\ No newline at end of file
@@ -17,9 +17,9 @@ PipelineShader::PipelineShaderCreationInfo::~PipelineShaderCreationInfo()
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-PipelineShader::PipelineShader(std::string_view shaderName)
-: _vertexShader(Shader(Shader::Type::Vertex, shaderName))
-, _fragmentShader(Shader(Shader::Type::Fragment, shaderName))
+PipelineShader::PipelineShader(Shader&& vertexShader, Shader&& fragmentShader)
+: _vertexShader(std::move(vertexShader))
+, _fragmentShader(std::move(fragmentShader))
 { }
 
 // ---------------------------------------------------------------------------------------------------------------------
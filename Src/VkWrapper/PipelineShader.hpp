@@ -1,5 +1,5 @@
 #pragma once
-#include <VkWrapper/Shader.hpp>
+#include <VkWrapper/Shader/Shader.hpp>
 
 namespace VkWrapper
 {
@@ -19,7 +19,7 @@ namespace VkWrapper
         };
 
     public:
-        explicit PipelineShader(std::string_view shaderName);
+        PipelineShader(Shader&& vertexShader, Shader&& fragmentShader);
 
         [[nodiscard]]
         PipelineShaderCreationInfo GetVertexShaderCreationInfo(VkDevice lDevice) const;
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+
+namespace VkWrapper
+{
+    /*!
+     * How frames are presented, a trade-off between latency, tearing and power. If the surface does not support
+     * the mode, the closest supported one is used, FIFO is always available.
+     */
+    enum class PresentPolicy : uint8_t
+    {
+        Fifo,        // V-sync, the CPU is throttled by the display. Lowest power, highest latency
+        FifoRelaxed, // V-sync, but a late frame is presented immediately and may tear. Falls back to FIFO
+        Mailbox,     // V-sync without throttling, the newest frame replaces the queued one. Falls back to FIFO
+        Immediate    // No v-sync, lowest latency with tearing. Falls back to MAILBOX, then to FIFO
+    };
+
+    /*!
+     * Settings of the presentation and frame pacing, can be changed at runtime (see Application).
+     */
+    struct PresentConfiguration
+    {
+        PresentPolicy policy = PresentPolicy::Mailbox;
+
+        // Number of swap chain images, 0 means one more than the minimum of the surface. Clamped to the limits of
+        // the surface. Ignored in the headless mode
+        uint32_t imageCount = 0;
+
+        // Number of frames that are processed by the GPU at the same time, fewer frames give lower latency
+        uint32_t framesInFlight = 2;
+
+        // Maximal number of frames per second, 0 means no limit. The limiter sleeps before the frame is begun
+        double frameRateLimit = 0.0;
+
+        bool operator==(const PresentConfiguration& other) const = default;
+    };
+}
@@ -5,7 +5,8 @@ using namespace VkWrapper;
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-QueueFamilyIndices::QueueFamilyIndices(VkPhysicalDevice device, const Surface& surface)
+QueueFamilyIndices::QueueFamilyIndices(VkPhysicalDevice device, const Surface* surface)
+: _isPresentRequired(surface != nullptr)
 {
     TraceIt;
 
@@ -15,33 +16,58 @@ QueueFamilyIndices::QueueFamilyIndices(VkPhysicalDevice device, const Surface& s
     // Get queue families
     std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
     vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
-    // Find graphics family
+    // Find families, the whole list is checked because dedicated families usually go after the graphics one
+    std::optional<uint32_t> transferOnlyFamily;
+    std::optional<uint32_t> computeOnlyFamily;
     uint32_t i(0);
     for (const auto& queueFamily : queueFamilies)
     {
-        if (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT)
+        const auto flags = queueFamily.queueFlags;
+        if (!_graphicsFamily.has_value() && (flags & VK_QUEUE_GRAPHICS_BIT))
         {
             _graphicsFamily = i;
             _uniqueFamilies.insert({i, graphicsPriority});
         }
 
         // Check present support
-        VkBool32 presentSupport(VK_FALSE);
-        vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface.GetHandle(), &presentSupport);
-        if (presentSupport == VK_TRUE)
+        if (_isPresentRequired && !_presentFamily.has_value())
         {
-            _presentFamily = i;
-            _uniqueFamilies.insert({i, presentPriority});
+            VkBool32 presentSupport(VK_FALSE);
+            vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface->GetHandle(), &presentSupport);
+            if (presentSupport == VK_TRUE)
+            {
+                _presentFamily = i;
+                _uniqueFamilies.insert({i, presentPriority});
+            }
         }
 
-        // If we found all required queue families break loop
-        if (IsComplete())
+        // Families without graphics support are served by separate hardware engines.
+        // Compute families support transfer commands even if the transfer bit is not reported
+        if (!(flags & VK_QUEUE_GRAPHICS_BIT))
         {
-            break;
+            if (!computeOnlyFamily.has_value() && (flags & VK_QUEUE_COMPUTE_BIT))
+            {
+                computeOnlyFamily = i;
+            }
+            else if (!transferOnlyFamily.has_value() && (flags & VK_QUEUE_TRANSFER_BIT))
+            {
+                transferOnlyFamily = i;
+            }
         }
 
         ++i;
     }
+
+    _computeFamily = computeOnlyFamily;
+    _transferFamily = transferOnlyFamily.has_value() ? transferOnlyFamily : computeOnlyFamily;
+    if (_computeFamily.has_value())
+    {
+        _uniqueFamilies.insert({_computeFamily.value(), computePriority});
+    }
+    if (_transferFamily.has_value())
+    {
+        _uniqueFamilies.insert({_transferFamily.value(), transferPriority});
+    }
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -50,7 +76,10 @@ QueueFamilyIndices::QueueFamilyIndices(const QueueFamilyIndices& other)
 {
     _graphicsFamily = other._graphicsFamily;
     _presentFamily = other._presentFamily;
+    _transferFamily = other._transferFamily;
+    _computeFamily = other._computeFamily;
     _uniqueFamilies = other._uniqueFamilies;
+    _isPresentRequired = other._isPresentRequired;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -59,7 +88,10 @@ QueueFamilyIndices::QueueFamilyIndices(QueueFamilyIndices&& other) noexcept
 {
     _graphicsFamily = other._graphicsFamily;
     _presentFamily = other._presentFamily;
+    _transferFamily = other._transferFamily;
+    _computeFamily = other._computeFamily;
     _uniqueFamilies = std::move(other._uniqueFamilies);
+    _isPresentRequired = other._isPresentRequired;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -68,7 +100,10 @@ QueueFamilyIndices& QueueFamilyIndices::operator=(const QueueFamilyIndices& othe
 {
     _graphicsFamily = other._graphicsFamily;
     _presentFamily = other._presentFamily;
+    _transferFamily = other._transferFamily;
+    _computeFamily = other._computeFamily;
     _uniqueFamilies = other._uniqueFamilies;
+    _isPresentRequired = other._isPresentRequired;
     return *this;
 }
 
@@ -78,7 +113,10 @@ QueueFamilyIndices& QueueFamilyIndices::operator=(QueueFamilyIndices&& other) no
 {
     _graphicsFamily = other._graphicsFamily;
     _presentFamily = other._presentFamily;
+    _transferFamily = other._transferFamily;
+    _computeFamily = other._computeFamily;
     _uniqueFamilies = std::move(other._uniqueFamilies);
+    _isPresentRequired = other._isPresentRequired;
     return *this;
 }
 
@@ -87,7 +125,7 @@ QueueFamilyIndices& QueueFamilyIndices::operator=(QueueFamilyIndices&& other) no
 bool QueueFamilyIndices::IsComplete() const
 {
     return _graphicsFamily.has_value() &&
-           _presentFamily.has_value();
+           (_presentFamily.has_value() || !_isPresentRequired);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -106,6 +144,20 @@ const std::optional<uint32_t>& QueueFamilyIndices::GetPresentFamily() const
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+const std::optional<uint32_t>& QueueFamilyIndices::GetTransferFamily() const
+{
+    return _transferFamily;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::optional<uint32_t>& QueueFamilyIndices::GetComputeFamily() const
+{
+    return _computeFamily;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 std::vector<VkDeviceQueueCreateInfo> QueueFamilyIndices::CreateInfo() const
 {
     std::vector<VkDeviceQueueCreateInfo> info;
@@ -8,7 +8,11 @@ namespace VkWrapper
     class QueueFamilyIndices final
     {
     public:
-        explicit QueueFamilyIndices(VkPhysicalDevice device, const Surface& surface);
+        /*!
+         * \param surface Surface to which images are presented or nullptr if the present family is not required
+         *                (headless mode).
+         */
+        explicit QueueFamilyIndices(VkPhysicalDevice device, const Surface* surface);
         QueueFamilyIndices(const QueueFamilyIndices& other);
         QueueFamilyIndices(QueueFamilyIndices&& other) noexcept;
         QueueFamilyIndices& operator=(const QueueFamilyIndices& other);
@@ -23,11 +27,27 @@ namespace VkWrapper
         [[nodiscard]]
         const std::optional<uint32_t>& GetPresentFamily() const;
 
+        /*!
+         * \return Index of a family without graphics support that can execute transfer commands.
+         *         Transfer-only families (DMA engines) are preferred over async compute ones.
+         *         Empty if the device has no such family (e.g. single-queue devices like lavapipe).
+         */
+        [[nodiscard]]
+        const std::optional<uint32_t>& GetTransferFamily() const;
+
+        /*!
+         * \return Index of a compute family without graphics support (async compute) or empty if there is none.
+         */
+        [[nodiscard]]
+        const std::optional<uint32_t>& GetComputeFamily() const;
+
         [[nodiscard]]
         std::vector<VkDeviceQueueCreateInfo> CreateInfo() const;
 
         const float graphicsPriority = 1.0f;
         const float presentPriority = 1.0f;
+        const float transferPriority = 0.5f;
+        const float computePriority = 0.5f;
 
     private:
         struct QueueData
@@ -40,6 +60,9 @@ namespace VkWrapper
 
         std::optional<uint32_t> _graphicsFamily;
         std::optional<uint32_t> _presentFamily;
+        std::optional<uint32_t> _transferFamily;
+        std::optional<uint32_t> _computeFamily;
         std::set<QueueData> _uniqueFamilies;
+        bool _isPresentRequired = true;
     };
 }
\ No newline at end of file
@@ -0,0 +1,850 @@
+#include "RenderGraph.hpp"
+#include <numeric>
+#include <algorithm>
+#include <unordered_set>
+#include <Utility/Assert.hpp>
+#include <Utility/Threading/WorkerPool.hpp>
+#include <Logger/Logger.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    struct AccessInfo
+    {
+        VkPipelineStageFlags stage;
+        VkAccessFlags readAccess;
+        VkAccessFlags writeAccess;
+        VkImageLayout layout;
+        VkImageUsageFlags usage;
+    };
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    AccessInfo GetAccessInfo(RenderGraph::Access access)
+    {
+        switch (access)
+        {
+            case RenderGraph::Access::ColorAttachment:
+                return { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                         VK_ACCESS_COLOR_ATTACHMENT_READ_BIT,
+                         VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                         VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                         VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT };
+            case RenderGraph::Access::Sampled:
+                return { VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         VK_ACCESS_SHADER_READ_BIT,
+                         0,
+                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                         VK_IMAGE_USAGE_SAMPLED_BIT };
+            case RenderGraph::Access::TransferSource:
+                return { VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_ACCESS_TRANSFER_READ_BIT,
+                         0,
+                         VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                         VK_IMAGE_USAGE_TRANSFER_SRC_BIT };
+            case RenderGraph::Access::TransferDestination:
+                return { VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0,
+                         VK_ACCESS_TRANSFER_WRITE_BIT,
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                         VK_IMAGE_USAGE_TRANSFER_DST_BIT };
+        }
+
+        return {};
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    /*!
+     * All uses of the resource within one pass, they must agree on the layout.
+     */
+    struct CombinedUse
+    {
+        RenderGraph::ResourceId resource;
+        VkPipelineStageFlags stage = 0;
+        VkAccessFlags readAccess = 0;
+        VkAccessFlags writeAccess = 0;
+        VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        bool isWrite = false;
+    };
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    /*!
+     * Synchronization state of the resource between passes.
+     */
+    struct ResourceState
+    {
+        VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        VkPipelineStageFlags writeStage = 0;    // Stage of the last write or layout transition
+        VkAccessFlags writeAccess = 0;          // Access of the last write which is not available yet
+        VkPipelineStageFlags readStages = 0;    // Stages that read the resource after the last write
+        VkPipelineStageFlags visibleStages = 0; // Stages to which the last write is already visible
+    };
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    bool IsOverlapping(VkDeviceSize firstOffset, VkDeviceSize firstSize, VkDeviceSize secondOffset,
+                       VkDeviceSize secondSize)
+    {
+        return firstOffset < secondOffset + secondSize && secondOffset < firstOffset + firstSize;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+RenderGraph::PassBuilder::PassBuilder(RenderGraph& graph, size_t pass)
+: _graph(graph)
+, _pass(pass)
+{ }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::PassBuilder::Read(ResourceId resource, Access access)
+{
+    Assert(resource < _graph._resources.size(), "Unknown resource");
+    Assert(access != Access::TransferDestination, "Transfer destination can not be read");
+
+    _graph._passes[_pass].uses.push_back({ resource, access, false });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::PassBuilder::Write(ResourceId resource, Access access)
+{
+    Assert(resource < _graph._resources.size(), "Unknown resource");
+    Assert(access != Access::Sampled && access != Access::TransferSource, "Read only access can not be written");
+
+    _graph._passes[_pass].uses.push_back({ resource, access, true });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+RenderGraph::RenderGraph(VkDevice lDevice, const PDevice& pDevice, uint32_t queueFamilyIndex, uint32_t slotCount)
+: _lDevice(lDevice)
+, _pDevice(pDevice)
+, _queueFamilyIndex(queueFamilyIndex)
+, _slotCount(slotCount)
+{
+    Assert(_slotCount > 0, "Render graph requires at least one slot");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+RenderGraph::~RenderGraph()
+{
+    DestroySecondaryCommandBuffers();
+    DestroyTransientImages();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+RenderGraph::ResourceId RenderGraph::ImportImage(std::string name, const ImportedImage& image)
+{
+    _isCompiled = false;
+
+    Resource resource;
+    resource.name = std::move(name);
+    resource.isImported = true;
+    resource.imported = image;
+    resource.image = image.image;
+    resource.imageView = image.imageView;
+    _resources.push_back(std::move(resource));
+
+    return static_cast<ResourceId>(_resources.size() - 1);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::SetImportedImage(ResourceId resource, VkImage image, VkImageView imageView)
+{
+    Assert(resource < _resources.size() && _resources[resource].isImported, "Resource is not imported");
+
+    _resources[resource].image = image;
+    _resources[resource].imageView = imageView;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+RenderGraph::ResourceId RenderGraph::CreateTransientImage(std::string name,
+                                                          const TransientImageDescription& description)
+{
+    _isCompiled = false;
+
+    Resource resource;
+    resource.name = std::move(name);
+    resource.description = description;
+    _resources.push_back(std::move(resource));
+
+    return static_cast<ResourceId>(_resources.size() - 1);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::AddPass(std::string name, const SetupFunction& setup, RecordFunction record)
+{
+    _isCompiled = false;
+
+    _passes.push_back({ std::move(name), std::move(record), {} });
+    PassBuilder builder(*this, _passes.size() - 1);
+    setup(builder);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::Compile()
+{
+    TraceIt;
+
+    DestroySecondaryCommandBuffers();
+    DestroyTransientImages();
+
+    CullPasses();
+    CalcLifetimes();
+    CreateTransientImages();
+    CalcBarriers();
+
+    _isCompiled = true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::Execute(VkCommandBuffer commandBuffer, uint32_t slot)
+{
+    Assert(_isCompiled, "Render graph must be compiled before the execution");
+    Assert(slot < _slotCount, "Slot is out of range");
+
+    if (!UsesSecondaryCommandBuffers())
+    {
+        for (const auto& compiledPass : _compiledPasses)
+        {
+            RecordBarriers(commandBuffer, compiledPass.barriers, _resources);
+            _passes[compiledPass.pass].record({ commandBuffer, slot, *this });
+        }
+        RecordBarriers(commandBuffer, _finalBarriers, _resources);
+        return;
+    }
+
+    if (_secondaryCommandBuffers.empty())
+    {
+        CreateSecondaryCommandBuffers();
+    }
+
+    // Workers of the persistent pool record passes to command buffers of their own command pools
+    for (size_t i = 0; i < _recordingWorkerCount; ++i)
+    {
+        vkResetCommandPool(_lDevice, _commandPools[slot * _recordingWorkerCount + i], 0);
+    }
+    C2D::WorkerPool::GetShared().ParallelFor(_compiledPasses.size(), [this, slot](size_t compiledPass, size_t)
+    {
+        RecordSecondaryCommandBuffer(compiledPass, slot);
+    });
+
+    // Barriers can not be recorded to secondary command buffers outside of rendering, so they stay in the primary
+    for (size_t i = 0; i < _compiledPasses.size(); ++i)
+    {
+        RecordBarriers(commandBuffer, _compiledPasses[i].barriers, _resources);
+        vkCmdExecuteCommands(commandBuffer, 1, &_secondaryCommandBuffers[slot * _compiledPasses.size() + i]);
+    }
+    RecordBarriers(commandBuffer, _finalBarriers, _resources);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkImage RenderGraph::GetImage(ResourceId resource) const
+{
+    return _resources[resource].image;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkImageView RenderGraph::GetImageView(ResourceId resource) const
+{
+    return _resources[resource].imageView;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkExtent2D RenderGraph::GetExtent(ResourceId resource) const
+{
+    const auto& resourceData = _resources[resource];
+    return resourceData.isImported ? resourceData.imported.extent : resourceData.description.extent;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::vector<std::string> RenderGraph::GetCompiledPasses() const
+{
+    std::vector<std::string> names;
+    names.reserve(_compiledPasses.size());
+    for (const auto& compiledPass : _compiledPasses)
+    {
+        names.push_back(_passes[compiledPass.pass].name);
+    }
+
+    return names;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::vector<RenderGraph::Barrier>& RenderGraph::GetPassBarriers(size_t compiledPass) const
+{
+    return _compiledPasses[compiledPass].barriers;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::vector<RenderGraph::Barrier>& RenderGraph::GetFinalBarriers() const
+{
+    return _finalBarriers;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool RenderGraph::UsesSecondaryCommandBuffers() const
+{
+    return _compiledPasses.size() > 1;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkDeviceSize RenderGraph::GetTransientMemorySize() const
+{
+    return _transientMemorySize;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::vector<VkDeviceSize> RenderGraph::AssignMemoryOffsets(const std::vector<AliasingRequest>& requests,
+                                                           VkDeviceSize& totalSize)
+{
+    std::vector<size_t> order(requests.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&requests](size_t first, size_t second)
+    {
+        return requests[first].size > requests[second].size;
+    });
+
+    std::vector<VkDeviceSize> offsets(requests.size(), 0);
+    std::vector<size_t> placed;
+    totalSize = 0;
+    for (const auto index : order)
+    {
+        const auto& request = requests[index];
+        const auto isAlive = [&requests, &request](size_t other)
+        {
+            return requests[other].firstPass <= request.lastPass && request.firstPass <= requests[other].lastPass;
+        };
+
+        // The block can start at the beginning or right after any block that is alive at the same time
+        std::vector<VkDeviceSize> candidates = { 0 };
+        for (const auto other : placed)
+        {
+            if (isAlive(other))
+            {
+                candidates.push_back(offsets[other] + requests[other].size);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (const auto candidate : candidates)
+        {
+            const auto alignment = std::max<VkDeviceSize>(request.alignment, 1);
+            const auto offset = (candidate + alignment - 1) / alignment * alignment;
+            const auto isFree = std::none_of(placed.begin(), placed.end(), [&](size_t other)
+            {
+                return isAlive(other) && IsOverlapping(offset, request.size, offsets[other], requests[other].size);
+            });
+
+            if (isFree)
+            {
+                offsets[index] = offset;
+                break;
+            }
+        }
+
+        placed.push_back(index);
+        totalSize = std::max(totalSize, offsets[index] + request.size);
+    }
+
+    return offsets;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::CullPasses()
+{
+    // Walking backwards, a pass is kept if it writes something that is needed later. Imported images are
+    // needed after the graph, reads of kept passes are needed before them, full overwrites are not
+    std::unordered_set<ResourceId> neededResources;
+    for (ResourceId i = 0; i < _resources.size(); ++i)
+    {
+        if (_resources[i].isImported)
+        {
+            neededResources.insert(i);
+        }
+    }
+
+    std::vector<size_t> keptPasses;
+    for (size_t pass = _passes.size(); pass-- > 0;)
+    {
+        const auto& uses = _passes[pass].uses;
+        const auto isNeeded = std::any_of(uses.begin(), uses.end(), [&neededResources](const Use& use)
+        {
+            return use.isWrite && neededResources.contains(use.resource);
+        });
+        if (!isNeeded)
+        {
+            Logger::LogVerbose("Pass '" + _passes[pass].name + "' is culled", __PRETTY_FUNCTION__);
+            continue;
+        }
+
+        keptPasses.push_back(pass);
+        for (const auto& use : uses)
+        {
+            const auto isRead = std::any_of(uses.begin(), uses.end(), [&use](const Use& other)
+            {
+                return other.resource == use.resource && !other.isWrite;
+            });
+            if (use.isWrite && !isRead)
+            {
+                neededResources.erase(use.resource);
+            }
+        }
+        for (const auto& use : uses)
+        {
+            if (!use.isWrite)
+            {
+                neededResources.insert(use.resource);
+            }
+        }
+    }
+
+    _compiledPasses.clear();
+    for (auto pass = keptPasses.rbegin(); pass != keptPasses.rend(); ++pass)
+    {
+        _compiledPasses.push_back({ *pass, {} });
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::CalcLifetimes()
+{
+    for (auto& resource : _resources)
+    {
+        resource.isUsed = false;
+        resource.usage = 0;
+    }
+
+    for (size_t i = 0; i < _compiledPasses.size(); ++i)
+    {
+        for (const auto& use : _passes[_compiledPasses[i].pass].uses)
+        {
+            auto& resource = _resources[use.resource];
+            if (!resource.isUsed)
+            {
+                resource.firstPass = i;
+                resource.isUsed = true;
+            }
+            resource.lastPass = i;
+            resource.usage |= GetAccessInfo(use.access).usage;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::CreateTransientImages()
+{
+    std::vector<ResourceId> transients;
+    for (ResourceId i = 0; i < _resources.size(); ++i)
+    {
+        if (!_resources[i].isImported && _resources[i].isUsed)
+        {
+            transients.push_back(i);
+        }
+    }
+
+    if (transients.empty())
+    {
+        return;
+    }
+
+    // Images are created first to know their memory requirements
+    std::vector<AliasingRequest> requests;
+    uint32_t memoryTypeBits = UINT32_MAX;
+    for (const auto id : transients)
+    {
+        auto& resource = _resources[id];
+        VkImageCreateInfo createInfo =
+        {
+            .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+            .imageType = VK_IMAGE_TYPE_2D,
+            .format = resource.description.format,
+            .extent = { resource.description.extent.width, resource.description.extent.height, 1 },
+            .mipLevels = 1,
+            .arrayLayers = 1,
+            .samples = VK_SAMPLE_COUNT_1_BIT,
+            .tiling = VK_IMAGE_TILING_OPTIMAL,
+            .usage = resource.usage,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
+        };
+        Assert(vkCreateImage(_lDevice, &createInfo, nullptr, &resource.image) == VK_SUCCESS,
+               "Failed to create transient image");
+
+        VkMemoryRequirements memoryRequirements;
+        vkGetImageMemoryRequirements(_lDevice, resource.image, &memoryRequirements);
+        memoryTypeBits &= memoryRequirements.memoryTypeBits;
+        resource.memorySize = memoryRequirements.size;
+        requests.push_back({ memoryRequirements.size,
+                             memoryRequirements.alignment,
+                             resource.firstPass,
+                             resource.lastPass });
+    }
+
+    // All transient images share one allocation
+    const auto offsets = AssignMemoryOffsets(requests, _transientMemorySize);
+    const auto memoryType = _pDevice.FindMemoryType(memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    Assert(memoryType.has_value(), "There is no memory type suitable for all transient images");
+
+    VkMemoryAllocateInfo allocateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .allocationSize = _transientMemorySize,
+        .memoryTypeIndex = memoryType.value()
+    };
+    Assert(vkAllocateMemory(_lDevice, &allocateInfo, nullptr, &_transientMemory) == VK_SUCCESS,
+           "Failed to allocate memory for transient images");
+
+    VkDeviceSize unaliasedSize(0);
+    for (size_t i = 0; i < transients.size(); ++i)
+    {
+        auto& resource = _resources[transients[i]];
+        resource.memoryOffset = offsets[i];
+        unaliasedSize += resource.memorySize;
+        vkBindImageMemory(_lDevice, resource.image, _transientMemory, resource.memoryOffset);
+
+        VkImageViewCreateInfo viewCreateInfo =
+        {
+            .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+            .image = resource.image,
+            .viewType = VK_IMAGE_VIEW_TYPE_2D,
+            .format = resource.description.format,
+            .subresourceRange =
+            {
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .baseMipLevel = 0,
+                .levelCount = 1,
+                .baseArrayLayer = 0,
+                .layerCount = 1
+            }
+        };
+        Assert(vkCreateImageView(_lDevice, &viewCreateInfo, nullptr, &resource.imageView) == VK_SUCCESS,
+               "Failed to create transient image view");
+    }
+
+    Logger::LogVerbose(std::to_string(transients.size()) + " transient images use " +
+                       std::to_string(_transientMemorySize) + " bytes instead of " + std::to_string(unaliasedSize),
+                       __PRETTY_FUNCTION__);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::CalcBarriers()
+{
+    // Stages and accesses of the last use of each resource. The first use of a transient image waits for them
+    // for itself and for images that share its memory, as they are used earlier in the frame or by
+    // the previous frame, which is before in the submission order
+    std::vector<VkPipelineStageFlags> lastStages(_resources.size(), 0);
+    std::vector<VkAccessFlags> lastWriteAccesses(_resources.size(), 0);
+    for (const auto& compiledPass : _compiledPasses)
+    {
+        for (const auto& use : _passes[compiledPass.pass].uses)
+        {
+            const auto accessInfo = GetAccessInfo(use.access);
+            lastStages[use.resource] = accessInfo.stage;
+            lastWriteAccesses[use.resource] = use.isWrite ? accessInfo.writeAccess : 0;
+        }
+    }
+
+    std::vector<ResourceState> states(_resources.size());
+    for (ResourceId i = 0; i < _resources.size(); ++i)
+    {
+        const auto& resource = _resources[i];
+        if (resource.isImported)
+        {
+            states[i].layout = resource.imported.initialLayout;
+            states[i].writeStage = resource.imported.initialStage;
+            continue;
+        }
+
+        for (ResourceId j = 0; j < _resources.size(); ++j)
+        {
+            const auto& other = _resources[j];
+            if (!other.isImported && other.isUsed &&
+                IsOverlapping(resource.memoryOffset, resource.memorySize, other.memoryOffset, other.memorySize))
+            {
+                states[i].writeStage |= lastStages[j];
+                states[i].writeAccess |= lastWriteAccesses[j];
+            }
+        }
+    }
+
+    for (auto& compiledPass : _compiledPasses)
+    {
+        // Uses of the same resource are combined, e.g. loading and storing of an attachment
+        std::vector<CombinedUse> combinedUses;
+        for (const auto& use : _passes[compiledPass.pass].uses)
+        {
+            auto combinedUse = std::find_if(combinedUses.begin(), combinedUses.end(), [&use](const CombinedUse& other)
+            {
+                return other.resource == use.resource;
+            });
+            if (combinedUse == combinedUses.end())
+            {
+                combinedUses.push_back({ .resource = use.resource });
+                combinedUse = combinedUses.end() - 1;
+            }
+
+            const auto accessInfo = GetAccessInfo(use.access);
+            Assert(combinedUse->stage == 0 || combinedUse->layout == accessInfo.layout,
+                   "Resource is used in different layouts by the same pass");
+            combinedUse->stage |= accessInfo.stage;
+            combinedUse->layout = accessInfo.layout;
+            combinedUse->readAccess |= use.isWrite ? 0 : accessInfo.readAccess;
+            combinedUse->writeAccess |= use.isWrite ? accessInfo.writeAccess : 0;
+            combinedUse->isWrite |= use.isWrite;
+        }
+
+        for (const auto& use : combinedUses)
+        {
+            auto& state = states[use.resource];
+            const auto dstAccess = use.readAccess | use.writeAccess;
+
+            if (state.layout != use.layout)
+            {
+                // Transition waits for everything before and makes the last write visible
+                compiledPass.barriers.push_back({ use.resource,
+                                                  state.writeStage | state.readStages,
+                                                  use.stage,
+                                                  state.writeAccess,
+                                                  dstAccess,
+                                                  state.layout,
+                                                  use.layout });
+                state = { use.layout, use.stage, use.writeAccess, use.isWrite ? 0u : use.stage, use.stage };
+            }
+            else if (use.isWrite)
+            {
+                // Write after read needs only the execution dependency, write after write makes the previous
+                // write available
+                const auto srcStage = state.readStages | state.writeStage;
+                if (srcStage != 0)
+                {
+                    compiledPass.barriers.push_back({ use.resource,
+                                                      srcStage,
+                                                      use.stage,
+                                                      state.writeAccess,
+                                                      dstAccess,
+                                                      state.layout,
+                                                      use.layout });
+                }
+                state = { use.layout, use.stage, use.writeAccess, 0, use.stage };
+            }
+            else
+            {
+                // Read after read in the same layout does not need a barrier
+                if (state.writeAccess != 0 && (state.visibleStages & use.stage) != use.stage)
+                {
+                    compiledPass.barriers.push_back({ use.resource,
+                                                      state.writeStage,
+                                                      use.stage,
+                                                      state.writeAccess,
+                                                      dstAccess,
+                                                      state.layout,
+                                                      use.layout });
+                    state.visibleStages |= use.stage;
+                }
+                state.readStages |= use.stage;
+            }
+        }
+    }
+
+    // Imported images are left in their final layouts with all writes available
+    _finalBarriers.clear();
+    for (ResourceId i = 0; i < _resources.size(); ++i)
+    {
+        const auto& resource = _resources[i];
+        const auto& state = states[i];
+        if (!resource.isImported || (state.layout == resource.imported.finalLayout && state.writeAccess == 0))
+        {
+            continue;
+        }
+
+        _finalBarriers.push_back({ i,
+                                   state.writeStage | state.readStages,
+                                   resource.imported.finalStage,
+                                   state.writeAccess,
+                                   resource.imported.finalAccess,
+                                   state.layout,
+                                   resource.imported.finalLayout });
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::RecordSecondaryCommandBuffer(size_t compiledPass, uint32_t slot)
+{
+    const auto index = slot * _compiledPasses.size() + compiledPass;
+    auto commandBuffer = _secondaryCommandBuffers[index];
+
+    // Rendering is begun and ended by passes themselves, so nothing is inherited
+    VkCommandBufferInheritanceInfo inheritanceInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO
+    };
+    VkCommandBufferBeginInfo beginInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = 0,
+        .pInheritanceInfo = &inheritanceInfo
+    };
+
+    Assert(vkBeginCommandBuffer(commandBuffer, &beginInfo) == VK_SUCCESS,
+           "Failed to begin recording secondary command buffer");
+    _passes[_compiledPasses[compiledPass].pass].record({ commandBuffer, slot, *this });
+    Assert(vkEndCommandBuffer(commandBuffer) == VK_SUCCESS, "Failed to record secondary command buffer");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::CreateSecondaryCommandBuffers()
+{
+    TraceIt;
+
+    // Pass is always recorded by the same worker of the pool, so each worker has its own command pool per slot
+    _recordingWorkerCount = C2D::WorkerPool::GetShared().GetActiveWorkerCount(_compiledPasses.size());
+    _commandPools.resize(_slotCount * _recordingWorkerCount, VK_NULL_HANDLE);
+    for (auto& commandPool : _commandPools)
+    {
+        VkCommandPoolCreateInfo poolCreateInfo =
+        {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+            .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+            .queueFamilyIndex = _queueFamilyIndex
+        };
+        Assert(vkCreateCommandPool(_lDevice, &poolCreateInfo, nullptr, &commandPool) == VK_SUCCESS,
+               "Failed to create command pool of the render graph");
+    }
+
+    _secondaryCommandBuffers.resize(_slotCount * _compiledPasses.size(), VK_NULL_HANDLE);
+    for (size_t i = 0; i < _secondaryCommandBuffers.size(); ++i)
+    {
+        const auto slot = i / _compiledPasses.size();
+        const auto worker = i % _compiledPasses.size() % _recordingWorkerCount;
+        VkCommandBufferAllocateInfo allocateInfo =
+        {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .commandPool = _commandPools[slot * _recordingWorkerCount + worker],
+            .level = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+            .commandBufferCount = 1
+        };
+        Assert(vkAllocateCommandBuffers(_lDevice, &allocateInfo, &_secondaryCommandBuffers[i]) == VK_SUCCESS,
+               "Failed to allocate secondary command buffer");
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::DestroyTransientImages()
+{
+    for (auto& resource : _resources)
+    {
+        if (resource.isImported || resource.image == VK_NULL_HANDLE)
+        {
+            continue;
+        }
+
+        vkDestroyImageView(_lDevice, resource.imageView, nullptr);
+        vkDestroyImage(_lDevice, resource.image, nullptr);
+        resource.imageView = VK_NULL_HANDLE;
+        resource.image = VK_NULL_HANDLE;
+    }
+
+    if (_transientMemory != VK_NULL_HANDLE)
+    {
+        vkFreeMemory(_lDevice, _transientMemory, nullptr);
+        _transientMemory = VK_NULL_HANDLE;
+    }
+    _transientMemorySize = 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::DestroySecondaryCommandBuffers()
+{
+    // Command buffers are freed together with their pools
+    for (auto commandPool : _commandPools)
+    {
+        vkDestroyCommandPool(_lDevice, commandPool, nullptr);
+    }
+    _commandPools.clear();
+    _secondaryCommandBuffers.clear();
+    _recordingWorkerCount = 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderGraph::RecordBarriers(VkCommandBuffer commandBuffer,
+                                 const std::vector<Barrier>& barriers,
+                                 const std::vector<Resource>& resources)
+{
+    if (barriers.empty())
+    {
+        return;
+    }
+
+    VkPipelineStageFlags srcStages(0);
+    VkPipelineStageFlags dstStages(0);
+    std::vector<VkImageMemoryBarrier> imageBarriers;
+    imageBarriers.reserve(barriers.size());
+    for (const auto& barrier : barriers)
+    {
+        srcStages |= barrier.srcStage;
+        dstStages |= barrier.dstStage;
+        imageBarriers.push_back(
+        {
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .srcAccessMask = barrier.srcAccess,
+            .dstAccessMask = barrier.dstAccess,
+            .oldLayout = barrier.oldLayout,
+            .newLayout = barrier.newLayout,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = resources[barrier.resource].image,
+            .subresourceRange =
+            {
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .baseMipLevel = 0,
+                .levelCount = 1,
+                .baseArrayLayer = 0,
+                .layerCount = 1
+            }
+        });
+    }
+
+    vkCmdPipelineBarrier(commandBuffer,
+                         srcStages != 0 ? srcStages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                         dstStages != 0 ? dstStages : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                         0,
+                         0, nullptr,
+                         0, nullptr,
+                         static_cast<uint32_t>(imageBarriers.size()), imageBarriers.data());
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
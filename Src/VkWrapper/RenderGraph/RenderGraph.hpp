@@ -0,0 +1,261 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <functional>
+#include <vulkan/vulkan.h>
+#include <VkWrapper/PDevice.hpp>
+
+namespace VkWrapper
+{
+    /*!
+     * Frame graph on top of the Vulkan objects. Passes are declared in the execution order together with images
+     * they read and write, Compile() then:
+     *  - culls passes whose results are used neither by imported images nor by other passes,
+     *  - computes image barriers and layout transitions between passes, one pipeline barrier per pass,
+     *  - creates transient images, images whose lifetimes do not overlap share the same memory.
+     *
+     * Execute() records barriers to the primary command buffer. If there are several passes, they are recorded
+     * in parallel to secondary command buffers by workers of the shared C2D::WorkerPool, otherwise the only pass
+     * is recorded directly. Each worker has its own command pool per slot, and a pass is always recorded
+     * by the same worker.
+     *
+     * Graph has several slots of secondary command buffers, e.g. one per primary command buffer, so a slot
+     * can be re-recorded while command buffers of other slots are executed.
+     *
+     * \threadSafety Not thread-safe. Record functions of passes are called concurrently, so state that they share
+     *               must be synchronized (e.g. GpuProfiler can be used by one pass only).
+     */
+    class RenderGraph final
+    {
+    public:
+        using ResourceId = uint32_t;
+
+        /*!
+         * How a pass uses an image, determines the layout, the pipeline stage and memory access.
+         */
+        enum class Access
+        {
+            ColorAttachment,    // Read to load previous content, write to render
+            Sampled,            // Read only, by fragment shaders
+            TransferSource,     // Read only
+            TransferDestination // Write only
+        };
+
+        /*!
+         * Image which is owned outside of the graph, e.g. swap chain image. Its content is kept after the graph.
+         */
+        struct ImportedImage
+        {
+            VkImage image = VK_NULL_HANDLE;
+            VkImageView imageView = VK_NULL_HANDLE;
+            VkExtent2D extent{};
+            VkImageLayout initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            VkPipelineStageFlags initialStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT; // E.g. semaphore wait
+            VkImageLayout finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+            VkPipelineStageFlags finalStage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+            VkAccessFlags finalAccess = 0;
+        };
+
+        /*!
+         * Image which is created by the graph and lives only within it, its content is undefined at the first use.
+         */
+        struct TransientImageDescription
+        {
+            VkFormat format = VK_FORMAT_UNDEFINED;
+            VkExtent2D extent{};
+        };
+
+        class PassBuilder final
+        {
+        public:
+            void Read(ResourceId resource, Access access);
+            void Write(ResourceId resource, Access access);
+
+        private:
+            friend class RenderGraph;
+
+            PassBuilder(RenderGraph& graph, size_t pass);
+
+            RenderGraph& _graph;
+            size_t _pass;
+        };
+
+        struct PassContext
+        {
+            VkCommandBuffer commandBuffer;
+            uint32_t slot;
+            const RenderGraph& graph;
+        };
+
+        using SetupFunction = std::function<void(PassBuilder&)>;
+        using RecordFunction = std::function<void(const PassContext&)>;
+
+        struct Barrier
+        {
+            ResourceId resource;
+            VkPipelineStageFlags srcStage;
+            VkPipelineStageFlags dstStage;
+            VkAccessFlags srcAccess;
+            VkAccessFlags dstAccess;
+            VkImageLayout oldLayout;
+            VkImageLayout newLayout;
+        };
+
+        /*!
+         * Memory of a transient image, lifetime is the range of compiled passes that use it.
+         */
+        struct AliasingRequest
+        {
+            VkDeviceSize size;
+            VkDeviceSize alignment;
+            size_t firstPass;
+            size_t lastPass;
+        };
+
+        /*!
+         * Does not call Vulkan, objects are created by Compile() and Execute().
+         */
+        RenderGraph(VkDevice lDevice, const PDevice& pDevice, uint32_t queueFamilyIndex, uint32_t slotCount);
+        ~RenderGraph();
+
+        RenderGraph(const RenderGraph& other) = delete;
+        RenderGraph& operator=(const RenderGraph& other) = delete;
+
+        ResourceId ImportImage(std::string name, const ImportedImage& image);
+
+        /*!
+         * Replaces the imported image, e.g. with the next swap chain image. Compilation is not invalidated.
+         */
+        void SetImportedImage(ResourceId resource, VkImage image, VkImageView imageView);
+
+        ResourceId CreateTransientImage(std::string name, const TransientImageDescription& description);
+
+        /*!
+         * \param setup Declares resources of the pass, called immediately.
+         * \param record Records commands of the pass, called by Execute().
+         */
+        void AddPass(std::string name, const SetupFunction& setup, RecordFunction record);
+
+        void Compile();
+
+        /*!
+         * \attention Secondary command buffers of the slot must not be in use by the GPU.
+         */
+        void Execute(VkCommandBuffer commandBuffer, uint32_t slot);
+
+        [[nodiscard]]
+        VkImage GetImage(ResourceId resource) const;
+
+        [[nodiscard]]
+        VkImageView GetImageView(ResourceId resource) const;
+
+        [[nodiscard]]
+        VkExtent2D GetExtent(ResourceId resource) const;
+
+        /*!
+         * \return Names of passes that survived culling, in the execution order.
+         */
+        [[nodiscard]]
+        std::vector<std::string> GetCompiledPasses() const;
+
+        /*!
+         * \return Barriers that are recorded before the compiled pass.
+         */
+        [[nodiscard]]
+        const std::vector<Barrier>& GetPassBarriers(size_t compiledPass) const;
+
+        /*!
+         * \return Barriers that transition imported images to their final layouts after all passes.
+         */
+        [[nodiscard]]
+        const std::vector<Barrier>& GetFinalBarriers() const;
+
+        /*!
+         * \return True if passes are recorded to secondary command buffers, queries that are active in the primary
+         *         command buffer are not inherited by them.
+         */
+        [[nodiscard]]
+        bool UsesSecondaryCommandBuffers() const;
+
+        [[nodiscard]]
+        VkDeviceSize GetTransientMemorySize() const;
+
+        /*!
+         * Places blocks with overlapping lifetimes at non-overlapping offsets, largest blocks first.
+         *
+         * \param totalSize Size of the memory that fits all blocks.
+         * \return Offset of each block.
+         */
+        [[nodiscard]]
+        static std::vector<VkDeviceSize> AssignMemoryOffsets(const std::vector<AliasingRequest>& requests,
+                                                             VkDeviceSize& totalSize);
+
+    private:
+        struct Use
+        {
+            ResourceId resource;
+            Access access;
+            bool isWrite;
+        };
+
+        struct Pass
+        {
+            std::string name;
+            RecordFunction record;
+            std::vector<Use> uses;
+        };
+
+        struct Resource
+        {
+            std::string name;
+            bool isImported = false;
+            ImportedImage imported;
+            TransientImageDescription description;
+            VkImage image = VK_NULL_HANDLE;
+            VkImageView imageView = VK_NULL_HANDLE;
+            VkImageUsageFlags usage = 0;
+            VkDeviceSize memoryOffset = 0;
+            VkDeviceSize memorySize = 0;
+            size_t firstPass = 0;
+            size_t lastPass = 0;
+            bool isUsed = false;
+        };
+
+        struct CompiledPass
+        {
+            size_t pass;
+            std::vector<Barrier> barriers;
+        };
+
+        void CullPasses();
+        void CalcLifetimes();
+        void CreateTransientImages();
+        void CalcBarriers();
+        void RecordSecondaryCommandBuffer(size_t compiledPass, uint32_t slot);
+        void CreateSecondaryCommandBuffers();
+        void DestroyTransientImages();
+        void DestroySecondaryCommandBuffers();
+
+        static void RecordBarriers(VkCommandBuffer commandBuffer,
+                                   const std::vector<Barrier>& barriers,
+                                   const std::vector<Resource>& resources);
+
+        VkDevice _lDevice;
+        const PDevice& _pDevice;
+        uint32_t _queueFamilyIndex;
+        uint32_t _slotCount;
+
+        std::vector<Resource> _resources;
+        std::vector<Pass> _passes;
+        std::vector<CompiledPass> _compiledPasses;
+        std::vector<Barrier> _finalBarriers;
+        bool _isCompiled = false;
+
+        VkDeviceMemory _transientMemory = VK_NULL_HANDLE;
+        VkDeviceSize _transientMemorySize = 0;
+
+        std::vector<VkCommandPool> _commandPools; // One per slot and recording worker, reset once per execution
+        std::vector<VkCommandBuffer> _secondaryCommandBuffers; // One per slot and compiled pass
+        size_t _recordingWorkerCount = 0;
+    };
+}
\ No newline at end of file
@@ -5,7 +5,7 @@ using namespace VkWrapper;
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-RenderPass::RenderPass(VkDevice lDevice, VkFormat swapChainImageFormat)
+RenderPass::RenderPass(VkDevice lDevice, VkFormat swapChainImageFormat, VkImageLayout finalLayout)
 : _lDevice(lDevice)
 {
     VkAttachmentDescription colorAttachment =
@@ -17,7 +17,7 @@ RenderPass::RenderPass(VkDevice lDevice, VkFormat swapChainImageFormat)
         .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
         .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
         .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-        .finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+        .finalLayout = finalLayout
     };
 
     VkAttachmentReference colorAttachmentRef =
@@ -33,15 +33,27 @@ RenderPass::RenderPass(VkDevice lDevice, VkFormat swapChainImageFormat)
         .pColorAttachments = &colorAttachmentRef
     };
 
-    VkSubpassDependency dependency =
+    VkSubpassDependency dependencies[] =
     {
-        .srcSubpass = VK_SUBPASS_EXTERNAL,
-        .dstSubpass = 0,
-        .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-        .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-        .srcAccessMask = 0,
-        .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+        {
+            .srcSubpass = VK_SUBPASS_EXTERNAL,
+            .dstSubpass = 0,
+            .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+            .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+            .srcAccessMask = 0,
+            .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+        },
+        // Images which are read back must be visible to transfer commands after the pass
+        {
+            .srcSubpass = 0,
+            .dstSubpass = VK_SUBPASS_EXTERNAL,
+            .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+            .dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT,
+            .srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT
+        }
     };
+    const uint32_t dependencyCount = finalLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL ? 2 : 1;
 
     VkRenderPassCreateInfo createInfo =
     {
@@ -50,8 +62,8 @@ RenderPass::RenderPass(VkDevice lDevice, VkFormat swapChainImageFormat)
         .pAttachments = &colorAttachment,
         .subpassCount = 1,
         .pSubpasses = &subpass,
-        .dependencyCount = 1,
-        .pDependencies = &dependency
+        .dependencyCount = dependencyCount,
+        .pDependencies = dependencies
     };
 
     Assert(vkCreateRenderPass(_lDevice, &createInfo, nullptr, &_renderPass) == VK_SUCCESS,
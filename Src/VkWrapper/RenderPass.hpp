@@ -6,7 +6,13 @@ namespace VkWrapper
     class RenderPass final
     {
     public:
-        RenderPass(VkDevice lDevice, VkFormat swapChainImageFormat);
+        /*!
+         * \param finalLayout Layout of the color attachment after the pass, e.g. the transfer source layout
+         *                    for offscreen images that are read back.
+         */
+        RenderPass(VkDevice lDevice,
+                   VkFormat swapChainImageFormat,
+                   VkImageLayout finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
         ~RenderPass();
 
         [[nodiscard]]
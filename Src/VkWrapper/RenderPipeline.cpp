@@ -7,7 +7,7 @@ using namespace VkWrapper;
 
 namespace
 {
-    constexpr int maxFramesInFlight = 2;
+    constexpr VkClearValue clearValue = {{{0.0f, 0.0f, 0.0f, 1.0f}}};
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -16,24 +16,44 @@ RenderPipeline::RenderPipeline(const std::unique_ptr<LDevice>& lDevice,
                                const SuitablePDevice& suitablePDevice,
                                const PipelineShader& pipelineShader,
                                std::reference_wrapper<std::unique_ptr<SwapChain>> swapChain,
-                               std::reference_wrapper<std::unique_ptr<SwapChainImageViews>> swapChainImageViews)
+                               std::reference_wrapper<std::unique_ptr<SwapChainImageViews>> swapChainImageViews,
+                               uint32_t framesInFlight)
 : _lDevice(lDevice)
 , _suitablePDevice(suitablePDevice)
 , _pipelineShader(pipelineShader)
-, _swapChain(swapChain)
-, _swapChainImageViews(swapChainImageViews)
+, _swapChain(&swapChain.get())
+, _swapChainImageViews(&swapChainImageViews.get())
+, _frameScheduler(_lDevice->GetHandle(), framesInFlight)
 {
-    CreateNewRenderPipeline();
+    CreateRenderPassAndGraphicsPipeline();
+    CreateTargetDependentResources();
+    CreateSynchronizationObjects();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+RenderPipeline::RenderPipeline(const std::unique_ptr<LDevice>& lDevice,
+                               const SuitablePDevice& suitablePDevice,
+                               const PipelineShader& pipelineShader,
+                               const OffscreenTarget& offscreenTarget,
+                               uint32_t framesInFlight)
+: _lDevice(lDevice)
+, _suitablePDevice(suitablePDevice)
+, _pipelineShader(pipelineShader)
+, _offscreenTarget(&offscreenTarget)
+, _frameScheduler(_lDevice->GetHandle(), framesInFlight)
+{
+    CreateRenderPassAndGraphicsPipeline();
+    CreateTargetDependentResources();
+    CreateSynchronizationObjects();
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
 void RenderPipeline::Clean()
 {
-    _commandBuffers.reset();
+    _renderGraph.reset();
     _framebuffers.reset();
-    _graphicsPipeline.reset();
-    _renderPass.reset();
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -41,47 +61,158 @@ void RenderPipeline::Clean()
 void RenderPipeline::Recreate(std::reference_wrapper<std::unique_ptr<SwapChain>> swapChain,
                               std::reference_wrapper<std::unique_ptr<SwapChainImageViews>> swapChainImageViews)
 {
-    _swapChain = swapChain;
-    _swapChainImageViews = _swapChainImageViews;
+    Assert(_offscreenTarget == nullptr, "Swap chain can not be recreated in the headless mode");
+
+    _swapChain = &swapChain.get();
+    _swapChainImageViews = &swapChainImageViews.get();
+
+    // Render pass (and the pipeline that is bound to it or to the attachment format) depends only on the image
+    // format, viewport and scissor are dynamic, so in most cases they survive the recreation
+    if (GetTargetImageFormat() != _renderPassFormat)
+    {
+        _graphicsPipeline.reset();
+        _renderPass.reset();
+        _dynamicRendering.reset();
+        CreateRenderPassAndGraphicsPipeline();
+    }
+
+    CreateTargetDependentResources();
+
+    // Images of the new swap chain are not used by any frame yet
+    _imageInFlight.assign(GetTargetImageViews().size(), 0);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderPipeline::RebuildGraphicsPipeline()
+{
+    auto graphicsPipeline = CreateGraphicsPipeline();
 
-    CreateNewRenderPipeline();
+    // The old pipeline and command buffers can be touched only when no frame uses them
+    _frameScheduler.WaitForSubmittedFrames();
+    _graphicsPipeline = std::move(graphicsPipeline);
+    RecordCommandBuffers();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderPipeline::SetDrawParameters(const DrawParameters& drawParameters)
+{
+    _drawParameters = drawParameters;
+
+    _frameScheduler.WaitForSubmittedFrames();
+    RecordCommandBuffers();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderPipeline::SetFramesInFlight(uint32_t framesInFlight)
+{
+    _frameScheduler.WaitForSubmittedFrames();
+    _frameScheduler.SetFramesInFlight(framesInFlight);
+    CreateSynchronizationObjects();
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
 VkResult RenderPipeline::DrawFrame()
+{
+    return _offscreenTarget != nullptr ? DrawOffscreenFrame() : DrawSwapChainFrame();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::vector<uint8_t> RenderPipeline::ReadBackLastFrame() const
+{
+    Assert(_offscreenTarget != nullptr, "Frames can be read back only in the headless mode");
+
+    return _offscreenTarget->ReadBack(_lastImageIndex, _commandPool->GetHandle(), _lDevice->GetGraphicsQueue());
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const RenderPipeline::FrameTimings& RenderPipeline::GetFrameTimings() const
+{
+    return _frameTimings;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+FrameScheduler& RenderPipeline::GetFrameScheduler()
+{
+    return _frameScheduler;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const FrameScheduler& RenderPipeline::GetFrameScheduler() const
+{
+    return _frameScheduler;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const GpuProfiler& RenderPipeline::GetGpuProfiler() const
+{
+    return *_gpuProfiler;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkResult RenderPipeline::DrawSwapChainFrame()
 {
     auto lDeviceHandle = _lDevice->GetHandle();
+    const auto& swapChain = *_swapChain;
 
-    // Wait for the current fence
-    vkWaitForFences(lDeviceHandle, 1, &_inFlightFences[_currentFrame]->GetHandle(), VK_TRUE, UINT64_MAX);
+    // Wait until the frame that used the same synchronization objects is finished
+    const auto frameNumber = _frameScheduler.BeginFrame();
+    const auto frameSlot = _frameScheduler.GetFrameSlot(frameNumber);
 
     // Acquire next image and wait 'til it is ready to use
+    const auto acquireStart = std::chrono::steady_clock::now();
     uint32_t imageIndex;
     auto result = vkAcquireNextImageKHR(lDeviceHandle,
-                                        _swapChain.get()->GetHandle(),
+                                        swapChain->GetHandle(),
                                         UINT64_MAX,
-                                        _imageAvailableSemaphores[_currentFrame]->GetHandle(),
+                                        _imageAvailableSemaphores[frameSlot]->GetHandle(),
                                         VK_NULL_HANDLE,
                                         &imageIndex);
+    _frameTimings.acquire = std::chrono::steady_clock::now() - acquireStart;
     if (result == VK_ERROR_OUT_OF_DATE_KHR)
     {
         return result;
     }
 
-    if (_imageInFlight[imageIndex] != VK_NULL_HANDLE)
+    // Image can still be used by a frame from another slot if there are more images than frames in flight.
+    // Once that frame is finished, its GPU zones can be read without waiting
+    _frameScheduler.WaitForFrame(_imageInFlight[imageIndex]);
+    if (_imageInFlight[imageIndex] != 0)
     {
-        vkWaitForFences(lDeviceHandle, 1, &_imageInFlight[imageIndex], VK_TRUE, UINT64_MAX);
+        _gpuProfiler->CollectResults(imageIndex);
     }
-    _imageInFlight[imageIndex] = _inFlightFences[_currentFrame]->GetHandle();
+    _imageInFlight[imageIndex] = frameNumber;
 
-    // Submitting the command buffer
-    VkSemaphore waitSemaphores[] = { _imageAvailableSemaphores[_currentFrame]->GetHandle() };
+    // Submitting the command buffer, the timeline semaphore is signaled with the number of the frame.
+    // Values of binary semaphores are ignored
+    const auto submitStart = std::chrono::steady_clock::now();
+    VkSemaphore waitSemaphores[] = { _imageAvailableSemaphores[frameSlot]->GetHandle() };
     VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    VkSemaphore signalSemaphores[] = { _renderFinishedSemaphores[_currentFrame]->GetHandle() };
+    const uint64_t waitValues[] = { 0 };
+    VkSemaphore signalSemaphores[] = { _renderFinishedSemaphores[frameSlot]->GetHandle(),
+                                       _frameScheduler.GetTimelineSemaphore() };
+    const uint64_t signalValues[] = { 0, frameNumber };
+    VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+        .waitSemaphoreValueCount = static_cast<uint32_t>(std::size(waitValues)),
+        .pWaitSemaphoreValues = waitValues,
+        .signalSemaphoreValueCount = static_cast<uint32_t>(std::size(signalValues)),
+        .pSignalSemaphoreValues = signalValues
+    };
     VkSubmitInfo submitInfo =
     {
         .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = &timelineSubmitInfo,
         .waitSemaphoreCount = static_cast<uint32_t>(std::size(waitSemaphores)),
         .pWaitSemaphores = waitSemaphores,
         .pWaitDstStageMask = waitStages,
@@ -90,82 +221,287 @@ VkResult RenderPipeline::DrawFrame()
         .signalSemaphoreCount = static_cast<uint32_t>(std::size(signalSemaphores)),
         .pSignalSemaphores = signalSemaphores
     };
-    vkResetFences(lDeviceHandle, 1, &_inFlightFences[_currentFrame]->GetHandle());
-    Assert(vkQueueSubmit(_lDevice->GetGraphicsQueue(),
-                         1,
-                         &submitInfo,
-                         _inFlightFences[_currentFrame]->GetHandle()) == VK_SUCCESS,
+    Assert(vkQueueSubmit(_lDevice->GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE) == VK_SUCCESS,
            "Failed to submit draw command buffer");
+    _frameScheduler.EndFrame(frameNumber);
+    _frameTimings.record = std::chrono::nanoseconds::zero();
+    _frameTimings.submit = std::chrono::steady_clock::now() - submitStart;
+    _lastImageIndex = imageIndex;
 
-    // Present a new frame
-    VkSwapchainKHR swapChains[] = { _swapChain.get()->GetHandle() };
+    // Present a new frame, it waits only for the binary semaphore
+    VkSwapchainKHR swapChains[] = { swapChain->GetHandle() };
     VkPresentInfoKHR presentInfo =
     {
         .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
-        .waitSemaphoreCount = std::size(signalSemaphores),
+        .waitSemaphoreCount = 1,
         .pWaitSemaphores = signalSemaphores,
         .swapchainCount = std::size(swapChains),
         .pSwapchains = swapChains,
         .pImageIndices = &imageIndex,
         .pResults = nullptr
     };
+    const auto presentStart = std::chrono::steady_clock::now();
     result = vkQueuePresentKHR(_lDevice->GetPresentQueue(), &presentInfo); // TODO: Handle later
-    _currentFrame = (_currentFrame + 1) % maxFramesInFlight;
+    _frameTimings.present = std::chrono::steady_clock::now() - presentStart;
 
     return result;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-void RenderPipeline::CreateNewRenderPipeline()
+VkResult RenderPipeline::DrawOffscreenFrame()
+{
+    const auto frameNumber = _frameScheduler.BeginFrame();
+
+    // Images are used in turn, so the image is free when the frame that used it last time is finished
+    const auto imageIndex = static_cast<uint32_t>(frameNumber % _imageInFlight.size());
+    _frameScheduler.WaitForFrame(_imageInFlight[imageIndex]);
+    if (_imageInFlight[imageIndex] != 0)
+    {
+        _gpuProfiler->CollectResults(imageIndex);
+    }
+    _imageInFlight[imageIndex] = frameNumber;
+
+    // Commands are recorded every frame as it would be done for dynamic content
+    const auto recordStart = std::chrono::steady_clock::now();
+    RecordCommandBuffer(imageIndex);
+    const auto submitStart = std::chrono::steady_clock::now();
+
+    VkSemaphore signalSemaphores[] = { _frameScheduler.GetTimelineSemaphore() };
+    const uint64_t signalValues[] = { frameNumber };
+    VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+        .signalSemaphoreValueCount = static_cast<uint32_t>(std::size(signalValues)),
+        .pSignalSemaphoreValues = signalValues
+    };
+    VkSubmitInfo submitInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = &timelineSubmitInfo,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &_commandBuffers->GetCommandBuffers()[imageIndex],
+        .signalSemaphoreCount = static_cast<uint32_t>(std::size(signalSemaphores)),
+        .pSignalSemaphores = signalSemaphores
+    };
+    Assert(vkQueueSubmit(_lDevice->GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE) == VK_SUCCESS,
+           "Failed to submit draw command buffer");
+    _frameScheduler.EndFrame(frameNumber);
+
+    const auto submitEnd = std::chrono::steady_clock::now();
+    _frameTimings.acquire = std::chrono::nanoseconds::zero();
+    _frameTimings.record = submitStart - recordStart;
+    _frameTimings.submit = submitEnd - submitStart;
+    _frameTimings.present = std::chrono::nanoseconds::zero();
+    _lastImageIndex = imageIndex;
+
+    return VK_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkFormat RenderPipeline::GetTargetImageFormat() const
+{
+    return _offscreenTarget != nullptr ? _offscreenTarget->GetImageFormat() : (*_swapChain)->GetImageFormat();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkExtent2D RenderPipeline::GetTargetExtent() const
+{
+    return _offscreenTarget != nullptr ? _offscreenTarget->GetExtent() : (*_swapChain)->GetExtent();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::vector<VkImage>& RenderPipeline::GetTargetImages() const
+{
+    return _offscreenTarget != nullptr ? _offscreenTarget->GetImages() : (*_swapChain)->GetImages();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const std::vector<VkImageView>& RenderPipeline::GetTargetImageViews() const
+{
+    return _offscreenTarget != nullptr ? _offscreenTarget->GetImageViews() : (*_swapChainImageViews)->GetImageViews();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::unique_ptr<GraphicsPipeline> RenderPipeline::CreateGraphicsPipeline() const
+{
+    if (_dynamicRendering)
+    {
+        return std::make_unique<GraphicsPipeline>(_lDevice->GetHandle(), _pipelineShader, _renderPassFormat);
+    }
+
+    return std::make_unique<GraphicsPipeline>(_lDevice->GetHandle(), _pipelineShader, _renderPass->GetHandle());
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderPipeline::CreateRenderPassAndGraphicsPipeline()
 {
     auto lDeviceHandle = _lDevice->GetHandle();
-    auto swapChainExtent = _swapChain.get()->GetExtent();
-
-    // Graphics
-    _renderPass = std::make_unique<RenderPass>(lDeviceHandle, _swapChain.get()->GetImageFormat());
-    auto renderPassHandle = _renderPass->GetHandle();
-    _graphicsPipeline = std::make_unique<GraphicsPipeline>(lDeviceHandle,
-                                                           _pipelineShader,
-                                                           swapChainExtent,
-                                                           renderPassHandle);
-    _framebuffers = std::make_unique<Framebuffers>(lDeviceHandle,
-                                                   *(_swapChainImageViews.get()),
-                                                   renderPassHandle,
-                                                   swapChainExtent);
+
+    _renderPassFormat = GetTargetImageFormat();
+    if (_suitablePDevice.IsDynamicRenderingSupported())
+    {
+        _dynamicRendering = std::make_unique<DynamicRendering>(lDeviceHandle);
+    }
+    else
+    {
+        // Offscreen images are left in the layout from which they can be read back
+        const auto finalLayout = _offscreenTarget != nullptr ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+                                                             : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        _renderPass = std::make_unique<RenderPass>(lDeviceHandle, _renderPassFormat, finalLayout);
+    }
+    _graphicsPipeline = CreateGraphicsPipeline();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderPipeline::CreateTargetDependentResources()
+{
+    auto lDeviceHandle = _lDevice->GetHandle();
+
+    // With dynamic rendering commands refer to image views directly
+    if (!_dynamicRendering)
+    {
+        _framebuffers = std::make_unique<Framebuffers>(lDeviceHandle,
+                                                       GetTargetImageViews(),
+                                                       _renderPass->GetHandle(),
+                                                       GetTargetExtent());
+    }
+    else
+    {
+        CreateRenderGraph();
+    }
 
     // Commands
     if (!_commandPool)
     {
         _commandPool = std::make_unique<CommandPool>(
                 lDeviceHandle,
-                _suitablePDevice.GetQueueFamilyIndices().GetGraphicsFamily().value());
-    }
-    _commandBuffers = std::make_unique<CommandBuffers>(lDeviceHandle,
-                                                       _framebuffers->GetFramebuffers().size(),
-                                                       _commandPool->GetHandle(),
-                                                       renderPassHandle,
-                                                       _framebuffers->GetFramebuffers(),
-                                                       swapChainExtent,
-                                                       _graphicsPipeline->GetHandle());
-
-    // Clean synchronization stuff
-    _imageAvailableSemaphores.clear();
-    _renderFinishedSemaphores.clear();
-    _inFlightFences.clear();
-    _imageInFlight.clear();
-
-    // Create synchronization stuff
-    _imageAvailableSemaphores.resize(maxFramesInFlight);
-    _renderFinishedSemaphores.resize(maxFramesInFlight);
-    _inFlightFences.resize(maxFramesInFlight);
-    _imageInFlight.resize(_swapChain.get()->GetImages().size(), VK_NULL_HANDLE);
-    for (size_t i = 0; i < maxFramesInFlight; ++i)
+                _suitablePDevice.GetQueueFamilyIndices().GetGraphicsFamily().value(),
+                VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    }
+
+    // Command buffers are reallocated only if the number of swap chain images was changed,
+    // the profiler has one query range per command buffer, so it follows them
+    const auto imageCount = GetTargetImageViews().size();
+    if (!_commandBuffers || _commandBuffers->GetCommandBuffers().size() != imageCount)
+    {
+        _commandBuffers.reset();
+        _commandBuffers = std::make_unique<CommandBuffers>(lDeviceHandle, imageCount, _commandPool->GetHandle());
+        _gpuProfiler.reset();
+        _gpuProfiler = std::make_unique<GpuProfiler>(
+                lDeviceHandle,
+                _suitablePDevice.GetPDevice(),
+                _suitablePDevice.GetQueueFamilyIndices().GetGraphicsFamily().value(),
+                _lDevice->GetGraphicsQueue(),
+                static_cast<uint32_t>(imageCount));
+    }
+    RecordCommandBuffers();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderPipeline::CreateSynchronizationObjects()
+{
+    auto lDeviceHandle = _lDevice->GetHandle();
+    const auto framesInFlight = _frameScheduler.GetFramesInFlight();
+
+    _imageInFlight.resize(GetTargetImageViews().size(), 0);
+
+    // Binary semaphores are required only by the swap chain, one set per frame in flight
+    if (_offscreenTarget != nullptr)
+    {
+        return;
+    }
+
+    _imageAvailableSemaphores.resize(framesInFlight);
+    _renderFinishedSemaphores.resize(framesInFlight);
+    for (size_t i = 0; i < framesInFlight; ++i)
     {
         _imageAvailableSemaphores[i] = std::make_unique<Semaphore>(lDeviceHandle);
         _renderFinishedSemaphores[i] = std::make_unique<Semaphore>(lDeviceHandle);
-        _inFlightFences[i] = std::make_unique<Fence>(lDeviceHandle);
     }
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderPipeline::CreateRenderGraph()
+{
+    const auto imageCount = static_cast<uint32_t>(GetTargetImageViews().size());
+    _renderGraph = std::make_unique<RenderGraph>(_lDevice->GetHandle(),
+                                                 _suitablePDevice.GetPDevice(),
+                                                 _suitablePDevice.GetQueueFamilyIndices().GetGraphicsFamily().value(),
+                                                 imageCount);
+
+    // Target image is set before each recording. Offscreen images are left in the layout from which they can be
+    // read back, swap chain images are presented after the semaphore
+    RenderGraph::ImportedImage target = { .extent = GetTargetExtent() };
+    if (_offscreenTarget != nullptr)
+    {
+        target.finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        target.finalStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        target.finalAccess = VK_ACCESS_TRANSFER_READ_BIT;
+    }
+    _targetResource = _renderGraph->ImportImage("Target", target);
+
+    // Pipeline and draw parameters are read when commands are recorded, so their changes need only re-recording
+    _renderGraph->AddPass("Sprites",
+                          [this](RenderGraph::PassBuilder& builder)
+                          {
+                              builder.Write(_targetResource, RenderGraph::Access::ColorAttachment);
+                          },
+                          [this](const RenderGraph::PassContext& context)
+                          {
+                              const auto extent = context.graph.GetExtent(_targetResource);
+                              _dynamicRendering->Begin(context.commandBuffer,
+                                                       context.graph.GetImageView(_targetResource),
+                                                       extent,
+                                                       clearValue);
+                              CommandBuffers::RecordDraw(context.commandBuffer,
+                                                         extent,
+                                                         _graphicsPipeline->GetHandle(),
+                                                         _drawParameters,
+                                                         _gpuProfiler.get(),
+                                                         context.slot);
+                              _dynamicRendering->End(context.commandBuffer);
+                          });
+    _renderGraph->Compile();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderPipeline::RecordCommandBuffers()
+{
+    for (size_t i = 0; i < _commandBuffers->GetCommandBuffers().size(); ++i)
+    {
+        RecordCommandBuffer(i);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void RenderPipeline::RecordCommandBuffer(size_t index)
+{
+    if (_renderGraph)
+    {
+        _renderGraph->SetImportedImage(_targetResource, GetTargetImages()[index], GetTargetImageViews()[index]);
+        _commandBuffers->Record(index, *_renderGraph, _gpuProfiler.get());
+        return;
+    }
+
+    _commandBuffers->Record(index,
+                            _renderPass->GetHandle(),
+                            _framebuffers->GetFramebuffers()[index],
+                            GetTargetExtent(),
+                            _graphicsPipeline->GetHandle(),
+                            _drawParameters,
+                            _gpuProfiler.get());
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
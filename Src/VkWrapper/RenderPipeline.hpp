@@ -1,53 +1,172 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <chrono>
 #include <VkWrapper/LDevice.hpp>
 #include <VkWrapper/SwapChain.hpp>
 #include <VkWrapper/SwapChainImageViews.hpp>
+#include <VkWrapper/OffscreenTarget.hpp>
 #include <VkWrapper/RenderPass.hpp>
 #include <VkWrapper/GraphicsPipeline.hpp>
 #include <VkWrapper/Framebuffers.hpp>
 #include <VkWrapper/CommandPool.hpp>
 #include <VkWrapper/CommandBuffers.hpp>
+#include <VkWrapper/DynamicRendering.hpp>
+#include <VkWrapper/RenderGraph/RenderGraph.hpp>
 #include <VkWrapper/Semaphore.hpp>
-#include <VkWrapper/Fence.hpp>
+#include <VkWrapper/FrameScheduler.hpp>
+#include <VkWrapper/GpuProfiler.hpp>
 
 namespace VkWrapper
 {
+    /*!
+     * Renders frames to the swap chain or to the offscreen target. If the device supports dynamic rendering,
+     * frames are described by the render graph whose passes render directly to image views, so only command buffers
+     * depend on the target images. Otherwise a render pass and framebuffers are used.
+     */
     class RenderPipeline final
     {
     public:
+        struct FrameTimings
+        {
+            std::chrono::nanoseconds acquire = std::chrono::nanoseconds::zero();
+            std::chrono::nanoseconds record = std::chrono::nanoseconds::zero();
+            std::chrono::nanoseconds submit = std::chrono::nanoseconds::zero();
+            std::chrono::nanoseconds present = std::chrono::nanoseconds::zero();
+        };
+
         RenderPipeline(const std::unique_ptr<LDevice>& lDevice,
                        const SuitablePDevice& suitablePDevice,
                        const PipelineShader& pipelineShader,
                        std::reference_wrapper<std::unique_ptr<SwapChain>> swapChain,
-                       std::reference_wrapper<std::unique_ptr<SwapChainImageViews>> swapChainImageViews);
+                       std::reference_wrapper<std::unique_ptr<SwapChainImageViews>> swapChainImageViews,
+                       uint32_t framesInFlight);
+
+        /*!
+         * Creates the pipeline for the headless mode. Frames are rendered to the images of the target in turn.
+         */
+        RenderPipeline(const std::unique_ptr<LDevice>& lDevice,
+                       const SuitablePDevice& suitablePDevice,
+                       const PipelineShader& pipelineShader,
+                       const OffscreenTarget& offscreenTarget,
+                       uint32_t framesInFlight);
 
+        /*!
+         * Releases resources that depend on the images of the current swap chain.
+         * Must be called before the swap chain image views are destroyed.
+         */
         void Clean();
 
+        /*!
+         * Rebuilds only resources that depend on the new swap chain images (framebuffers if dynamic rendering is
+         * not available and recorded commands).
+         * Render pass and graphics pipeline are reused unless the image format of the swap chain was changed.
+         */
         void Recreate(std::reference_wrapper<std::unique_ptr<SwapChain>> swapChain,
                       std::reference_wrapper<std::unique_ptr<SwapChainImageViews>> swapChainImageViews);
 
+        /*!
+         * Rebuilds the graphics pipeline from the current state of the pipeline shader (e.g. after a hot reload).
+         * The new pipeline is created while previous frames are still being rendered, so the only wait is for
+         * the frames in flight before command buffers are re-recorded.
+         */
+        void RebuildGraphicsPipeline();
+
+        /*!
+         * Changes the number of vertices and instances that are drawn every frame.
+         */
+        void SetDrawParameters(const DrawParameters& drawParameters);
+
+        /*!
+         * Recreates per-frame synchronization objects for the new number of frames in flight.
+         *
+         * \attention The device must be idle, binary semaphores can still be used by the presentation engine
+         *            after the frame is completed.
+         */
+        void SetFramesInFlight(uint32_t framesInFlight);
+
         VkResult DrawFrame();
 
+        /*!
+         * Copies the image of the last submitted frame to the host memory. Available only in the headless mode.
+         *
+         * \attention Blocks until the frame is rendered.
+         */
+        [[nodiscard]]
+        std::vector<uint8_t> ReadBackLastFrame() const;
+
+        /*!
+         * \return CPU time spent on the acquisition, recording, submission and presentation of the last frame.
+         *         Command buffers for the swap chain are recorded in advance, so the record time is not zero only
+         *         in the headless mode where commands are recorded every frame. There is nothing to acquire and
+         *         present in the headless mode. In the FIFO mode the acquire or present time includes
+         *         waiting for the vertical blank.
+         */
+        [[nodiscard]]
+        const FrameTimings& GetFrameTimings() const;
+
+        [[nodiscard]]
+        FrameScheduler& GetFrameScheduler();
+
+        [[nodiscard]]
+        const FrameScheduler& GetFrameScheduler() const;
+
+        /*!
+         * \return Profiler with GPU times of the last finished frame. Results lag behind by the number of images,
+         *         because they are read only when the image is reused.
+         */
+        [[nodiscard]]
+        const GpuProfiler& GetGpuProfiler() const;
+
     private:
-        void CreateNewRenderPipeline();
+        VkResult DrawSwapChainFrame();
+        VkResult DrawOffscreenFrame();
+
+        [[nodiscard]]
+        VkFormat GetTargetImageFormat() const;
+
+        [[nodiscard]]
+        VkExtent2D GetTargetExtent() const;
+
+        [[nodiscard]]
+        const std::vector<VkImage>& GetTargetImages() const;
+
+        [[nodiscard]]
+        const std::vector<VkImageView>& GetTargetImageViews() const;
+
+        [[nodiscard]]
+        std::unique_ptr<GraphicsPipeline> CreateGraphicsPipeline() const;
+
+        void CreateRenderPassAndGraphicsPipeline();
+        void CreateTargetDependentResources();
+        void CreateSynchronizationObjects();
+        void CreateRenderGraph();
+        void RecordCommandBuffers();
+        void RecordCommandBuffer(size_t index);
 
         const std::unique_ptr<LDevice>& _lDevice;
         const SuitablePDevice& _suitablePDevice;
         const PipelineShader& _pipelineShader;
-        std::reference_wrapper<std::unique_ptr<SwapChain>> _swapChain;
-        std::reference_wrapper<std::unique_ptr<SwapChainImageViews>> _swapChainImageViews;
+        std::unique_ptr<SwapChain>* _swapChain = nullptr;
+        std::unique_ptr<SwapChainImageViews>* _swapChainImageViews = nullptr;
+        const OffscreenTarget* _offscreenTarget = nullptr;
 
+        VkFormat _renderPassFormat = VK_FORMAT_UNDEFINED;
+        std::unique_ptr<DynamicRendering> _dynamicRendering;
         std::unique_ptr<RenderPass> _renderPass;
         std::unique_ptr<GraphicsPipeline> _graphicsPipeline;
         std::unique_ptr<Framebuffers> _framebuffers;
         std::unique_ptr<CommandPool> _commandPool;
         std::unique_ptr<CommandBuffers> _commandBuffers;
+        std::unique_ptr<GpuProfiler> _gpuProfiler;
+        std::unique_ptr<RenderGraph> _renderGraph;
+        RenderGraph::ResourceId _targetResource = 0;
+        DrawParameters _drawParameters;
+        FrameScheduler _frameScheduler;
+        FrameTimings _frameTimings;
         std::vector<std::unique_ptr<Semaphore>> _imageAvailableSemaphores;
         std::vector<std::unique_ptr<Semaphore>> _renderFinishedSemaphores;
-        std::vector<std::unique_ptr<Fence>> _inFlightFences;
-        std::vector<VkFence> _imageInFlight;
-        size_t _currentFrame = 0;
+        std::vector<uint64_t> _imageInFlight; // Number of the last frame that rendered to the image
+        uint32_t _lastImageIndex = 0;
     };
 }
\ No newline at end of file
@@ -1,42 +1,40 @@
 #include "Shader.hpp"
-#include <filesystem>
-#include <fstream>
-#include <iostream>
 #include <Utility/Assert.hpp>
-#include <Tracer/TraceScopeTimer.hpp>
 
 using namespace VkWrapper;
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-Shader::Shader(Type type, std::string_view shaderName)
-: _pathToShaderSrc(shaderName)
-, _pathToShaderCompiled(shaderName)
+Shader::Shader(Type type, std::vector<uint32_t>&& byteCode)
+: _type(type)
+, _byteCode(std::move(byteCode))
 {
+    Assert(!_byteCode.empty(), "Shader byte code is empty");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::string Shader::GetSourcePath(Type type, std::string_view shaderName)
+{
+    std::string path(shaderName);
     switch (type)
     {
         case Type::Vertex:
-            _pathToShaderSrc += ".vert";
-            _pathToShaderCompiled += "Vert.spv";
+            path += ".vert";
             break;
         case Type::Fragment:
-            _pathToShaderSrc += ".frag";
-            _pathToShaderCompiled += "Frag.spv";
+            path += ".frag";
             break;
     }
 
-    std::filesystem::path shaderCompiled = _pathToShaderCompiled;
-    if (std::filesystem::exists(shaderCompiled))
-    {
-        Load();
-        return;
-    }
+    return path;
+}
 
-    std::filesystem::path shaderSrc = _pathToShaderSrc;
-    Assert(std::filesystem::exists(shaderSrc), "Specified shader does not exist");
+// ---------------------------------------------------------------------------------------------------------------------
 
-    Compile();
-    Load();
+Shader::Type Shader::GetType() const
+{
+    return _type;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -46,38 +44,13 @@ VkShaderModule Shader::CreateModule(VkDevice lDevice) const
     VkShaderModuleCreateInfo createInfo =
     {
         .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-        .codeSize = _byteCode.size(),
-        .pCode = reinterpret_cast<const uint32_t*>(_byteCode.data())
+        .codeSize = _byteCode.size() * sizeof(uint32_t),
+        .pCode = _byteCode.data()
     };
     VkShaderModule shaderModule;
-    Assert(vkCreateShaderModule(lDevice, &createInfo, nullptr, &shaderModule) == VK_SUCCESS, "");
+    Assert(vkCreateShaderModule(lDevice, &createInfo, nullptr, &shaderModule) == VK_SUCCESS,
+           "Failed to create shader module");
     return shaderModule;
 }
 
-// ---------------------------------------------------------------------------------------------------------------------
-
-void Shader::Compile()
-{
-    TraceIt;
-
-    std::stringstream stringStream;
-    stringStream << "glslc.exe " << _pathToShaderSrc<< " -o " << _pathToShaderCompiled;
-    std::system(stringStream.str().c_str());
-}
-
-// ---------------------------------------------------------------------------------------------------------------------
-
-void Shader::Load()
-{
-    TraceIt;
-
-    std::ifstream file(_pathToShaderCompiled.c_str(), std::ios::ate | std::ios::binary);
-    size_t fileSize = static_cast<size_t>(file.tellg());
-    _byteCode.resize(fileSize);
-    file.seekg(0);
-    file.read(_byteCode.data(), fileSize);
-
-    file.close();
-}
-
 // ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -14,17 +14,19 @@ namespace VkWrapper
             Fragment
         };
 
-        explicit Shader(Type type, std::string_view shaderName);
+        Shader(Type type, std::vector<uint32_t>&& byteCode);
+
+        [[nodiscard]]
+        static std::string GetSourcePath(Type type, std::string_view shaderName);
+
+        [[nodiscard]]
+        Type GetType() const;
 
         [[nodiscard]]
         VkShaderModule CreateModule(VkDevice lDevice) const;
 
     private:
-        void Compile();
-        void Load();
-
-        std::string _pathToShaderSrc;
-        std::string _pathToShaderCompiled;
-        std::vector<char> _byteCode;
+        Type _type;
+        std::vector<uint32_t> _byteCode;
     };
 }
\ No newline at end of file
@@ -0,0 +1,258 @@
+#include "ShaderCompiler.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <atomic>
+#include <thread>
+#ifdef C2D_USE_SHADERC
+#include <shaderc/shaderc.hpp>
+#endif
+#include <Logger/Logger.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+#ifdef C2D_USE_SHADERC
+    constexpr std::string_view compilerId = "shaderc";
+#else
+    constexpr std::string_view compilerId = "glslc";
+#endif
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    std::string_view GetStageName(Shader::Type type)
+    {
+        switch (type)
+        {
+            case Shader::Type::Vertex:
+                return "vert";
+            case Shader::Type::Fragment:
+                return "frag";
+        }
+
+        return "unknown";
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    // FNV-1a, good enough to distinguish sources and much cheaper than cryptographic hashes
+    uint64_t CalculateHash(std::string_view data, uint64_t hash = 14695981039346656037ull)
+    {
+        for (const auto symbol : data)
+        {
+            hash ^= static_cast<uint8_t>(symbol);
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    bool ReadFile(const std::filesystem::path& path, std::string& content)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        std::stringstream stream;
+        stream << file.rdbuf();
+        content = stream.str();
+
+        return true;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    std::vector<uint32_t> ReadByteCode(const std::filesystem::path& path)
+    {
+        std::vector<uint32_t> byteCode;
+
+        std::ifstream file(path, std::ios::ate | std::ios::binary);
+        if (file.is_open())
+        {
+            const auto fileSize = static_cast<size_t>(file.tellg());
+            byteCode.resize(fileSize / sizeof(uint32_t));
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(byteCode.data()), static_cast<std::streamsize>(fileSize));
+        }
+
+        return byteCode;
+    }
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+    void WriteByteCode(const std::filesystem::path& path, const std::vector<uint32_t>& byteCode)
+    {
+        // Write to the temporary file first so other threads or processes never read a half-written cache entry
+        static std::atomic_uint32_t tempCounter = 0;
+        std::stringstream tempName;
+        tempName << path.filename().string() << '.' << std::this_thread::get_id() << '.' << tempCounter++ << ".tmp";
+        const auto tempPath = path.parent_path() / tempName.str();
+
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(byteCode.data()),
+                       static_cast<std::streamsize>(byteCode.size() * sizeof(uint32_t)));
+        }
+
+        std::error_code errorCode;
+        std::filesystem::rename(tempPath, path, errorCode);
+        if (errorCode)
+        {
+            std::filesystem::remove(tempPath, errorCode);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool ShaderCompiler::Result::IsSuccessful() const
+{
+    return !byteCode.empty();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+ShaderCompiler::ShaderCompiler(std::filesystem::path cacheDirectory)
+: _cacheDirectory(std::move(cacheDirectory))
+{
+    std::error_code errorCode;
+    std::filesystem::create_directories(_cacheDirectory, errorCode);
+    if (errorCode)
+    {
+        Logger::LogWarning("Failed to create shader cache directory: " + errorCode.message(), __PRETTY_FUNCTION__);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+ShaderCompiler::Result ShaderCompiler::Compile(Shader::Type type, const std::filesystem::path& sourcePath) const
+{
+    TraceIt;
+
+    Result result;
+
+    std::string source;
+    if (!ReadFile(sourcePath, source))
+    {
+        result.log = "Failed to read shader source " + sourcePath.string();
+        return result;
+    }
+
+    // Use already compiled byte code if the source was not changed
+    const auto cachedPath = GetCachedPath(type, source);
+    result.byteCode = ReadByteCode(cachedPath);
+    if (result.IsSuccessful())
+    {
+        return result;
+    }
+
+    result = CompileSource(type, source, sourcePath);
+    if (result.IsSuccessful())
+    {
+        WriteByteCode(cachedPath, result.byteCode);
+    }
+
+    return result;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+ShaderCompiler::Result ShaderCompiler::CompileSource(Shader::Type type,
+                                                     const std::string& source,
+                                                     const std::filesystem::path& sourcePath)
+{
+    Result result;
+
+#ifdef C2D_USE_SHADERC
+    shaderc::Compiler compiler;
+    shaderc::CompileOptions options;
+    options.SetOptimizationLevel(shaderc_optimization_level_performance);
+
+    const auto kind = (type == Shader::Type::Vertex) ? shaderc_glsl_vertex_shader : shaderc_glsl_fragment_shader;
+    const auto module = compiler.CompileGlslToSpv(source, kind, sourcePath.string().c_str(), options);
+    result.log = module.GetErrorMessage();
+    if (module.GetCompilationStatus() == shaderc_compilation_status_success)
+    {
+        result.byteCode.assign(module.cbegin(), module.cend());
+    }
+#else
+    // Compile exactly the source that was hashed, even if the original file is being edited at the moment
+    static std::atomic_uint32_t outputCounter = 0;
+    std::stringstream outputName;
+    outputName << "c2d_" << std::this_thread::get_id() << '_' << outputCounter++ << ".spv";
+    const auto outputPath = std::filesystem::temp_directory_path() / outputName.str();
+    const auto inputPath = outputPath.string() + ".glsl";
+    {
+        std::ofstream input(inputPath, std::ios::binary | std::ios::trunc);
+        input << source;
+    }
+
+    std::stringstream command;
+    command << compilerId << " -O -fshader-stage=" << GetStageName(type)
+            << " \"" << inputPath << "\" -o \"" << outputPath.string() << "\" 2>&1";
+
+#ifdef _WIN32
+    auto* process = _popen(command.str().c_str(), "r");
+#else
+    auto* process = popen(command.str().c_str(), "r");
+#endif
+    if (process != nullptr)
+    {
+        char buffer[256];
+        while (std::fgets(buffer, sizeof(buffer), process) != nullptr)
+        {
+            result.log += buffer;
+        }
+#ifdef _WIN32
+        const auto exitCode = _pclose(process);
+#else
+        const auto exitCode = pclose(process);
+#endif
+        if (exitCode == 0)
+        {
+            result.byteCode = ReadByteCode(outputPath);
+        }
+    }
+    else
+    {
+        result.log = "Failed to run " + std::string(compilerId);
+    }
+
+    std::error_code errorCode;
+    std::filesystem::remove(outputPath, errorCode);
+    std::filesystem::remove(inputPath, errorCode);
+#endif
+
+    if (!result.IsSuccessful())
+    {
+        result.log = sourcePath.string() + ":\n" + result.log;
+    }
+
+    return result;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::filesystem::path ShaderCompiler::GetCachedPath(Shader::Type type, const std::string& source) const
+{
+    // Stage and compiler are the part of the key, so the same source used in different ways does not collide
+    auto hash = CalculateHash(compilerId);
+    hash = CalculateHash(GetStageName(type), hash);
+    hash = CalculateHash(source, hash);
+
+    std::stringstream fileName;
+    fileName << std::hex << std::setw(16) << std::setfill('0') << hash << ".spv";
+
+    return _cacheDirectory / fileName.str();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <VkWrapper/Shader/Shader.hpp>
+
+namespace VkWrapper
+{
+    /*!
+     * Compiles GLSL sources to SPIR-V.
+     *
+     * Uses libshaderc in-process if it was found at configuration time, otherwise runs glslc and captures its output.
+     * Compiled byte code is stored in the cache directory under the hash of the source, so unchanged shaders
+     * are never compiled twice.
+     *
+     * \threadSafety Thread-safe. Compile() can be called from any thread simultaneously.
+     */
+    class ShaderCompiler final
+    {
+    public:
+        struct Result
+        {
+            std::vector<uint32_t> byteCode;
+            std::string log;
+
+            [[nodiscard]]
+            bool IsSuccessful() const;
+        };
+
+        explicit ShaderCompiler(std::filesystem::path cacheDirectory);
+
+        [[nodiscard]]
+        Result Compile(Shader::Type type, const std::filesystem::path& sourcePath) const;
+
+    private:
+        [[nodiscard]]
+        static Result CompileSource(Shader::Type type,
+                                    const std::string& source,
+                                    const std::filesystem::path& sourcePath);
+
+        [[nodiscard]]
+        std::filesystem::path GetCachedPath(Shader::Type type, const std::string& source) const;
+
+        std::filesystem::path _cacheDirectory;
+    };
+}
\ No newline at end of file
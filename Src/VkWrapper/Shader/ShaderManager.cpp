@@ -1,19 +1,171 @@
 #include "ShaderManager.hpp"
+#include <Logger/Logger.hpp>
+#include <Utility/Assert.hpp>
 
 using namespace VkWrapper;
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+ShaderManager::ShaderManager(const std::vector<std::string>& shadersList, std::filesystem::path cacheDirectory)
+: _compiler(std::move(cacheDirectory))
+{
+    for (const auto& shaderName : shadersList)
+    {
+        _watchedShaders.emplace(shaderName, GetSourcesWriteTime(shaderName));
+        _pendingShaders.emplace(shaderName,
+                                std::async(std::launch::async, &ShaderManager::BuildPipelineShader, this, shaderName));
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+ShaderManager::~ShaderManager()
+{
+    _isWatching = false;
+    if (_watcher.joinable())
+    {
+        _watcher.join();
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 const PipelineShader& ShaderManager::GetPipelineShader(const std::string& shaderName)
 {
     auto position = _pipelineShaders.find(shaderName);
-    if (position == _pipelineShaders.end())
+    if (position != _pipelineShaders.end())
+    {
+        return position->second;
+    }
+
+    std::optional<PipelineShader> pipelineShader;
+    auto pendingPosition = _pendingShaders.find(shaderName);
+    if (pendingPosition != _pendingShaders.end())
     {
-        auto [shaderIter, added] = _pipelineShaders.emplace(shaderName, PipelineShader(shaderName));
-        return shaderIter->second;
+        pipelineShader = pendingPosition->second.get();
+        _pendingShaders.erase(pendingPosition);
+    }
+    else
+    {
+        Logger::LogWarning("Shader '" + shaderName + "' was not preloaded, compiling it on the calling thread",
+                           __PRETTY_FUNCTION__);
+        pipelineShader = BuildPipelineShader(shaderName);
+
+        std::lock_guard lock(_watchMutex);
+        _watchedShaders.emplace(shaderName, GetSourcesWriteTime(shaderName));
     }
 
-    return position->second;
+    Assert(pipelineShader.has_value(), "Failed to build pipeline shader");
+
+    auto [shaderIter, added] = _pipelineShaders.emplace(shaderName, std::move(*pipelineShader));
+    return shaderIter->second;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void ShaderManager::EnableHotReload(std::chrono::milliseconds checkInterval)
+{
+    if (_isWatching.exchange(true))
+    {
+        return;
+    }
+
+    _watcher = std::thread(&ShaderManager::WatchSources, this, checkInterval);
+    Logger::LogInfo("Shader hot reload is enabled", __PRETTY_FUNCTION__);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::vector<std::string> ShaderManager::ApplyReloadedShaders()
+{
+    std::vector<std::string> reloadedNames;
+
+    std::unique_lock lock(_watchMutex, std::try_to_lock);
+    if (!lock.owns_lock() || _reloadedShaders.empty())
+    {
+        return reloadedNames;
+    }
+    auto reloadedShaders = std::move(_reloadedShaders);
+    _reloadedShaders.clear();
+    lock.unlock();
+
+    for (auto& [shaderName, pipelineShader] : reloadedShaders)
+    {
+        // Assignment keeps the node, so references that were handed out by GetPipelineShader() stay valid
+        _pipelineShaders.insert_or_assign(shaderName, std::move(pipelineShader));
+        reloadedNames.push_back(std::move(shaderName));
+    }
+
+    return reloadedNames;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+std::optional<PipelineShader> ShaderManager::BuildPipelineShader(const std::string& shaderName) const
+{
+    auto vertexResult = _compiler.Compile(Shader::Type::Vertex, Shader::GetSourcePath(Shader::Type::Vertex, shaderName));
+    auto fragmentResult = _compiler.Compile(Shader::Type::Fragment,
+                                            Shader::GetSourcePath(Shader::Type::Fragment, shaderName));
+
+    if (!vertexResult.IsSuccessful() || !fragmentResult.IsSuccessful())
+    {
+        Logger::LogError("Failed to compile shader '" + shaderName + "'\n" + vertexResult.log + fragmentResult.log,
+                         __PRETTY_FUNCTION__);
+        return std::nullopt;
+    }
+
+    return PipelineShader(Shader(Shader::Type::Vertex, std::move(vertexResult.byteCode)),
+                          Shader(Shader::Type::Fragment, std::move(fragmentResult.byteCode)));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+ShaderManager::SourcesWriteTime ShaderManager::GetSourcesWriteTime(const std::string& shaderName)
+{
+    std::error_code errorCode;
+    const auto vertexTime = std::filesystem::last_write_time(Shader::GetSourcePath(Shader::Type::Vertex, shaderName),
+                                                             errorCode);
+    const auto fragmentTime = std::filesystem::last_write_time(
+            Shader::GetSourcePath(Shader::Type::Fragment, shaderName),
+            errorCode);
+
+    return { vertexTime, fragmentTime };
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void ShaderManager::WatchSources(std::chrono::milliseconds checkInterval)
+{
+    while (_isWatching)
+    {
+        std::this_thread::sleep_for(checkInterval);
+
+        // Copy the list so compilation does not block the owning thread
+        std::unique_lock lock(_watchMutex);
+        auto watchedShaders = _watchedShaders;
+        lock.unlock();
+
+        for (auto& [shaderName, writeTime] : watchedShaders)
+        {
+            const auto newWriteTime = GetSourcesWriteTime(shaderName);
+            if (newWriteTime == writeTime)
+            {
+                continue;
+            }
+
+            Logger::LogInfo("Shader '" + shaderName + "' was changed, recompiling it", __PRETTY_FUNCTION__);
+            // A broken shader is reported by BuildPipelineShader() and the old version stays in use
+            auto pipelineShader = BuildPipelineShader(shaderName);
+
+            lock.lock();
+            _watchedShaders[shaderName] = newWriteTime;
+            if (pipelineShader.has_value())
+            {
+                _reloadedShaders.emplace_back(shaderName, std::move(*pipelineShader));
+            }
+            lock.unlock();
+        }
+    }
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -1,16 +1,73 @@
 #pragma once
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <chrono>
+#include <optional>
+#include <filesystem>
 #include <unordered_map>
 #include <VkWrapper/PipelineShader.hpp>
+#include <VkWrapper/Shader/ShaderCompiler.hpp>
 
 namespace VkWrapper
 {
+    /*!
+     * Owns all pipeline shaders of the application.
+     *
+     * Shaders from the list are compiled on background threads right after construction, so by the time
+     * the first frame needs them they are usually ready. Optionally, the manager can watch shader sources and
+     * recompile them in the background when they are changed; recompiled shaders are applied on the owning thread
+     * only via ApplyReloadedShaders(), so rendering never waits for the compiler.
+     *
+     * \threadSafety Not thread-safe. Everything except the background work must be called from the owning thread.
+     */
     class ShaderManager final
     {
     public:
+        explicit ShaderManager(const std::vector<std::string>& shadersList,
+                               std::filesystem::path cacheDirectory = "./ShaderCache");
+        ~ShaderManager();
+
+        /*!
+         * Gets the pipeline shader. Blocks only if the shader is still being compiled or was not preloaded.
+         * The returned reference stays valid for the lifetime of the manager, reloads update it in place.
+         */
         [[nodiscard]]
         const PipelineShader& GetPipelineShader(const std::string& shaderName);
 
+        /*!
+         * Starts watching sources of all known shaders for changes.
+         */
+        void EnableHotReload(std::chrono::milliseconds checkInterval = std::chrono::milliseconds(500));
+
+        /*!
+         * Replaces shaders that were recompiled in the background since the last call.
+         * Never blocks: if the watcher holds the lock at the moment, shaders will be applied on the next call.
+         *
+         * \return Names of the shaders that were replaced.
+         */
+        std::vector<std::string> ApplyReloadedShaders();
+
     private:
+        using SourcesWriteTime = std::pair<std::filesystem::file_time_type, std::filesystem::file_time_type>;
+
+        [[nodiscard]]
+        std::optional<PipelineShader> BuildPipelineShader(const std::string& shaderName) const;
+
+        [[nodiscard]]
+        static SourcesWriteTime GetSourcesWriteTime(const std::string& shaderName);
+
+        void WatchSources(std::chrono::milliseconds checkInterval);
+
+        ShaderCompiler _compiler;
         std::unordered_map<std::string, PipelineShader> _pipelineShaders;
+        std::unordered_map<std::string, std::future<std::optional<PipelineShader>>> _pendingShaders;
+
+        std::mutex _watchMutex;
+        std::unordered_map<std::string, SourcesWriteTime> _watchedShaders;
+        std::vector<std::pair<std::string, PipelineShader>> _reloadedShaders;
+        std::atomic_bool _isWatching = false;
+        std::thread _watcher;
     };
 }
\ No newline at end of file
@@ -0,0 +1,374 @@
+#include "StagingUploader.hpp"
+#include <Utility/Assert.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+    void SubmitWithTimeline(VkQueue queue,
+                            VkCommandBuffer commandBuffer,
+                            const TimelineSemaphore* waitSemaphore,
+                            uint64_t waitValue,
+                            const TimelineSemaphore& signalSemaphore,
+                            uint64_t signalValue)
+    {
+        VkSemaphore waitHandle = waitSemaphore != nullptr ? waitSemaphore->GetHandle() : VK_NULL_HANDLE;
+        VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        VkSemaphore signalHandle = signalSemaphore.GetHandle();
+        VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo =
+        {
+            .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+            .waitSemaphoreValueCount = waitSemaphore != nullptr ? 1u : 0u,
+            .pWaitSemaphoreValues = &waitValue,
+            .signalSemaphoreValueCount = 1,
+            .pSignalSemaphoreValues = &signalValue
+        };
+        VkSubmitInfo submitInfo =
+        {
+            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            .pNext = &timelineSubmitInfo,
+            .waitSemaphoreCount = waitSemaphore != nullptr ? 1u : 0u,
+            .pWaitSemaphores = &waitHandle,
+            .pWaitDstStageMask = &waitStage,
+            .commandBufferCount = 1,
+            .pCommandBuffers = &commandBuffer,
+            .signalSemaphoreCount = 1,
+            .pSignalSemaphores = &signalHandle
+        };
+
+        Assert(vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE) == VK_SUCCESS, "Failed to submit upload commands");
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+StagingUploader::StagingUploader(const LDevice& lDevice, const SuitablePDevice& suitablePDevice)
+: _lDevice(lDevice)
+, _pDevice(suitablePDevice.GetPDevice())
+, _graphicsFamily(suitablePDevice.GetQueueFamilyIndices().GetGraphicsFamily().value())
+, _transferFamily(suitablePDevice.GetQueueFamilyIndices().GetTransferFamily().value_or(_graphicsFamily))
+, _transferCommandPool(lDevice.GetHandle(), _transferFamily, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT)
+, _transferSemaphore(lDevice.GetHandle())
+, _completionSemaphore(lDevice.GetHandle())
+{
+    TraceIt;
+
+    // Acquire barriers are recorded to the command buffers of the graphics family
+    if (HasDedicatedTransferQueue())
+    {
+        _graphicsCommandPool = std::make_unique<CommandPool>(lDevice.GetHandle(),
+                                                             _graphicsFamily,
+                                                             VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+StagingUploader::~StagingUploader()
+{
+    WaitForBatch(_submittedBatch);
+    ReleaseCompletedBatches();
+    FreeBatch(_recordingBatch);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void StagingUploader::UploadBuffer(VkBuffer dstBuffer, const void* data, VkDeviceSize size, VkDeviceSize dstOffset)
+{
+    const auto& stagingBuffer = CreateStagingBuffer(data, size);
+    auto commandBuffer = GetRecordingCommandBuffer();
+
+    VkBufferCopy region =
+    {
+        .srcOffset = 0,
+        .dstOffset = dstOffset,
+        .size = size
+    };
+    vkCmdCopyBuffer(commandBuffer, stagingBuffer.GetHandle(), dstBuffer, 1, &region);
+
+    _bufferBarriers.push_back(
+    {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+        .buffer = dstBuffer,
+        .offset = dstOffset,
+        .size = size
+    });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void StagingUploader::UploadImage(VkImage dstImage,
+                                  const void* data,
+                                  VkDeviceSize size,
+                                  VkExtent3D extent,
+                                  VkImageLayout finalLayout)
+{
+    const auto& stagingBuffer = CreateStagingBuffer(data, size);
+    auto commandBuffer = GetRecordingCommandBuffer();
+
+    const VkImageSubresourceRange subresourceRange =
+    {
+        .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .baseMipLevel = 0,
+        .levelCount = 1,
+        .baseArrayLayer = 0,
+        .layerCount = 1
+    };
+
+    // The old content is discarded, so the image can be transitioned from the undefined layout
+    VkImageMemoryBarrier toTransferBarrier =
+    {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .srcAccessMask = 0,
+        .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = dstImage,
+        .subresourceRange = subresourceRange
+    };
+    vkCmdPipelineBarrier(commandBuffer,
+                         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0,
+                         0, nullptr,
+                         0, nullptr,
+                         1, &toTransferBarrier);
+
+    VkBufferImageCopy region =
+    {
+        .bufferOffset = 0,
+        .bufferRowLength = 0,
+        .bufferImageHeight = 0,
+        .imageSubresource =
+        {
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .mipLevel = 0,
+            .baseArrayLayer = 0,
+            .layerCount = 1
+        },
+        .imageOffset = { 0, 0, 0 },
+        .imageExtent = extent
+    };
+    vkCmdCopyBufferToImage(commandBuffer,
+                           stagingBuffer.GetHandle(),
+                           dstImage,
+                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                           1,
+                           &region);
+
+    // Layout transition is a part of the ownership transfer and must be the same in release and acquire barriers
+    _imageBarriers.push_back(
+    {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout = finalLayout,
+        .image = dstImage,
+        .subresourceRange = subresourceRange
+    });
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint64_t StagingUploader::Submit()
+{
+    ReleaseCompletedBatches();
+
+    if (_recordingBatch.transferCommandBuffer == VK_NULL_HANDLE)
+    {
+        return _submittedBatch;
+    }
+
+    auto& batch = _recordingBatch;
+    batch.number = _submittedBatch + 1;
+
+    RecordOwnershipBarriers(batch.transferCommandBuffer, false);
+    Assert(vkEndCommandBuffer(batch.transferCommandBuffer) == VK_SUCCESS, "Failed to record upload commands");
+
+    if (HasDedicatedTransferQueue())
+    {
+        // Copies are executed on the transfer queue, the graphics queue waits for them only on the GPU side
+        SubmitWithTimeline(_lDevice.GetTransferQueue(),
+                           batch.transferCommandBuffer,
+                           nullptr,
+                           0,
+                           _transferSemaphore,
+                           batch.number);
+
+        batch.acquireCommandBuffer = BeginCommandBuffer(_graphicsCommandPool->GetHandle());
+        RecordOwnershipBarriers(batch.acquireCommandBuffer, true);
+        Assert(vkEndCommandBuffer(batch.acquireCommandBuffer) == VK_SUCCESS, "Failed to record acquire barriers");
+        SubmitWithTimeline(_lDevice.GetGraphicsQueue(),
+                           batch.acquireCommandBuffer,
+                           &_transferSemaphore,
+                           batch.number,
+                           _completionSemaphore,
+                           batch.number);
+    }
+    else
+    {
+        SubmitWithTimeline(_lDevice.GetGraphicsQueue(),
+                           batch.transferCommandBuffer,
+                           nullptr,
+                           0,
+                           _completionSemaphore,
+                           batch.number);
+    }
+
+    _bufferBarriers.clear();
+    _imageBarriers.clear();
+    _submittedBatch = batch.number;
+    _submittedBatches.push_back(std::move(batch));
+    _recordingBatch = Batch();
+
+    return _submittedBatch;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool StagingUploader::IsBatchCompleted(uint64_t batchNumber) const
+{
+    return _completionSemaphore.GetValue() >= batchNumber;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void StagingUploader::WaitForBatch(uint64_t batchNumber) const
+{
+    Assert(batchNumber <= _submittedBatch, "Batch is not submitted");
+    Assert(_completionSemaphore.Wait(batchNumber), "Failed to wait for the upload batch");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool StagingUploader::HasDedicatedTransferQueue() const
+{
+    return _transferFamily != _graphicsFamily;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkCommandBuffer StagingUploader::GetRecordingCommandBuffer()
+{
+    if (_recordingBatch.transferCommandBuffer == VK_NULL_HANDLE)
+    {
+        _recordingBatch.transferCommandBuffer = BeginCommandBuffer(_transferCommandPool.GetHandle());
+    }
+
+    return _recordingBatch.transferCommandBuffer;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkCommandBuffer StagingUploader::BeginCommandBuffer(VkCommandPool commandPool) const
+{
+    VkCommandBufferAllocateInfo allocateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool = commandPool,
+        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = 1
+    };
+
+    VkCommandBuffer commandBuffer(VK_NULL_HANDLE);
+    Assert(vkAllocateCommandBuffers(_lDevice.GetHandle(), &allocateInfo, &commandBuffer) == VK_SUCCESS,
+           "Failed to allocate upload command buffer");
+
+    VkCommandBufferBeginInfo beginInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+    };
+    Assert(vkBeginCommandBuffer(commandBuffer, &beginInfo) == VK_SUCCESS, "Failed to begin upload command buffer");
+
+    return commandBuffer;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const Buffer& StagingUploader::CreateStagingBuffer(const void* data, VkDeviceSize size)
+{
+    auto stagingBuffer = std::make_unique<Buffer>(_lDevice.GetHandle(),
+                                                  _pDevice,
+                                                  size,
+                                                  VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                  VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    stagingBuffer->Write(data, size);
+
+    // Staging buffer lives until the batch is executed
+    return *_recordingBatch.stagingBuffers.emplace_back(std::move(stagingBuffer));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void StagingUploader::RecordOwnershipBarriers(VkCommandBuffer commandBuffer, bool isAcquire)
+{
+    const bool isOwnershipTransfer = HasDedicatedTransferQueue();
+    const uint32_t srcFamily = isOwnershipTransfer ? _transferFamily : VK_QUEUE_FAMILY_IGNORED;
+    const uint32_t dstFamily = isOwnershipTransfer ? _graphicsFamily : VK_QUEUE_FAMILY_IGNORED;
+
+    // Release barrier makes the writes available, acquire one makes them visible.
+    // Without the ownership transfer one barrier does both
+    VkAccessFlags srcAccess = isAcquire ? 0 : VK_ACCESS_TRANSFER_WRITE_BIT;
+    VkAccessFlags dstAccess = isOwnershipTransfer && !isAcquire ? 0 : VK_ACCESS_MEMORY_READ_BIT;
+    VkPipelineStageFlags srcStage = isAcquire ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_TRANSFER_BIT;
+    VkPipelineStageFlags dstStage = isOwnershipTransfer && !isAcquire ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT
+                                                                      : VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+    for (auto& barrier : _bufferBarriers)
+    {
+        barrier.srcAccessMask = srcAccess;
+        barrier.dstAccessMask = dstAccess;
+        barrier.srcQueueFamilyIndex = srcFamily;
+        barrier.dstQueueFamilyIndex = dstFamily;
+    }
+    for (auto& barrier : _imageBarriers)
+    {
+        barrier.srcAccessMask = srcAccess;
+        barrier.dstAccessMask = dstAccess;
+        barrier.srcQueueFamilyIndex = srcFamily;
+        barrier.dstQueueFamilyIndex = dstFamily;
+    }
+
+    vkCmdPipelineBarrier(commandBuffer,
+                         srcStage,
+                         dstStage,
+                         0,
+                         0, nullptr,
+                         static_cast<uint32_t>(_bufferBarriers.size()), _bufferBarriers.data(),
+                         static_cast<uint32_t>(_imageBarriers.size()), _imageBarriers.data());
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void StagingUploader::FreeBatch(Batch& batch) const
+{
+    if (batch.transferCommandBuffer != VK_NULL_HANDLE)
+    {
+        vkFreeCommandBuffers(_lDevice.GetHandle(), _transferCommandPool.GetHandle(), 1, &batch.transferCommandBuffer);
+    }
+    if (batch.acquireCommandBuffer != VK_NULL_HANDLE)
+    {
+        vkFreeCommandBuffers(_lDevice.GetHandle(), _graphicsCommandPool->GetHandle(), 1, &batch.acquireCommandBuffer);
+    }
+    batch.stagingBuffers.clear();
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void StagingUploader::ReleaseCompletedBatches()
+{
+    const auto completedBatch = _completionSemaphore.GetValue();
+    while (!_submittedBatches.empty() && _submittedBatches.front().number <= completedBatch)
+    {
+        FreeBatch(_submittedBatches.front());
+        _submittedBatches.pop_front();
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+#include <deque>
+#include <memory>
+#include <vector>
+#include <vulkan/vulkan.h>
+#include <VkWrapper/LDevice.hpp>
+#include <VkWrapper/CommandPool.hpp>
+#include <VkWrapper/Buffer.hpp>
+#include <VkWrapper/TimelineSemaphore.hpp>
+
+namespace VkWrapper
+{
+    /*!
+     * Copies data to device local buffers and images through host visible staging buffers.
+     *
+     * Uploads are recorded into a batch which is executed by Submit(). If the device has a dedicated transfer
+     * family, copies are executed on the transfer queue and the ownership of the resources is transferred to
+     * the graphics family (release barriers on the transfer queue, acquire barriers on the graphics queue),
+     * so streaming of the content does not take time of the graphics queue. Otherwise everything is executed
+     * on the graphics queue with a simple memory barrier.
+     *
+     * \attention The acquire part is submitted to the graphics queue, so Submit() must be called from the thread
+     *            that submits rendering commands. Resources must be created with the exclusive sharing mode.
+     */
+    class StagingUploader final
+    {
+    public:
+        StagingUploader(const LDevice& lDevice, const SuitablePDevice& suitablePDevice);
+        ~StagingUploader();
+
+        /*!
+         * Records a copy of the data to the buffer. The buffer must have the transfer destination usage.
+         */
+        void UploadBuffer(VkBuffer dstBuffer, const void* data, VkDeviceSize size, VkDeviceSize dstOffset = 0);
+
+        /*!
+         * Records a copy of the tightly packed data to the first mip level and layer of the color image.
+         * The previous content of the image is discarded.
+         *
+         * \param finalLayout Layout in which the image is left after the upload.
+         */
+        void UploadImage(VkImage dstImage,
+                         const void* data,
+                         VkDeviceSize size,
+                         VkExtent3D extent,
+                         VkImageLayout finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+        /*!
+         * Submits all recorded uploads. Commands submitted to the graphics queue after this call see
+         * the uploaded data.
+         *
+         * \return Number of the batch or number of the last submitted batch if nothing was recorded.
+         */
+        uint64_t Submit();
+
+        [[nodiscard]]
+        bool IsBatchCompleted(uint64_t batchNumber) const;
+
+        void WaitForBatch(uint64_t batchNumber) const;
+
+        [[nodiscard]]
+        bool HasDedicatedTransferQueue() const;
+
+    private:
+        struct Batch
+        {
+            uint64_t number = 0;
+            VkCommandBuffer transferCommandBuffer = VK_NULL_HANDLE;
+            VkCommandBuffer acquireCommandBuffer = VK_NULL_HANDLE;
+            std::vector<std::unique_ptr<Buffer>> stagingBuffers;
+        };
+
+        VkCommandBuffer GetRecordingCommandBuffer();
+        VkCommandBuffer BeginCommandBuffer(VkCommandPool commandPool) const;
+        const Buffer& CreateStagingBuffer(const void* data, VkDeviceSize size);
+        void RecordOwnershipBarriers(VkCommandBuffer commandBuffer, bool isAcquire);
+        void FreeBatch(Batch& batch) const;
+        void ReleaseCompletedBatches();
+
+        const LDevice& _lDevice;
+        const PDevice& _pDevice;
+        uint32_t _graphicsFamily;
+        uint32_t _transferFamily;
+        CommandPool _transferCommandPool;
+        std::unique_ptr<CommandPool> _graphicsCommandPool;
+        TimelineSemaphore _transferSemaphore;
+        TimelineSemaphore _completionSemaphore;
+
+        Batch _recordingBatch;
+        std::vector<VkBufferMemoryBarrier> _bufferBarriers;
+        std::vector<VkImageMemoryBarrier> _imageBarriers;
+        std::deque<Batch> _submittedBatches;
+        uint64_t _submittedBatch = 0;
+    };
+}
\ No newline at end of file
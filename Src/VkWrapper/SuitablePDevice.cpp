@@ -1,4 +1,5 @@
 #include "SuitablePDevice.hpp"
+#include "DynamicRendering.hpp"
 #include <cstring>
 #include <Logger/Logger.hpp>
 #include <Utility/Assert.hpp>
@@ -8,14 +9,23 @@ using namespace VkWrapper;
 // ---------------------------------------------------------------------------------------------------------------------
 
 SuitablePDevice::SuitablePDevice(const PDevice& device,
-                                 const Surface& surface,
+                                 const Surface* surface,
                                  QueueFamilyIndices&& queueFamilyIndices,
                                  const std::vector<const char*>& requiredExtensions)
 : _device(device)
 , _surface(surface)
 , _queueFamilyIndices(std::move(queueFamilyIndices))
 , _requiredDeviceExtensions(requiredExtensions)
-{ }
+, _isDynamicRenderingSupported(DynamicRendering::IsSupported(device))
+{
+    if (_isDynamicRenderingSupported)
+    {
+        const auto& dynamicRenderingExtensions = DynamicRendering::GetRequiredExtensions();
+        _requiredDeviceExtensions.insert(_requiredDeviceExtensions.end(),
+                                         dynamicRenderingExtensions.begin(),
+                                         dynamicRenderingExtensions.end());
+    }
+}
 
 // ---------------------------------------------------------------------------------------------------------------------
 
@@ -40,20 +50,30 @@ const std::vector<const char*>& SuitablePDevice::GetRequiredDeviceExtensions() c
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+bool SuitablePDevice::IsDynamicRenderingSupported() const
+{
+    return _isDynamicRenderingSupported;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 SwapChainDetails SuitablePDevice::GetSwapChainDetails() const
 {
-    return SwapChainDetails(_device.GetHandle(), _surface.GetHandle());
+    Assert(_surface != nullptr, "Swap chain is not available in the headless mode");
+    return SwapChainDetails(_device.GetHandle(), _surface->GetHandle());
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
 namespace
 {
-    const std::vector<const char*> requiredDeviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+    const std::vector<const char*> requiredDeviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME,
+                                                                VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME };
+    const std::vector<const char*> requiredHeadlessDeviceExtensions = { VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME };
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-    bool CheckDeviceExtensionSupport(const PDevice& pDevice)
+    bool CheckDeviceExtensionSupport(const PDevice& pDevice, const std::vector<const char*>& requiredDeviceExtensions)
     {
         bool allPresent(true);
         for (const auto& requiredExtension : requiredDeviceExtensions)
@@ -83,21 +103,29 @@ namespace
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-std::vector<SuitablePDevice> VkWrapper::GetSuitablePDevicesForSurface(const std::vector<PDevice>& pDevices,
-                                                                      const Surface& surface)
+std::vector<SuitablePDevice> VkWrapper::GetSuitablePDevices(const std::vector<PDevice>& pDevices,
+                                                            const Surface* surface)
 {
+    const auto& requiredExtensions = surface != nullptr ? requiredDeviceExtensions : requiredHeadlessDeviceExtensions;
+
     std::vector<SuitablePDevice> suitableDevices;
     for (const auto& device : pDevices)
     {
         QueueFamilyIndices queueFamilyIndices(device.GetHandle(), surface);
-        SwapChainDetails swapChainDetails(device.GetHandle(), surface.GetHandle());
-        if (queueFamilyIndices.IsComplete() && CheckDeviceExtensionSupport(device) && swapChainDetails.IsAdequate())
+        if (!queueFamilyIndices.IsComplete() || !CheckDeviceExtensionSupport(device, requiredExtensions))
         {
-            suitableDevices.emplace_back(SuitablePDevice(device,
-                                                         surface,
-                                                         std::move(queueFamilyIndices),
-                                                         requiredDeviceExtensions));
+            continue;
         }
+
+        if (surface != nullptr && !SwapChainDetails(device.GetHandle(), surface->GetHandle()).IsAdequate())
+        {
+            continue;
+        }
+
+        suitableDevices.emplace_back(SuitablePDevice(device,
+                                                     surface,
+                                                     std::move(queueFamilyIndices),
+                                                     requiredExtensions));
     }
 
     Assert(!suitableDevices.empty(), "There are no suitable devices for the specified surface");
@@ -8,7 +8,7 @@ namespace VkWrapper
     {
     public:
         SuitablePDevice(const PDevice& device,
-                        const Surface& surface,
+                        const Surface* surface,
                         QueueFamilyIndices&& queueFamilyIndices,
                         const std::vector<const char*>& requiredExtensions);
 
@@ -18,20 +18,36 @@ namespace VkWrapper
         [[nodiscard]]
         const QueueFamilyIndices& GetQueueFamilyIndices() const;
 
+        /*!
+         * \return Extensions which must be enabled, optional extensions supported by the device are included.
+         */
         [[nodiscard]]
         const std::vector<const char*>& GetRequiredDeviceExtensions() const;
 
+        /*!
+         * \return True if frames can be rendered without render pass and framebuffer objects (see DynamicRendering).
+         */
+        [[nodiscard]]
+        bool IsDynamicRenderingSupported() const;
+
+        /*!
+         * \attention Must not be called for devices selected for the headless mode.
+         */
         [[nodiscard]]
         SwapChainDetails GetSwapChainDetails() const;
 
     private:
         const PDevice& _device;
-        const Surface& _surface;
+        const Surface* _surface;
         QueueFamilyIndices _queueFamilyIndices;
-        const std::vector<const char*>& _requiredDeviceExtensions;
+        std::vector<const char*> _requiredDeviceExtensions;
+        bool _isDynamicRenderingSupported;
     };
 
-    std::vector<SuitablePDevice> GetSuitablePDevicesForSurface(const std::vector<PDevice>& pDevices,
-                                                               const Surface& surface);
+    /*!
+     * \param surface Surface to which images are presented or nullptr if devices are selected for the headless mode,
+     *                in that case neither present support nor swap chain extension are required.
+     */
+    std::vector<SuitablePDevice> GetSuitablePDevices(const std::vector<PDevice>& pDevices, const Surface* surface);
 }
 
@@ -1,6 +1,9 @@
 #include "SwapChain.hpp"
 #include <Utility/Assert.hpp>
 #include <Tracer/TraceScopeTimer.hpp>
+#include <Logger/Logger.hpp>
+#include <algorithm>
+#include <string>
 
 using namespace VkWrapper;
 
@@ -9,7 +12,9 @@ using namespace VkWrapper;
 SwapChain::SwapChain(VkDevice lDevice,
                      VkSurfaceKHR surface,
                      const SuitablePDevice& pDevice,
-                     const GLFWWrapper::Window& window)
+                     VkExtent2D frameBufferExtent,
+                     const PresentConfiguration& presentConfiguration,
+                     VkSwapchainKHR oldSwapChain)
 : _lDevice(lDevice)
 {
     TraceIt;
@@ -20,14 +25,9 @@ SwapChain::SwapChain(VkDevice lDevice,
     auto swapChainDetail = pDevice.GetSwapChainDetails();
     const auto& surfaceFormat = ChooseSwapSurfaceFormat(swapChainDetail.GetFormats());
     _imageFormat = surfaceFormat.format;
-    const auto presentMode = ChooseSwapPresentMode(swapChainDetail.GetPresentModes());
-    _extent = ChooseSwapExtent(swapChainDetail.GetCapabilities(), window);
-
-    // Get image counter
-    uint32_t imageCount = swapChainDetail.GetCapabilities().minImageCount + 1;
-    std::clamp(imageCount,
-               swapChainDetail.GetCapabilities().minImageCount,
-               swapChainDetail.GetCapabilities().maxImageCount);
+    _presentMode = ChooseSwapPresentMode(swapChainDetail.GetPresentModes(), presentConfiguration.policy);
+    _extent = ChooseSwapExtent(swapChainDetail.GetCapabilities(), frameBufferExtent);
+    uint32_t imageCount = ChooseImageCount(swapChainDetail.GetCapabilities(), presentConfiguration.imageCount);
 
     // Create createInfo for swap chain
     VkSwapchainCreateInfoKHR createInfo{};
@@ -58,9 +58,10 @@ SwapChain::SwapChain(VkDevice lDevice,
     }
     createInfo.preTransform = swapChainDetail.GetCapabilities().currentTransform;
     createInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
-    createInfo.presentMode = presentMode;
+    createInfo.presentMode = _presentMode;
     createInfo.clipped = VK_TRUE; // Turn it off if all pixels should be readable to create final image
-    createInfo.oldSwapchain = VK_NULL_HANDLE;
+    // Handing over the old swap chain lets the driver reuse its resources and keep presenting already acquired images
+    createInfo.oldSwapchain = oldSwapChain;
 
     Assert(vkCreateSwapchainKHR(_lDevice, &createInfo, nullptr, &_swapChain) == VK_SUCCESS,
            "Failed to create swap chain");
@@ -69,6 +70,9 @@ SwapChain::SwapChain(VkDevice lDevice,
     vkGetSwapchainImagesKHR(_lDevice, _swapChain, &imageCount, nullptr);
     _images.resize(imageCount);
     vkGetSwapchainImagesKHR(_lDevice, _swapChain, &imageCount, _images.data());
+
+    Logger::LogInfo("Swap chain was created with " + std::to_string(imageCount) + " images and present mode " +
+                    std::to_string(_presentMode), __PRETTY_FUNCTION__);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -101,6 +105,13 @@ const std::vector<VkImage>& SwapChain::GetImages() const
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+VkPresentModeKHR SwapChain::GetPresentMode() const
+{
+    return _presentMode;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 VkSwapchainKHR SwapChain::GetHandle() const
 {
     return _swapChain;
@@ -123,25 +134,60 @@ const VkSurfaceFormatKHR& SwapChain::ChooseSwapSurfaceFormat(const std::vector<V
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-VkPresentModeKHR SwapChain::ChooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes)
+VkPresentModeKHR SwapChain::ChooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes,
+                                                  PresentPolicy policy)
 {
-    for (const auto& presentMode : presentModes)
+    // Modes in the order of preference, the closest one to the policy in terms of latency and tearing goes first
+    std::vector<VkPresentModeKHR> preferredModes;
+    switch (policy)
+    {
+        case PresentPolicy::Immediate:
+            preferredModes = { VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_MAILBOX_KHR };
+            break;
+        case PresentPolicy::Mailbox:
+            preferredModes = { VK_PRESENT_MODE_MAILBOX_KHR };
+            break;
+        case PresentPolicy::FifoRelaxed:
+            preferredModes = { VK_PRESENT_MODE_FIFO_RELAXED_KHR };
+            break;
+        case PresentPolicy::Fifo:
+            break;
+    }
+
+    for (const auto preferredMode : preferredModes)
     {
-        if (presentMode == VK_PRESENT_MODE_MAILBOX_KHR)
+        if (std::find(presentModes.begin(), presentModes.end(), preferredMode) != presentModes.end())
         {
-            return presentMode;
+            return preferredMode;
         }
     }
 
+    // FIFO is the only mode which support is required
     return VK_PRESENT_MODE_FIFO_KHR;
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-VkExtent2D SwapChain::ChooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities, const GLFWWrapper::Window& window)
+uint32_t SwapChain::ChooseImageCount(const VkSurfaceCapabilitiesKHR& capabilities, uint32_t requestedImageCount)
 {
-    auto [width, height] = window.GetFrameBufferSize();
-    VkExtent2D extent2D = {static_cast<uint32_t>(width), static_cast<uint32_t>(height)};
+    const auto imageCount = requestedImageCount != 0 ? requestedImageCount : capabilities.minImageCount + 1;
+
+    // Zero maximum means that the number of images is not limited
+    const auto maxImageCount = capabilities.maxImageCount != 0 ? capabilities.maxImageCount : UINT32_MAX;
+    return std::clamp(imageCount, capabilities.minImageCount, maxImageCount);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkExtent2D SwapChain::ChooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities, VkExtent2D frameBufferExtent)
+{
+    // Most surfaces define the extent themselves, so it is correct even if the last resize message is not handled yet
+    if (capabilities.currentExtent.width != UINT32_MAX)
+    {
+        return capabilities.currentExtent;
+    }
+
+    VkExtent2D extent2D = frameBufferExtent;
     extent2D.width = std::max(capabilities.minImageExtent.width,
                               std::min(capabilities.maxImageExtent.width, extent2D.width));
     extent2D.height = std::max(capabilities.minImageExtent.height,
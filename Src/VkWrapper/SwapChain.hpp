@@ -1,16 +1,24 @@
 #pragma once
 #include <VkWrapper/SuitablePDevice.hpp>
-#include <GLFWWrapper/Window.hpp>
+#include <VkWrapper/PresentConfiguration.hpp>
 
 namespace VkWrapper
 {
     class SwapChain final
     {
     public:
+        /*!
+         * \param frameBufferExtent Size of the window frame buffer, used only if the surface does not define it.
+         *                          It is passed instead of the window, so the swap chain can be recreated
+         *                          on the render thread without calls to GLFW.
+         * \param presentConfiguration Present policy and number of images, frames in flight are not used.
+         */
         SwapChain(VkDevice lDevice,
                   VkSurfaceKHR surface,
                   const SuitablePDevice& pDevice,
-                  const GLFWWrapper::Window& window);
+                  VkExtent2D frameBufferExtent,
+                  const PresentConfiguration& presentConfiguration,
+                  VkSwapchainKHR oldSwapChain = VK_NULL_HANDLE);
         ~SwapChain();
 
         [[nodiscard]]
@@ -22,18 +30,27 @@ namespace VkWrapper
         [[nodiscard]]
         const std::vector<VkImage>& GetImages() const;
 
+        /*!
+         * \return Mode that was selected for the present policy, it can differ if the policy is not supported.
+         */
+        [[nodiscard]]
+        VkPresentModeKHR GetPresentMode() const;
+
         [[nodiscard]]
         VkSwapchainKHR GetHandle() const;
 
     private:
         static const VkSurfaceFormatKHR& ChooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& formats);
-        static VkPresentModeKHR ChooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes);
+        static VkPresentModeKHR ChooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes,
+                                                      PresentPolicy policy);
+        static uint32_t ChooseImageCount(const VkSurfaceCapabilitiesKHR& capabilities, uint32_t requestedImageCount);
         static VkExtent2D ChooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities,
-                                           const GLFWWrapper::Window& window);
+                                           VkExtent2D frameBufferExtent);
 
         VkDevice _lDevice;
         VkFormat _imageFormat{};
         VkExtent2D _extent{};
+        VkPresentModeKHR _presentMode = VK_PRESENT_MODE_FIFO_KHR;
         std::vector<VkImage> _images;
         VkSwapchainKHR _swapChain{};
     };
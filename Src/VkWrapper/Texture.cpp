@@ -0,0 +1,114 @@
+#include "Texture.hpp"
+#include <Utility/Assert.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+Texture::Texture(VkDevice lDevice, const PDevice& pDevice, VkExtent2D extent, VkFormat format)
+: _lDevice(lDevice)
+, _extent(extent)
+, _format(format)
+, _image(VK_NULL_HANDLE)
+, _memory(VK_NULL_HANDLE)
+, _imageView(VK_NULL_HANDLE)
+{
+    TraceIt;
+
+    VkImageCreateInfo imageCreateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .imageType = VK_IMAGE_TYPE_2D,
+        .format = _format,
+        .extent = { _extent.width, _extent.height, 1 },
+        .mipLevels = 1,
+        .arrayLayers = 1,
+        .samples = VK_SAMPLE_COUNT_1_BIT,
+        .tiling = VK_IMAGE_TILING_OPTIMAL,
+        .usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
+    };
+    Assert(vkCreateImage(_lDevice, &imageCreateInfo, nullptr, &_image) == VK_SUCCESS, "Failed to create texture");
+
+    VkMemoryRequirements memoryRequirements;
+    vkGetImageMemoryRequirements(_lDevice, _image, &memoryRequirements);
+    const auto memoryType = pDevice.FindMemoryType(memoryRequirements.memoryTypeBits,
+                                                   VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    Assert(memoryType.has_value(), "Failed to find suitable memory type for texture");
+
+    VkMemoryAllocateInfo allocateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .allocationSize = memoryRequirements.size,
+        .memoryTypeIndex = memoryType.value()
+    };
+    Assert(vkAllocateMemory(_lDevice, &allocateInfo, nullptr, &_memory) == VK_SUCCESS,
+           "Failed to allocate texture memory");
+    vkBindImageMemory(_lDevice, _image, _memory, 0);
+
+    VkImageViewCreateInfo viewCreateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+        .image = _image,
+        .viewType = VK_IMAGE_VIEW_TYPE_2D,
+        .format = _format,
+        .components =
+        {
+            .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+            .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+            .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+            .a = VK_COMPONENT_SWIZZLE_IDENTITY,
+        },
+        .subresourceRange =
+        {
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = 1,
+            .baseArrayLayer = 0,
+            .layerCount = 1
+        }
+    };
+    Assert(vkCreateImageView(_lDevice, &viewCreateInfo, nullptr, &_imageView) == VK_SUCCESS,
+           "Failed to create texture view");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+Texture::~Texture()
+{
+    vkDestroyImageView(_lDevice, _imageView, nullptr);
+    vkDestroyImage(_lDevice, _image, nullptr);
+    vkFreeMemory(_lDevice, _memory, nullptr);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkImage Texture::GetImage() const
+{
+    return _image;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkImageView Texture::GetImageView() const
+{
+    return _imageView;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+const VkExtent2D& Texture::GetExtent() const
+{
+    return _extent;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkFormat Texture::GetFormat() const
+{
+    return _format;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
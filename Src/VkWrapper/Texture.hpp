@@ -0,0 +1,43 @@
+#pragma once
+#include <vulkan/vulkan.h>
+#include <VkWrapper/PDevice.hpp>
+
+namespace VkWrapper
+{
+    /*!
+     * Device local 2D image with a single mip level which is sampled by shaders. The content is uploaded through
+     * the StagingUploader, so the image has the transfer destination usage and the exclusive sharing mode.
+     */
+    class Texture final
+    {
+    public:
+        Texture(VkDevice lDevice,
+                const PDevice& pDevice,
+                VkExtent2D extent,
+                VkFormat format = VK_FORMAT_R8G8B8A8_UNORM);
+        ~Texture();
+
+        Texture(const Texture& other) = delete;
+        Texture& operator=(const Texture& other) = delete;
+
+        [[nodiscard]]
+        VkImage GetImage() const;
+
+        [[nodiscard]]
+        VkImageView GetImageView() const;
+
+        [[nodiscard]]
+        const VkExtent2D& GetExtent() const;
+
+        [[nodiscard]]
+        VkFormat GetFormat() const;
+
+    private:
+        VkDevice _lDevice;
+        VkExtent2D _extent;
+        VkFormat _format;
+        VkImage _image;
+        VkDeviceMemory _memory;
+        VkImageView _imageView;
+    };
+}
\ No newline at end of file
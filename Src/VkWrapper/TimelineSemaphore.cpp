@@ -0,0 +1,76 @@
+#include "TimelineSemaphore.hpp"
+#include <Utility/Assert.hpp>
+#include <Tracer/TraceScopeTimer.hpp>
+
+using namespace VkWrapper;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+TimelineSemaphore::TimelineSemaphore(VkDevice lDevice, uint64_t initialValue)
+: _lDevice(lDevice)
+, _semaphore(nullptr)
+{
+    TraceIt;
+
+    VkSemaphoreTypeCreateInfoKHR typeCreateInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR,
+        .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR,
+        .initialValue = initialValue
+    };
+
+    VkSemaphoreCreateInfo createInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+        .pNext = &typeCreateInfo
+    };
+
+    Assert(vkCreateSemaphore(_lDevice, &createInfo, nullptr, &_semaphore) == VK_SUCCESS,
+           "Failed to create timeline semaphore");
+
+    // Functions of the extension are not exported by the loader, so they must be obtained from the device
+    _getCounterValue = reinterpret_cast<PFN_vkGetSemaphoreCounterValueKHR>(
+            vkGetDeviceProcAddr(_lDevice, "vkGetSemaphoreCounterValueKHR"));
+    _waitSemaphores = reinterpret_cast<PFN_vkWaitSemaphoresKHR>(vkGetDeviceProcAddr(_lDevice, "vkWaitSemaphoresKHR"));
+    Assert(_getCounterValue != nullptr && _waitSemaphores != nullptr, "Timeline semaphore functions are not available");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+TimelineSemaphore::~TimelineSemaphore()
+{
+    vkDestroySemaphore(_lDevice, _semaphore, nullptr);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+VkSemaphore TimelineSemaphore::GetHandle() const
+{
+    return _semaphore;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+uint64_t TimelineSemaphore::GetValue() const
+{
+    uint64_t value(0);
+    _getCounterValue(_lDevice, _semaphore, &value);
+    return value;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool TimelineSemaphore::Wait(uint64_t value, uint64_t timeout) const
+{
+    VkSemaphoreWaitInfoKHR waitInfo =
+    {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR,
+        .semaphoreCount = 1,
+        .pSemaphores = &_semaphore,
+        .pValues = &value
+    };
+
+    return _waitSemaphores(_lDevice, &waitInfo, timeout) == VK_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include <vulkan/vulkan.h>
+
+namespace VkWrapper
+{
+    /*!
+     * Semaphore with a monotonically increasing 64-bit counter (VK_KHR_timeline_semaphore).
+     * Unlike fences it can be waited for any past value and queried without blocking.
+     */
+    class TimelineSemaphore final
+    {
+    public:
+        explicit TimelineSemaphore(VkDevice lDevice, uint64_t initialValue = 0);
+        ~TimelineSemaphore();
+
+        [[nodiscard]]
+        VkSemaphore GetHandle() const;
+
+        [[nodiscard]]
+        uint64_t GetValue() const;
+
+        /*!
+         * Blocks until the counter reaches the value or the timeout expires.
+         *
+         * \return True if the value was reached. Otherwise - false.
+         */
+        bool Wait(uint64_t value, uint64_t timeout = UINT64_MAX) const;
+
+    private:
+        VkDevice _lDevice;
+        VkSemaphore _semaphore;
+        PFN_vkGetSemaphoreCounterValueKHR _getCounterValue;
+        PFN_vkWaitSemaphoresKHR _waitSemaphores;
+    };
+}
\ No newline at end of file
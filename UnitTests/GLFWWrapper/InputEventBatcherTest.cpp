@@ -0,0 +1,77 @@
+#include "GLFWWrapper/InputEventBatcher.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace GLFWWrapper;
+
+namespace
+{
+    InputEvent CursorMove(float x, float y)
+    {
+        return { C2D::EngineClock::now(), InputEvent::Type::CursorMoved, 0, 0, 0, x, y };
+    }
+
+    InputEvent Scroll(float x, float y)
+    {
+        return { C2D::EngineClock::now(), InputEvent::Type::Scrolled, 0, 0, 0, x, y };
+    }
+}
+
+/*!
+ * Testing that consecutive moves and scrolls are merged
+ */
+TEST(InputEventBatcher, MergeConsecutive)
+{
+    InputEventBatcher batcher;
+    std::vector<InputEvent> events;
+    const auto push = [&events](const InputEvent& event) { events.push_back(event); };
+
+    batcher.MoveCursor(CursorMove(1.0f, 2.0f), push);
+    batcher.MoveCursor(CursorMove(3.0f, 4.0f), push);
+    EXPECT_TRUE(events.empty());
+
+    batcher.Flush(push);
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(InputEvent::Type::CursorMoved, events[0].type);
+    EXPECT_EQ(3.0f, events[0].x);
+    EXPECT_EQ(4.0f, events[0].y);
+
+    batcher.Scroll(Scroll(0.5f, 1.0f), push);
+    batcher.Scroll(Scroll(0.25f, -3.0f), push);
+    batcher.Flush(push);
+    ASSERT_EQ(2u, events.size());
+    EXPECT_EQ(InputEvent::Type::Scrolled, events[1].type);
+    EXPECT_EQ(0.75f, events[1].x);
+    EXPECT_EQ(-2.0f, events[1].y);
+
+    // Nothing is pending after the flush
+    batcher.Flush(push);
+    EXPECT_EQ(2u, events.size());
+}
+
+/*!
+ * Testing that interleaved moves and scrolls are pushed in the arrival order
+ */
+TEST(InputEventBatcher, KeepOrderOfInterleaved)
+{
+    InputEventBatcher batcher;
+    std::vector<InputEvent> events;
+    const auto push = [&events](const InputEvent& event) { events.push_back(event); };
+
+    batcher.MoveCursor(CursorMove(1.0f, 1.0f), push);
+    batcher.Scroll(Scroll(0.0f, 1.0f), push);
+    batcher.MoveCursor(CursorMove(2.0f, 2.0f), push);
+    batcher.Scroll(Scroll(0.0f, 2.0f), push);
+    batcher.Scroll(Scroll(0.0f, 3.0f), push);
+    batcher.Flush(push);
+
+    ASSERT_EQ(4u, events.size());
+    EXPECT_EQ(InputEvent::Type::CursorMoved, events[0].type);
+    EXPECT_EQ(1.0f, events[0].x);
+    EXPECT_EQ(InputEvent::Type::Scrolled, events[1].type);
+    EXPECT_EQ(1.0f, events[1].y);
+    EXPECT_EQ(InputEvent::Type::CursorMoved, events[2].type);
+    EXPECT_EQ(2.0f, events[2].x);
+    EXPECT_EQ(InputEvent::Type::Scrolled, events[3].type);
+    EXPECT_EQ(5.0f, events[3].y);
+}
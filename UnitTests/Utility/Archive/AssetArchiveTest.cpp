@@ -0,0 +1,113 @@
+#include "Utility/Archive/ArchiveWriter.hpp"
+#include "Utility/Archive/AssetLibrary.hpp"
+#include <fstream>
+#include <string_view>
+#include <gtest/gtest.h>
+
+using namespace C2D;
+
+namespace
+{
+    std::vector<std::byte> ToBytes(std::string_view text)
+    {
+        const auto* data = reinterpret_cast<const std::byte*>(text.data());
+        return { data, data + text.size() };
+    }
+
+    std::filesystem::path GetTestDirectory()
+    {
+        const auto directory = std::filesystem::temp_directory_path() / "AssetArchiveTest";
+        std::filesystem::create_directories(directory);
+        return directory;
+    }
+}
+
+/*!
+ * Testing that uncompressed assets are views of the mapping, aligned, and compressed assets are restored
+ */
+TEST(AssetArchive, WriteAndRead)
+{
+    const auto archivePath = GetTestDirectory() / "Assets.c2da";
+    const auto shader = ToBytes("\x03\x02\x23\x07 shader");
+    const auto text = ToBytes(std::string(1000, 'a'));
+
+    ArchiveWriter writer;
+    EXPECT_TRUE(writer.Add("Shaders/Sprites.spv", shader));
+    EXPECT_TRUE(writer.Add("Texts/Long.txt", text, true));
+    EXPECT_TRUE(writer.Add("Empty", {}));
+    EXPECT_FALSE(writer.Add("./Shaders\\Sprites.spv", shader));
+    ASSERT_TRUE(writer.Write(archivePath));
+
+    AssetArchive archive(archivePath);
+    ASSERT_TRUE(archive.IsOpen());
+    EXPECT_EQ(3, archive.GetEntryCount());
+    EXPECT_FALSE(archive.Contains("Missing"));
+    EXPECT_FALSE(archive.Read("Missing").has_value());
+
+    const auto shaderBlob = archive.Read("Shaders/Sprites.spv");
+    ASSERT_TRUE(shaderBlob.has_value());
+    EXPECT_TRUE(shaderBlob->IsView());
+    EXPECT_EQ(shader, std::vector<std::byte>(shaderBlob->GetData().begin(), shaderBlob->GetData().end()));
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(shaderBlob->GetData().data()) % AssetArchive::blobAlignment);
+
+    const auto textBlob = archive.Read("Texts/Long.txt");
+    ASSERT_TRUE(textBlob.has_value());
+    EXPECT_FALSE(textBlob->IsView());
+    EXPECT_EQ(text, std::vector<std::byte>(textBlob->GetData().begin(), textBlob->GetData().end()));
+
+    const auto emptyBlob = archive.Read("Empty");
+    ASSERT_TRUE(emptyBlob.has_value());
+    EXPECT_TRUE(emptyBlob->GetData().empty());
+}
+
+/*!
+ * Testing that files which are not archives are rejected
+ */
+TEST(AssetArchive, RejectInvalidFiles)
+{
+    const auto path = GetTestDirectory() / "NotArchive.c2da";
+    std::ofstream(path, std::ios::binary) << "Definitely not an archive";
+
+    EXPECT_FALSE(AssetArchive(path).IsOpen());
+    EXPECT_FALSE(AssetArchive(GetTestDirectory() / "Missing.c2da").IsOpen());
+}
+
+/*!
+ * Testing that later archives override earlier ones and loose files are used as a fallback
+ */
+TEST(AssetLibrary, MountAndFallback)
+{
+    const auto directory = GetTestDirectory();
+    std::ofstream(directory / "Loose.txt", std::ios::binary) << "loose";
+
+    ArchiveWriter base;
+    base.Add("Shared.txt", ToBytes("base"));
+    base.Add("Base.txt", ToBytes("base only"));
+    ASSERT_TRUE(base.Write(directory / "Base.c2da"));
+
+    ArchiveWriter patch;
+    patch.Add("Shared.txt", ToBytes("patch"));
+    ASSERT_TRUE(patch.Write(directory / "Patch.c2da"));
+
+    const auto read = [](const AssetLibrary& library, std::string_view path)
+    {
+        const auto blob = library.Read(path);
+        return blob.has_value() ? std::string(reinterpret_cast<const char*>(blob->GetData().data()),
+                                              blob->GetData().size())
+                                : std::string("<missing>");
+    };
+
+    AssetLibrary library(directory);
+    EXPECT_TRUE(library.Mount(directory / "Base.c2da"));
+    EXPECT_TRUE(library.Mount(directory / "Patch.c2da"));
+    EXPECT_FALSE(library.Mount(directory / "Missing.c2da"));
+    EXPECT_EQ(2, library.GetArchiveCount());
+
+    EXPECT_EQ("patch", read(library, "Shared.txt"));
+    EXPECT_EQ("base only", read(library, "Base.txt"));
+    EXPECT_EQ("loose", read(library, "Loose.txt"));
+    EXPECT_EQ("<missing>", read(library, "Missing.txt"));
+
+    AssetLibrary shippedLibrary(directory, false);
+    EXPECT_EQ("<missing>", read(shippedLibrary, "Loose.txt"));
+}
\ No newline at end of file
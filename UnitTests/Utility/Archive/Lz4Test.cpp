@@ -0,0 +1,68 @@
+#include "Utility/Archive/Lz4.hpp"
+#include <string_view>
+#include <gtest/gtest.h>
+
+using namespace C2D;
+using namespace std::string_view_literals;
+
+namespace
+{
+    std::vector<std::byte> ToBytes(std::string_view text)
+    {
+        const auto* data = reinterpret_cast<const std::byte*>(text.data());
+        return { data, data + text.size() };
+    }
+}
+
+/*!
+ * Testing that repetitive data is compressed and restored exactly, including short and empty inputs
+ */
+TEST(Lz4, RoundTrip)
+{
+    std::string text;
+    for (int i = 0; i < 1000; ++i)
+    {
+        text += "sprite_" + std::to_string(i % 17) + ".ppm;";
+    }
+
+    for (const auto& data : { ToBytes(text), ToBytes("short"), ToBytes(std::string(300, 'a')), ToBytes("") })
+    {
+        const auto compressed = Lz4::Compress(data);
+        const auto decompressed = Lz4::Decompress(compressed, data.size());
+        ASSERT_TRUE(decompressed.has_value());
+        EXPECT_EQ(data, decompressed.value());
+    }
+
+    EXPECT_LT(Lz4::Compress(ToBytes(text)).size(), text.size() / 4);
+}
+
+/*!
+ * Testing a hand-encoded block with an overlapping match and lengths that continue after the token
+ */
+TEST(Lz4, DecompressReference)
+{
+    // 16 literals "abcdefghijklmnop", then the match of 20 bytes at the offset 1, then 5 literals
+    const auto block = ToBytes("\xFF\x01" "abcdefghijklmnop" "\x01\x00\x01\x50" "qrstu"sv);
+
+    const auto decompressed = Lz4::Decompress(block, 16 + 20 + 5);
+    ASSERT_TRUE(decompressed.has_value());
+    EXPECT_EQ(ToBytes("abcdefghijklmnop" + std::string(20, 'p') + "qrstu"), decompressed.value());
+}
+
+/*!
+ * Testing that malformed blocks and wrong sizes are rejected instead of reading or writing out of bounds
+ */
+TEST(Lz4, RejectMalformed)
+{
+    const auto data = ToBytes(std::string(100, 'x') + "tail of the block");
+    const auto compressed = Lz4::Compress(data);
+
+    EXPECT_FALSE(Lz4::Decompress(compressed, data.size() - 1).has_value());
+    EXPECT_FALSE(Lz4::Decompress(compressed, data.size() + 1).has_value());
+    EXPECT_FALSE(Lz4::Decompress({ compressed.data(), compressed.size() / 2 }, data.size()).has_value());
+
+    // Offset points before the beginning of the output
+    const std::vector<std::byte> badOffset = { std::byte{ 0x10 }, std::byte{ 'a' }, std::byte{ 0x02 }, std::byte{ 0 },
+                                               std::byte{ 0x00 } };
+    EXPECT_FALSE(Lz4::Decompress(badOffset, 5).has_value());
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+
+/*!
+ * \brief Runs the function once and prints its duration. Benchmark tests only print timings for reference,
+ *        so the format is the same for all of them. They are disabled, so regular runs stay fast,
+ *        run them with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*.
+ * \param tag - name of the benchmark, printed in brackets before the case.
+ * \param name - name of the measured case.
+ * \param function - measured function.
+ * \param callCount - number of measured calls made by the function, the time is printed per call if it is not 1.
+ */
+template<class Function>
+void MeasureAndPrint(const char* tag, const char* name, Function&& function, size_t callCount = 1)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - start;
+
+    std::cout << "[ " << tag << " ] " << name << ": ";
+    if (callCount == 1)
+    {
+        std::cout << time.count() << " ms" << std::endl;
+    }
+    else
+    {
+        std::cout << time.count() * 1000000.0 / static_cast<double>(callCount) << " ns per call" << std::endl;
+    }
+}
@@ -0,0 +1,227 @@
+#include "Utility/Containers/Delegate/Event.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace
+{
+    int Twice(const int value)
+    {
+        return value * 2;
+    }
+
+    class Counter
+    {
+    public:
+        void Add(const int value)
+        {
+            total += value;
+        }
+
+        int Get() const
+        {
+            return total;
+        }
+
+        int total = 0;
+    };
+}
+
+/*!
+ * Testing calls of functions, methods and functors
+ */
+TEST(Delegate, Call)
+{
+    C2D::Delegate<int(int)> function(&Twice);
+    EXPECT_EQ(6, function(3));
+
+    Counter counter;
+    C2D::Delegate<void(int)> method(&counter, &Counter::Add);
+    method(2);
+    method(3);
+    EXPECT_EQ(5, counter.total);
+
+    C2D::Delegate<int()> constMethod(static_cast<const Counter*>(&counter), &Counter::Get);
+    EXPECT_EQ(5, constMethod());
+
+    // Functors can change their state
+    C2D::Delegate<int()> functor([calls = 0]() mutable { return ++calls; });
+    functor();
+    EXPECT_EQ(2, functor());
+
+    // Return value is converted to the return type of the signature
+    C2D::Delegate<double(int)> converted([](int value) { return value; });
+    EXPECT_EQ(4.0, converted(4));
+
+    // Signatures are checked at compile time
+    static_assert(!std::is_constructible_v<C2D::Delegate<int(int)>, void(*)(std::string)>);
+    static_assert(!std::is_constructible_v<C2D::Delegate<int(int)>, int(*)()>);
+
+    C2D::Delegate<void()> empty;
+    EXPECT_FALSE(empty);
+    EXPECT_THROW(empty(), std::bad_function_call);
+}
+
+/*!
+ * Testing copying and moving of callables that manage resources
+ */
+TEST(Delegate, CopyMove)
+{
+    auto resource = std::make_shared<std::string>("resource");
+    C2D::Delegate<size_t()> delegate([resource]() { return resource->size(); });
+    EXPECT_EQ(2, resource.use_count());
+
+    auto copy = delegate;
+    EXPECT_EQ(3, resource.use_count());
+    EXPECT_EQ(8, copy());
+
+    auto moved = std::move(copy);
+    EXPECT_FALSE(copy);
+    EXPECT_EQ(3, resource.use_count());
+    EXPECT_EQ(8, moved());
+
+    moved = delegate;
+    EXPECT_EQ(3, resource.use_count());
+    delegate = C2D::Delegate<size_t()>();
+    moved = C2D::Delegate<size_t()>();
+    EXPECT_EQ(1, resource.use_count());
+}
+
+/*!
+ * Testing invocation, subscription and unsubscription of handlers
+ */
+TEST(Event, Invoke)
+{
+    C2D::Event<int> event;
+    Counter first;
+    Counter second;
+
+    const auto firstId = event.Subscribe(&first, &Counter::Add);
+    event.Subscribe(&second, &Counter::Add);
+    EXPECT_EQ(2, event.GetSubscriberCount());
+
+    event.Invoke(3);
+    EXPECT_EQ(3, first.total);
+    EXPECT_EQ(3, second.total);
+
+    event.Unsubscribe(firstId);
+    event.Unsubscribe(firstId);
+    event.Invoke(4);
+    EXPECT_EQ(3, first.total);
+    EXPECT_EQ(7, second.total);
+    EXPECT_EQ(1, event.GetSubscriberCount());
+}
+
+/*!
+ * Testing that handlers can subscribe and unsubscribe during invocation
+ */
+TEST(Event, ChangeDuringInvoke)
+{
+    C2D::Event<> event;
+    std::vector<std::string> calls;
+    C2D::Event<>::SubscriptionId secondId(0);
+
+    event.Subscribe([&]()
+    {
+        calls.emplace_back("first");
+        event.Unsubscribe(secondId);
+        event.Subscribe([&calls]() { calls.emplace_back("new"); });
+    });
+    secondId = event.Subscribe([&calls]() { calls.emplace_back("second"); });
+
+    event.Invoke();
+    EXPECT_EQ(std::vector<std::string>({ "first" }), calls);
+    EXPECT_EQ(2, event.GetSubscriberCount());
+
+    calls.clear();
+    event.Invoke();
+    EXPECT_EQ(std::vector<std::string>({ "first", "new" }), calls);
+}
+
+/*!
+ * Testing that invocation does not copy handlers, they are copied only when subscriptions change during invocation
+ */
+TEST(Event, InvokeWithoutCopies)
+{
+    struct CopyCounter
+    {
+        CopyCounter(int& copies) : copies(copies) { }
+        CopyCounter(const CopyCounter& other) : copies(other.copies) { ++copies; }
+        CopyCounter(CopyCounter&& other) noexcept : copies(other.copies) { }
+        void operator()() const { }
+
+        int& copies;
+    };
+
+    C2D::Event<> event;
+    int copies(0);
+    event.Subscribe(CopyCounter(copies));
+    event.Subscribe(CopyCounter(copies));
+
+    copies = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        event.Invoke();
+    }
+    EXPECT_EQ(0, copies);
+
+    // A snapshot of two handlers is copied once, the handler subscribed after it is moved
+    bool isSubscribed(false);
+    event.Subscribe([&]()
+    {
+        if (!isSubscribed)
+        {
+            isSubscribed = true;
+            copies = 0;
+            event.Subscribe(CopyCounter(copies));
+            EXPECT_EQ(2, copies);
+        }
+    });
+    event.Invoke();
+    EXPECT_EQ(4, event.GetSubscriberCount());
+
+    copies = 0;
+    event.Invoke();
+    EXPECT_EQ(0, copies);
+}
+
+/*!
+ * Testing batched invocation of events that were enqueued from several threads
+ */
+TEST(Event, Dispatch)
+{
+    C2D::Event<std::string, int> event;
+    std::vector<std::pair<std::string, int>> received;
+    event.Subscribe([&received](std::string name, int value) { received.emplace_back(std::move(name), value); });
+
+    event.Enqueue("first", 1);
+    event.Enqueue("second", 2);
+    EXPECT_TRUE(received.empty());
+
+    event.Dispatch();
+    EXPECT_EQ((std::vector<std::pair<std::string, int>>({ { "first", 1 }, { "second", 2 } })), received);
+
+    // Nothing is dispatched twice
+    event.Dispatch();
+    EXPECT_EQ(2, received.size());
+
+    received.clear();
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&event, thread]()
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                event.Enqueue("thread", thread);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    event.Dispatch();
+    EXPECT_EQ(400, received.size());
+}
@@ -0,0 +1,68 @@
+#include "Utility/Containers/Journal/Journal.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/*!
+ * Testing that entries are consumed once, in the order of appending
+ */
+TEST(Journal, AppendConsume)
+{
+    C2D::Journal<std::unique_ptr<uint64_t>> journal;
+    EXPECT_TRUE(journal.IsEmpty());
+    EXPECT_EQ(0u, journal.Consume([](std::unique_ptr<uint64_t>&) { FAIL(); }));
+
+    for (uint64_t i = 0; i < 5; ++i)
+    {
+        journal.Append(std::make_unique<uint64_t>(i));
+    }
+    EXPECT_FALSE(journal.IsEmpty());
+
+    std::vector<uint64_t> entries;
+    EXPECT_EQ(5u, journal.Consume([&entries](std::unique_ptr<uint64_t>& entry) { entries.push_back(*entry); }));
+    EXPECT_EQ(std::vector<uint64_t>({ 0, 1, 2, 3, 4 }), entries);
+    EXPECT_TRUE(journal.IsEmpty());
+
+    // Entries that are not consumed are destroyed with the journal
+    journal.Append(std::make_unique<uint64_t>(5));
+}
+
+/*!
+ * Testing that entries of several producers are consumed once and in the order of each producer
+ */
+TEST(Journal, ProducersConsumer)
+{
+    constexpr uint64_t producerCount = 4;
+    constexpr uint64_t entryCount = 10000;
+    C2D::Journal<std::pair<uint64_t, uint64_t>> journal;
+
+    std::vector<std::thread> producers;
+    for (uint64_t producer = 0; producer < producerCount; ++producer)
+    {
+        producers.emplace_back([&journal, producer]
+        {
+            for (uint64_t i = 0; i < entryCount; ++i)
+            {
+                journal.Append({ producer, i });
+            }
+        });
+    }
+
+    std::vector<uint64_t> expected(producerCount, 0);
+    uint64_t consumed(0);
+    while (consumed < producerCount * entryCount)
+    {
+        consumed += journal.Consume([&expected](const std::pair<uint64_t, uint64_t>& entry)
+        {
+            ASSERT_EQ(expected[entry.first], entry.second);
+            ++expected[entry.first];
+        });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_TRUE(journal.IsEmpty());
+}
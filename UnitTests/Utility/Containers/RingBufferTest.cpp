@@ -1,5 +1,8 @@
 #include "Utility/Containers/RingBuffer/RingBuffer.hpp"
+#include "BenchmarkHelpers.hpp"
 #include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
 
 /*!
  * Testing functions Resize() and GetSize()
@@ -200,4 +203,219 @@ TEST(RingBuffer, ReverseIterator)
     }
     // Check number of entries in ring buffer
     EXPECT_EQ(0ull, ++count);
-}
\ No newline at end of file
+}
+
+/*!
+ * Testing that reverse iterator passes the start of the buffer when the ring is wrapped
+ */
+TEST(RingBuffer, WrappedReverseIterator)
+{
+    C2D::RingBuffer<uint64_t> ringBuffer;
+
+    // Head of the ring is in the middle of the buffer
+    for (uint64_t i = 0ull; i < 15ull; ++i)
+    {
+        ringBuffer.PushBack(i);
+    }
+
+    uint64_t count = 14ull;
+    for (auto entry = ringBuffer.rbegin(); entry != ringBuffer.rend(); ++entry)
+    {
+        EXPECT_EQ(count, *entry);
+        --count;
+    }
+    EXPECT_EQ(4ull, count);
+}
+
+/*!
+ * Testing functions GetCount(), Clear() and operator[]
+ */
+TEST(RingBuffer, Indexing)
+{
+    // Sizes that are wrapped by mask and by subtraction
+    for (const auto size : { 8ull, 10ull })
+    {
+        C2D::RingBuffer<uint64_t> ringBuffer;
+        ringBuffer.Resize(size);
+        EXPECT_EQ(0ull, ringBuffer.GetCount());
+
+        for (uint64_t i = 0ull; i < 5ull; ++i)
+        {
+            ringBuffer.PushBack(i);
+        }
+        EXPECT_EQ(5ull, ringBuffer.GetCount());
+        EXPECT_EQ(0ull, ringBuffer[0]);
+        EXPECT_EQ(4ull, ringBuffer[4]);
+
+        for (uint64_t i = 5ull; i < 100ull; ++i)
+        {
+            ringBuffer.PushBack(i);
+        }
+        EXPECT_EQ(size, ringBuffer.GetCount());
+        for (uint64_t i = 0ull; i < size; ++i)
+        {
+            EXPECT_EQ(100ull - size + i, ringBuffer[i]);
+        }
+
+        ringBuffer[0] = 1000ull;
+        EXPECT_EQ(1000ull, *ringBuffer.begin());
+
+        ringBuffer.Clear();
+        EXPECT_EQ(0ull, ringBuffer.GetCount());
+        EXPECT_TRUE(ringBuffer.begin() == ringBuffer.end());
+    }
+}
+
+/*!
+ * Testing function PushBack() with a range of entries
+ */
+TEST(RingBuffer, PushBackRange)
+{
+    C2D::RingBuffer<uint64_t> ringBuffer;
+    std::vector<uint64_t> entries(25);
+    std::iota(entries.begin(), entries.end(), 0ull);
+
+    // Range that fits the buffer
+    ringBuffer.PushBack(std::span<const uint64_t>(entries).first(4));
+    ASSERT_EQ(4ull, ringBuffer.GetCount());
+    for (uint64_t i = 0ull; i < 4ull; ++i)
+    {
+        EXPECT_EQ(i, ringBuffer[i]);
+    }
+
+    // Range that wraps around the end of the buffer and overwrites the oldest entries
+    ringBuffer.PushBack(std::span<const uint64_t>(entries).subspan(4, 9));
+    ASSERT_EQ(10ull, ringBuffer.GetCount());
+    uint64_t count(3ull);
+    for (auto& entry : ringBuffer)
+    {
+        EXPECT_EQ(count, entry);
+        ++count;
+    }
+    EXPECT_EQ(13ull, count);
+
+    // Range that is bigger than the buffer keeps only its last entries
+    ringBuffer.PushBack(entries);
+    ASSERT_EQ(10ull, ringBuffer.GetCount());
+    for (uint64_t i = 0ull; i < 10ull; ++i)
+    {
+        EXPECT_EQ(15ull + i, ringBuffer[i]);
+    }
+
+    // Empty range does not change the buffer
+    ringBuffer.PushBack(std::span<const uint64_t>());
+    EXPECT_EQ(10ull, ringBuffer.GetCount());
+}
+
+/*!
+ * Testing function GetSpans()
+ */
+TEST(RingBuffer, GetSpans)
+{
+    C2D::RingBuffer<uint64_t> ringBuffer;
+
+    auto [first, second] = ringBuffer.GetSpans();
+    EXPECT_TRUE(first.empty());
+    EXPECT_TRUE(second.empty());
+
+    // Entries that are not wrapped are in the first span only
+    for (uint64_t i = 0ull; i < 6ull; ++i)
+    {
+        ringBuffer.PushBack(i);
+    }
+    std::tie(first, second) = ringBuffer.GetSpans();
+    EXPECT_EQ(std::vector<uint64_t>({ 0, 1, 2, 3, 4, 5 }), std::vector<uint64_t>(first.begin(), first.end()));
+    EXPECT_TRUE(second.empty());
+
+    // Wrapped entries are split in two spans
+    for (uint64_t i = 6ull; i < 13ull; ++i)
+    {
+        ringBuffer.PushBack(i);
+    }
+    std::tie(first, second) = ringBuffer.GetSpans();
+    EXPECT_EQ(std::vector<uint64_t>({ 3, 4, 5, 6, 7, 8, 9 }), std::vector<uint64_t>(first.begin(), first.end()));
+    EXPECT_EQ(std::vector<uint64_t>({ 10, 11, 12 }), std::vector<uint64_t>(second.begin(), second.end()));
+}
+
+/*!
+ * Testing that entries which can only be moved are stored with EmplaceBack()
+ */
+TEST(RingBuffer, MoveOnlyEntries)
+{
+    C2D::RingBuffer<std::unique_ptr<uint64_t>> ringBuffer;
+    ringBuffer.Resize(4);
+
+    for (uint64_t i = 0ull; i < 6ull; ++i)
+    {
+        ringBuffer.EmplaceBack(std::make_unique<uint64_t>(i));
+    }
+
+    ASSERT_EQ(4ull, ringBuffer.GetCount());
+    for (uint64_t i = 0ull; i < 4ull; ++i)
+    {
+        ASSERT_NE(nullptr, ringBuffer[i]);
+        EXPECT_EQ(2ull + i, *ringBuffer[i]);
+    }
+
+    // Resize rotates entries, so they must stay valid
+    ringBuffer.Resize(8);
+    ringBuffer.EmplaceBack(std::make_unique<uint64_t>(6ull));
+    EXPECT_EQ(2ull, *ringBuffer[0]);
+    EXPECT_EQ(6ull, *ringBuffer[ringBuffer.GetCount() - 1]);
+}
+
+/*!
+ * Comparing per-entry and range pushes, and iterator and span traversal.
+ * Timings are printed for reference, only results are checked.
+ */
+TEST(RingBuffer, DISABLED_Benchmark)
+{
+    constexpr size_t entryCount = 1 << 20;
+    constexpr size_t chunkSize = 256;
+
+    std::vector<uint64_t> entries(entryCount);
+    std::iota(entries.begin(), entries.end(), 0ull);
+
+    for (const auto size : { entryCount, entryCount - 1 })
+    {
+        C2D::RingBuffer<uint64_t> single;
+        C2D::RingBuffer<uint64_t> range;
+        single.Resize(size);
+        range.Resize(size);
+
+        MeasureAndPrint("RingBuffer", "PushBack per entry", [&]()
+        {
+            for (const auto entry : entries)
+            {
+                single.PushBack(entry);
+            }
+        });
+        MeasureAndPrint("RingBuffer", "PushBack by range", [&]()
+        {
+            for (size_t i = 0; i < entryCount; i += chunkSize)
+            {
+                range.PushBack(std::span<const uint64_t>(entries).subspan(i, chunkSize));
+            }
+        });
+
+        uint64_t iteratorSum(0ull);
+        uint64_t spanSum(0ull);
+        MeasureAndPrint("RingBuffer", "Sum by iterator", [&]()
+        {
+            for (const auto& entry : single)
+            {
+                iteratorSum += entry;
+            }
+        });
+        MeasureAndPrint("RingBuffer", "Sum by spans", [&]()
+        {
+            const auto [first, second] = range.GetSpans();
+            spanSum = std::accumulate(first.begin(), first.end(), 0ull);
+            spanSum = std::accumulate(second.begin(), second.end(), spanSum);
+        });
+
+        const auto expected = std::accumulate(entries.end() - static_cast<ptrdiff_t>(size), entries.end(), 0ull);
+        EXPECT_EQ(expected, iteratorSum);
+        EXPECT_EQ(expected, spanSum);
+    }
+}
@@ -0,0 +1,80 @@
+#include "Utility/Containers/SpscQueue/SpscQueue.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+/*!
+ * Testing functions TryPush(), TryPop(), Front() and Pop() in a single thread
+ */
+TEST(SpscQueue, PushPop)
+{
+    C2D::SpscQueue<uint64_t, 4> queue;
+    uint64_t item(0);
+
+    // Empty queue
+    EXPECT_EQ(nullptr, queue.Front());
+    EXPECT_FALSE(queue.TryPop(item));
+
+    // Fill the queue up to the capacity
+    for (uint64_t i = 0; i < queue.GetCapacity(); ++i)
+    {
+        EXPECT_TRUE(queue.TryPush(i));
+    }
+    EXPECT_FALSE(queue.TryPush(4ull));
+    EXPECT_EQ(4ull, queue.GetSize());
+
+    // Items are popped in the push order
+    ASSERT_NE(nullptr, queue.Front());
+    EXPECT_EQ(0ull, *queue.Front());
+    queue.Pop();
+    EXPECT_TRUE(queue.TryPop(item));
+    EXPECT_EQ(1ull, item);
+
+    // Indices wrap around the array
+    EXPECT_TRUE(queue.TryPush(4ull));
+    EXPECT_TRUE(queue.TryPush(5ull));
+    EXPECT_FALSE(queue.TryPush(6ull));
+    for (uint64_t i = 2; i < 6; ++i)
+    {
+        EXPECT_TRUE(queue.TryPop(item));
+        EXPECT_EQ(i, item);
+    }
+    EXPECT_EQ(0ull, queue.GetSize());
+}
+
+/*!
+ * Testing that items pushed by one thread are popped by another in the same order
+ */
+TEST(SpscQueue, ProducerConsumer)
+{
+    constexpr uint64_t itemCount = 10000;
+    C2D::SpscQueue<uint64_t, 64> queue;
+
+    std::thread producer([&queue]
+    {
+        for (uint64_t i = 0; i < itemCount; ++i)
+        {
+            while (!queue.TryPush(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint64_t expected(0);
+    uint64_t item(0);
+    while (expected < itemCount)
+    {
+        if (queue.TryPop(item))
+        {
+            ASSERT_EQ(expected, item);
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(0ull, queue.GetSize());
+}
@@ -1,6 +1,18 @@
+#include <Utility/Math/FastMath.hpp>
+#include <Utility/Math/Transform2D.hpp>
 #include <Utility/Math/Vector2.hpp>
-#include <SFML/System/Vector2.hpp>
+#include <Utility/Math/VectorKernels.hpp>
+#include "BenchmarkHelpers.hpp"
 #include <gtest/gtest.h>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Interoperability with SFML is tested only when SFML is available
+#if __has_include(<SFML/System/Vector2.hpp>)
+    #include <SFML/System/Vector2.hpp>
+    #define C2D_TEST_SFML_VECTOR
+#endif
 
 constexpr float xValue1(0.0f), yValue1(5.9f);
 constexpr float xValue2(434.548f), yValue2(-245.1445f);
@@ -49,6 +61,7 @@ TEST(Vector2, Constructors)
     EXPECT_EQ(xValue2, vec8.x.load());
     EXPECT_EQ(yValue2, vec8.y.load());
 
+#if defined(C2D_TEST_SFML_VECTOR)
     // Create sfml vectors
     sf::Vector2<float> sfmlVec1(xValue1, yValue1);
     sf::Vector2<float> sfmlVec2(xValue2, yValue2);
@@ -68,6 +81,7 @@ TEST(Vector2, Constructors)
     C2D::Vector2<float, true> vec12(sf::Vector2(xValue2, yValue2));
     EXPECT_EQ(xValue2, vec12.x.load());
     EXPECT_EQ(yValue2, vec12.y.load());
+#endif
 }
 
 /*!
@@ -115,6 +129,7 @@ TEST(Vector2, Assignments)
     EXPECT_EQ(xValue2, vec8.x.load());
     EXPECT_EQ(yValue2, vec8.y.load());
 
+#if defined(C2D_TEST_SFML_VECTOR)
     // Create sfml vectors
     sf::Vector2<float> sfmlVec1(xValue1, yValue1);
     sf::Vector2<float> sfmlVec2(xValue2, yValue2);
@@ -138,6 +153,7 @@ TEST(Vector2, Assignments)
     vec12 = sf::Vector2(xValue2, yValue2);
     EXPECT_EQ(xValue2, vec12.x.load());
     EXPECT_EQ(yValue2, vec12.y.load());
+#endif
 }
 
 /*!
@@ -393,4 +409,181 @@ TEST(Vector2, Subtraction)
     // -atomic
     C2D::Vector2<float, true> minusVec2(-xValue2, -yValue2);
     EXPECT_EQ(minusVec2, -vec2);
-}
\ No newline at end of file
+}
+
+namespace
+{
+    constexpr float kernelTolerance = 1e-4f;
+
+    /*!
+     * Points with different signs and magnitudes, count is not a multiple of SIMD width to test tails.
+     */
+    std::vector<C2D::Vector2f> CreatePoints(const size_t count)
+    {
+        std::vector<C2D::Vector2f> points;
+        points.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto value = static_cast<float>(i);
+            points.emplace_back(std::sin(value) * value, std::cos(value * 0.5f) * 100.0f - value);
+        }
+
+        return points;
+    }
+
+    void ExpectNear(const C2D::Vector2f& expected, const C2D::Vector2f& actual)
+    {
+        EXPECT_NEAR(expected.x, actual.x, kernelTolerance * std::max(1.0f, std::abs(expected.x)));
+        EXPECT_NEAR(expected.y, actual.y, kernelTolerance * std::max(1.0f, std::abs(expected.y)));
+    }
+}
+
+/*!
+ * Testing error of SinCos() against the standard library
+ */
+TEST(VectorKernels, SinCos)
+{
+    static_assert(C2D::FastCos(0.0f) == 1.0f);
+
+    float maxError(0.0f);
+    for (float angle = -1000.0f; angle <= 1000.0f; angle += 0.01f)
+    {
+        float sine(0.0f), cosine(0.0f);
+        C2D::SinCos(angle, sine, cosine);
+        maxError = std::max(maxError, static_cast<float>(std::abs(sine - std::sin(static_cast<double>(angle)))));
+        maxError = std::max(maxError, static_cast<float>(std::abs(cosine - std::cos(static_cast<double>(angle)))));
+    }
+    EXPECT_LT(maxError, 2e-7f);
+}
+
+/*!
+ * Testing composition and inversion of transforms
+ */
+TEST(VectorKernels, Transform2D)
+{
+    constexpr auto translation = C2D::Transform2D::Translation(10.0f, 0.0f);
+    static_assert(translation.TransformPoint(C2D::Vector2f(1.0f, 2.0f)) == C2D::Vector2f(11.0f, 2.0f));
+    static_assert(translation.TransformVector(C2D::Vector2f(1.0f, 2.0f)) == C2D::Vector2f(1.0f, 2.0f));
+
+    // Positive angles rotate clockwise on the screen, y axis looks down
+    const auto rotated = (translation * C2D::Transform2D::Rotation(90.0f)).TransformPoint(C2D::Vector2f(1.0f, 0.0f));
+    ExpectNear(C2D::Vector2f(10.0f, 1.0f), rotated);
+
+    const C2D::Vector2f origin(3.0f, -4.0f), position(20.0f, 30.0f), scale(2.0f, 0.5f);
+    const auto transform = C2D::Transform2D::FromComponents(origin, position, 37.0f, scale);
+    const auto expected = C2D::Transform2D::Translation(position.x, position.y)
+                          * C2D::Transform2D::Rotation(37.0f)
+                          * C2D::Transform2D::Scaling(scale.x, scale.y)
+                          * C2D::Transform2D::Translation(-origin.x, -origin.y);
+    for (const auto& point : CreatePoints(16))
+    {
+        ExpectNear(expected.TransformPoint(point), transform.TransformPoint(point));
+        ExpectNear(point, transform.GetInverse().TransformPoint(transform.TransformPoint(point)));
+    }
+    ExpectNear(position, transform.TransformPoint(origin));
+    EXPECT_NEAR(scale.x * scale.y, transform.GetDeterminant(), kernelTolerance);
+
+    // Singular transforms can not be inverted
+    EXPECT_EQ(C2D::Transform2D(), C2D::Transform2D::Scaling(0.0f, 1.0f).GetInverse());
+}
+
+/*!
+ * Testing that SIMD kernels are equal to the scalar ones for all sizes of tails
+ */
+TEST(VectorKernels, MatchScalar)
+{
+    std::cout << "[ VectorKernels ] Implementation: " << C2D::VectorKernels::GetImplementationName() << std::endl;
+
+    const auto transform = C2D::Transform2D::FromComponents(C2D::Vector2f(1.0f, 2.0f),
+                                                            C2D::Vector2f(-5.0f, 7.0f),
+                                                            123.0f,
+                                                            C2D::Vector2f(1.5f, -2.0f));
+    for (size_t count = 0; count <= 19; ++count)
+    {
+        auto points = CreatePoints(count);
+        if (count > 2)
+        {
+            points[2] = C2D::Vector2f(0.0f, 0.0f);
+        }
+        const auto others = CreatePoints(count + 3);
+
+        std::vector<C2D::Vector2f> expected(count), actual(count);
+        C2D::VectorKernels::Scalar::TransformPoints(transform, points, expected);
+        C2D::VectorKernels::TransformPoints(transform, points, actual);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ExpectNear(expected[i], actual[i]);
+        }
+
+        C2D::VectorKernels::Scalar::Normalize(points, expected);
+        C2D::VectorKernels::Normalize(points, actual);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ExpectNear(expected[i], actual[i]);
+        }
+        if (count > 2)
+        {
+            EXPECT_EQ(C2D::Vector2f(0.0f, 0.0f), actual[2]);
+        }
+
+        std::vector<float> expectedDots(count), actualDots(count);
+        const std::span<const C2D::Vector2f> right(others.data() + 3, count);
+        C2D::VectorKernels::Scalar::Dot(points, right, expectedDots);
+        C2D::VectorKernels::Dot(points, right, actualDots);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto scale = std::max(1.0f, std::abs(expectedDots[i]));
+            EXPECT_NEAR(expectedDots[i], actualDots[i], kernelTolerance * scale);
+        }
+
+        const auto expectedBounds = C2D::VectorKernels::Scalar::GetBounds(points);
+        const auto actualBounds = C2D::VectorKernels::GetBounds(points);
+        EXPECT_EQ(expectedBounds.min, actualBounds.min);
+        EXPECT_EQ(expectedBounds.max, actualBounds.max);
+    }
+
+    // Empty bounds are inverted
+    const auto empty = C2D::VectorKernels::GetBounds({});
+    EXPECT_GT(empty.min.x, empty.max.x);
+    EXPECT_GT(empty.min.y, empty.max.y);
+
+    // Arrays can be transformed in place
+    auto points = CreatePoints(7);
+    std::vector<C2D::Vector2f> expected(points.size());
+    C2D::VectorKernels::Scalar::TransformPoints(transform, points, expected);
+    C2D::VectorKernels::TransformPoints(transform, points, points);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        ExpectNear(expected[i], points[i]);
+    }
+}
+
+/*!
+ * Comparing performance of scalar and SIMD kernels, results are only printed
+ */
+TEST(VectorKernels, DISABLED_Benchmark)
+{
+    constexpr size_t pointCount = 1 << 20;
+
+    const auto points = CreatePoints(pointCount);
+    std::vector<C2D::Vector2f> output(pointCount);
+    std::vector<float> dots(pointCount);
+    const auto transform = C2D::Transform2D::FromComponents(C2D::Vector2f(), C2D::Vector2f(1.0f, 2.0f), 30.0f,
+                                                            C2D::Vector2f(2.0f, 2.0f));
+
+    constexpr auto tag = "VectorKernels";
+    MeasureAndPrint(tag, "Scalar TransformPoints", [&]()
+    {
+        C2D::VectorKernels::Scalar::TransformPoints(transform, points, output);
+    });
+    MeasureAndPrint(tag, "TransformPoints", [&]() { C2D::VectorKernels::TransformPoints(transform, points, output); });
+    MeasureAndPrint(tag, "Scalar Normalize", [&]() { C2D::VectorKernels::Scalar::Normalize(points, output); });
+    MeasureAndPrint(tag, "Normalize", [&]() { C2D::VectorKernels::Normalize(points, output); });
+    MeasureAndPrint(tag, "Scalar Dot", [&]() { C2D::VectorKernels::Scalar::Dot(points, output, dots); });
+    MeasureAndPrint(tag, "Dot", [&]() { C2D::VectorKernels::Dot(points, output, dots); });
+
+    C2D::VectorKernels::Bounds bounds;
+    MeasureAndPrint(tag, "Scalar GetBounds", [&]() { bounds = C2D::VectorKernels::Scalar::GetBounds(points); });
+    MeasureAndPrint(tag, "GetBounds", [&]() { bounds = C2D::VectorKernels::GetBounds(points); });
+    EXPECT_LE(bounds.min.x, bounds.max.x);
+}
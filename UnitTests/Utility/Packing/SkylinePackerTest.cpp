@@ -0,0 +1,95 @@
+#include "Utility/Packing/SkylinePacker.hpp"
+#include <gtest/gtest.h>
+
+using namespace C2D;
+
+/*!
+ * Testing that rectangles fill the bottom row first and do not overlap
+ */
+TEST(SkylinePacker, Insert)
+{
+    SkylinePacker packer(64, 64);
+
+    const auto first = packer.Insert(32, 16);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(0u, first->x);
+    EXPECT_EQ(0u, first->y);
+
+    const auto second = packer.Insert(32, 8);
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(32u, second->x);
+    EXPECT_EQ(0u, second->y);
+
+    // The lowest place is above the second rectangle
+    const auto third = packer.Insert(32, 8);
+    ASSERT_TRUE(third.has_value());
+    EXPECT_EQ(32u, third->x);
+    EXPECT_EQ(8u, third->y);
+
+    // The skyline is flat again, so the wide rectangle is placed right above
+    const auto fourth = packer.Insert(64, 48);
+    ASSERT_TRUE(fourth.has_value());
+    EXPECT_EQ(0u, fourth->x);
+    EXPECT_EQ(16u, fourth->y);
+    EXPECT_FLOAT_EQ(1.0f, packer.GetOccupancy());
+}
+
+/*!
+ * Testing rectangles that do not fit
+ */
+TEST(SkylinePacker, Overflow)
+{
+    SkylinePacker packer(32, 32);
+
+    EXPECT_FALSE(packer.Insert(33, 1).has_value());
+    EXPECT_FALSE(packer.Insert(1, 33).has_value());
+    EXPECT_FALSE(packer.Insert(0, 1).has_value());
+
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        EXPECT_TRUE(packer.Insert(8, 8).has_value());
+    }
+    EXPECT_FALSE(packer.Insert(1, 1).has_value());
+
+    packer.Clear();
+    EXPECT_FLOAT_EQ(0.0f, packer.GetOccupancy());
+    EXPECT_TRUE(packer.Insert(32, 32).has_value());
+}
+
+/*!
+ * Testing that many small rectangles are packed without overlaps
+ */
+TEST(SkylinePacker, NoOverlaps)
+{
+    struct Rectangle
+    {
+        uint32_t x, y, width, height;
+    };
+
+    SkylinePacker packer(256, 256);
+    std::vector<Rectangle> rectangles;
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        const auto width = 4 + (i * 7) % 13;
+        const auto height = 4 + (i * 5) % 11;
+        if (const auto position = packer.Insert(width, height))
+        {
+            rectangles.push_back({ position->x, position->y, width, height });
+        }
+    }
+
+    ASSERT_FALSE(rectangles.empty());
+    for (size_t i = 0; i < rectangles.size(); ++i)
+    {
+        const auto& first = rectangles[i];
+        EXPECT_LE(first.x + first.width, 256u);
+        EXPECT_LE(first.y + first.height, 256u);
+        for (size_t j = i + 1; j < rectangles.size(); ++j)
+        {
+            const auto& second = rectangles[j];
+            const auto isOverlapping = first.x < second.x + second.width && second.x < first.x + first.width &&
+                                       first.y < second.y + second.height && second.y < first.y + first.height;
+            EXPECT_FALSE(isOverlapping);
+        }
+    }
+}
\ No newline at end of file
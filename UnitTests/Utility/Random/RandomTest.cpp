@@ -0,0 +1,264 @@
+#include "Utility/Random/RandomGenerator.hpp"
+#include "Utility/Random/Pcg32.hpp"
+#include "Utility/Random/Philox4x32.hpp"
+#include "BenchmarkHelpers.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+/*!
+ * Testing Xoshiro256++ against the reference implementation
+ */
+TEST(Random, Xoshiro256)
+{
+    C2D::Xoshiro256 generator(std::array<uint64_t, 4>({ 1, 2, 3, 4 }));
+    EXPECT_EQ(0x0000000002800001ull, generator());
+    EXPECT_EQ(0x0000000003800067ull, generator());
+    EXPECT_EQ(0x000CC00003800067ull, generator());
+    EXPECT_EQ(0x000CC201994400B2ull, generator());
+
+    C2D::Xoshiro256 jumped(std::array<uint64_t, 4>({ 1, 2, 3, 4 }));
+    jumped.Jump();
+    EXPECT_EQ(0xEC879073673DF437ull, jumped());
+}
+
+/*!
+ * Testing PCG32 against the reference implementation and testing function Advance()
+ */
+TEST(Random, Pcg32)
+{
+    C2D::Pcg32 generator(42, 54);
+    EXPECT_EQ(0xA15C02B7u, generator());
+    EXPECT_EQ(0x7B47F409u, generator());
+    EXPECT_EQ(0xBA1D3330u, generator());
+    EXPECT_EQ(0x83D2F293u, generator());
+    EXPECT_EQ(0xBFA4784Bu, generator());
+    EXPECT_EQ(0xCBED606Eu, generator());
+
+    C2D::Pcg32 advanced(42, 54);
+    advanced.Advance(4);
+    EXPECT_EQ(0xBFA4784Bu, advanced());
+
+    // Different streams of the same seed produce different sequences
+    C2D::Pcg32 otherStream(42, 55);
+    EXPECT_NE(0xA15C02B7u, otherStream());
+}
+
+/*!
+ * Testing Philox4x32-10 against known answers and testing access by index
+ */
+TEST(Random, Philox4x32)
+{
+    EXPECT_EQ(C2D::Philox4x32::Block({ 0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8 }),
+              C2D::Philox4x32::Generate({ 0, 0, 0, 0 }, { 0, 0 }));
+    EXPECT_EQ(C2D::Philox4x32::Block({ 0x408F276D, 0x41C83B0E, 0xA20BC7C6, 0x6D5451FD }),
+              C2D::Philox4x32::Generate({ 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF },
+                                        { 0xFFFFFFFF, 0xFFFFFFFF }));
+
+    C2D::Philox4x32 generator(12345, 7);
+    std::vector<uint32_t> sequence(103);
+    for (auto& value : sequence)
+    {
+        value = generator();
+    }
+
+    // Any number of the sequence is available directly
+    for (uint64_t i = 0; i < sequence.size(); ++i)
+    {
+        EXPECT_EQ(sequence[i], generator.Get(i));
+    }
+
+    // Filling continues the sequence from any position
+    C2D::Philox4x32 filled(12345, 7);
+    filled.Seek(1);
+    std::vector<uint32_t> values(sequence.size() - 2);
+    filled.Fill(values);
+    EXPECT_EQ(std::vector<uint32_t>(sequence.begin() + 1, sequence.end() - 1), values);
+    EXPECT_EQ(sequence.back(), filled());
+
+    std::vector<float> reals(1000);
+    filled.Fill(reals, -2.0f, 3.0f);
+    for (const auto real : reals)
+    {
+        EXPECT_LE(-2.0f, real);
+        EXPECT_GT(3.0f, real);
+    }
+}
+
+/*!
+ * Testing that generators with the same seed and stream produce the same sequence in any thread
+ */
+TEST(Random, Streams)
+{
+    C2D::RandomGenerator first(100, 1);
+    C2D::RandomGenerator same(100, 1);
+    C2D::RandomGenerator otherStream(100, 2);
+    C2D::RandomGenerator otherSeed(101, 1);
+
+    std::vector<uint64_t> sequence(16);
+    size_t equalToOtherStream(0);
+    size_t equalToOtherSeed(0);
+    for (auto& value : sequence)
+    {
+        value = first.Get64();
+        EXPECT_EQ(value, same.Get64());
+        equalToOtherStream += value == otherStream.Get64();
+        equalToOtherSeed += value == otherSeed.Get64();
+    }
+    EXPECT_EQ(0, equalToOtherStream);
+    EXPECT_EQ(0, equalToOtherSeed);
+
+    // Resetting the seed restarts the sequence
+    first.SetSeed(100);
+    EXPECT_EQ(1, first.GetStream());
+    EXPECT_EQ(sequence[0], first.Get64());
+
+    std::vector<uint64_t> threadSequence(sequence.size());
+    std::thread thread([&threadSequence]()
+    {
+        C2D::RandomGenerator generator(100, 1);
+        for (auto& value : threadSequence)
+        {
+            value = generator.Get64();
+        }
+    });
+    thread.join();
+    EXPECT_EQ(sequence, threadSequence);
+}
+
+/*!
+ * Testing that every thread has its own static instance
+ */
+TEST(Random, Instance)
+{
+    RANDOM.SetSeed(5);
+    const auto* instance = &RANDOM;
+
+    const C2D::RandomGenerator* threadInstance(nullptr);
+    uint32_t threadSeed(0);
+    std::thread thread([&threadInstance, &threadSeed]()
+    {
+        threadInstance = &RANDOM;
+        RANDOM.SetSeed(6);
+        threadSeed = RANDOM.GetSeed();
+    });
+    thread.join();
+
+    EXPECT_NE(instance, threadInstance);
+    EXPECT_EQ(6u, threadSeed);
+    EXPECT_EQ(5u, RANDOM.GetSeed());
+}
+
+/*!
+ * Testing ranges of generated numbers
+ */
+TEST(Random, Ranges)
+{
+    C2D::RandomGenerator generator(1);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto integer = generator.Get<int32_t>(-3, 3);
+        EXPECT_LE(-3, integer);
+        EXPECT_GE(3, integer);
+
+        const auto real = generator.Get<double>(0.5, 1.5);
+        EXPECT_LE(0.5, real);
+        EXPECT_GE(1.5, real);
+    }
+
+    std::vector<int32_t> integers(1001);
+    generator.Fill(integers, -3, 3);
+    std::array<size_t, 7> histogram{};
+    for (const auto integer : integers)
+    {
+        ASSERT_LE(-3, integer);
+        ASSERT_GE(3, integer);
+        ++histogram[integer + 3];
+    }
+    for (const auto count : histogram)
+    {
+        EXPECT_LT(0, count);
+    }
+
+    std::vector<float> reals(1001);
+    generator.Fill(reals, 10.0f, 20.0f);
+    for (const auto real : reals)
+    {
+        EXPECT_LE(10.0f, real);
+        EXPECT_GT(20.0f, real);
+    }
+
+    // Full range of 32-bit integers
+    generator.Fill(integers, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+}
+
+/*!
+ * Comparing generators with Mersenne Twister which was used before.
+ * Timings are printed for reference, only results are checked.
+ */
+TEST(Random, DISABLED_Benchmark)
+{
+    constexpr size_t count = 1 << 22;
+    std::vector<uint32_t> values(count);
+    std::vector<float> reals(count);
+
+    std::mt19937 mersenneTwister(1);
+    MeasureAndPrint("Random", "mt19937 per value", [&]()
+    {
+        for (auto& value : values)
+        {
+            value = mersenneTwister();
+        }
+    });
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    MeasureAndPrint("Random", "mt19937 floats", [&]()
+    {
+        for (auto& real : reals)
+        {
+            real = distribution(mersenneTwister);
+        }
+    });
+
+    C2D::RandomGenerator generator(1);
+    MeasureAndPrint("Random", "RandomGenerator per value", [&]()
+    {
+        for (auto& value : values)
+        {
+            value = generator.Get();
+        }
+    });
+    MeasureAndPrint("Random", "RandomGenerator fill", [&]()
+    {
+        generator.Fill(values);
+    });
+    MeasureAndPrint("Random", "RandomGenerator fill floats", [&]()
+    {
+        generator.Fill(reals, 0.0f, 1.0f);
+    });
+
+    C2D::Pcg32 pcg(1, 0);
+    MeasureAndPrint("Random", "Pcg32 per value", [&]()
+    {
+        for (auto& value : values)
+        {
+            value = pcg();
+        }
+    });
+
+    C2D::Philox4x32 philox(1, 0);
+    MeasureAndPrint("Random", "Philox4x32 fill", [&]()
+    {
+        philox.Fill(values);
+    });
+    EXPECT_EQ(philox.Get(count - 1), values.back());
+    MeasureAndPrint("Random", "Philox4x32 fill floats", [&]()
+    {
+        philox.Fill(reals, 0.0f, 1.0f);
+    });
+
+    for (const auto real : reals)
+    {
+        ASSERT_LE(0.0f, real);
+        ASSERT_GT(1.0f, real);
+    }
+}
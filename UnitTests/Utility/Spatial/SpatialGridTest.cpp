@@ -0,0 +1,126 @@
+#include "Utility/Spatial/SpatialGrid.hpp"
+#include "Utility/Random/Pcg32.hpp"
+#include <gtest/gtest.h>
+#include <limits>
+
+using namespace C2D;
+
+namespace
+{
+    VectorKernels::Bounds MakeBounds(float left, float top, float right, float bottom)
+    {
+        return { Vector2f(left, top), Vector2f(right, bottom) };
+    }
+}
+
+/*!
+ * Testing that queries find intersecting boxes once, in ascending order, and skip empty boxes
+ */
+TEST(SpatialGrid, Query)
+{
+    const std::vector<VectorKernels::Bounds> bounds =
+    {
+        MakeBounds(0.0f, 0.0f, 10.0f, 10.0f),
+        MakeBounds(500.0f, 500.0f, 510.0f, 510.0f),
+        MakeBounds(-100.0f, -100.0f, 1000.0f, 1000.0f), // Covers all cells
+        MakeBounds(10.0f, 10.0f, 0.0f, 0.0f),           // Empty
+        MakeBounds(300.0f, 0.0f, 310.0f, 10.0f)
+    };
+
+    SpatialGrid grid(64.0f);
+    grid.Build(bounds);
+    EXPECT_EQ(bounds.size(), grid.GetSize());
+
+    std::vector<uint32_t> result;
+    grid.Query(MakeBounds(-50.0f, -50.0f, 400.0f, 50.0f), result);
+    EXPECT_EQ(std::vector<uint32_t>({ 0, 2, 4 }), result);
+
+    // Touching the border is an intersection
+    grid.Query(MakeBounds(510.0f, 510.0f, 600.0f, 600.0f), result);
+    EXPECT_EQ(std::vector<uint32_t>({ 1, 2 }), result);
+
+    grid.Query(MakeBounds(2000.0f, 2000.0f, 3000.0f, 3000.0f), result);
+    EXPECT_TRUE(result.empty());
+
+    grid.Build({});
+    grid.Query(MakeBounds(0.0f, 0.0f, 10.0f, 10.0f), result);
+    EXPECT_TRUE(result.empty());
+}
+
+/*!
+ * Testing that queries match brute force and cells grow when boxes are sparse
+ */
+TEST(SpatialGrid, MatchesBruteForce)
+{
+    Pcg32 random(7, 1);
+    const auto randomFloat = [&random](float min, float max)
+    {
+        return min + (max - min) * static_cast<float>(random()) / static_cast<float>(UINT32_MAX);
+    };
+
+    std::vector<VectorKernels::Bounds> bounds;
+    for (int i = 0; i < 500; ++i)
+    {
+        const auto x = randomFloat(-100000.0f, 100000.0f);
+        const auto y = randomFloat(-5000.0f, 5000.0f);
+        bounds.push_back(MakeBounds(x, y, x + randomFloat(0.0f, 3000.0f), y + randomFloat(0.0f, 300.0f)));
+    }
+
+    SpatialGrid grid(16.0f);
+    grid.Build(bounds);
+    EXPECT_GT(grid.GetCellSize(), 16.0f);
+
+    std::vector<uint32_t> result;
+    for (int query = 0; query < 100; ++query)
+    {
+        const auto x = randomFloat(-110000.0f, 110000.0f);
+        const auto y = randomFloat(-6000.0f, 6000.0f);
+        const auto area = MakeBounds(x, y, x + randomFloat(0.0f, 20000.0f), y + randomFloat(0.0f, 2000.0f));
+
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < bounds.size(); ++i)
+        {
+            if (bounds[i].min.x <= area.max.x && area.min.x <= bounds[i].max.x &&
+                bounds[i].min.y <= area.max.y && area.min.y <= bounds[i].max.y)
+            {
+                expected.push_back(i);
+            }
+        }
+
+        grid.Query(area, result);
+        EXPECT_EQ(expected, result);
+    }
+}
+
+/*!
+ * Testing that boxes with infinite or NaN coordinates are skipped, so they do not make the grid infinite
+ */
+TEST(SpatialGrid, SkipInfiniteBoxes)
+{
+    constexpr auto infinity = std::numeric_limits<float>::infinity();
+    constexpr auto nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<VectorKernels::Bounds> bounds =
+    {
+        MakeBounds(0.0f, 0.0f, 10.0f, 10.0f),
+        MakeBounds(-infinity, 0.0f, 10.0f, 10.0f),
+        MakeBounds(0.0f, 0.0f, infinity, infinity),
+        MakeBounds(0.0f, nan, 10.0f, 10.0f),
+        MakeBounds(100.0f, 100.0f, 110.0f, 110.0f)
+    };
+
+    SpatialGrid grid(64.0f);
+    grid.Build(bounds);
+    EXPECT_EQ(64.0f, grid.GetCellSize());
+
+    // Infinite area is clamped to the grid
+    std::vector<uint32_t> result;
+    grid.Query(MakeBounds(-infinity, -infinity, infinity, infinity), result);
+    EXPECT_EQ(std::vector<uint32_t>({ 0, 4 }), result);
+
+    grid.Query(MakeBounds(nan, 0.0f, 10.0f, 10.0f), result);
+    EXPECT_TRUE(result.empty());
+
+    grid.Build(std::vector<VectorKernels::Bounds>({ MakeBounds(-infinity, -infinity, infinity, infinity) }));
+    grid.Query(MakeBounds(0.0f, 0.0f, 10.0f, 10.0f), result);
+    EXPECT_TRUE(result.empty());
+}
@@ -0,0 +1,85 @@
+#include "Utility/Threading/WorkerPool.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+
+using namespace C2D;
+
+/*!
+ * Testing that every task runs once on the worker given by the static split
+ */
+TEST(WorkerPool, ParallelFor)
+{
+    WorkerPool pool(4);
+    EXPECT_EQ(4u, pool.GetWorkerCount());
+    EXPECT_EQ(1u, pool.GetActiveWorkerCount(0));
+    EXPECT_EQ(3u, pool.GetActiveWorkerCount(3));
+    EXPECT_EQ(4u, pool.GetActiveWorkerCount(100));
+
+    // The same pool runs many jobs, as it does once per frame
+    for (size_t taskCount : { 0u, 1u, 2u, 3u, 4u, 5u, 17u, 100u, 1u, 64u })
+    {
+        std::vector<std::atomic<uint32_t>> runs(taskCount);
+        std::vector<size_t> workers(taskCount, 0);
+        pool.ParallelFor(taskCount, [&](size_t task, size_t worker)
+        {
+            runs[task].fetch_add(1);
+            workers[task] = worker;
+        });
+
+        const auto activeWorkerCount = pool.GetActiveWorkerCount(taskCount);
+        for (size_t task = 0; task < taskCount; ++task)
+        {
+            EXPECT_EQ(1u, runs[task].load());
+            EXPECT_EQ(task % activeWorkerCount, workers[task]);
+        }
+    }
+}
+
+/*!
+ * Testing that a single task and a pool of one worker run on the calling thread
+ */
+TEST(WorkerPool, CallingThread)
+{
+    const auto callingThread = std::this_thread::get_id();
+
+    WorkerPool pool(4);
+    pool.ParallelFor(1, [&](size_t, size_t worker)
+    {
+        EXPECT_EQ(0u, worker);
+        EXPECT_EQ(callingThread, std::this_thread::get_id());
+    });
+
+    WorkerPool singlePool(1);
+    EXPECT_EQ(1u, singlePool.GetWorkerCount());
+    singlePool.ParallelFor(10, [&](size_t, size_t worker)
+    {
+        EXPECT_EQ(0u, worker);
+        EXPECT_EQ(callingThread, std::this_thread::get_id());
+    });
+}
+
+/*!
+ * Testing that an exception of a task is rethrown after all tasks are done and the pool stays usable
+ */
+TEST(WorkerPool, Exception)
+{
+    WorkerPool pool(3);
+    std::atomic<uint32_t> runCount(0);
+    EXPECT_THROW(pool.ParallelFor(9, [&](size_t task, size_t)
+                 {
+                     runCount.fetch_add(1);
+                     if (task == 4)
+                     {
+                         throw std::runtime_error("Task failed");
+                     }
+                 }),
+                 std::runtime_error);
+
+    // Worker that threw skips its remaining tasks, the others finish theirs
+    EXPECT_EQ(8u, runCount.load());
+
+    runCount = 0;
+    pool.ParallelFor(9, [&](size_t, size_t) { runCount.fetch_add(1); });
+    EXPECT_EQ(9u, runCount.load());
+}
@@ -0,0 +1,252 @@
+#include "Utility/Time/EngineClock.hpp"
+#include "Utility/Time/FrameLimiter.hpp"
+#include "Utility/Time/GameTime.hpp"
+#include "Utility/Time/TimeSpan.hpp"
+#include "Utility/Time/TimerWheel.hpp"
+#include "BenchmarkHelpers.hpp"
+#include <gtest/gtest.h>
+#include <iostream>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+/*!
+ * Testing that the engine clock is monotonic and follows the steady clock
+ */
+TEST(Time, EngineClock)
+{
+    C2D::EngineClock::Calibrate();
+    std::cout << "[ EngineClock ] TSC is used: " << C2D::EngineClock::IsTscUsed()
+              << ", frequency: " << C2D::EngineClock::GetTscFrequency() << " Hz" << std::endl;
+
+    auto previous = C2D::EngineClock::now();
+    for (int i = 0; i < 100000; ++i)
+    {
+        const auto current = C2D::EngineClock::now();
+        ASSERT_LE(previous, current);
+        previous = current;
+    }
+
+    const auto steadyStart = std::chrono::steady_clock::now();
+    const auto start = C2D::EngineClock::now();
+    std::this_thread::sleep_for(50ms);
+    const auto elapsed = C2D::EngineClock::now() - start;
+    const auto steadyElapsed = std::chrono::steady_clock::now() - steadyStart;
+    EXPECT_GE(elapsed, 50ms);
+    const std::chrono::duration<double, std::milli> difference = steadyElapsed - elapsed;
+    EXPECT_NEAR(0.0, difference.count(), 1.0);
+
+    // Conversion to the steady clock and back
+    const auto now = C2D::EngineClock::now();
+    EXPECT_EQ(now, C2D::EngineClock::FromSteadyTime(C2D::EngineClock::ToSteadyTime(now)));
+    const auto steadyNow = std::chrono::steady_clock::now();
+    const std::chrono::duration<double, std::milli> offset = steadyNow - C2D::EngineClock::ToSteadyTime(now);
+    EXPECT_NEAR(0.0, offset.count(), 1.0);
+}
+
+/*!
+ * Comparing cost of the engine clock and the steady clock, results are only printed
+ */
+TEST(Time, DISABLED_EngineClockBenchmark)
+{
+    constexpr int callCount = 1000000;
+    int64_t sum(0);
+
+    MeasureAndPrint("EngineClock", "EngineClock::now", [&sum]()
+    {
+        for (int i = 0; i < callCount; ++i)
+        {
+            sum += C2D::EngineClock::now().time_since_epoch().count();
+        }
+    }, callCount);
+    MeasureAndPrint("EngineClock", "steady_clock::now", [&sum]()
+    {
+        for (int i = 0; i < callCount; ++i)
+        {
+            sum += std::chrono::steady_clock::now().time_since_epoch().count();
+        }
+    }, callCount);
+    EXPECT_NE(0, sum);
+}
+
+/*!
+ * Testing deltas and smoothing of the time span
+ */
+TEST(Time, TimeSpan)
+{
+    const C2D::EngineTimePoint start(1s);
+    C2D::TimeSpan timeSpan(0.5f);
+    timeSpan.Reset(start);
+    EXPECT_EQ(start, timeSpan.GetStart());
+    EXPECT_EQ(start, timeSpan.GetEnd());
+    EXPECT_EQ(0, timeSpan.GetIterationCount());
+
+    // The first delta is not averaged with zero
+    timeSpan.SetNewEnd(start + 10ms);
+    EXPECT_EQ(start, timeSpan.GetStart());
+    EXPECT_EQ(start + 10ms, timeSpan.GetEnd());
+    EXPECT_EQ(10ms, timeSpan.GetDelta());
+    EXPECT_EQ(10ms, timeSpan.GetSmoothedDelta());
+    EXPECT_FLOAT_EQ(0.01f, timeSpan.GetDeltaSeconds());
+
+    timeSpan.SetNewEnd(start + 40ms);
+    EXPECT_EQ(start + 10ms, timeSpan.GetStart());
+    EXPECT_EQ(30ms, timeSpan.GetDelta());
+    EXPECT_EQ(20ms, timeSpan.GetSmoothedDelta());
+    EXPECT_EQ(2, timeSpan.GetIterationCount());
+
+    // Time can not go backwards
+    timeSpan.SetNewEnd(start);
+    EXPECT_EQ(0ms, timeSpan.GetDelta());
+    EXPECT_EQ(start + 40ms, timeSpan.GetEnd());
+}
+
+/*!
+ * Testing scale, pause and clamping of the game time
+ */
+TEST(Time, GameTime)
+{
+    C2D::GameTime gameTime(100ms);
+    gameTime.Advance(10ms);
+    EXPECT_EQ(10ms, gameTime.GetDelta());
+
+    gameTime.SetScale(0.5f);
+    gameTime.Advance(10ms);
+    EXPECT_EQ(5ms, gameTime.GetDelta());
+    EXPECT_EQ(15ms, gameTime.GetTime());
+
+    gameTime.Pause();
+    EXPECT_TRUE(gameTime.IsPaused());
+    gameTime.Advance(10ms);
+    EXPECT_EQ(0ms, gameTime.GetDelta());
+    EXPECT_EQ(15ms, gameTime.GetTime());
+
+    // Hitches are clamped
+    gameTime.Resume();
+    gameTime.SetScale(1.0f);
+    gameTime.Advance(1s);
+    EXPECT_EQ(100ms, gameTime.GetDelta());
+    EXPECT_EQ(115ms, gameTime.GetTime());
+    EXPECT_EQ(1030ms, gameTime.GetRealTime());
+
+    gameTime.SetScale(-1.0f);
+    EXPECT_EQ(0.0f, gameTime.GetScale());
+}
+
+/*!
+ * Testing order, cancellation and repetition of timers
+ */
+TEST(Time, TimerWheel)
+{
+    C2D::TimerWheel timers(1ms, 8);
+    std::vector<int> fired;
+
+    timers.Schedule(5ms, [&fired]() { fired.push_back(5); });
+    timers.Schedule(3ms, [&fired]() { fired.push_back(3); });
+    // Delay is longer than the whole wheel, so the timer waits for several revolutions
+    timers.Schedule(20ms, [&fired]() { fired.push_back(20); });
+    const auto canceled = timers.Schedule(4ms, [&fired]() { fired.push_back(4); });
+    EXPECT_EQ(4, timers.GetCount());
+    EXPECT_TRUE(timers.Cancel(canceled));
+    EXPECT_FALSE(timers.Cancel(canceled));
+
+    timers.Advance(2ms);
+    EXPECT_TRUE(fired.empty());
+    timers.Advance(4ms);
+    EXPECT_EQ(std::vector<int>({ 3, 5 }), fired);
+    timers.Advance(13ms);
+    EXPECT_EQ(2, fired.size());
+    timers.Advance(1ms);
+    EXPECT_EQ(std::vector<int>({ 3, 5, 20 }), fired);
+    EXPECT_EQ(0, timers.GetCount());
+    EXPECT_EQ(20ms, timers.GetTime());
+
+    // Repeating timer keeps the phase and catches up
+    int repeatCount(0);
+    const auto repeating = timers.ScheduleRepeating(10ms, [&repeatCount]() { ++repeatCount; });
+    timers.Advance(15ms);
+    EXPECT_EQ(1, repeatCount);
+    timers.Advance(5ms);
+    EXPECT_EQ(2, repeatCount);
+    timers.Advance(100ms);
+    EXPECT_EQ(12, repeatCount);
+    EXPECT_TRUE(timers.Cancel(repeating));
+    timers.Advance(100ms);
+    EXPECT_EQ(12, repeatCount);
+}
+
+/*!
+ * Testing callbacks that schedule and cancel timers
+ */
+TEST(Time, TimerWheelReentrancy)
+{
+    C2D::TimerWheel timers;
+    std::vector<int> fired;
+
+    // Repeating timer cancels itself on the third call
+    C2D::TimerWheel::TimerId self(0);
+    int selfCount(0);
+    self = timers.ScheduleRepeating(1ms, [&]()
+    {
+        if (++selfCount == 3)
+        {
+            timers.Cancel(self);
+        }
+    });
+
+    // Timer cancels another one that expires at the same advance
+    C2D::TimerWheel::TimerId victim(0);
+    timers.Schedule(2ms, [&]()
+    {
+        fired.push_back(1);
+        timers.Cancel(victim);
+        timers.Schedule(0ms, [&fired]() { fired.push_back(3); });
+    });
+    victim = timers.Schedule(3ms, [&fired]() { fired.push_back(2); });
+
+    timers.Advance(10ms);
+    EXPECT_EQ(3, selfCount);
+    EXPECT_EQ(std::vector<int>({ 1 }), fired);
+
+    // Timers scheduled from callbacks fire at the next advance
+    timers.Advance(1ms);
+    EXPECT_EQ(std::vector<int>({ 1, 3 }), fired);
+    EXPECT_EQ(0, timers.GetCount());
+}
+
+/*!
+ * Testing that the frame limiter keeps the cadence and that the limit can be disabled
+ */
+TEST(Time, FrameLimiter)
+{
+    C2D::FrameLimiter frameLimiter;
+    EXPECT_EQ(0.0, frameLimiter.GetFrameRate());
+    EXPECT_EQ(C2D::EngineDuration::zero(), frameLimiter.Wait());
+
+    frameLimiter.SetFrameRate(200.0);
+    EXPECT_EQ(5ms, frameLimiter.GetInterval());
+    EXPECT_DOUBLE_EQ(200.0, frameLimiter.GetFrameRate());
+
+    // The first frame starts immediately, the next ones never before their deadlines. A late frame does not
+    // shift the following deadlines, so only the total time is bounded from above
+    constexpr int frameCount = 21;
+    const auto start = C2D::EngineClock::now();
+    auto previous = start;
+    for (int i = 0; i < frameCount; ++i)
+    {
+        frameLimiter.Wait();
+        previous = C2D::EngineClock::now();
+        EXPECT_GE(previous - start, i * 5ms);
+    }
+    const std::chrono::duration<double, std::milli> elapsed = previous - start;
+    EXPECT_LT(elapsed.count(), 150.0);
+    EXPECT_GE(frameLimiter.GetSpinMargin(), 50us);
+    EXPECT_LE(frameLimiter.GetSpinMargin(), 4ms);
+
+    // Late frame starts the cadence over instead of a burst of frames without waiting
+    std::this_thread::sleep_for(20ms);
+    frameLimiter.Wait();
+    const auto lateFrame = C2D::EngineClock::now();
+    frameLimiter.Wait();
+    EXPECT_GE(C2D::EngineClock::now() - lateFrame, 4ms);
+}
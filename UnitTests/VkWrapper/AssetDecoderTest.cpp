@@ -0,0 +1,106 @@
+#include "VkWrapper/Assets/AssetDecoder.hpp"
+#include <string>
+#include <gtest/gtest.h>
+
+using namespace VkWrapper;
+
+namespace
+{
+    std::vector<uint8_t> ToBytes(const std::string& header, const std::vector<uint8_t>& pixels)
+    {
+        std::vector<uint8_t> bytes(header.begin(), header.end());
+        bytes.insert(bytes.end(), pixels.begin(), pixels.end());
+        return bytes;
+    }
+}
+
+/*!
+ * Testing that RGB pixels of PPM are expanded to RGBA and comments are skipped
+ */
+TEST(AssetDecoder, DecodePpm)
+{
+    // The first pixel looks like a whitespace, so it must not be consumed by the header
+    const auto data = ToBytes("P6\n# Comment\n2 1\n255\n", { 10, 20, 30, 40, 50, 60 });
+
+    const auto image = DecodeNetpbm(data);
+    ASSERT_TRUE(image.has_value());
+    EXPECT_EQ(2, image->extent.width);
+    EXPECT_EQ(1, image->extent.height);
+    EXPECT_EQ(std::vector<uint8_t>({ 10, 20, 30, 255, 40, 50, 60, 255 }), image->pixels);
+}
+
+/*!
+ * Testing PAM with different depths and scaling of channels with a smaller maximum value
+ */
+TEST(AssetDecoder, DecodePam)
+{
+    const auto rgba = DecodeNetpbm(ToBytes("P7\nWIDTH 1\nHEIGHT 1\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n",
+                                           { 1, 2, 3, 4 }));
+    ASSERT_TRUE(rgba.has_value());
+    EXPECT_EQ(std::vector<uint8_t>({ 1, 2, 3, 4 }), rgba->pixels);
+
+    const auto grayscaleAlpha = DecodeNetpbm(ToBytes("P7\nWIDTH 1\nHEIGHT 1\nDEPTH 2\nMAXVAL 15\nENDHDR\n",
+                                                     { 15, 5 }));
+    ASSERT_TRUE(grayscaleAlpha.has_value());
+    EXPECT_EQ(std::vector<uint8_t>({ 255, 255, 255, 85 }), grayscaleAlpha->pixels);
+}
+
+/*!
+ * Testing that unsupported and truncated images are rejected
+ */
+TEST(AssetDecoder, RejectInvalidImages)
+{
+    EXPECT_FALSE(DecodeNetpbm(ToBytes("P3\n1 1\n255\n", { 1, 2, 3 })).has_value());
+    EXPECT_FALSE(DecodeNetpbm(ToBytes("P6\n2 1\n255\n", { 1, 2, 3 })).has_value());
+    EXPECT_FALSE(DecodeNetpbm(ToBytes("P6\n1 1\n65535\n", { 1, 2, 3, 4, 5, 6 })).has_value());
+    EXPECT_FALSE(DecodeNetpbm(ToBytes("P7\nWIDTH 1\nHEIGHT 1\nDEPTH 5\nMAXVAL 255\nENDHDR\n",
+                                      { 1, 2, 3, 4, 5 })).has_value());
+    EXPECT_FALSE(DecodeNetpbm({}).has_value());
+}
+
+/*!
+ * Testing that PNG is decoded to RGBA and the format of images is detected by the signature
+ */
+TEST(AssetDecoder, DecodePng)
+{
+    // 2x1 RGBA image with pixels { 10, 20, 30, 255 } and { 40, 50, 60, 128 }
+    const std::vector<uint8_t> png =
+    {
+        0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x08, 0x06, 0x00, 0x00, 0x00, 0xf4, 0x22, 0x7f,
+        0x8a, 0x00, 0x00, 0x00, 0x11, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0x63, 0xe0, 0x12, 0x91, 0xfb,
+        0xaf, 0x61, 0x64, 0xd3, 0x00, 0x00, 0x08, 0xc2, 0x02, 0x52, 0x06, 0xcb, 0x66, 0xbe, 0x00, 0x00,
+        0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+    };
+
+    const auto image = DecodePng(png);
+    ASSERT_TRUE(image.has_value());
+    EXPECT_EQ(2, image->extent.width);
+    EXPECT_EQ(1, image->extent.height);
+    EXPECT_EQ(std::vector<uint8_t>({ 10, 20, 30, 255, 40, 50, 60, 128 }), image->pixels);
+
+    const auto detected = DecodeImage(png);
+    ASSERT_TRUE(detected.has_value());
+    EXPECT_EQ(image->pixels, detected->pixels);
+    EXPECT_TRUE(DecodeImage(ToBytes("P6\n1 1\n255\n", { 1, 2, 3 })).has_value());
+
+    // Truncated image and Netpbm are not PNG
+    EXPECT_FALSE(DecodePng({ png.data(), png.size() - 20 }).has_value());
+    EXPECT_FALSE(DecodePng(ToBytes("P6\n1 1\n255\n", { 1, 2, 3 })).has_value());
+    EXPECT_FALSE(DecodeImage({ png.data(), 4 }).has_value());
+}
+
+/*!
+ * Testing the check of the SPIR-V header
+ */
+TEST(AssetDecoder, IsSpirV)
+{
+    std::vector<uint32_t> module = { 0x07230203, 0x00010000, 0, 1, 0 };
+    const auto* bytes = reinterpret_cast<const uint8_t*>(module.data());
+
+    EXPECT_TRUE(IsSpirV({ bytes, module.size() * sizeof(uint32_t) }));
+    EXPECT_FALSE(IsSpirV({ bytes, module.size() * sizeof(uint32_t) - 1 }));
+
+    module[0] = 0x03022307;
+    EXPECT_FALSE(IsSpirV({ bytes, module.size() * sizeof(uint32_t) }));
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include "VkWrapper/PDevice.hpp"
+#include <cstring>
+#include <gtest/gtest.h>
+
+using namespace VkWrapper;
+
+namespace
+{
+    /*!
+     * Describes a mock device, nothing is queried from the driver.
+     */
+    PDevice CreateMockPDevice(const char* name,
+                              VkPhysicalDeviceType type,
+                              VkDeviceSize vramMiB,
+                              std::vector<VkQueueFlags> queueFamilies = { VK_QUEUE_GRAPHICS_BIT |
+                                                                          VK_QUEUE_COMPUTE_BIT |
+                                                                          VK_QUEUE_TRANSFER_BIT },
+                              std::vector<const char*> extensions = {},
+                              uint32_t apiVersion = VK_API_VERSION_1_1)
+    {
+        VkPhysicalDeviceProperties properties{};
+        properties.apiVersion = apiVersion;
+        properties.deviceType = type;
+        std::strncpy(properties.deviceName, name, VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1);
+        properties.limits.maxImageDimension2D = 16384;
+        properties.limits.maxPushConstantsSize = 128;
+
+        VkPhysicalDeviceMemoryProperties memoryProperties{};
+        memoryProperties.memoryHeapCount = 1;
+        memoryProperties.memoryHeaps[0].size = vramMiB * 1024 * 1024;
+        memoryProperties.memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+
+        std::vector<VkExtensionProperties> extensionProperties(extensions.size());
+        for (size_t i = 0; i < extensions.size(); ++i)
+        {
+            std::strncpy(extensionProperties[i].extensionName, extensions[i], VK_MAX_EXTENSION_NAME_SIZE - 1);
+        }
+
+        std::vector<VkQueueFamilyProperties> queueFamilyProperties(queueFamilies.size());
+        for (size_t i = 0; i < queueFamilies.size(); ++i)
+        {
+            queueFamilyProperties[i].queueFlags = queueFamilies[i];
+            queueFamilyProperties[i].queueCount = 1;
+        }
+
+        return PDevice(VK_NULL_HANDLE,
+                       properties,
+                       memoryProperties,
+                       VkPhysicalDeviceFeatures{},
+                       std::move(extensionProperties),
+                       std::move(queueFamilyProperties));
+    }
+
+    std::vector<std::reference_wrapper<const PDevice>> ToReferences(const std::vector<PDevice>& pDevices)
+    {
+        return { pDevices.begin(), pDevices.end() };
+    }
+}
+
+/*!
+ * Testing that the device type outweighs other parts of the score
+ */
+TEST(PDevice, ScoreByType)
+{
+    const auto discrete = CreateMockPDevice("Discrete", VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, 4096);
+    const auto integrated = CreateMockPDevice("Integrated", VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU, 16384);
+    const auto software = CreateMockPDevice("llvmpipe", VK_PHYSICAL_DEVICE_TYPE_CPU, 32768);
+
+    EXPECT_GT(discrete.GetScore(), integrated.GetScore());
+    EXPECT_GT(integrated.GetScore(), software.GetScore());
+    EXPECT_NE(std::string::npos, discrete.GetScoreDescription().find("discrete GPU"));
+
+    // Type tiers hold even against the best capabilities, e.g. a virtual GPU with the largest limits
+    const auto bestVirtual = CreateMockPDevice("Virtual",
+                                         VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU,
+                                         65536,
+                                         { VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT,
+                                           VK_QUEUE_COMPUTE_BIT,
+                                           VK_QUEUE_TRANSFER_BIT },
+                                         {},
+                                         VK_API_VERSION_1_3);
+    auto properties = bestVirtual.GetProperties();
+    properties.limits.maxImageDimension2D = 65536;
+    properties.limits.maxPushConstantsSize = 4096;
+    const PDevice virtualWithLargeLimits(VK_NULL_HANDLE,
+                                         properties,
+                                         bestVirtual.GetMemoryProperties(),
+                                         VkPhysicalDeviceFeatures{},
+                                         {},
+                                         bestVirtual.GetQueueFamilies());
+    const auto worstIntegrated = CreateMockPDevice("Integrated", VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU, 0, {});
+    EXPECT_GT(worstIntegrated.GetScore(), virtualWithLargeLimits.GetScore());
+}
+
+/*!
+ * Testing that memory, dedicated queues and extensions distinguish devices of the same type
+ */
+TEST(PDevice, ScoreByCapabilities)
+{
+    const auto small = CreateMockPDevice("Small", VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, 2048);
+    const auto large = CreateMockPDevice("Large", VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, 8192);
+    EXPECT_GT(large.GetScore(), small.GetScore());
+
+    const auto withQueues = CreateMockPDevice("Queues",
+                                              VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU,
+                                              2048,
+                                              { VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT,
+                                                VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT,
+                                                VK_QUEUE_TRANSFER_BIT });
+    EXPECT_EQ(small.GetScore() + 1000, withQueues.GetScore());
+
+    const auto withExtensions = CreateMockPDevice("Extensions",
+                                                  VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU,
+                                                  2048,
+                                                  { VK_QUEUE_GRAPHICS_BIT },
+                                                  { VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME });
+    EXPECT_EQ(small.GetScore() + 300, withExtensions.GetScore());
+    EXPECT_TRUE(withExtensions.IsExtensionSupported(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME));
+    EXPECT_FALSE(withExtensions.IsExtensionSupported(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME));
+
+    // Descriptor indexing and timeline semaphores are core in Vulkan 1.2
+    const auto vulkan12 = CreateMockPDevice("Vulkan 1.2",
+                                            VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU,
+                                            2048,
+                                            { VK_QUEUE_GRAPHICS_BIT },
+                                            {},
+                                            VK_API_VERSION_1_2);
+    EXPECT_EQ(small.GetScore() + 600, vulkan12.GetScore());
+}
+
+/*!
+ * Testing selection of the device with the highest score
+ */
+TEST(PDevice, SelectByScore)
+{
+    const std::vector<PDevice> pDevices =
+    {
+        CreateMockPDevice("llvmpipe", VK_PHYSICAL_DEVICE_TYPE_CPU, 32768),
+        CreateMockPDevice("Discrete", VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, 8192),
+        CreateMockPDevice("Integrated", VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU, 16384)
+    };
+
+    EXPECT_EQ(1ull, SelectPDevice(ToReferences(pDevices), ""));
+
+    // Ties are resolved in favor of the first device
+    const std::vector<PDevice> sameDevices =
+    {
+        CreateMockPDevice("First", VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, 8192),
+        CreateMockPDevice("Second", VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, 8192)
+    };
+    EXPECT_EQ(0ull, SelectPDevice(ToReferences(sameDevices), ""));
+}
+
+/*!
+ * Testing that the device from the configuration is selected regardless of its score
+ */
+TEST(PDevice, SelectForced)
+{
+    const std::vector<PDevice> pDevices =
+    {
+        CreateMockPDevice("Discrete", VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, 8192),
+        CreateMockPDevice("llvmpipe", VK_PHYSICAL_DEVICE_TYPE_CPU, 32768)
+    };
+
+    EXPECT_EQ(1ull, SelectPDevice(ToReferences(pDevices), "llvmpipe"));
+
+    // Unknown device falls back to the score
+    EXPECT_EQ(0ull, SelectPDevice(ToReferences(pDevices), "Unknown"));
+}
\ No newline at end of file
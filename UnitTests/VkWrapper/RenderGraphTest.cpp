@@ -0,0 +1,192 @@
+#include "VkWrapper/RenderGraph/RenderGraph.hpp"
+#include <gtest/gtest.h>
+
+using namespace VkWrapper;
+
+namespace
+{
+    /*!
+     * Graphs in tests use only imported images, so compilation does not create Vulkan objects.
+     */
+    PDevice CreateMockPDevice()
+    {
+        return PDevice(VK_NULL_HANDLE,
+                       VkPhysicalDeviceProperties{},
+                       VkPhysicalDeviceMemoryProperties{},
+                       VkPhysicalDeviceFeatures{},
+                       {},
+                       {});
+    }
+
+    const RenderGraph::RecordFunction emptyRecord = [](const RenderGraph::PassContext&) { };
+}
+
+/*!
+ * Testing that passes whose results are not used are culled
+ */
+TEST(RenderGraph, CullUnusedPasses)
+{
+    const auto pDevice = CreateMockPDevice();
+    RenderGraph graph(VK_NULL_HANDLE, pDevice, 0, 1);
+    const auto target = graph.ImportImage("Target", {});
+    const auto unused = graph.CreateTransientImage("Unused", { VK_FORMAT_R8G8B8A8_UNORM, { 64, 64 } });
+
+    graph.AddPass("Unused", [unused](RenderGraph::PassBuilder& builder)
+    {
+        builder.Write(unused, RenderGraph::Access::ColorAttachment);
+    }, emptyRecord);
+    graph.AddPass("Draw", [target](RenderGraph::PassBuilder& builder)
+    {
+        builder.Write(target, RenderGraph::Access::ColorAttachment);
+    }, emptyRecord);
+    graph.Compile();
+
+    EXPECT_EQ(std::vector<std::string>({ "Draw" }), graph.GetCompiledPasses());
+    EXPECT_FALSE(graph.UsesSecondaryCommandBuffers());
+    EXPECT_EQ(0, graph.GetTransientMemorySize());
+}
+
+/*!
+ * Testing that a pass is culled if the next pass overwrites its result and kept if the next pass reads it
+ */
+TEST(RenderGraph, CullOverwrittenPasses)
+{
+    const auto pDevice = CreateMockPDevice();
+    RenderGraph overwritingGraph(VK_NULL_HANDLE, pDevice, 0, 1);
+    auto target = overwritingGraph.ImportImage("Target", {});
+    overwritingGraph.AddPass("Draw", [target](RenderGraph::PassBuilder& builder)
+    {
+        builder.Write(target, RenderGraph::Access::ColorAttachment);
+    }, emptyRecord);
+    overwritingGraph.AddPass("Copy", [target](RenderGraph::PassBuilder& builder)
+    {
+        builder.Write(target, RenderGraph::Access::TransferDestination);
+    }, emptyRecord);
+    overwritingGraph.Compile();
+    EXPECT_EQ(std::vector<std::string>({ "Copy" }), overwritingGraph.GetCompiledPasses());
+
+    RenderGraph blendingGraph(VK_NULL_HANDLE, pDevice, 0, 1);
+    target = blendingGraph.ImportImage("Target", {});
+    blendingGraph.AddPass("Background", [target](RenderGraph::PassBuilder& builder)
+    {
+        builder.Write(target, RenderGraph::Access::ColorAttachment);
+    }, emptyRecord);
+    blendingGraph.AddPass("Sprites", [target](RenderGraph::PassBuilder& builder)
+    {
+        builder.Read(target, RenderGraph::Access::ColorAttachment);
+        builder.Write(target, RenderGraph::Access::ColorAttachment);
+    }, emptyRecord);
+    blendingGraph.Compile();
+    EXPECT_EQ(std::vector<std::string>({ "Background", "Sprites" }), blendingGraph.GetCompiledPasses());
+    EXPECT_TRUE(blendingGraph.UsesSecondaryCommandBuffers());
+}
+
+/*!
+ * Testing layout transitions and dependencies between passes and after the graph
+ */
+TEST(RenderGraph, Barriers)
+{
+    const auto pDevice = CreateMockPDevice();
+    RenderGraph graph(VK_NULL_HANDLE, pDevice, 0, 1);
+    const auto target = graph.ImportImage("Target", {});
+    const auto copy = graph.ImportImage("Copy", { .finalLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL });
+
+    graph.AddPass("Draw", [target](RenderGraph::PassBuilder& builder)
+    {
+        builder.Write(target, RenderGraph::Access::ColorAttachment);
+    }, emptyRecord);
+    graph.AddPass("Copy", [target, copy](RenderGraph::PassBuilder& builder)
+    {
+        builder.Read(target, RenderGraph::Access::TransferSource);
+        builder.Write(copy, RenderGraph::Access::TransferDestination);
+    }, emptyRecord);
+    graph.Compile();
+
+    const auto& drawBarriers = graph.GetPassBarriers(0);
+    ASSERT_EQ(1, drawBarriers.size());
+    EXPECT_EQ(target, drawBarriers[0].resource);
+    EXPECT_EQ(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, drawBarriers[0].srcStage);
+    EXPECT_EQ(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, drawBarriers[0].dstStage);
+    EXPECT_EQ(0, drawBarriers[0].srcAccess);
+    EXPECT_EQ(VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, drawBarriers[0].dstAccess);
+    EXPECT_EQ(VK_IMAGE_LAYOUT_UNDEFINED, drawBarriers[0].oldLayout);
+    EXPECT_EQ(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, drawBarriers[0].newLayout);
+
+    const auto& copyBarriers = graph.GetPassBarriers(1);
+    ASSERT_EQ(2, copyBarriers.size());
+    EXPECT_EQ(target, copyBarriers[0].resource);
+    EXPECT_EQ(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, copyBarriers[0].srcStage);
+    EXPECT_EQ(VK_PIPELINE_STAGE_TRANSFER_BIT, copyBarriers[0].dstStage);
+    EXPECT_EQ(VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, copyBarriers[0].srcAccess);
+    EXPECT_EQ(VK_ACCESS_TRANSFER_READ_BIT, copyBarriers[0].dstAccess);
+    EXPECT_EQ(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, copyBarriers[0].newLayout);
+    EXPECT_EQ(copy, copyBarriers[1].resource);
+    EXPECT_EQ(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copyBarriers[1].newLayout);
+
+    // The copy stays in its final layout, but its write must be made available
+    const auto& finalBarriers = graph.GetFinalBarriers();
+    ASSERT_EQ(2, finalBarriers.size());
+    EXPECT_EQ(target, finalBarriers[0].resource);
+    EXPECT_EQ(VK_PIPELINE_STAGE_TRANSFER_BIT, finalBarriers[0].srcStage);
+    EXPECT_EQ(0, finalBarriers[0].srcAccess);
+    EXPECT_EQ(VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, finalBarriers[0].newLayout);
+    EXPECT_EQ(copy, finalBarriers[1].resource);
+    EXPECT_EQ(VK_ACCESS_TRANSFER_WRITE_BIT, finalBarriers[1].srcAccess);
+    EXPECT_EQ(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, finalBarriers[1].oldLayout);
+    EXPECT_EQ(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, finalBarriers[1].newLayout);
+}
+
+/*!
+ * Testing that reads in the same layout do not wait for each other
+ */
+TEST(RenderGraph, NoBarrierBetweenReads)
+{
+    const auto pDevice = CreateMockPDevice();
+    RenderGraph graph(VK_NULL_HANDLE, pDevice, 0, 1);
+    const auto scene = graph.ImportImage("Scene", {});
+    const auto first = graph.ImportImage("First", {});
+    const auto second = graph.ImportImage("Second", {});
+
+    graph.AddPass("Scene", [scene](RenderGraph::PassBuilder& builder)
+    {
+        builder.Write(scene, RenderGraph::Access::ColorAttachment);
+    }, emptyRecord);
+    graph.AddPass("First", [scene, first](RenderGraph::PassBuilder& builder)
+    {
+        builder.Read(scene, RenderGraph::Access::Sampled);
+        builder.Write(first, RenderGraph::Access::ColorAttachment);
+    }, emptyRecord);
+    graph.AddPass("Second", [scene, second](RenderGraph::PassBuilder& builder)
+    {
+        builder.Read(scene, RenderGraph::Access::Sampled);
+        builder.Write(second, RenderGraph::Access::ColorAttachment);
+    }, emptyRecord);
+    graph.Compile();
+
+    ASSERT_EQ(3, graph.GetCompiledPasses().size());
+    const auto& firstBarriers = graph.GetPassBarriers(1);
+    ASSERT_EQ(2, firstBarriers.size());
+    EXPECT_EQ(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, firstBarriers[0].newLayout);
+
+    const auto& secondBarriers = graph.GetPassBarriers(2);
+    ASSERT_EQ(1, secondBarriers.size());
+    EXPECT_EQ(second, secondBarriers[0].resource);
+}
+
+/*!
+ * Testing that blocks with disjoint lifetimes share memory and alignment is respected
+ */
+TEST(RenderGraph, AssignMemoryOffsets)
+{
+    const std::vector<RenderGraph::AliasingRequest> requests =
+    {
+        { 100, 1, 0, 1 },
+        { 100, 1, 2, 3 },
+        { 50, 64, 1, 2 }
+    };
+
+    VkDeviceSize totalSize;
+    const auto offsets = RenderGraph::AssignMemoryOffsets(requests, totalSize);
+    EXPECT_EQ(std::vector<VkDeviceSize>({ 0, 0, 128 }), offsets);
+    EXPECT_EQ(178, totalSize);
+}
\ No newline at end of file